@@ -17,16 +17,113 @@
 
 #include <stdint.h>
 
-/* 设置横屏或者竖屏显示 0或1为竖屏 2或3为横屏 */
+/* 屏幕方向，取值与USE_HORIZONTAL相同 */
+#define LCD_ROTATION_PORTRAIT           0   /* 竖屏 */
+#define LCD_ROTATION_PORTRAIT_FLIP      1   /* 竖屏，旋转180度 */
+#define LCD_ROTATION_LANDSCAPE          2   /* 横屏 */
+#define LCD_ROTATION_LANDSCAPE_FLIP     3   /* 横屏，旋转180度 */
+
+/* lcd_init设置的屏幕方向 0或1为竖屏 2或3为横屏，运行时可用lcd_set_rotation切换 */
+#ifndef USE_HORIZONTAL
 #define USE_HORIZONTAL      0
+#endif
 
-/* 根据LCD是横屏或者竖屏，设置LCD的宽度和高度 */
+/* USE_HORIZONTAL方向的宽度和高度，用于计算显存大小 */
 #if ((USE_HORIZONTAL==0) || (USE_HORIZONTAL==1))
-#define LCD_W 240
-#define LCD_H 320
+#define LCD_DEFAULT_W       240
+#define LCD_DEFAULT_H       320
 #else
-#define LCD_W 320
-#define LCD_H 240
+#define LCD_DEFAULT_W       320
+#define LCD_DEFAULT_H       240
+#endif
+
+/* 宽度和高度中较大的一个，用于定义与方向无关的缓冲区 */
+#define LCD_SIZE_MAX        320
+
+/* 当前方向的宽度和高度，随lcd_set_rotation改变 */
+#define LCD_W               lcd_get_width()
+#define LCD_H               lcd_get_height()
+
+/* 显存行数，按USE_HORIZONTAL方向的宽度计算显存大小
+ * 0 => 不使用显存，绘图直接写入LCD
+ * LCD_DEFAULT_H => 整帧显存
+ * 小于LCD_DEFAULT_H => 分段显存，只缓存[band_y, band_y + 行数)的行，
+ *              其余行直接写入LCD。切换方向后显存大小不变，行数按新的
+ *              宽度重新计算
+ */
+#ifndef LCD_FB_LINES
+#define LCD_FB_LINES        0
+#endif
+
+/* 是否启用异步刷新(需要LCD_FB_LINES不为0)
+ * 0 => lcd_flush在调用者的任务中发送显存
+ * 1 => 显存双缓冲，lcd_flush_async将显存交给刷新任务发送，
+ *      调用者切换到另一块显存继续绘制
+ */
+#ifndef LCD_ASYNC_FLUSH
+#define LCD_ASYNC_FLUSH     0
+#endif
+
+/* 刷新任务的优先级，默认低于一般的采集任务 */
+#ifndef LCD_FLUSH_TASK_PRIO
+#define LCD_FLUSH_TASK_PRIO 25
+#endif
+
+/* 显存脏矩形的最大数目 */
+#ifndef LCD_DIRTY_RECT_MAX
+#define LCD_DIRTY_RECT_MAX  16
+#endif
+
+/* 行缓冲区的像素数目，决定一次总线传输的最大长度 */
+#ifndef LCD_LINE_BUF_PIXELS
+#define LCD_LINE_BUF_PIXELS LCD_DEFAULT_W
+#endif
+
+/* 字模缓存的总字节数，0为不使用字模缓存 */
+#ifndef LCD_GLYPH_CACHE_SIZE
+#define LCD_GLYPH_CACHE_SIZE    16384
+#endif
+
+/* 字模缓存的数据块大小(字节，须为偶数) */
+#ifndef LCD_GLYPH_CACHE_BLOCK
+#define LCD_GLYPH_CACHE_BLOCK   256
+#endif
+
+/* 字模缓存的最大条目数 */
+#ifndef LCD_GLYPH_CACHE_ENTRIES
+#define LCD_GLYPH_CACHE_ENTRIES 64
+#endif
+
+/* 抗锯齿文字的混合查找表缓存数目，每个查找表对应一组字的颜色和背景色 */
+#ifndef LCD_AA_LUT_NUM
+#define LCD_AA_LUT_NUM      4
+#endif
+
+/* 由母版缩小的1-bpp字模缓存的条目数，每个条目占64字节。叠加模式、屏幕边缘和
+ * 字模缓存超出预算时直接使用这些点阵，0为每次显示都由母版缩小
+ */
+#ifndef LCD_FONT_MASK_CACHE_NUM
+#define LCD_FONT_MASK_CACHE_NUM 32
+#endif
+
+/* 是否由32号母版字体生成16、24号抗锯齿字模(缓存未命中时生成)，为0时这两个字号按1-bpp显示 */
+#ifndef LCD_FONT_AA_SCALED
+#define LCD_FONT_AA_SCALED  1
+#endif
+
+/* 数字控件的最大位数 */
+#ifndef LCD_NUM_MAX_LEN
+#define LCD_NUM_MAX_LEN     10
+#endif
+
+/* 多边形的最大顶点数，圆弧和扇形按此拆分为多个多边形填充 */
+#ifndef LCD_POLY_MAX_VERTICES
+#define LCD_POLY_MAX_VERTICES   32
+#endif
+
+/* 是否统计总线传输的字节数和窗口数 */
+#ifndef LCD_ENABLE_STATS
+#define LCD_ENABLE_STATS    1
 #endif
 
 /* 画笔颜色 */
@@ -58,6 +155,77 @@
 #define LCD_FONT_SIZE24     24
 #define LCD_FONT_SIZE32     32
 
+/* 总线传输统计 */
+typedef struct {
+    uint32_t bytes;         /* 发送的字节数(含命令和地址) */
+    uint32_t windows;       /* 设置地址窗口的次数 */
+    uint32_t transfers;     /* 总线传输的次数 */
+} lcd_stats_t;
+
+/* 字模缓存统计 */
+typedef struct {
+    uint32_t hits;          /* 命中次数 */
+    uint32_t misses;        /* 未命中次数 */
+    uint32_t evictions;     /* 淘汰的条目数 */
+    uint32_t used_bytes;    /* 已使用的字节数 */
+    uint32_t budget_bytes;  /* 缓存预算(字节) */
+} lcd_glyph_cache_stats_t;
+
+/* 数字控件，记录上一次显示的字符，更新时只重画变化的字符 */
+typedef struct {
+    uint16_t x;                             /* 起始位置X坐标 */
+    uint16_t y;                             /* 起始位置Y坐标 */
+    uint16_t fc;                            /* 数字的颜色 */
+    uint16_t bc;                            /* 数字的背景色 */
+    uint8_t sizey;                          /* 字号 */
+    uint8_t len;                            /* 数字位数(含小数位) */
+    uint8_t decimals;                       /* 小数位数 */
+    uint8_t valid;                          /* cells是否为屏幕上的内容 */
+    uint8_t cells[LCD_NUM_MAX_LEN + 1];     /* 上一次显示的字符 */
+} lcd_num_t;
+
+/* 图片编码格式，由tools/lcd_image_gen.py生成
+ * 游程编码(RLE)的数据包以1个字节开头：最高位为1表示后面的1个像素
+ * 重复(低7位 + 1)次；最高位为0表示后面跟着(低7位 + 1)个原样像素
+ */
+#define LCD_IMAGE_RAW       0   /* RGB565原始数据，高字节在前 */
+#define LCD_IMAGE_RLE       1   /* RGB565游程编码，像素高字节在前 */
+#define LCD_IMAGE_INDEX     2   /* 调色板索引，每像素1/2/4/8位，高位在前，每行按字节对齐 */
+#define LCD_IMAGE_INDEX_RLE 3   /* 8位调色板索引的游程编码 */
+
+/* 图片资源 */
+typedef struct {
+    uint16_t width;             /* 图片宽度 */
+    uint16_t height;            /* 图片高度 */
+    uint8_t format;             /* 编码格式，LCD_IMAGE_xxx */
+    uint8_t bpp;                /* 每像素位数 */
+    uint16_t palette_num;       /* 调色板颜色数目 */
+    const uint16_t *palette;    /* 调色板，RGB565 */
+    const uint8_t *data;        /* 图片数据 */
+    uint32_t data_len;          /* 图片数据长度 */
+} lcd_image_t;
+
+/* 位图，RGB565像素按面板字节序(高字节在前)存放，与LCD_IMAGE_RAW格式的
+ * 图片数据相同。精灵表把多个同样大小的图标按网格排列在一幅位图中，
+ * 图标从左上角开始按行优先编号
+ */
+typedef struct {
+    uint16_t width;             /* 位图宽度 */
+    uint16_t height;            /* 位图高度 */
+    uint16_t cell_w;            /* 精灵表中每个图标的宽度，不是精灵表时为0 */
+    uint16_t cell_h;            /* 精灵表中每个图标的高度 */
+    const uint8_t *data;        /* 像素数据，每行width个像素 */
+} lcd_bitmap_t;
+
+/* 多边形的顶点 */
+typedef struct {
+    int16_t x;
+    int16_t y;
+} lcd_point_t;
+
+/* lcd_blit的flags：与key颜色相同的像素透明，不写入LCD */
+#define LCD_BLIT_COLOR_KEY  0x01
+
 /***************************************************************
  * 函数名称: lcd_init
  * 说    明: Lcd初始化
@@ -76,6 +244,47 @@ unsigned int lcd_init(void);
 unsigned int lcd_deinit(void);
 
 
+/***************************************************************
+ * 函数名称: lcd_set_rotation
+ * 说    明: 运行时切换屏幕方向：修改MADCTL并更新LCD_W和LCD_H，然后
+ *           用背景色清屏。坐标变换由LCD控制器完成，所有方向的绘图
+ *           都按窗口写入。切换前先把显存刷新到LCD，并退出硬件滚动；
+ *           显存大小不变，行数按新的宽度重新计算
+ * 参    数:
+ *       @rotation：LCD_ROTATION_PORTRAIT等，与USE_HORIZONTAL的取值相同
+ *       @bc：清屏的背景色
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+unsigned int lcd_set_rotation(uint8_t rotation, uint16_t bc);
+
+
+/***************************************************************
+ * 函数名称: lcd_get_rotation
+ * 说    明: 获取当前的屏幕方向
+ * 参    数: 无
+ * 返 回 值: LCD_ROTATION_PORTRAIT等
+ ***************************************************************/
+uint8_t lcd_get_rotation(void);
+
+
+/***************************************************************
+ * 函数名称: lcd_get_width
+ * 说    明: 获取当前方向的屏幕宽度，即LCD_W
+ * 参    数: 无
+ * 返 回 值: 屏幕宽度
+ ***************************************************************/
+uint16_t lcd_get_width(void);
+
+
+/***************************************************************
+ * 函数名称: lcd_get_height
+ * 说    明: 获取当前方向的屏幕高度，即LCD_H
+ * 参    数: 无
+ * 返 回 值: 屏幕高度
+ ***************************************************************/
+uint16_t lcd_get_height(void);
+
+
 /***************************************************************
  * 函数名称: lcd_fill
  * 说    明: 指定区域填充颜色
@@ -130,6 +339,22 @@ void lcd_draw_line(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t
 void lcd_draw_rectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color);
 
 
+/***************************************************************
+ * 函数名称: lcd_fill_rect_outline
+ * 说    明: 指定位置画带边框的实心矩形
+ * 参    数:
+ *       @x1：指定矩形的起始点X坐标
+ *       @y1：指定矩形的起始点Y坐标
+ *       @x2：指定矩形的结束点X坐标
+ *       @y2：指定矩形的结束点Y坐标
+ *       @fill_color：矩形内部的颜色
+ *       @line_color：矩形边框的颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_fill_rect_outline(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2,
+                           uint16_t fill_color, uint16_t line_color);
+
+
 /***************************************************************
  * 函数名称: lcd_draw_circle
  * 说    明: 指定位置画圆
@@ -143,6 +368,91 @@ void lcd_draw_rectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint
 void lcd_draw_circle(uint16_t x0, uint16_t y0, uint8_t r, uint16_t color);
 
 
+/***************************************************************
+ * 函数名称: lcd_fill_circle
+ * 说    明: 指定位置画实心圆，轮廓与lcd_draw_circle一致
+ * 参    数:
+ *       @x0：指定圆的中心点X坐标
+ *       @y0：指定圆的中心点Y坐标
+ *       @r：指定圆的半径
+ *       @color：指定圆的颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_fill_circle(uint16_t x0, uint16_t y0, uint8_t r, uint16_t color);
+
+
+/***************************************************************
+ * 函数名称: lcd_fill_triangle
+ * 说    明: 画实心三角形，填充规则同lcd_fill_polygon
+ * 参    数:
+ *       @x0/y0、x1/y1、x2/y2：三个顶点的坐标，可以为负数
+ *       @color：填充颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_fill_triangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color);
+
+
+/***************************************************************
+ * 函数名称: lcd_fill_polygon
+ * 说    明: 画实心多边形。按奇偶规则填充中心落在多边形内的像素，
+ *           相邻多边形的公共边不会重复填充；每条扫描线上的每一段
+ *           只设置一次窗口，超出屏幕的部分被裁剪
+ * 参    数:
+ *       @points：顶点数组，首尾自动相连
+ *       @num：顶点数目，3 ~ LCD_POLY_MAX_VERTICES
+ *       @color：填充颜色
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+unsigned int lcd_fill_polygon(const lcd_point_t *points, uint8_t num, uint16_t color);
+
+
+/***************************************************************
+ * 函数名称: lcd_fill_pie
+ * 说    明: 画实心扇形。角度以度为单位，0度指向右方，顺时针增加，
+ *           从start顺时针画到end，两者相等时不画；圆弧用弦近似，
+ *           误差不超过1/4像素
+ * 参    数:
+ *       @x0/y0：圆心坐标，可以为负数
+ *       @r：半径
+ *       @start：起始角度
+ *       @end：结束角度
+ *       @color：填充颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_fill_pie(int16_t x0, int16_t y0, uint16_t r, int16_t start, int16_t end, uint16_t color);
+
+
+/***************************************************************
+ * 函数名称: lcd_fill_arc
+ * 说    明: 画有宽度的圆弧(圆环的一段)，角度规则同lcd_fill_pie，
+ *           宽度不小于半径时即为扇形
+ * 参    数:
+ *       @x0/y0：圆心坐标，可以为负数
+ *       @r：外半径
+ *       @width：圆弧宽度，内半径为r - width
+ *       @start：起始角度
+ *       @end：结束角度
+ *       @color：填充颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_fill_arc(int16_t x0, int16_t y0, uint16_t r, uint16_t width, int16_t start, int16_t end, uint16_t color);
+
+
+/***************************************************************
+ * 函数名称: lcd_fill_needle
+ * 说    明: 画仪表指针：底边中点在圆心、宽度为width、指向angle方向
+ *           的实心三角形，顶点坐标精确到1/256像素
+ * 参    数:
+ *       @x0/y0：圆心坐标，可以为负数
+ *       @len：指针长度
+ *       @width：指针底边宽度
+ *       @angle：指针方向，角度规则同lcd_fill_pie
+ *       @color：填充颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_fill_needle(int16_t x0, int16_t y0, uint16_t len, uint16_t width, int16_t angle, uint16_t color);
+
+
 /***************************************************************
  * 函数名称: lcd_show_chinese
  * 说    明: 显示汉字串
@@ -159,6 +469,40 @@ void lcd_draw_circle(uint16_t x0, uint16_t y0, uint8_t r, uint16_t color);
 void lcd_show_chinese(uint16_t x, uint16_t y, uint8_t *s, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode);
 
 
+/***************************************************************
+ * 函数名称: lcd_draw_text
+ * 说    明: 显示UTF-8字符串，ASCII字符和汉字可以混合显示，
+ *           遇到'\n'时换到下一行的起始X坐标
+ * 参    数:
+ *       @x：指定字符串的起始位置X坐标
+ *       @y：指定字符串的起始位置Y坐标
+ *       @s：指定字符串（utf-8编码）
+ *       @fc: 字的颜色
+ *       @bc: 字的背景色
+ *       @sizey: 字号，可选：12、16、24、32
+ *       @mode: 0为非叠加模式；1为叠加模式
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_draw_text(uint16_t x, uint16_t y, const uint8_t *s, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode);
+
+
+/***************************************************************
+ * 函数名称: lcd_draw_text_aa
+ * 说    明: 用4-bpp抗锯齿字库显示UTF-8字符串，字的边缘按覆盖率与背景色
+ *           混合。没有抗锯齿字库的字号和非ASCII字符按lcd_draw_text的
+ *           非叠加模式显示。遇到'\n'时换到下一行的起始X坐标
+ * 参    数:
+ *       @x：指定字符串的起始位置X坐标
+ *       @y：指定字符串的起始位置Y坐标
+ *       @s：指定字符串
+ *       @fc: 字的颜色
+ *       @bc: 字的背景色
+ *       @sizey: 字号，抗锯齿字库为16、24、32
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_draw_text_aa(uint16_t x, uint16_t y, const uint8_t *s, uint16_t fc, uint16_t bc, uint8_t sizey);
+
+
 /***************************************************************
  * 函数名称: lcd_show_char
  * 说    明: 显示一个字符
@@ -221,6 +565,57 @@ void lcd_show_int_num(uint16_t x, uint16_t y, uint16_t num, uint8_t len, uint16_
 void lcd_show_float_num1(uint16_t x, uint16_t y, float num, uint8_t len, uint16_t fc, uint16_t bc, uint8_t sizey);
 
 
+/***************************************************************
+ * 函数名称: lcd_num_init
+ * 说    明: 初始化数字控件，第一次设置数值时绘制全部字符
+ * 参    数:
+ *       @num：数字控件
+ *       @x：指定数字的起始位置X坐标
+ *       @y：指定数字的起始位置Y坐标
+ *       @len：数字位数(含小数位)，不超过LCD_NUM_MAX_LEN
+ *       @decimals：小数位数，0为整数
+ *       @fc: 数字的颜色
+ *       @bc: 数字的背景色
+ *       @sizey: 字号，可选：12、16、24、32
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_num_init(lcd_num_t *num, uint16_t x, uint16_t y, uint8_t len, uint8_t decimals,
+                  uint16_t fc, uint16_t bc, uint8_t sizey);
+
+
+/***************************************************************
+ * 函数名称: lcd_num_set_int
+ * 说    明: 设置数字控件显示的整数，只重画发生变化的字符。
+ *           有小数位时value为放大10^decimals倍后的数值
+ * 参    数:
+ *       @num：数字控件
+ *       @value：数值
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_num_set_int(lcd_num_t *num, int32_t value);
+
+
+/***************************************************************
+ * 函数名称: lcd_num_set_float
+ * 说    明: 设置数字控件显示的小数，按小数位数四舍五入
+ * 参    数:
+ *       @num：数字控件
+ *       @value：数值
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_num_set_float(lcd_num_t *num, float value);
+
+
+/***************************************************************
+ * 函数名称: lcd_num_invalidate
+ * 说    明: 标记数字控件需要完全重画，用于清屏或被其他内容覆盖之后
+ * 参    数:
+ *       @num：数字控件
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_num_invalidate(lcd_num_t *num);
+
+
 /***************************************************************
  * 函数名称: lcd_show_picture
  * 说    明: 显示图片
@@ -235,4 +630,188 @@ void lcd_show_float_num1(uint16_t x, uint16_t y, float num, uint8_t len, uint16_
 void lcd_show_picture(uint16_t x, uint16_t y, uint16_t length, uint16_t width, const uint8_t *pic);
 
 
+/***************************************************************
+ * 函数名称: lcd_show_image
+ * 说    明: 显示压缩图片，逐行解码到行缓冲区后整行发送
+ * 参    数:
+ *       @x：指定图片的起始位置X坐标
+ *       @y：指定图片的起始位置Y坐标
+ *       @image：图片资源
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+unsigned int lcd_show_image(uint16_t x, uint16_t y, const lcd_image_t *image);
+
+
+/***************************************************************
+ * 函数名称: lcd_blit
+ * 说    明: 显示位图中的一块区域，超出屏幕的部分被裁剪，完全在屏幕
+ *           外时直接返回。不透明时整块区域只设置一次窗口；透明时每行
+ *           连续的不透明像素为一段，下面各行位置相同的段合并为一个
+ *           矩形，每个矩形只设置一次窗口
+ * 参    数:
+ *       @x/y：区域左上角在屏幕上的坐标，可以为负数
+ *       @bitmap：位图
+ *       @sx/sy：区域左上角在位图中的坐标
+ *       @w/h：区域的宽度和高度
+ *       @flags：LCD_BLIT_COLOR_KEY或0
+ *       @key：透明色，flags为0时忽略
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+unsigned int lcd_blit(int16_t x, int16_t y, const lcd_bitmap_t *bitmap, uint16_t sx, uint16_t sy,
+                      uint16_t w, uint16_t h, uint8_t flags, uint16_t key);
+
+
+/***************************************************************
+ * 函数名称: lcd_blit_sprite
+ * 说    明: 显示精灵表中的一个图标，裁剪和透明方式同lcd_blit
+ * 参    数:
+ *       @x/y：图标左上角在屏幕上的坐标，可以为负数
+ *       @sheet：精灵表，cell_w和cell_h不为0
+ *       @index：图标编号
+ *       @flags：LCD_BLIT_COLOR_KEY或0
+ *       @key：透明色，flags为0时忽略
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+unsigned int lcd_blit_sprite(int16_t x, int16_t y, const lcd_bitmap_t *sheet, uint16_t index,
+                             uint8_t flags, uint16_t key);
+
+
+/***************************************************************
+ * 函数名称: lcd_flush
+ * 说    明: 将显存中的脏矩形刷新到LCD，每个脏矩形只设置一次窗口
+ *           未启用显存(LCD_FB_LINES为0)时不做任何操作
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_flush(void);
+
+
+/***************************************************************
+ * 函数名称: lcd_flush_async
+ * 说    明: 将当前显存交给刷新任务发送，然后切换到另一块显存继续
+ *           绘制。上一次提交的显存还未发送完时先等待。
+ *           未启用异步刷新(LCD_ASYNC_FLUSH为0)时等同于lcd_flush
+ * 参    数: 无
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+unsigned int lcd_flush_async(void);
+
+
+/***************************************************************
+ * 函数名称: lcd_flush_wait
+ * 说    明: 等待已提交的显存发送完成
+ * 参    数:
+ *       @timeout：最长等待的tick数，LOS_WAIT_FOREVER为一直等待
+ * 返 回 值: 返回0为发送完成，反之为超时或失败
+ ***************************************************************/
+unsigned int lcd_flush_wait(uint32_t timeout);
+
+
+/***************************************************************
+ * 函数名称: lcd_fb_set_band
+ * 说    明: 设置分段显存覆盖的起始行，会先刷新当前显存，
+ *           然后用背景色填充新的显存段并标记为脏
+ * 参    数:
+ *       @y：显存段的起始行
+ *       @bc：显存段的背景色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_fb_set_band(uint16_t y, uint16_t bc);
+
+
+/***************************************************************
+ * 函数名称: lcd_scroll_set_area
+ * 说    明: 设置硬件垂直滚动区域(VSCRDEF)，并将滚动偏移设为0。
+ *           ST7789按GRAM行滚动，横屏时滚动方向为水平方向，不支持
+ * 参    数:
+ *       @y：滚动区域的起始行
+ *       @height：滚动区域的行数
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+unsigned int lcd_scroll_set_area(uint16_t y, uint16_t height);
+
+
+/***************************************************************
+ * 函数名称: lcd_hscroll_set_area
+ * 说    明: 横屏时设置硬件水平滚动区域，并将滚动偏移设为0。横屏时
+ *           GRAM的一行对应屏幕的一列，区域内整列(从顶部到底部)一起
+ *           滚动。滚动偏移同样用lcd_scroll_set_start设置
+ * 参    数:
+ *       @x：滚动区域的起始列
+ *       @width：滚动区域的列数
+ * 返 回 值: 返回0为成功，反之为失败(竖屏时不支持)
+ ***************************************************************/
+unsigned int lcd_hscroll_set_area(uint16_t x, uint16_t width);
+
+
+/***************************************************************
+ * 函数名称: lcd_scroll_set_start
+ * 说    明: 设置滚动偏移(VSCSAD)：滚动区域中第offset行显示在区域的顶部，
+ *           之前的行接在区域底部显示。水平滚动时第offset列显示在区域
+ *           的左边
+ * 参    数:
+ *       @offset：滚动偏移，相对于滚动区域的起始行(列)
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_scroll_set_start(uint16_t offset);
+
+
+/***************************************************************
+ * 函数名称: lcd_scroll_reset
+ * 说    明: 退出滚动，恢复正常显示
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_scroll_reset(void);
+
+
+/***************************************************************
+ * 函数名称: lcd_get_stats
+ * 说    明: 获取总线传输统计
+ * 参    数:
+ *       @stats：存放统计结果
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_get_stats(lcd_stats_t *stats);
+
+
+/***************************************************************
+ * 函数名称: lcd_reset_stats
+ * 说    明: 清零总线传输统计
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_reset_stats(void);
+
+
+/***************************************************************
+ * 函数名称: lcd_glyph_cache_set_budget
+ * 说    明: 设置字模缓存可使用的字节数，不超过LCD_GLYPH_CACHE_SIZE，
+ *           超出新预算的条目按最近最少使用淘汰
+ * 参    数:
+ *       @bytes：缓存预算(字节)
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_glyph_cache_set_budget(uint32_t bytes);
+
+
+/***************************************************************
+ * 函数名称: lcd_glyph_cache_clear
+ * 说    明: 清空字模缓存
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_glyph_cache_clear(void);
+
+
+/***************************************************************
+ * 函数名称: lcd_glyph_cache_get_stats
+ * 说    明: 获取字模缓存的命中/未命中统计
+ * 参    数:
+ *       @stats：存放统计结果
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_glyph_cache_get_stats(lcd_glyph_cache_stats_t *stats);
+
+
 #endif /* _LCD_H_ */
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef _LCD_CHART_H_
+#define _LCD_CHART_H_
+
+#include <stdint.h>
+#include "lcd.h"
+
+/* 每个曲线图最多的曲线数 */
+#ifndef LCD_CHART_SERIES_MAX
+#define LCD_CHART_SERIES_MAX    4
+#endif
+
+/* 绘图区域的最大高度 */
+#ifndef LCD_CHART_MAX_HEIGHT
+#define LCD_CHART_MAX_HEIGHT    320
+#endif
+
+/* lcd_chart_init的flags：横屏时使用硬件水平滚动 */
+#define LCD_CHART_HW_SCROLL     0x01
+
+typedef struct {
+    float min;                  /* 纵轴下限 */
+    float max;                  /* 纵轴上限 */
+    float lo;                   /* 待画样本的最小值 */
+    float hi;                   /* 待画样本的最大值 */
+    float last;                 /* 最后一个待画样本 */
+    uint16_t pending;           /* 待画样本的个数 */
+    int16_t prev_y;             /* 上一列最后一个样本的Y坐标，-1为还没有样本 */
+    uint16_t color;             /* 曲线颜色 */
+} lcd_chart_series_t;
+
+typedef struct {
+    uint16_t x;
+    uint16_t y;
+    uint16_t width;
+    uint16_t height;
+    uint16_t bc;                /* 背景色 */
+    uint16_t grid;              /* 网格线颜色 */
+    uint8_t grid_step;          /* 网格线间距，0为不画网格线 */
+    uint8_t hw_scroll;          /* 是否使用硬件滚动 */
+    uint8_t series_num;         /* 已设置的曲线数 */
+    uint16_t cursor;            /* 下一列在绘图区域中的位置 */
+    uint32_t columns;           /* 已画出的列数 */
+    lcd_chart_series_t series[LCD_CHART_SERIES_MAX];
+} lcd_chart_t;
+
+/***************************************************************
+ * 函数名称: lcd_chart_init
+ * 说    明: 初始化滚动曲线图并清空绘图区域。每次lcd_chart_update只画
+ *           最新的一列：指定LCD_CHART_HW_SCROLL且为横屏时，用ST7789的
+ *           硬件滚动使最新一列显示在最右边，此时绘图区域内整列(从屏幕
+ *           顶部到底部)一起滚动，这些列中不应再画其他内容，同一时间只
+ *           能有一个曲线图使用硬件滚动；否则按列循环覆盖(扫描模式)，
+ *           最新一列的右边留一列空白
+ * 参    数:
+ *       @chart：曲线图
+ *       @x/y：绘图区域的左上角坐标
+ *       @width/height：绘图区域的宽度和高度，height不超过LCD_CHART_MAX_HEIGHT
+ *       @bc：背景色
+ *       @grid：网格线颜色
+ *       @grid_step：网格线间距，0为不画网格线
+ *       @flags：LCD_CHART_HW_SCROLL或0
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+unsigned int lcd_chart_init(lcd_chart_t *chart, uint16_t x, uint16_t y, uint16_t width, uint16_t height,
+                            uint16_t bc, uint16_t grid, uint8_t grid_step, uint8_t flags);
+
+
+/***************************************************************
+ * 函数名称: lcd_chart_deinit
+ * 说    明: 退出曲线图，使用硬件滚动时恢复正常显示并清空绘图区域
+ * 参    数:
+ *       @chart：曲线图
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_chart_deinit(lcd_chart_t *chart);
+
+
+/***************************************************************
+ * 函数名称: lcd_chart_set_series
+ * 说    明: 设置曲线的纵轴范围和颜色，超出范围的样本画在边界上
+ * 参    数:
+ *       @chart：曲线图
+ *       @series：曲线编号，0~LCD_CHART_SERIES_MAX-1
+ *       @min：纵轴下限
+ *       @max：纵轴上限
+ *       @color：曲线颜色
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+unsigned int lcd_chart_set_series(lcd_chart_t *chart, uint8_t series, float min, float max, uint16_t color);
+
+
+/***************************************************************
+ * 函数名称: lcd_chart_push
+ * 说    明: 添加一个样本，只记录到下一列中，不画图。一列中有多个样本
+ *           时画出它们的最小值到最大值，不会丢失尖峰。NaN样本(例如
+ *           传感器读取失败)被忽略
+ * 参    数:
+ *       @chart：曲线图
+ *       @series：曲线编号
+ *       @value：样本值
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_chart_push(lcd_chart_t *chart, uint8_t series, float value);
+
+
+/***************************************************************
+ * 函数名称: lcd_chart_update
+ * 说    明: 把上次更新以来添加的样本画为新的一列，没有新样本时不画。
+ *           按显示的帧率调用，样本比帧率快时自动抽取为每帧一列
+ * 参    数:
+ *       @chart：曲线图
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_chart_update(lcd_chart_t *chart);
+
+
+/***************************************************************
+ * 函数名称: lcd_chart_restart
+ * 说    明: 清空绘图区域，从最左边一列重新开始画曲线，已添加但还没有
+ *           画出的样本保留到下一次lcd_chart_update，用于绘图区域被
+ *           其他内容覆盖之后
+ * 参    数:
+ *       @chart：曲线图
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_chart_restart(lcd_chart_t *chart);
+
+
+/***************************************************************
+ * 函数名称: lcd_chart_clear
+ * 说    明: 清空绘图区域和待画样本
+ * 参    数:
+ *       @chart：曲线图
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_chart_clear(lcd_chart_t *chart);
+
+#endif /* _LCD_CHART_H_ */
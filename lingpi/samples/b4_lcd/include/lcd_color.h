@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef _LCD_COLOR_H_
+#define _LCD_COLOR_H_
+
+#include <stdint.h>
+
+/* 源像素格式 */
+#define LCD_COLOR_RGB888        0   /* 每像素3字节，依次为R、G、B */
+#define LCD_COLOR_ARGB8888      1   /* 每像素为小端的uint32_t 0xAARRGGBB，即依次为B、G、R、A，Alpha忽略 */
+#define LCD_COLOR_GRAY8         2   /* 每像素1字节灰度 */
+
+/***************************************************************
+ * 函数名称: lcd_color_convert
+ * 说    明: 将一行像素转换为RGB565，按面板字节序(高字节在前)存放，
+ *           可直接交给lcd_show_picture等接口发送。每次处理4个像素，
+ *           整字读写，在寄存器中同时拼出两个RGB565像素
+ * 参    数:
+ *       @dst：RGB565像素，count * 2个字节
+ *       @src：源像素
+ *       @count：像素数目
+ *       @format：源像素格式，LCD_COLOR_xxx
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+unsigned int lcd_color_convert(uint8_t *dst, const uint8_t *src, uint32_t count, uint8_t format);
+
+
+/***************************************************************
+ * 函数名称: lcd_color_convert_dither
+ * 说    明: 同lcd_color_convert，截断前按4x4有序抖动(Bayer矩阵)加上
+ *           阈值，渐变图片不出现色带。阈值只与像素在屏幕上的坐标有关，
+ *           同一幅图片分块转换的结果与整幅转换相同
+ * 参    数:
+ *       @dst：RGB565像素，count * 2个字节
+ *       @src：源像素
+ *       @count：像素数目
+ *       @format：源像素格式，LCD_COLOR_xxx
+ *       @x：第一个像素在屏幕上的X坐标
+ *       @y：这一行在屏幕上的Y坐标
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+unsigned int lcd_color_convert_dither(uint8_t *dst, const uint8_t *src, uint32_t count, uint8_t format,
+                                      uint16_t x, uint16_t y);
+
+#endif /* _LCD_COLOR_H_ */
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef _LCD_CONSOLE_H_
+#define _LCD_CONSOLE_H_
+
+#include <stdint.h>
+#include "lcd.h"
+
+/* 控制台每行最多保存的字符数 */
+#ifndef LCD_CONSOLE_COLS
+#define LCD_CONSOLE_COLS        40
+#endif
+
+/* 控制台最多显示的行数 */
+#ifndef LCD_CONSOLE_ROWS
+#define LCD_CONSOLE_ROWS        26
+#endif
+
+/* 颜色属性的数目 */
+#ifndef LCD_CONSOLE_ATTRS
+#define LCD_CONSOLE_ATTRS       8
+#endif
+
+/* lcd_console_printf单次输出的最大字符数 */
+#ifndef LCD_CONSOLE_PRINTF_SIZE
+#define LCD_CONSOLE_PRINTF_SIZE 128
+#endif
+
+/* 文本中切换颜色属性的转义字符，后跟一位数字'0'~'7'，
+ * 例如 LCD_CONSOLE_ATTR("1") "ERROR" LCD_CONSOLE_ATTR("0")
+ */
+#define LCD_CONSOLE_ESC         '\033'
+#define LCD_CONSOLE_ATTR(n)     "\033" n
+
+/***************************************************************
+ * 函数名称: lcd_console_init
+ * 说    明: 初始化控制台，清空[y, y + height)区域。竖屏时使用ST7789的
+ *           硬件垂直滚动，新增一行只画新行并移动滚动起始地址；横屏时
+ *           滚动一行需要重画所有行。控制台区域内不应再画其他内容
+ * 参    数:
+ *       @y：控制台区域的起始行
+ *       @height：控制台区域的行数，按字号取整
+ *       @sizey：字号，可选：12、16、24、32
+ *       @fc：颜色属性0的字的颜色
+ *       @bc：颜色属性0的背景色，也用于清空新行
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+unsigned int lcd_console_init(uint16_t y, uint16_t height, uint8_t sizey, uint16_t fc, uint16_t bc);
+
+
+/***************************************************************
+ * 函数名称: lcd_console_deinit
+ * 说    明: 退出控制台，恢复正常显示(不滚动)，控制台的内容保留在屏幕上
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_console_deinit(void);
+
+
+/***************************************************************
+ * 函数名称: lcd_console_set_attr
+ * 说    明: 设置颜色属性，文本中用LCD_CONSOLE_ATTR("n")切换
+ * 参    数:
+ *       @attr：属性编号，0~LCD_CONSOLE_ATTRS-1
+ *       @fc：字的颜色
+ *       @bc：字的背景色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_console_set_attr(uint8_t attr, uint16_t fc, uint16_t bc);
+
+
+/***************************************************************
+ * 函数名称: lcd_console_puts
+ * 说    明: 在控制台追加文本，'\n'换行，超过一行的宽度时自动换行。
+ *           只支持ASCII字符
+ * 参    数:
+ *       @s：文本
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_console_puts(const char *s);
+
+
+/***************************************************************
+ * 函数名称: lcd_console_printf
+ * 说    明: 格式化后追加到控制台，单次输出最多LCD_CONSOLE_PRINTF_SIZE个字符
+ * 参    数:
+ *       @fmt：格式字符串
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_console_printf(const char *fmt, ...);
+
+
+/***************************************************************
+ * 函数名称: lcd_console_clear
+ * 说    明: 清空控制台
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_console_clear(void);
+
+#endif /* _LCD_CONSOLE_H_ */
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef _LCD_QOI_H_
+#define _LCD_QOI_H_
+
+#include <stdint.h>
+#include "lcd.h"
+
+/* lcd_show_qoi每次读取的字节数 */
+#ifndef LCD_QOI_CHUNK
+#define LCD_QOI_CHUNK           512
+#endif
+
+/* QOI文件头的字节数 */
+#define LCD_QOI_HEADER_SIZE     14
+
+/* lcd_qoi_begin的flags：转换为RGB565时按屏幕坐标做有序抖动 */
+#define LCD_QOI_DITHER          0x01
+
+/* 解码状态 */
+#define LCD_QOI_STATE_HEADER    0   /* 正在读取文件头 */
+#define LCD_QOI_STATE_PIXELS    1   /* 正在解码像素 */
+#define LCD_QOI_STATE_DONE      2   /* 所有像素已显示，之后的数据(结束标记)被忽略 */
+#define LCD_QOI_STATE_ERROR     3   /* 数据错误，之后的数据被忽略 */
+
+/* 流式QOI解码器。数据可以按任意长度分段送入，跨段的文件头和数据块
+ * 暂存在解码器中；像素解码到一行的缓冲区，每解码完一行就用一个地址
+ * 窗口发送到LCD，不需要整幅图片的内存
+ */
+typedef struct {
+    int16_t x;                      /* 图片左上角在屏幕上的位置 */
+    int16_t y;
+    uint8_t flags;                  /* LCD_QOI_xxx */
+    uint8_t state;                  /* LCD_QOI_STATE_xxx */
+    uint32_t width;                 /* 图片宽度，文件头读完后有效 */
+    uint32_t height;                /* 图片高度，文件头读完后有效 */
+    uint32_t col;                   /* 当前行中下一个像素的位置 */
+    uint32_t row;                   /* 当前行 */
+    uint16_t vis_first;             /* 当前行中在屏幕内的第一个像素 */
+    uint16_t vis_num;               /* 每行在屏幕内的像素数，0为整幅图片都在屏幕外 */
+    uint8_t op_len;                 /* op中已暂存的字节数 */
+    uint8_t op[LCD_QOI_HEADER_SIZE];/* 跨段的文件头或数据块 */
+    uint8_t px[4];                  /* 上一个像素，依次为R、G、B、A */
+    uint8_t index[64][4];           /* 最近出现过的像素 */
+    uint8_t line[LCD_SIZE_MAX * 3]; /* 当前行在屏幕内的像素，RGB888 */
+} lcd_qoi_t;
+
+/* lcd_show_qoi读取数据的回调函数，返回读到的字节数，0为数据结束，负数为错误。
+ * 与read()、recv()的返回值相同，可以直接包装文件或套接字
+ */
+typedef int (*lcd_qoi_read_t)(void *ctx, uint8_t *buf, uint32_t len);
+
+/***************************************************************
+ * 函数名称: lcd_qoi_begin
+ * 说    明: 初始化QOI解码器，图片可以部分超出屏幕，超出的部分被裁剪
+ * 参    数:
+ *       @qoi：解码器
+ *       @x：图片左上角的X坐标
+ *       @y：图片左上角的Y坐标
+ *       @flags：LCD_QOI_DITHER或0
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_qoi_begin(lcd_qoi_t *qoi, int16_t x, int16_t y, uint8_t flags);
+
+
+/***************************************************************
+ * 函数名称: lcd_qoi_feed
+ * 说    明: 送入一段QOI数据，解码出的每一整行立即显示
+ * 参    数:
+ *       @qoi：解码器
+ *       @data：数据
+ *       @len：数据长度，可以为任意值
+ * 返 回 值: 返回0为成功，数据错误返回非0，之后的数据不再解码
+ ***************************************************************/
+unsigned int lcd_qoi_feed(lcd_qoi_t *qoi, const uint8_t *data, uint32_t len);
+
+
+/***************************************************************
+ * 函数名称: lcd_qoi_done
+ * 说    明: 判断图片的所有像素是否已经显示
+ * 参    数:
+ *       @qoi：解码器
+ * 返 回 值: 全部显示返回1，否则返回0
+ ***************************************************************/
+uint8_t lcd_qoi_done(const lcd_qoi_t *qoi);
+
+
+/***************************************************************
+ * 函数名称: lcd_show_qoi
+ * 说    明: 通过回调函数分段读取QOI图片并显示，每次读取LCD_QOI_CHUNK
+ *           个字节，读到所有像素后返回，不再读取文件的结束标记
+ * 参    数:
+ *       @x：图片左上角的X坐标
+ *       @y：图片左上角的Y坐标
+ *       @read：读取数据的回调函数
+ *       @ctx：传给回调函数的参数，例如文件描述符或套接字的地址
+ *       @flags：LCD_QOI_DITHER或0
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+unsigned int lcd_show_qoi(int16_t x, int16_t y, lcd_qoi_read_t read, void *ctx, uint8_t flags);
+
+#endif /* _LCD_QOI_H_ */
@@ -0,0 +1,325 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef _LCD_UI_H_
+#define _LCD_UI_H_
+
+#include <stdint.h>
+#include "lcd.h"
+#include "lcd_chart.h"
+
+/* 一次绘制之间最多记录的失效矩形数，超出时合并浪费像素最少的两个 */
+#ifndef LCD_UI_DIRTY_MAX
+#define LCD_UI_DIRTY_MAX        8
+#endif
+
+/* 文字控件最多的字符数 */
+#ifndef LCD_UI_TEXT_MAX
+#define LCD_UI_TEXT_MAX         32
+#endif
+
+/* 控件类型 */
+#define LCD_UI_PANEL            0   /* 纯色背景，用作其他控件的容器 */
+#define LCD_UI_LABEL            1   /* 单行ASCII文字 */
+#define LCD_UI_NUMBER           2   /* 固定位数的数字 */
+#define LCD_UI_BAR              3   /* 水平进度条 */
+#define LCD_UI_ICON             4   /* 位图或精灵表中的图标 */
+#define LCD_UI_IMAGE            5   /* 压缩图片(lcd_image_t) */
+#define LCD_UI_CHART            6   /* 滚动曲线图 */
+
+/* lcd_ui_label_init的flags：用抗锯齿字体显示 */
+#define LCD_UI_TEXT_AA          0x01
+
+/* 控件的公共部分，各控件结构体的第一个成员。坐标为屏幕坐标，
+ * 子控件应在父控件的范围内；同一父控件下，后添加的控件画在上面
+ */
+typedef struct lcd_ui_widget {
+    struct lcd_ui_widget *parent;
+    struct lcd_ui_widget *child;    /* 第一个子控件 */
+    struct lcd_ui_widget *next;     /* 下一个兄弟控件 */
+    uint16_t x;
+    uint16_t y;
+    uint16_t w;
+    uint16_t h;
+    uint8_t type;                   /* 控件类型，LCD_UI_xxx */
+    uint8_t visible;                /* 是否显示，隐藏的容器连同子控件一起隐藏 */
+} lcd_ui_widget_t;
+
+typedef struct {
+    lcd_ui_widget_t base;
+    uint16_t bc;                    /* 背景色 */
+} lcd_ui_panel_t;
+
+typedef struct {
+    lcd_ui_widget_t base;
+    uint16_t fc;                    /* 字的颜色 */
+    uint16_t bc;                    /* 背景色 */
+    uint8_t sizey;                  /* 字号 */
+    uint8_t flags;                  /* LCD_UI_TEXT_AA或0 */
+    uint8_t cols;                   /* 字符数，控件宽度为cols * sizey / 2 */
+    uint8_t len;                    /* 当前文字的长度 */
+    char text[LCD_UI_TEXT_MAX + 1]; /* 当前文字，超出len的字符显示为空格 */
+} lcd_ui_label_t;
+
+typedef struct {
+    lcd_ui_label_t label;           /* 显示字符，第一次设置数值前为空白 */
+    uint8_t digits;                 /* 数字位数(含小数位) */
+    uint8_t decimals;               /* 小数位数 */
+} lcd_ui_number_t;
+
+typedef struct {
+    lcd_ui_widget_t base;
+    uint16_t fc;                    /* 已完成部分的颜色 */
+    uint16_t bc;                    /* 未完成部分的颜色 */
+    float min;
+    float max;
+    uint16_t fill;                  /* 已完成部分的宽度 */
+} lcd_ui_bar_t;
+
+typedef struct {
+    lcd_ui_widget_t base;
+    const lcd_bitmap_t *bitmap;     /* 位图或精灵表 */
+    uint16_t index;                 /* 精灵表中的图标编号 */
+    uint8_t flags;                  /* LCD_BLIT_COLOR_KEY或0 */
+    uint16_t key;                   /* 透明色 */
+} lcd_ui_icon_t;
+
+typedef struct {
+    lcd_ui_widget_t base;
+    const lcd_image_t *image;
+} lcd_ui_image_t;
+
+typedef struct {
+    lcd_ui_widget_t base;
+    lcd_chart_t chart;              /* 用lcd_chart_set_series/lcd_chart_push设置曲线和添加样本 */
+} lcd_ui_chart_t;
+
+/***************************************************************
+ * 函数名称: lcd_ui_panel_init
+ * 说    明: 初始化容器并加入父控件，父控件为NULL时作为根控件
+ * 参    数:
+ *       @panel：容器
+ *       @parent：父控件
+ *       @x/y/w/h：范围
+ *       @bc：背景色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_ui_panel_init(lcd_ui_panel_t *panel, lcd_ui_panel_t *parent, uint16_t x, uint16_t y,
+                       uint16_t w, uint16_t h, uint16_t bc);
+
+
+/***************************************************************
+ * 函数名称: lcd_ui_label_init
+ * 说    明: 初始化文字控件并加入父控件
+ * 参    数:
+ *       @label：文字控件
+ *       @parent：父控件
+ *       @x/y：左上角坐标
+ *       @cols：字符数，不超过LCD_UI_TEXT_MAX
+ *       @sizey：字号，可选：12、16、24、32
+ *       @fc：字的颜色
+ *       @bc：背景色
+ *       @flags：LCD_UI_TEXT_AA或0
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+unsigned int lcd_ui_label_init(lcd_ui_label_t *label, lcd_ui_panel_t *parent, uint16_t x, uint16_t y,
+                               uint8_t cols, uint8_t sizey, uint16_t fc, uint16_t bc, uint8_t flags);
+
+
+/***************************************************************
+ * 函数名称: lcd_ui_label_set_text
+ * 说    明: 设置文字，只把与原来不同的字符标记为失效
+ * 参    数:
+ *       @label：文字控件
+ *       @text：ASCII文字，超出cols的部分被截断
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_ui_label_set_text(lcd_ui_label_t *label, const char *text);
+
+
+/***************************************************************
+ * 函数名称: lcd_ui_label_set_color
+ * 说    明: 设置文字颜色，颜色改变时整个控件失效
+ * 参    数:
+ *       @label：文字控件
+ *       @fc：字的颜色
+ *       @bc：背景色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_ui_label_set_color(lcd_ui_label_t *label, uint16_t fc, uint16_t bc);
+
+
+/***************************************************************
+ * 函数名称: lcd_ui_number_init
+ * 说    明: 初始化数字控件并加入父控件
+ * 参    数:
+ *       @number：数字控件
+ *       @parent：父控件
+ *       @x/y：左上角坐标
+ *       @len：数字位数(含小数位)，不超过LCD_NUM_MAX_LEN
+ *       @decimals：小数位数，0为整数
+ *       @sizey：字号，可选：12、16、24、32
+ *       @fc：数字的颜色
+ *       @bc：背景色
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+unsigned int lcd_ui_number_init(lcd_ui_number_t *number, lcd_ui_panel_t *parent, uint16_t x, uint16_t y,
+                                uint8_t len, uint8_t decimals, uint8_t sizey, uint16_t fc, uint16_t bc);
+
+
+/***************************************************************
+ * 函数名称: lcd_ui_number_set_int
+ * 说    明: 设置整数，只把变化的数字标记为失效。有小数位时value为
+ *           放大10^decimals倍后的数值
+ * 参    数:
+ *       @number：数字控件
+ *       @value：数值
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_ui_number_set_int(lcd_ui_number_t *number, int32_t value);
+
+
+/***************************************************************
+ * 函数名称: lcd_ui_number_set_float
+ * 说    明: 设置小数，按小数位数四舍五入
+ * 参    数:
+ *       @number：数字控件
+ *       @value：数值
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_ui_number_set_float(lcd_ui_number_t *number, float value);
+
+
+/***************************************************************
+ * 函数名称: lcd_ui_bar_init
+ * 说    明: 初始化进度条并加入父控件，初始值为min
+ * 参    数:
+ *       @bar：进度条
+ *       @parent：父控件
+ *       @x/y/w/h：范围
+ *       @min/max：数值范围
+ *       @fc：已完成部分的颜色
+ *       @bc：未完成部分的颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_ui_bar_init(lcd_ui_bar_t *bar, lcd_ui_panel_t *parent, uint16_t x, uint16_t y, uint16_t w,
+                     uint16_t h, float min, float max, uint16_t fc, uint16_t bc);
+
+
+/***************************************************************
+ * 函数名称: lcd_ui_bar_set_value
+ * 说    明: 设置数值，只把已完成部分变化的几列标记为失效
+ * 参    数:
+ *       @bar：进度条
+ *       @value：数值，超出范围时按边界显示
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_ui_bar_set_value(lcd_ui_bar_t *bar, float value);
+
+
+/***************************************************************
+ * 函数名称: lcd_ui_icon_init
+ * 说    明: 初始化图标并加入父控件。位图为精灵表时显示第index个图标，
+ *           否则显示整幅位图
+ * 参    数:
+ *       @icon：图标
+ *       @parent：父控件
+ *       @x/y：左上角坐标
+ *       @bitmap：位图或精灵表
+ *       @index：精灵表中的图标编号
+ *       @flags：LCD_BLIT_COLOR_KEY或0，透明时透出父控件的背景
+ *       @key：透明色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_ui_icon_init(lcd_ui_icon_t *icon, lcd_ui_panel_t *parent, uint16_t x, uint16_t y,
+                      const lcd_bitmap_t *bitmap, uint16_t index, uint8_t flags, uint16_t key);
+
+
+/***************************************************************
+ * 函数名称: lcd_ui_icon_set_index
+ * 说    明: 切换精灵表中的图标，编号改变时整个图标失效
+ * 参    数:
+ *       @icon：图标
+ *       @index：图标编号
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_ui_icon_set_index(lcd_ui_icon_t *icon, uint16_t index);
+
+
+/***************************************************************
+ * 函数名称: lcd_ui_image_init
+ * 说    明: 初始化压缩图片并加入父控件，图片失效时整幅重画
+ * 参    数:
+ *       @image：图片控件
+ *       @parent：父控件
+ *       @x/y：左上角坐标
+ *       @res：图片资源
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_ui_image_init(lcd_ui_image_t *image, lcd_ui_panel_t *parent, uint16_t x, uint16_t y,
+                       const lcd_image_t *res);
+
+
+/***************************************************************
+ * 函数名称: lcd_ui_chart_init
+ * 说    明: 初始化曲线图并加入父控件。曲线图按扫描方式(不使用硬件
+ *           滚动)自行逐列绘制，lcd_ui_render调用lcd_chart_update画出
+ *           新样本；曲线图失效时清空重画。曲线图上不应放置其他控件
+ * 参    数:
+ *       @chart：曲线图控件
+ *       @parent：父控件
+ *       @x/y/w/h：绘图区域
+ *       @bc：背景色
+ *       @grid：网格线颜色
+ *       @grid_step：网格线间距，0为不画网格线
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+unsigned int lcd_ui_chart_init(lcd_ui_chart_t *chart, lcd_ui_panel_t *parent, uint16_t x, uint16_t y,
+                               uint16_t w, uint16_t h, uint16_t bc, uint16_t grid, uint8_t grid_step);
+
+
+/***************************************************************
+ * 函数名称: lcd_ui_set_visible
+ * 说    明: 显示或隐藏控件，状态改变时控件所在的区域失效
+ * 参    数:
+ *       @widget：控件
+ *       @visible：1为显示，0为隐藏
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_ui_set_visible(lcd_ui_widget_t *widget, uint8_t visible);
+
+
+/***************************************************************
+ * 函数名称: lcd_ui_invalidate
+ * 说    明: 标记控件所在的区域失效，下次lcd_ui_render时重画，用于
+ *           屏幕被控件树以外的内容覆盖之后
+ * 参    数:
+ *       @widget：控件
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_ui_invalidate(lcd_ui_widget_t *widget);
+
+
+/***************************************************************
+ * 函数名称: lcd_ui_render
+ * 说    明: 重画所有失效区域并刷新到LCD。相交或相邻的失效区域先合并，
+ *           每个区域内按控件树的顺序只重画与它相交的部分，没有失效
+ *           区域时只画曲线图的新样本
+ * 参    数:
+ *       @root：根控件
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_ui_render(lcd_ui_panel_t *root);
+
+#endif /* _LCD_UI_H_ */
@@ -15,7 +15,16 @@
 #ifndef _PICTURE_H_
 #define _PICTURE_H_
 
+#include "lcd.h"
+
+/*
+ * logo的RGB565原始数据(1474种颜色)，是gImage_lingzhi_rle的生成源。
+ * src/picture.c不再编入例程，只由tools/lcd_sim使用
+ */
 #define IMAGE_MAXSIZE_LINGZHI           26040
 extern const unsigned char gImage_lingzhi[IMAGE_MAXSIZE_LINGZHI];
 
+/* gImage_lingzhi量化为256色(有损)后的压缩版本，256色调色板 + 游程编码 */
+extern const lcd_image_t gImage_lingzhi_rle;
+
 #endif
\ No newline at end of file
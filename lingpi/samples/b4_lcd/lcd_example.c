@@ -16,6 +16,7 @@
 #include "ohos_init.h"
 #include "picture.h"
 #include "lcd.h"
+#include "lcd_ui.h"
 
 /* 任务的堆栈大小 */
 #define TASK_STACK_SIZE     20480
@@ -25,73 +26,112 @@
 /* 循环等待时间 */
 #define WAIT_MSEC           1000
 
-/* 图片数据 */
-extern const unsigned char gImage_lingzhi[IMAGE_MAXSIZE_LINGZHI];
-
-/* LCD的位置 */
-#define LCD_FILL_X              0
-#define LCD_FILL_Y              0
-/* 图片的位置，长度和宽度 */
+/* 控件树覆盖的区域，下面留给中文 */
+#define LCD_UI_X                0
+#define LCD_UI_Y                0
+#define LCD_UI_HEIGHT           220
+/* 图片的位置 */
 #define LCD_PICTURE_X           15
 #define LCD_PICTURE_Y           0
-#define LCD_PICTURE_LENGTH      210
-#define LCD_PICTURE_WIDTH       62
-/* 字符串1的位置，长度和宽度 */
+/* 字符串1的位置，字符数和字号 */
 #define LCD_STRING1_X           0
-#define LCD_STRING1_Y           130
+#define LCD_STRING1_Y           100
+#define LCD_STRING1_COLS        23
 #define LCD_STRING1_SIZE        16
 #define LCD_STRING1_TEXT        "Welcome to XiaoLingPai!"
-#define LCD_STRING1_MODE        0
-/* 字符串2的位置，长度和宽度 */
+/* 字符串2的位置，字符数和字号 */
 #define LCD_STRING2_X           0
 #define LCD_STRING2_Y           130
+#define LCD_STRING2_COLS        26
 #define LCD_STRING2_SIZE        16
 #define LCD_STRING2_TEXT        "URL: http://www.fzlzda.com"
-#define LCD_STRING2_MODE        0
-/* 字符串3的位置，长度和宽度 */
+/* 字符串3的位置，字符数和字号 */
 #define LCD_STRING3_X           0
 #define LCD_STRING3_Y           160
+#define LCD_STRING3_COLS        6
 #define LCD_STRING3_SIZE        16
 #define LCD_STRING3_TEXT        "LCD_W:"
-#define LCD_STRING3_MODE        0
-/* 数字1int的位置，长度和宽度 */
-#define LCD_INT1_X              128
+/* 数字1int的位置，位数和字号 */
+#define LCD_INT1_X              48
 #define LCD_INT1_Y              160
+#define LCD_INT1_LEN            3
 #define LCD_INT1_SIZE           16
-#define LCD_INT1_VALUE          3
-/* 字符串4的位置，长度和宽度 */
-#define LCD_STRING4_X           80
+/* 字符串4的位置，字符数和字号 */
+#define LCD_STRING4_X           104
 #define LCD_STRING4_Y           160
+#define LCD_STRING4_COLS        6
 #define LCD_STRING4_SIZE        16
 #define LCD_STRING4_TEXT        "LCD_H:"
-#define LCD_STRING4_MODE        0
-/* 数字2int的位置，长度和宽度 */
-#define LCD_INT2_X              128
+/* 数字2int的位置，位数和字号 */
+#define LCD_INT2_X              152
 #define LCD_INT2_Y              160
+#define LCD_INT2_LEN            3
 #define LCD_INT2_SIZE           16
-#define LCD_INT2_VALUE          3
-/* 字符串5的位置，长度和宽度 */
-#define LCD_STRING5_X           80
-#define LCD_STRING5_Y           160
-#define LCD_STRING5_SIZE        16
-#define LCD_STRING5_TEXT        "LCD_H:"
-#define LCD_STRING5_MODE        0
-/* 字符串6的位置，长度和宽度 */
+/* 字符串6的位置，字符数和字号 */
 #define LCD_STRING6_X           0
 #define LCD_STRING6_Y           190
+#define LCD_STRING6_COLS        16
 #define LCD_STRING6_SIZE        16
 #define LCD_STRING6_TEXT        "Increaseing Num:"
-#define LCD_STRING6_MODE        0
-/* 数字float的位置，长度和宽度 */
+/* 数字float的位置，位数和字号 */
 #define LCD_FLOAT1_X            128
 #define LCD_FLOAT1_Y            190
+#define LCD_FLOAT1_LEN          4
+#define LCD_FLOAT1_DECIMALS     2
 #define LCD_FLOAT1_SIZE         16
-#define LCD_FLOAT1_NUM          4
 #define LCD_FLOAT1_INCREASE     (0.11)
 /* 中文数字的位置，长度和宽度 */
 #define LCD_CHINESE_X           0
 #define LCD_CHINESE_Y           220
 #define LCD_CHINESE_MODE        0
+
+/* 控件树：只在初始化时设置一次的文字和图片，以及每次循环更新的数字 */
+static lcd_ui_panel_t m_ui_root;
+static lcd_ui_image_t m_ui_picture;
+static lcd_ui_label_t m_ui_labels[5];
+static lcd_ui_number_t m_ui_width;
+static lcd_ui_number_t m_ui_height;
+static lcd_ui_number_t m_ui_float;
+
+/***************************************************************
+* 函数名称: lcd_ui_create
+* 说    明: 创建例程的控件树，第一次lcd_ui_render时画出全部控件
+* 参    数: 无
+* 返 回 值: 无
+***************************************************************/
+static void lcd_ui_create(void)
+{
+    lcd_ui_panel_init(&m_ui_root, NULL, LCD_UI_X, LCD_UI_Y, LCD_W, LCD_UI_HEIGHT, LCD_WHITE);
+    /* 图片使用压缩版本，Flash占用约为原始数据的1/3 */
+    lcd_ui_image_init(&m_ui_picture, &m_ui_root, LCD_PICTURE_X, LCD_PICTURE_Y, &gImage_lingzhi_rle);
+
+    lcd_ui_label_init(&m_ui_labels[0], &m_ui_root, LCD_STRING1_X, LCD_STRING1_Y, LCD_STRING1_COLS,
+                      LCD_STRING1_SIZE, LCD_RED, LCD_WHITE, 0);
+    lcd_ui_label_set_text(&m_ui_labels[0], LCD_STRING1_TEXT);
+    lcd_ui_label_init(&m_ui_labels[1], &m_ui_root, LCD_STRING2_X, LCD_STRING2_Y, LCD_STRING2_COLS,
+                      LCD_STRING2_SIZE, LCD_RED, LCD_WHITE, 0);
+    lcd_ui_label_set_text(&m_ui_labels[1], LCD_STRING2_TEXT);
+    lcd_ui_label_init(&m_ui_labels[2], &m_ui_root, LCD_STRING3_X, LCD_STRING3_Y, LCD_STRING3_COLS,
+                      LCD_STRING3_SIZE, LCD_BLUE, LCD_WHITE, 0);
+    lcd_ui_label_set_text(&m_ui_labels[2], LCD_STRING3_TEXT);
+    lcd_ui_label_init(&m_ui_labels[3], &m_ui_root, LCD_STRING4_X, LCD_STRING4_Y, LCD_STRING4_COLS,
+                      LCD_STRING4_SIZE, LCD_BLUE, LCD_WHITE, 0);
+    lcd_ui_label_set_text(&m_ui_labels[3], LCD_STRING4_TEXT);
+    lcd_ui_label_init(&m_ui_labels[4], &m_ui_root, LCD_STRING6_X, LCD_STRING6_Y, LCD_STRING6_COLS,
+                      LCD_STRING6_SIZE, LCD_BLACK, LCD_WHITE, 0);
+    lcd_ui_label_set_text(&m_ui_labels[4], LCD_STRING6_TEXT);
+
+    lcd_ui_number_init(&m_ui_width, &m_ui_root, LCD_INT1_X, LCD_INT1_Y, LCD_INT1_LEN, 0,
+                       LCD_INT1_SIZE, LCD_BLUE, LCD_WHITE);
+    lcd_ui_number_set_int(&m_ui_width, LCD_W);
+    lcd_ui_number_init(&m_ui_height, &m_ui_root, LCD_INT2_X, LCD_INT2_Y, LCD_INT2_LEN, 0,
+                       LCD_INT2_SIZE, LCD_BLUE, LCD_WHITE);
+    lcd_ui_number_set_int(&m_ui_height, LCD_H);
+    lcd_ui_number_init(&m_ui_float, &m_ui_root, LCD_FLOAT1_X, LCD_FLOAT1_Y, LCD_FLOAT1_LEN,
+                       LCD_FLOAT1_DECIMALS, LCD_FLOAT1_SIZE, LCD_BLACK, LCD_WHITE);
+}
+
+
 /***************************************************************
 * 函数名称: lcd_process
 * 说    明: lcd例程
@@ -103,7 +143,7 @@ void lcd_process(void)
     uint32_t ret = 0;
     float t = 0;
     uint8_t chinese_string[] = "小凌派";
-    uint8_t cur_sizey = SIZEY_12;
+    uint8_t cur_sizey = LCD_FONT_SIZE12;
     
     ret = lcd_init();
     if (ret != 0) {
@@ -111,31 +151,16 @@ void lcd_process(void)
         return;
     }
     
-    lcd_fill(LCD_FILL_X, LCD_FILL_Y, LCD_W, LCD_H, LCD_WHITE);
+    lcd_fill(0, 0, LCD_W, LCD_H, LCD_WHITE);
+    lcd_flush();
+    lcd_ui_create();
     
     while (1) {
         printf("************Lcd Example***********\n");
-        lcd_show_picture(LCD_PICTURE_X, LCD_PICTURE_Y, LCD_PICTURE_LENGTH,
-                         LCD_PICTURE_WIDTH, &gImage_lingzhi[0]);
-        lcd_show_string(LCD_STRING1_X, LCD_STRING1_Y, LCD_STRING1_TEXT,
-                        LCD_RED, LCD_WHITE, LCD_STRING1_SIZE, LCD_STRING1_MODE);
-        lcd_show_string(LCD_STRING2_X, LCD_STRING2_Y, LCD_STRING2_TEXT,
-                        LCD_RED, LCD_WHITE, LCD_STRING2_SIZE, LCD_STRING2_MODE);
-        lcd_show_string(LCD_STRING3_X, LCD_STRING3_Y, LCD_STRING3_TEXT,
-                        LCD_BLUE, LCD_WHITE, LCD_STRING3_SIZE, LCD_STRING3_MODE);
-        lcd_show_int_num(LCD_INT1_X, LCD_INT1_Y, LCD_W, LCD_INT1_VALUE,
-                         LCD_BLUE, LCD_WHITE, LCD_INT1_SIZE);
-        lcd_show_string(LCD_STRING4_X, LCD_STRING4_Y, LCD_STRING4_TEXT,
-                        LCD_BLUE, LCD_WHITE, LCD_STRING4_SIZE, LCD_STRING4_MODE);
-        lcd_show_int_num(LCD_INT2_X, LCD_INT2_Y, LCD_H, LCD_INT2_VALUE,
-                         LCD_BLUE, LCD_WHITE, LCD_INT2_SIZE);
-        lcd_show_string(LCD_STRING5_X, LCD_STRING5_Y, LCD_STRING5_TEXT,
-                        LCD_BLUE, LCD_WHITE, LCD_STRING5_SIZE, LCD_STRING5_MODE);
-        lcd_show_string(LCD_STRING6_X, LCD_STRING6_Y, LCD_STRING6_TEXT,
-                        LCD_BLACK, LCD_WHITE, LCD_STRING6_SIZE, LCD_STRING6_MODE);
-        lcd_show_float_num1(LCD_FLOAT1_X, LCD_FLOAT1_Y, t,
-                            LCD_FLOAT1_NUM, LCD_BLACK, LCD_WHITE, LCD_FLOAT1_SIZE);
+        /* 控件树中只有数字每次变化，lcd_ui_render只重画变化的数字 */
+        lcd_ui_number_set_float(&m_ui_float, t);
         t += LCD_FLOAT1_INCREASE;
+        lcd_ui_render(&m_ui_root);
         
         lcd_fill(LCD_CHINESE_X, LCD_CHINESE_Y, LCD_W, LCD_H, LCD_WHITE);
         lcd_show_chinese(LCD_CHINESE_X, LCD_CHINESE_Y, chinese_string,
@@ -149,6 +174,8 @@ void lcd_process(void)
         } else {
             cur_sizey = LCD_FONT_SIZE12;
         }
+        /* 启用显存时，将本次修改的区域刷新到LCD */
+        lcd_flush();
         
         printf("\n");
         LOS_Msleep(WAIT_MSEC);
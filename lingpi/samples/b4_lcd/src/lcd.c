@@ -12,23 +12,77 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <string.h>
 #include "lz_hardware.h"
-#include "lcd_font.h"
 #include "lcd.h"
+#if LCD_ASYNC_FLUSH
+#include "los_task.h"
+#include "los_sem.h"
+#include "los_mux.h"
+#include "los_event.h"
+#endif
+#include "lcd_font.h"
+#include "lcd_glyph_cache.h"
+#include "lcd_internal.h"
 
 /* 是否启用SPI通信
  * 0 => 禁用SPI，使用gpio模拟SPI通信
  * 1 => 启用SPI
  */
+#ifndef LCD_ENABLE_SPI
 #define LCD_ENABLE_SPI      0
+#endif
 #define LCD_SPI_BUS         0
 
+/* GPIO模拟SPI时是否直接写GPIO数据寄存器
+ * 0 => 每次电平变化都调用LzGpioSetVal
+ * 1 => 初始化时将CS/CLK/MOSI/DC解析为数据寄存器和位掩码，发送时直接写寄存器
+ */
+#ifndef LCD_GPIO_FAST
+#define LCD_GPIO_FAST       1
+#endif
+
 #define LCD_PIN_CS          GPIO0_PC0
 #define LCD_PIN_CLK         GPIO0_PC1
 #define LCD_PIN_MOSI        GPIO0_PC2
 #define LCD_PIN_RES         GPIO0_PC3
 #define LCD_PIN_DC          GPIO0_PC6
 
+#define LCD_RES_Clr()       LzGpioSetVal(LCD_PIN_RES, LZGPIO_LEVEL_LOW)
+#define LCD_RES_Set()       LzGpioSetVal(LCD_PIN_RES, LZGPIO_LEVEL_HIGH)
+
+#if !LCD_ENABLE_SPI && LCD_GPIO_FAST
+#include "hal_base.h"
+
+/* 每组GPIO的引脚数，以及每个数据寄存器(SWPORT_DR_L/H)控制的引脚数 */
+#define LCD_GPIO_PORT_PINS  32
+#define LCD_GPIO_REG_PINS   16
+/* 数据寄存器的高16位为低16位的写使能，写入时不需要先读出 */
+#define LCD_GPIO_WE_SHIFT   16
+
+/* 引脚对应的数据寄存器和位 */
+typedef struct {
+    volatile uint32_t *reg;
+    uint32_t bit;
+} lcd_gpio_pin_t;
+
+static lcd_gpio_pin_t m_gpio_cs;
+static lcd_gpio_pin_t m_gpio_dc;
+/* CLK和MOSI在同一个数据寄存器中，每位数据只需写两次寄存器 */
+static volatile uint32_t *m_gpio_sck_reg;
+static uint32_t m_gpio_sck_low;     /* CLK拉低，MOSI输出0 */
+static uint32_t m_gpio_sck_high;    /* CLK拉高，MOSI保持不变 */
+static uint32_t m_gpio_mosi;        /* MOSI输出1时或上的值 */
+
+#define LCD_GPIO_LOW(pin)   WRITE_REG(*(pin).reg, (pin).bit << LCD_GPIO_WE_SHIFT)
+#define LCD_GPIO_HIGH(pin)  WRITE_REG(*(pin).reg, ((pin).bit << LCD_GPIO_WE_SHIFT) | (pin).bit)
+
+#define LCD_CS_Clr()        LCD_GPIO_LOW(m_gpio_cs)
+#define LCD_CS_Set()        LCD_GPIO_HIGH(m_gpio_cs)
+
+#define LCD_DC_Clr()        LCD_GPIO_LOW(m_gpio_dc)
+#define LCD_DC_Set()        LCD_GPIO_HIGH(m_gpio_dc)
+#else
 #define LCD_CS_Clr()        LzGpioSetVal(LCD_PIN_CS, LZGPIO_LEVEL_LOW)
 #define LCD_CS_Set()        LzGpioSetVal(LCD_PIN_CS, LZGPIO_LEVEL_HIGH)
 
@@ -38,11 +92,9 @@
 #define LCD_MOSI_Clr()      LzGpioSetVal(LCD_PIN_MOSI, LZGPIO_LEVEL_LOW)
 #define LCD_MOSI_Set()      LzGpioSetVal(LCD_PIN_MOSI, LZGPIO_LEVEL_HIGH)
 
-#define LCD_RES_Clr()       LzGpioSetVal(LCD_PIN_RES, LZGPIO_LEVEL_LOW)
-#define LCD_RES_Set()       LzGpioSetVal(LCD_PIN_RES, LZGPIO_LEVEL_HIGH)
-
 #define LCD_DC_Clr()        LzGpioSetVal(LCD_PIN_DC, LZGPIO_LEVEL_LOW)
 #define LCD_DC_Set()        LzGpioSetVal(LCD_PIN_DC, LZGPIO_LEVEL_HIGH)
+#endif
 
 #if LCD_ENABLE_SPI
 static SpiBusIo m_spiBus = {
@@ -96,6 +148,14 @@ static LzSpiConfig m_spiConf = {
 #define REG_ADDRESS_COLUMN      0x2a
 #define REG_ADDRESS_LINE        0x2B
 #define REG_ADDRESS_WRITE       0x2C
+#define REG_NORMAL_MODE         0x13
+#define REG_MEMORY_ACCESS       0x36
+#define REG_SCROLL_AREA         0x33
+#define REG_SCROLL_START        0x37
+
+/* ST7789的GRAM列数和行数，垂直滚动按GRAM行计算 */
+#define LCD_GRAM_COLS           240
+#define LCD_GRAM_LINES          320
 
 /* 寄存器位数 */
 #define REG_BITS_MAXSIZE        8
@@ -103,9 +163,6 @@ static LzSpiConfig m_spiConf = {
 /* 寄存器最高位 */
 #define REG_BITS_HIGH           (0x80)
 
-/* sizey的字体单位大小 */
-#define SIZEY_UNIT              8
-
 /* uint16取值 */
 #define UINT16_TO_H(val)        (((val) & 0xFF00) >> 8)
 #define UINT16_TO_L(val)        ((val) & 0x00FF)
@@ -113,17 +170,232 @@ static LzSpiConfig m_spiConf = {
 /* 字节转化为bits */
 #define BYTE_TO_BITS            8
 
+#ifndef MIN
+#define MIN(a, b)               (((a) < (b)) ? (a) : (b))
+#endif
+#ifndef MAX
+#define MAX(a, b)               (((a) > (b)) ? (a) : (b))
+#endif
+
 /* LCD配置模式 */
 #define LCD_HORIZONTAL_MODE1    1
 #define LCD_HORIZONTAL_MODE2    2
 
-/* 中文转化为UTF-8的字节数 */
-#define CHINESE_TO_BYTES        2
+/* 各屏幕方向的MADCTL，按USE_HORIZONTAL的取值排列 */
+static const uint8_t m_madctl[] = {0x00, 0xC0, 0x70, 0xA0};
+#define LCD_ROTATION_NUM        (sizeof(m_madctl) / sizeof(m_madctl[0]))
+
+/* 当前的屏幕方向及其宽度和高度 */
+static uint8_t m_rotation = USE_HORIZONTAL;
+static uint16_t m_width = LCD_DEFAULT_W;
+static uint16_t m_height = LCD_DEFAULT_H;
+
+/* 垂直滚动区域，m_scroll_vsa为0表示未启用滚动；
+ * m_scroll_reverse为1表示逻辑坐标与GRAM行的顺序相反
+ */
+static uint16_t m_scroll_tfa = 0;
+static uint16_t m_scroll_vsa = 0;
+static uint8_t m_scroll_reverse = 0;
+
+/* 叠加显示时按行合并的点阵最大宽度和高度 */
+#define LCD_OVERLAY_MAX_SIZE    32
+
+/* 设置一次地址窗口的总线开销约等于的像素数(11个字节) */
+#define LCD_WINDOW_COST_PIXELS  6
+
+#if LCD_ENABLE_STATS
+#define LCD_STATS_ADD(field, n) (m_stats.field += (n))
+static lcd_stats_t m_stats;
+#else
+#define LCD_STATS_ADD(field, n)
+#endif
+
+#if LCD_FB_LINES
+/* 矩形，坐标包含边界 */
+typedef struct {
+    uint16_t x1;
+    uint16_t y1;
+    uint16_t x2;
+    uint16_t y2;
+} lcd_rect_t;
+
+/* 显存字节数，按USE_HORIZONTAL方向的宽度计算，切换方向时不变 */
+#define LCD_FB_BYTES            (LCD_FB_LINES * LCD_DEFAULT_W * 2)
+
+/* 显存，RGB565像素按面板字节序(高字节在前)存放，可直接发送，
+ * 每行的像素数为当前方向的宽度
+ */
+#if LCD_ASYNC_FLUSH
+/* 双缓冲：m_fb指向正在绘制的显存，另一块交给刷新任务发送 */
+static uint8_t m_fb_buf[2][LCD_FB_BYTES];
+static uint8_t *m_fb = m_fb_buf[0];
+#else
+static uint8_t m_fb[LCD_FB_BYTES];
+#endif
+/* 显存覆盖的起始行和行数，行数随方向改变 */
+static uint16_t m_fb_y0 = 0;
+static uint16_t m_fb_lines = LCD_FB_LINES;
+/* 脏矩形列表 */
+static lcd_rect_t m_dirty[LCD_DIRTY_RECT_MAX];
+static uint8_t m_dirty_num = 0;
+#endif
+
+#if LCD_ASYNC_FLUSH
+#if (LCD_FB_LINES == 0)
+#error "LCD_ASYNC_FLUSH requires LCD_FB_LINES"
+#endif
+
+/* 刷新任务的堆栈大小 */
+#define LCD_FLUSH_TASK_STACK_SIZE   2048
+
+/* 刷新任务空闲(没有正在发送的显存)事件 */
+#define LCD_EVENT_FLUSH_IDLE        0x00000001
+
+/* 交给刷新任务的显存 */
+typedef struct {
+    const uint8_t *fb;                      /* 显存 */
+    uint16_t fb_y0;                         /* 显存覆盖的起始行 */
+    uint8_t dirty_num;                      /* 脏矩形数目 */
+    lcd_rect_t dirty[LCD_DIRTY_RECT_MAX];   /* 脏矩形列表 */
+} lcd_flush_job_t;
+static lcd_flush_job_t m_flush_job;
+
+/* 总线互斥锁，刷新任务和直接写LCD的绘图函数共用 */
+static unsigned int m_bus_mux;
+/* 有新的显存需要发送 */
+static unsigned int m_flush_sem;
+/* 刷新完成事件 */
+static EVENT_CB_S m_flush_event;
+static unsigned int m_flush_task_id;
+
+static unsigned int lcd_flush_task_init(void);
+
+#define LCD_BUS_LOCK()          LOS_MuxPend(m_bus_mux, LOS_WAIT_FOREVER)
+#define LCD_BUS_UNLOCK()        LOS_MuxPost(m_bus_mux)
+#else
+#define LCD_BUS_LOCK()
+#define LCD_BUS_UNLOCK()
+#endif
+
+/* 当前的写窗口 */
+typedef struct {
+    uint16_t x1;
+    uint16_t y1;
+    uint16_t x2;
+    uint16_t y2;
+    uint16_t x;             /* 下一个像素的X坐标 */
+    uint16_t y;             /* 下一个像素的Y坐标 */
+    uint8_t to_panel;       /* 像素是否发送到LCD */
+    uint8_t to_fb;          /* 像素是否写入显存 */
+} lcd_window_t;
+static lcd_window_t m_window;
+
+/* 行缓冲区，攒够一批像素后一次性发送到LCD */
+static uint8_t m_line_buf[LCD_LINE_BUF_PIXELS * 2];
+static uint32_t m_line_len = 0;
+
+#if !LCD_ENABLE_SPI && LCD_GPIO_FAST
+/* 输出一位数据：拉低CLK的同时设置MOSI，再拉高CLK，LCD在上升沿采样 */
+#define LCD_GPIO_SEND_BIT(dat, mask) do { \
+        WRITE_REG(*reg, low | (((dat) & (mask)) ? mosi : 0)); \
+        WRITE_REG(*reg, high); \
+    } while (0)
+
+/***************************************************************
+ * 函数名称: lcd_gpio_write_bytes
+ * 说    明: 直接写GPIO数据寄存器发送多个字节，调用前需拉低CS
+ * 参    数:
+ *       @buf：数据
+ *       @len：数据长度
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_gpio_write_bytes(const uint8_t *buf, size_t len)
+{
+    /* 寄存器地址和写入值放在局部变量中，循环内不再访问全局变量 */
+    volatile uint32_t *reg = m_gpio_sck_reg;
+    uint32_t low = m_gpio_sck_low;
+    uint32_t high = m_gpio_sck_high;
+    uint32_t mosi = m_gpio_mosi;
+    uint32_t dat;
+    
+    while (len--) {
+        dat = *buf++;
+        LCD_GPIO_SEND_BIT(dat, 0x80);
+        LCD_GPIO_SEND_BIT(dat, 0x40);
+        LCD_GPIO_SEND_BIT(dat, 0x20);
+        LCD_GPIO_SEND_BIT(dat, 0x10);
+        LCD_GPIO_SEND_BIT(dat, 0x08);
+        LCD_GPIO_SEND_BIT(dat, 0x04);
+        LCD_GPIO_SEND_BIT(dat, 0x02);
+        LCD_GPIO_SEND_BIT(dat, 0x01);
+    }
+}
+
+/* 将引脚解析为所在的数据寄存器和位 */
+static unsigned int lcd_gpio_resolve(uint32_t gpio, lcd_gpio_pin_t *pin)
+{
+    struct GPIO_REG *port;
+    
+    switch (gpio / LCD_GPIO_PORT_PINS) {
+        case 0:
+            port = GPIO0;
+            break;
+        case 1:
+            port = GPIO1;
+            break;
+        default:
+            printf("%s, %d: gpio %u is not supported!\n", __FILE__, __LINE__, gpio);
+            return __LINE__;
+    }
+    
+    if ((gpio % LCD_GPIO_PORT_PINS) < LCD_GPIO_REG_PINS) {
+        pin->reg = &port->SWPORT_DR_L;
+    } else {
+        pin->reg = &port->SWPORT_DR_H;
+    }
+    pin->bit = 1u << (gpio % LCD_GPIO_REG_PINS);
+    return 0;
+}
+
+/***************************************************************
+ * 函数名称: lcd_gpio_fast_init
+ * 说    明: 解析CS/CLK/MOSI/DC引脚的数据寄存器，需在引脚配置为GPIO输出之后调用
+ * 参    数: 无
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+static unsigned int lcd_gpio_fast_init(void)
+{
+    lcd_gpio_pin_t clk, mosi;
+    
+    if (lcd_gpio_resolve(LCD_PIN_CS, &m_gpio_cs) != 0 ||
+        lcd_gpio_resolve(LCD_PIN_DC, &m_gpio_dc) != 0 ||
+        lcd_gpio_resolve(LCD_PIN_CLK, &clk) != 0 ||
+        lcd_gpio_resolve(LCD_PIN_MOSI, &mosi) != 0) {
+        return __LINE__;
+    }
+    if (clk.reg != mosi.reg) {
+        printf("%s, %d: CLK and MOSI must be in the same GPIO register!\n", __FILE__, __LINE__);
+        return __LINE__;
+    }
+    
+    m_gpio_sck_reg = clk.reg;
+    m_gpio_sck_low = (clk.bit | mosi.bit) << LCD_GPIO_WE_SHIFT;
+    m_gpio_sck_high = (clk.bit << LCD_GPIO_WE_SHIFT) | clk.bit;
+    m_gpio_mosi = mosi.bit;
+    return 0;
+}
+#endif
 
 static void lcd_write_bus(uint8_t dat)
 {
+    LCD_STATS_ADD(bytes, 1);
+    LCD_STATS_ADD(transfers, 1);
 #if LCD_ENABLE_SPI
     LzSpiWrite(LCD_SPI_BUS, 0, &dat, 1);
+#elif LCD_GPIO_FAST
+    LCD_CS_Clr();
+    lcd_gpio_write_bytes(&dat, 1);
+    LCD_CS_Set();
 #else
     uint8_t i;
     
@@ -142,19 +414,66 @@ static void lcd_write_bus(uint8_t dat)
 #endif
 }
 
-static void lcd_wr_data8(uint8_t dat)
+/***************************************************************
+ * 函数名称: lcd_write_buf
+ * 说    明: 连续发送多个字节，整个数据段只占用一次总线传输
+ *           (SPI模式为一次LzSpiWrite，GPIO模式下CS全程保持有效)
+ * 参    数:
+ *       @buf：数据
+ *       @len：数据长度
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_write_buf(const uint8_t *buf, size_t len)
 {
-    lcd_write_bus(dat);
+    if (len == 0) {
+        return;
+    }
+    
+    LCD_STATS_ADD(bytes, len);
+    LCD_STATS_ADD(transfers, 1);
+#if LCD_ENABLE_SPI
+    LzSpiWrite(LCD_SPI_BUS, 0, buf, len);
+#elif LCD_GPIO_FAST
+    LCD_CS_Clr();
+    lcd_gpio_write_bytes(buf, len);
+    LCD_CS_Set();
+#else
+    uint8_t i, dat;
+    
+    LCD_CS_Clr();
+    while (len--) {
+        dat = *buf++;
+        for (i = 0; i < REG_BITS_MAXSIZE; i++) {
+            LCD_CLK_Clr();
+            if (dat & REG_BITS_HIGH) {
+                LCD_MOSI_Set();
+            } else {
+                LCD_MOSI_Clr();
+            }
+            LCD_CLK_Set();
+            dat <<= 1;
+        }
+    }
+    LCD_CS_Set();
+#endif
+}
+
+/* 发送行缓冲区中尚未发送的像素 */
+static void lcd_line_flush(void)
+{
+    lcd_write_buf(m_line_buf, m_line_len);
+    m_line_len = 0;
 }
 
-static void lcd_wr_data(uint16_t dat)
+static void lcd_wr_data8(uint8_t dat)
 {
-    lcd_write_bus(UINT16_TO_H(dat));
-    lcd_write_bus(UINT16_TO_L(dat));
+    lcd_write_bus(dat);
 }
 
 static void lcd_wr_reg(uint8_t dat)
 {
+    /* 命令前必须先发送完已缓冲的像素 */
+    lcd_line_flush();
     LCD_DC_Clr();
     lcd_write_bus(dat);
     LCD_DC_Set();
@@ -162,360 +481,805 @@ static void lcd_wr_reg(uint8_t dat)
 
 static void lcd_address_set(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
 {
+#define ADDRESS_BYTES           4
+    uint8_t buf[ADDRESS_BYTES];
+    
+    LCD_STATS_ADD(windows, 1);
     /* 列地址设置 */
     lcd_wr_reg(REG_ADDRESS_COLUMN);
-    lcd_wr_data(x1);
-    lcd_wr_data(x2);
+    buf[0] = UINT16_TO_H(x1);
+    buf[1] = UINT16_TO_L(x1);
+    buf[2] = UINT16_TO_H(x2);
+    buf[3] = UINT16_TO_L(x2);
+    lcd_write_buf(buf, ADDRESS_BYTES);
     /* 行地址设置 */
     lcd_wr_reg(REG_ADDRESS_LINE);
-    lcd_wr_data(y1);
-    lcd_wr_data(y2);
+    buf[0] = UINT16_TO_H(y1);
+    buf[1] = UINT16_TO_L(y1);
+    buf[2] = UINT16_TO_H(y2);
+    buf[3] = UINT16_TO_L(y2);
+    lcd_write_buf(buf, ADDRESS_BYTES);
     /* 储存器写 */
     lcd_wr_reg(REG_ADDRESS_WRITE);
 }
 
-static uint32_t mypow(uint8_t m, uint8_t n)
+#if LCD_FB_LINES
+static uint32_t lcd_rect_area(const lcd_rect_t *r)
 {
-    uint32_t result = 1;
-    
-    while (n--) {
-        result *= m;
-    }
-    
-    return result;
+    return (uint32_t)(r->x2 - r->x1 + 1) * (r->y2 - r->y1 + 1);
+}
+
+
+static void lcd_rect_union(const lcd_rect_t *a, const lcd_rect_t *b, lcd_rect_t *out)
+{
+    out->x1 = (a->x1 < b->x1) ? a->x1 : b->x1;
+    out->y1 = (a->y1 < b->y1) ? a->y1 : b->y1;
+    out->x2 = (a->x2 > b->x2) ? a->x2 : b->x2;
+    out->y2 = (a->y2 > b->y2) ? a->y2 : b->y2;
 }
 
 
 /***************************************************************
- * 函数名称: lcd_show_chinese_12x12
- * 说    明: 显示单个12x12汉字
+ * 函数名称: lcd_dirty_add
+ * 说    明: 添加脏矩形。合并后多刷新的像素少于一次窗口设置的开销时
+ *           与已有矩形合并；列表已满时合并浪费像素最少的两个矩形
  * 参    数:
- *       @x：指定汉字串的起始位置X坐标
- *       @y：指定汉字串的起始位置X坐标
- *       @s：指定汉字串（该汉字串为ascii）
- *       @fc: 字的颜色
- *       @bc: 字的背景色
- *       @sizey: 字号，可选：12
- *       @mode: 0为非叠加模式；1为叠加模式
+ *       @x1/y1/x2/y2：矩形范围(含边界)
  * 返 回 值: 无
  ***************************************************************/
-static void lcd_show_chinese_12x12(uint16_t x,
-    uint16_t y,
-    uint8_t *s,
-    uint16_t fc,
-    uint16_t bc,
-    uint8_t sizey,
-    uint8_t mode)
+static void lcd_dirty_add(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
 {
-    uint8_t i, j, m = 0;
-    uint16_t k;
-    uint16_t HZnum;         // 汉字数目
-    uint16_t TypefaceNum;   // 一个字符所占字节大小
-    uint16_t x0 = x;
-    
-    TypefaceNum = (sizey / BYTE_TO_BITS + ((sizey % biBYTE_TO_BITSts) ? 1 : 0)) * sizey;
-    
-    /* 统计汉字数目 */
-    HZnum = sizeof(tfont12) / sizeof(typFNT_GB12);
-    
-    for (k = 0; k < HZnum; k++) {
-        if ((tfont12[k].Index[0] == *(s)) && (tfont12[k].Index[1] == *(s + 1))) {
-            lcd_address_set(x, y, x + sizey - 1, y + sizey - 1);
-            for (i = 0; i < TypefaceNum; i++) {
-                for (j = 0; j < BYTE_TO_BITS; j++) {
-                    if (!mode) {
-                        /* 非叠加方式 */
-                        if (tfont12[k].Msk[i] & (0x01 << j)) {
-                            lcd_wr_data(fc);
-                        } else {
-                            lcd_wr_data(bc);
-                        }
-                        
-                        m++;
-                        if ((m % sizey) == 0) {
-                            m = 0;
-                            break;
-                        }
-                    } else {
-                        /* 叠加方式 */
-                        if (tfont12[k].Msk[i] & (0x01 << j)) {
-                            /* 画一个点 */
-                            lcd_draw_point(x, y, fc);
-                        }
-                        
-                        x++;
-                        if ((x - x0) == sizey) {
-                            x = x0;
-                            y++;
-                            break;
-                        }
-                    }
+    lcd_rect_t r = {x1, y1, x2, y2};
+    lcd_rect_t u;
+    uint8_t i = 0, j;
+    uint8_t best_i = 0, best_j = 0;
+    int32_t cost, best_cost = -1;
+
+    while (i < m_dirty_num) {
+        lcd_rect_union(&m_dirty[i], &r, &u);
+        if (lcd_rect_area(&u) <= lcd_rect_area(&m_dirty[i]) + lcd_rect_area(&r) + LCD_WINDOW_COST_PIXELS) {
+            /* 合并后重新检查，新矩形可能与其他矩形相交 */
+            r = u;
+            m_dirty[i] = m_dirty[--m_dirty_num];
+            i = 0;
+        } else {
+            i++;
+        }
+    }
+
+    if (m_dirty_num == LCD_DIRTY_RECT_MAX) {
+        /* 新矩形暂放在列表末尾之后，一起参与两两比较 */
+        for (i = 0; i < m_dirty_num; i++) {
+            for (j = i + 1; j <= m_dirty_num; j++) {
+                lcd_rect_union(&m_dirty[i], (j == m_dirty_num) ? &r : &m_dirty[j], &u);
+                cost = (int32_t)lcd_rect_area(&u) - (int32_t)lcd_rect_area(&m_dirty[i]) -
+                    (int32_t)lcd_rect_area((j == m_dirty_num) ? &r : &m_dirty[j]);
+                if (best_cost < 0 || cost < best_cost) {
+                    best_i = i;
+                    best_j = j;
+                    best_cost = (cost < 0) ? 0 : cost;
                 }
             }
-            
-            break; /* 查找到对应点阵字库立即退出，防止多个汉字重复取模带来影响 */
         }
+        if (best_j == m_dirty_num) {
+            lcd_rect_union(&m_dirty[best_i], &r, &m_dirty[best_i]);
+            return;
+        }
+        lcd_rect_union(&m_dirty[best_i], &m_dirty[best_j], &m_dirty[best_i]);
+        m_dirty[best_j] = r;
+        return;
     }
+
+    m_dirty[m_dirty_num++] = r;
+}
+
+
+static inline void lcd_fb_put(uint16_t x, uint16_t y, uint16_t color)
+{
+    uint32_t offset = ((uint32_t)(y - m_fb_y0) * m_width + x) * 2;
+
+    m_fb[offset] = UINT16_TO_H(color);
+    m_fb[offset + 1] = UINT16_TO_L(color);
 }
+#endif
+
 
 /***************************************************************
- * 函数名称: lcd_show_chinese_16x16
- * 说    明: 显示单个16x16汉字
+ * 函数名称: lcd_window_begin
+ * 说    明: 开始向指定窗口写像素。窗口完全落在显存内时只写显存并
+ *           标记为脏；否则直接写LCD，与显存重叠的部分同时写入显存
  * 参    数:
- *       @x：指定汉字串的起始位置X坐标
- *       @y：指定汉字串的起始位置X坐标
- *       @s：指定汉字串（该汉字串为ascii）
- *       @fc: 字的颜色
- *       @bc: 字的背景色
- *       @sizey: 字号，可选：16
- *       @mode: 0为非叠加模式；1为叠加模式
+ *       @x1/y1/x2/y2：窗口范围(含边界)
  * 返 回 值: 无
  ***************************************************************/
-static void lcd_show_chinese_16x16(uint16_t x,
-    uint16_t y,
-    uint8_t *s,
-    uint16_t fc,
-    uint16_t bc,
-    uint8_t sizey,
-    uint8_t mode)
+void lcd_window_begin(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
 {
-    uint8_t i, j, m = 0;
-    uint16_t k;
-    uint16_t HZnum;         /* 汉字数目 */
-    uint16_t TypefaceNum;   /* 一个字符所占字节大小 */
-    uint16_t x0 = x;
-    
-    TypefaceNum = (sizey / SIZEY_UNIT + ((sizey % SIZEY_UNIT) ? 1 : 0)) * sizey;
-    /* 统计汉字数目 */
-    HZnum = sizeof(tfont16) / sizeof(typFNT_GB16);
-    
-    for (k = 0; k < HZnum; k++) {
-        if ((tfont16[k].Index[0] == *(s)) && (tfont16[k].Index[1] == *(s + 1))) {
-            lcd_address_set(x, y, x + sizey - 1, y + sizey - 1);
-            for (i = 0; i < TypefaceNum; i++) {
-                for (j = 0; j < BYTE_TO_BITS; j++) {
-                    if (!mode) {
-                        /* 非叠加方式 */
-                        if (tfont16[k].Msk[i] & (0x01 << j)) {
-                            lcd_wr_data(fc);
-                        } else {
-                            lcd_wr_data(bc);
-                        }
-                        
-                        m++;
-                        if (m % sizey == 0) {
-                            m = 0;
-                            break;
-                        }
-                    } else {
-                        /* 叠加方式 */
-                        if (tfont16[k].Msk[i] & (0x01 << j)) {
-                            /* 画一个点 */
-                            lcd_draw_point(x, y, fc);
-                        }
-                        
-                        x++;
-                        if ((x - x0) == sizey) {
-                            x = x0;
-                            y++;
-                            break;
-                        }
-                    }
-                }
-            }
-            
-            break; /* 查找到对应点阵字库立即退出，防止多个汉字重复取模带来影响 */
+    m_window.x1 = x1;
+    m_window.y1 = y1;
+    m_window.x2 = x2;
+    m_window.y2 = y2;
+    m_window.x = x1;
+    m_window.y = y1;
+    m_window.to_fb = 0;
+    m_window.to_panel = 1;
+#if LCD_FB_LINES
+    if (x2 < m_width && y2 >= m_fb_y0 && y1 < m_fb_y0 + m_fb_lines) {
+        m_window.to_fb = 1;
+        if (y1 >= m_fb_y0 && y2 < m_fb_y0 + m_fb_lines) {
+            m_window.to_panel = 0;
+            lcd_dirty_add(x1, y1, x2, y2);
+            return;
         }
+#if LCD_ASYNC_FLUSH
+        /* 刷新任务可能随后用旧显存覆盖这些像素，重叠部分也标记为脏 */
+        lcd_dirty_add(x1, MAX(y1, m_fb_y0), x2, MIN(y2, m_fb_y0 + m_fb_lines - 1));
+#endif
     }
+#endif
+    /* 直接写LCD时占用总线到lcd_window_end */
+    LCD_BUS_LOCK();
+    lcd_address_set(x1, y1, x2, y2);
 }
 
 
 /***************************************************************
- * 函数名称: lcd_show_chinese_24x24
- * 说    明: 显示单个24x24汉字
+ * 函数名称: lcd_window_push
+ * 说    明: 向当前窗口写一个像素，按行优先移动写入位置
  * 参    数:
- *       @x：指定汉字串的起始位置X坐标
- *       @y：指定汉字串的起始位置X坐标
- *       @s：指定汉字串（该汉字串为ascii）
- *       @fc: 字的颜色
- *       @bc: 字的背景色
- *       @sizey: 字号，可选：24
- *       @mode: 0为非叠加模式；1为叠加模式
+ *       @color：像素颜色
  * 返 回 值: 无
  ***************************************************************/
-static void lcd_show_chinese_24x24(uint16_t x,
-    uint16_t y,
-    uint8_t *s,
-    uint16_t fc,
-    uint16_t bc,
-    uint8_t sizey,
-    uint8_t mode)
+void lcd_window_push(uint16_t color)
 {
-    uint8_t i, j, m = 0;
-    uint16_t k;
-    uint16_t HZnum;         /* 汉字数目 */
-    uint16_t TypefaceNum;   /* 一个字符所占字节大小 */
-    uint16_t x0 = x;
-    
-    TypefaceNum = (sizey / BYTE_TO_BITS + ((sizey % BYTE_TO_BITS) ? 1 : 0)) * sizey;
-    /* 统计汉字数目 */
-    HZnum = sizeof(tfont24) / sizeof(typFNT_GB24);
-    
-    for (k = 0; k < HZnum; k++) {
-        if ((tfont24[k].Index[0] == *(s)) && (tfont24[k].Index[1] == *(s + 1))) {
-            lcd_address_set(x, y, x + sizey - 1, y + sizey - 1);
-            for (i = 0; i < TypefaceNum; i++) {
-                for (j = 0; j < BYTE_TO_BITS; j++) {
-                    if (!mode) {
-                        /* 非叠加方式 */
-                        if (tfont24[k].Msk[i] & (0x01 << j)) {
-                            lcd_wr_data(fc);
-                        } else {
-                            lcd_wr_data(bc);
-                        }
-                        
-                        m++;
-                        if (m % sizey == 0) {
-                            m = 0;
-                            break;
-                        }
-                    } else {
-                        /* 叠加方式 */
-                        if (tfont24[k].Msk[i] & (0x01 << j)) {
-                            /* 画一个点 */
-                            lcd_draw_point(x, y, fc);
-                        }
-                        
-                        x++;
-                        if ((x - x0) == sizey) {
-                            x = x0;
-                            y++;
-                            break;
-                        }
-                    }
-                }
-            }
-            
-            break; /* 查找到对应点阵字库立即退出，防止多个汉字重复取模带来影响 */
+#if LCD_FB_LINES
+    if (m_window.to_fb && m_window.y >= m_fb_y0 && m_window.y < m_fb_y0 + m_fb_lines) {
+        lcd_fb_put(m_window.x, m_window.y, color);
+    }
+#endif
+    if (m_window.to_panel) {
+        m_line_buf[m_line_len++] = UINT16_TO_H(color);
+        m_line_buf[m_line_len++] = UINT16_TO_L(color);
+        if (m_line_len == sizeof(m_line_buf)) {
+            lcd_line_flush();
         }
     }
+
+    if (m_window.x < m_window.x2) {
+        m_window.x++;
+    } else {
+        m_window.x = m_window.x1;
+        m_window.y++;
+    }
+}
+
+
+/* 将当前窗口的写入位置向后移动count个像素 */
+static void lcd_window_advance(uint32_t count)
+{
+    uint32_t width = m_window.x2 - m_window.x1 + 1;
+    uint32_t pos = (m_window.x - m_window.x1) + count;
+    
+    m_window.y += pos / width;
+    m_window.x = m_window.x1 + pos % width;
 }
 
 
 /***************************************************************
- * 函数名称: lcd_show_chinese_32x32
- * 说    明: 显示单个32x32汉字
+ * 函数名称: lcd_window_fill
+ * 说    明: 向当前窗口连续写入count个相同颜色的像素
+ *           行缓冲区只填充一次，之后重复整块发送
  * 参    数:
- *       @x：指定汉字串的起始位置X坐标
- *       @y：指定汉字串的起始位置X坐标
- *       @s：指定汉字串（该汉字串为ascii）
- *       @fc: 字的颜色
- *       @bc: 字的背景色
- *       @sizey: 字号，可选：32
- *       @mode: 0为非叠加模式；1为叠加模式
+ *       @color：像素颜色
+ *       @count：像素数目
  * 返 回 值: 无
  ***************************************************************/
-static void lcd_show_chinese_32x32(uint16_t x,
-    uint16_t y,
-    uint8_t *s,
-    uint16_t fc,
-    uint16_t bc,
-    uint8_t sizey,
-    uint8_t mode)
+void lcd_window_fill(uint16_t color, uint32_t count)
 {
-    uint8_t i, j, m = 0;
-    uint16_t k;
-    uint16_t HZnum;         /* 汉字数目 */
-    uint16_t TypefaceNum;   /* 一个字符所占字节大小 */
-    uint16_t x0 = x;
+    uint32_t i, n;
     
-    TypefaceNum = (sizey / SIZEY_UNIT + ((sizey % SIZEY_UNIT) ? 1 : 0)) * sizey;
-    /* 统计汉字数目 */
-    HZnum = sizeof(tfont32) / sizeof(typFNT_GB32);
-    
-    for (k = 0; k < HZnum; k++) {
-        if ((tfont32[k].Index[0] == *(s)) && (tfont32[k].Index[1] == *(s + 1))) {
-            lcd_address_set(x, y, x + sizey - 1, y + sizey - 1);
-            for (i = 0; i < TypefaceNum; i++) {
-                for (j = 0; j < BYTE_TO_BITS; j++) {
-                    if (!mode) {
-                        /* 非叠加方式 */
-                        if (tfont32[k].Msk[i] & (0x01 << j)) {
-                            lcd_wr_data(fc);
-                        } else {
-                            lcd_wr_data(bc);
-                        }
-                        
-                        m++;
-                        if (m % sizey == 0) {
-                            m = 0;
-                            break;
-                        }
-                    } else {
-                        /* 叠加方式 */
-                        if (tfont32[k].Msk[i] & (0x01 << j)) {
-                            lcd_draw_point(x, y, fc); /* 画一个点 */
-                        }
-                        
-                        x++;
-                        if ((x - x0) == sizey) {
-                            x = x0;
-                            y++;
-                            break;
-                        }
-                    }
-                }
-            }
-            
-            break; /* 查找到对应点阵字库立即退出，防止多个汉字重复取模带来影响 */
+#if LCD_FB_LINES
+    if (m_window.to_fb) {
+        /* 显存路径逐像素写入，由lcd_window_push处理显存段边界 */
+        while (count--) {
+            lcd_window_push(color);
         }
+        return;
+    }
+#endif
+    lcd_line_flush();
+    n = (count < LCD_LINE_BUF_PIXELS) ? count : LCD_LINE_BUF_PIXELS;
+    for (i = 0; i < n; i++) {
+        m_line_buf[i * 2] = UINT16_TO_H(color);
+        m_line_buf[i * 2 + 1] = UINT16_TO_L(color);
+    }
+    lcd_window_advance(count);
+    while (count > 0) {
+        n = (count < LCD_LINE_BUF_PIXELS) ? count : LCD_LINE_BUF_PIXELS;
+        lcd_write_buf(m_line_buf, n * 2);
+        count -= n;
     }
 }
 
+
 /***************************************************************
- * 函数名称: lcd_init
- * 说    明: Lcd初始化
+ * 函数名称: lcd_window_write
+ * 说    明: 向当前窗口连续写入count个像素，像素按面板字节序存放
+ *           (高字节在前)，直接写LCD时整块数据只占用一次总线传输
+ * 参    数:
+ *       @data：像素数据
+ *       @count：像素数目
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_window_write(const uint8_t *data, uint32_t count)
+{
+#if LCD_FB_LINES
+    if (m_window.to_fb) {
+        while (count--) {
+            lcd_window_push(((uint16_t)data[0] << REG_BITS_MAXSIZE) | data[1]);
+            data += 2;
+        }
+        return;
+    }
+#endif
+    lcd_line_flush();
+    lcd_write_buf(data, count * 2);
+    lcd_window_advance(count);
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_window_end
+ * 说    明: 结束当前窗口，发送行缓冲区中剩余的像素
  * 参    数: 无
- * 返 回 值: 返回0为成功，反之为失败
+ * 返 回 值: 无
  ***************************************************************/
-unsigned int lcd_init(void)
+void lcd_window_end(void)
 {
-    unsigned int delay_msec = 100;
-    unsigned int long_delay_msec = 500;
-#if LCD_ENABLE_SPI
-    LzSpiDeinit(LCD_SPI_BUS);
-    
-    if (SpiIoInit(m_spiBus) != LZ_HARDWARE_SUCCESS) {
-        printf("%s, %d: SpiIoInit failed!\n", __FILE__, __LINE__);
-        return __LINE__;
+    if (m_window.to_panel) {
+        lcd_line_flush();
+        LCD_BUS_UNLOCK();
     }
-    if (LzSpiInit(LCD_SPI_BUS, m_spiConf) != LZ_HARDWARE_SUCCESS) {
-        printf("%s, %d: LzSpiInit failed!\n", __FILE__, __LINE__);
-        return __LINE__;
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_fb_region
+ * 说    明: 区域完全落在显存内时将其标记为脏，返回区域左上角像素在
+ *           显存中的地址，调用者随后直接修改显存
+ * 参    数:
+ *       @x1/y1/x2/y2：区域范围(含边界)
+ *       @stride：返回显存每行的字节数
+ * 返 回 值: 显存地址，没有显存或区域不完全在显存内时返回NULL
+ ***************************************************************/
+uint8_t *lcd_fb_region(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint32_t *stride)
+{
+#if LCD_FB_LINES
+    if (x2 < m_width && y1 >= m_fb_y0 && y2 < m_fb_y0 + m_fb_lines) {
+        lcd_dirty_add(x1, y1, x2, y2);
+        *stride = (uint32_t)m_width * 2;
+        return &m_fb[((uint32_t)(y1 - m_fb_y0) * m_width + x1) * 2];
     }
 #else
-    /* 初始化GPIO0_C0 */
-    LzGpioInit(LCD_PIN_CS);
-    LzGpioSetDir(LCD_PIN_CS, LZGPIO_DIR_OUT);
-    LzGpioSetVal(LCD_PIN_CS, LZGPIO_LEVEL_HIGH);
-    /* 初始化GPIO0_C1 */
-    LzGpioInit(LCD_PIN_CLK);
-    LzGpioSetDir(LCD_PIN_CLK, LZGPIO_DIR_OUT);
-    LzGpioSetVal(LCD_PIN_CLK, LZGPIO_LEVEL_LOW);
-    /* 初始化GPIO0_C2 */
-    LzGpioInit(LCD_PIN_MOSI);
-    LzGpioSetDir(LCD_PIN_MOSI, LZGPIO_DIR_OUT);
-    LzGpioSetVal(LCD_PIN_MOSI, LZGPIO_LEVEL_LOW);
+    (void)x1;
+    (void)y1;
+    (void)x2;
+    (void)y2;
+    (void)stride;
 #endif
-    /* 初始化GPIO0_C3 */
-    LzGpioInit(LCD_PIN_RES);
-    LzGpioSetDir(LCD_PIN_RES, LZGPIO_DIR_OUT);
+    return NULL;
+}
+
+
+/* 将1bpp点阵展开为RGB565像素写入字模缓存条目 */
+static void lcd_mask_expand(const lcd_glyph_key_t *key, const uint8_t *mask, int entry)
+{
+    uint16_t stride = (key->w + BYTE_TO_BITS - 1) / BYTE_TO_BITS;
+    uint16_t px = 0, py = 0;
+    uint16_t color;
+    uint32_t i, len = 0;
+    uint8_t *data;
+    lcd_glyph_iter_t it;
+    
+    lcd_glyph_cache_iter(entry, &it);
+    while ((data = lcd_glyph_cache_next(&it, &len)) != NULL) {
+        for (i = 0; i < len; i += 2) {
+            if (mask[py * stride + px / BYTE_TO_BITS] & (0x01 << (px % BYTE_TO_BITS))) {
+                color = key->fc;
+            } else {
+                color = key->bc;
+            }
+            data[i] = UINT16_TO_H(color);
+            data[i + 1] = UINT16_TO_L(color);
+            if (++px == key->w) {
+                px = 0;
+                py++;
+            }
+        }
+    }
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_draw_mask
+ * 说    明: 以非叠加方式显示1bpp点阵，点阵每行占(w+7)/8个字节，低位
+ *           在前。展开后的像素存入字模缓存，再次显示相同的字模和颜色
+ *           时直接整块发送。由母版缩小的字模在字模缓存未命中时取自
+ *           lcd_font_scaled_mask的点阵缓存
+ * 参    数:
+ *       @x：点阵的起始位置X坐标
+ *       @y：点阵的起始位置Y坐标
+ *       @w：点阵的宽度
+ *       @h：点阵的高度
+ *       @mask：点阵数据，scaled为1时为母版字模
+ *       @scaled：是否由母版缩小生成
+ *       @fc: 字的颜色
+ *       @bc: 字的背景色
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_draw_mask(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+    const uint8_t *mask, uint8_t scaled, uint16_t fc, uint16_t bc)
+{
+    lcd_glyph_key_t key;
+    lcd_glyph_iter_t it;
+    uint16_t stride = (w + BYTE_TO_BITS - 1) / BYTE_TO_BITS;
+    uint16_t i, j;
+    uint32_t len = 0;
+    uint8_t *data;
+    int entry;
+    
+    lcd_glyph_key_set(&key, mask, w, h, fc, bc, 1);
+    lcd_window_begin(x, y, x + w - 1, y + h - 1);
+    entry = lcd_glyph_cache_find(&key);
+    if (entry < 0) {
+        if (scaled) {
+            mask = lcd_font_scaled_mask(mask, w, h);
+        }
+        entry = lcd_glyph_cache_alloc(&key);
+        if (entry >= 0) {
+            lcd_mask_expand(&key, mask, entry);
+        }
+    }
+    
+    if (entry >= 0) {
+        lcd_glyph_cache_iter(entry, &it);
+        while ((data = lcd_glyph_cache_next(&it, &len)) != NULL) {
+            lcd_window_write(data, len / 2);
+        }
+    } else {
+        /* 超出缓存预算时逐像素展开 */
+        for (i = 0; i < h; i++) {
+            for (j = 0; j < w; j++) {
+                if (mask[i * stride + j / BYTE_TO_BITS] & (0x01 << (j % BYTE_TO_BITS))) {
+                    lcd_window_push(fc);
+                } else {
+                    lcd_window_push(bc);
+                }
+            }
+        }
+    }
+    lcd_window_end();
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_draw_mask_runs
+ * 说    明: 以叠加方式显示不超过32*32的1bpp点阵。每行连续置位的点
+ *           为一段，下面若干行在同一位置有完全相同的段时合并为一个
+ *           矩形，每个矩形只设置一次窗口
+ * 参    数:
+ *       @x/y：点阵的起始位置
+ *       @w/h：点阵的宽度和高度
+ *       @mask：点阵数据
+ *       @fc: 字的颜色
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_draw_mask_runs(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+    const uint8_t *mask, uint16_t fc)
+{
+    uint16_t stride = (w + BYTE_TO_BITS - 1) / BYTE_TO_BITS;
+    uint32_t rows[LCD_OVERLAY_MAX_SIZE];
+    uint32_t run, edge;
+    uint16_t i, j, k, start;
+    
+    /* 每行展开为一个32位整数，第0位对应最左边的点 */
+    for (i = 0; i < h; i++) {
+        rows[i] = 0;
+        for (j = 0; j < stride; j++) {
+            rows[i] |= (uint32_t)mask[i * stride + j] << (j * BYTE_TO_BITS);
+        }
+    }
+    
+    for (i = 0; i < h; i++) {
+        while (rows[i] != 0) {
+            start = 0;
+            while (!(rows[i] & (1UL << start))) {
+                start++;
+            }
+            j = start;
+            while (j < LCD_OVERLAY_MAX_SIZE && (rows[i] & (1UL << j))) {
+                j++;
+            }
+            run = (j - start == LCD_OVERLAY_MAX_SIZE) ? 0xFFFFFFFFUL : (((1UL << (j - start)) - 1) << start);
+            /* 段两侧的点，用于判断下一行的段是否完全相同 */
+            edge = run;
+            edge |= (start > 0) ? (1UL << (start - 1)) : 0;
+            edge |= (j < LCD_OVERLAY_MAX_SIZE) ? (1UL << j) : 0;
+            for (k = i; k < h && (rows[k] & edge) == run; k++) {
+                rows[k] &= ~run;
+            }
+            lcd_window_begin(x + start, y + i, x + j - 1, y + k - 1);
+            lcd_window_fill(fc, (uint32_t)(j - start) * (k - i));
+            lcd_window_end();
+        }
+    }
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_draw_mask_overlay
+ * 说    明: 以叠加方式显示1bpp点阵，只画置位的点，点阵格式同lcd_draw_mask
+ *           点阵完全落在显存内时直接在显存中修改，只把置位点的外接
+ *           矩形标记为脏；否则每行连续置位的点合并为一段，每段只
+ *           设置一次窗口
+ * 参    数:
+ *       @x：点阵的起始位置X坐标
+ *       @y：点阵的起始位置Y坐标
+ *       @w：点阵的宽度
+ *       @h：点阵的高度
+ *       @mask：点阵数据
+ *       @fc: 字的颜色
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_draw_mask_overlay(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+    const uint8_t *mask, uint16_t fc)
+{
+    uint16_t stride = (w + BYTE_TO_BITS - 1) / BYTE_TO_BITS;
+    uint16_t i, j, start;
+    const uint8_t *row;
+    
+#if LCD_FB_LINES
+    if (x + w <= m_width && y >= m_fb_y0 && y + h <= m_fb_y0 + m_fb_lines) {
+        uint16_t x1 = w, y1 = h, x2 = 0, y2 = 0;
+        
+        for (i = 0; i < h; i++) {
+            row = &mask[i * stride];
+            for (j = 0; j < w; j++) {
+                if (row[j / BYTE_TO_BITS] & (0x01 << (j % BYTE_TO_BITS))) {
+                    lcd_fb_put(x + j, y + i, fc);
+                    x1 = MIN(x1, j);
+                    x2 = MAX(x2, j);
+                    y1 = MIN(y1, i);
+                    y2 = i;
+                }
+            }
+        }
+        if (x1 <= x2 && y1 <= y2) {
+            lcd_dirty_add(x + x1, y + y1, x + x2, y + y2);
+        }
+        return;
+    }
+#endif
+    
+    if (w <= LCD_OVERLAY_MAX_SIZE && h <= LCD_OVERLAY_MAX_SIZE) {
+        lcd_draw_mask_runs(x, y, w, h, mask, fc);
+        return;
+    }
+    
+    for (i = 0; i < h; i++) {
+        row = &mask[i * stride];
+        j = 0;
+        while (j < w) {
+            if (!(row[j / BYTE_TO_BITS] & (0x01 << (j % BYTE_TO_BITS)))) {
+                j++;
+                continue;
+            }
+            start = j;
+            while (j < w && (row[j / BYTE_TO_BITS] & (0x01 << (j % BYTE_TO_BITS)))) {
+                j++;
+            }
+            lcd_window_begin(x + start, y + i, x + j - 1, y + i);
+            lcd_window_fill(fc, j - start);
+            lcd_window_end();
+        }
+    }
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_font_find
+ * 说    明: 在字体中查找Unicode码点，有码点索引时二分查找
+ * 参    数:
+ *       @font：字体
+ *       @code：Unicode码点
+ * 返 回 值: 找到返回字模序号，否则返回-1
+ ***************************************************************/
+static int lcd_font_find(const lcd_font_t *font, uint32_t code)
+{
+    int low = 0;
+    int high = (int)font->count - 1;
+    int mid;
+    
+    if (font->index == NULL) {
+        if (code >= font->first && code < (uint32_t)font->first + font->count) {
+            return (int)(code - font->first);
+        }
+        return -1;
+    }
+    
+    while (low <= high) {
+        mid = (low + high) / 2;
+        if (font->index[mid] == code) {
+            return mid;
+        } else if (font->index[mid] < code) {
+            low = mid + 1;
+        } else {
+            high = mid - 1;
+        }
+    }
+    
+    return -1;
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_font_glyph
+ * 说    明: 按字号和Unicode码点查找字模
+ * 参    数:
+ *       @code：Unicode码点
+ *       @sizey：字号
+ *       @width：返回字模宽度
+ *       @scaled：返回字模是否需要由母版缩小生成
+ * 返 回 值: 找到返回字模数据，由母版缩小的字体返回母版字模，否则返回NULL
+ ***************************************************************/
+static const uint8_t *lcd_font_glyph(uint32_t code, uint8_t sizey, uint8_t *width, uint8_t *scaled)
+{
+    const lcd_font_t *font;
+    uint32_t i;
+    int k;
+    
+    for (i = 0; i < lcd_fonts_num; i++) {
+        font = &lcd_fonts[i];
+        if (font->height != sizey) {
+            continue;
+        }
+        k = lcd_font_find(font, code);
+        if (k >= 0) {
+            *width = font->width;
+            *scaled = (font->data == NULL);
+            if (*scaled) {
+                return ascii_aa_3216[k];
+            }
+            return font->data + (uint32_t)k * ((font->width + BYTE_TO_BITS - 1) / BYTE_TO_BITS) * font->height;
+        }
+    }
+    
+    return NULL;
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_utf8_next
+ * 说    明: 从UTF-8字符串中解码一个Unicode码点并移动字符串指针，
+ *           非法的字节序列解码为U+FFFD，每次只跳过一个字节
+ * 参    数:
+ *       @s：字符串指针的地址
+ * 返 回 值: Unicode码点，字符串结束返回0
+ ***************************************************************/
+uint32_t lcd_utf8_next(const uint8_t **s)
+{
+#define UTF8_REPLACEMENT        0xFFFD
+    const uint8_t *p = *s;
+    uint32_t code;
+    uint8_t i, follow;
+    
+    if (p[0] == '\0') {
+        return 0;
+    }
+    
+    if (p[0] < 0x80) {
+        *s = p + 1;
+        return p[0];
+    } else if ((p[0] & 0xE0) == 0xC0) {
+        code = p[0] & 0x1F;
+        follow = 1;
+    } else if ((p[0] & 0xF0) == 0xE0) {
+        code = p[0] & 0x0F;
+        follow = 2;
+    } else if ((p[0] & 0xF8) == 0xF0) {
+        code = p[0] & 0x07;
+        follow = 3;
+    } else {
+        *s = p + 1;
+        return UTF8_REPLACEMENT;
+    }
+    
+    for (i = 1; i <= follow; i++) {
+        /* 遇到字符串结束或非后续字节时，不吞掉该字节 */
+        if ((p[i] & 0xC0) != 0x80) {
+            *s = p + 1;
+            return UTF8_REPLACEMENT;
+        }
+        code = (code << 6) | (p[i] & 0x3F);
+    }
+    
+    *s = p + 1 + follow;
+    return code;
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_draw_mask_clipped
+ * 说    明: 显示超出屏幕右边或下边的1bpp点阵，只发送屏幕内的部分。
+ *           非叠加方式用一个裁剪后的窗口逐像素写入，叠加方式每行
+ *           连续置位的点画一条水平线段，都与其他图形一样经过显存
+ * 参    数:
+ *       @x/y：点阵的起始位置，在屏幕内
+ *       @w/h：点阵的宽度和高度
+ *       @mask：点阵数据
+ *       @fc: 字的颜色
+ *       @bc: 字的背景色
+ *       @mode: 0为非叠加模式；1为叠加模式
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_draw_mask_clipped(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+    const uint8_t *mask, uint16_t fc, uint16_t bc, uint8_t mode)
+{
+    uint16_t stride = (w + BYTE_TO_BITS - 1) / BYTE_TO_BITS;
+    uint16_t vw = MIN(w, m_width - x);
+    uint16_t vh = MIN(h, m_height - y);
+    uint16_t i, j, start;
+    const uint8_t *row;
+    
+    if (!mode) {
+        lcd_window_begin(x, y, x + vw - 1, y + vh - 1);
+        for (i = 0; i < vh; i++) {
+            row = &mask[i * stride];
+            for (j = 0; j < vw; j++) {
+                lcd_window_push((row[j / BYTE_TO_BITS] & (0x01 << (j % BYTE_TO_BITS))) ? fc : bc);
+            }
+        }
+        lcd_window_end();
+        return;
+    }
+    
+    for (i = 0; i < vh; i++) {
+        row = &mask[i * stride];
+        j = 0;
+        while (j < vw) {
+            if (!(row[j / BYTE_TO_BITS] & (0x01 << (j % BYTE_TO_BITS)))) {
+                j++;
+                continue;
+            }
+            start = j;
+            while (j < vw && (row[j / BYTE_TO_BITS] & (0x01 << (j % BYTE_TO_BITS)))) {
+                j++;
+            }
+            lcd_draw_span(x + start, y + i, x + j - 1, y + i, fc);
+        }
+    }
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_draw_glyph
+ * 说    明: 显示一个Unicode字符，字库中没有的字符非叠加模式下显示为
+ *           背景色
+ * 参    数:
+ *       @x：指定字符的起始位置X坐标
+ *       @y：指定字符的起始位置Y坐标
+ *       @code：Unicode码点
+ *       @fc: 字的颜色
+ *       @bc: 字的背景色
+ *       @sizey: 字号，可选：12、16、24、32
+ *       @mode: 0为非叠加模式；1为叠加模式
+ * 返 回 值: 字符宽度
+ ***************************************************************/
+static uint8_t lcd_draw_glyph(uint16_t x,
+    uint16_t y,
+    uint32_t code,
+    uint16_t fc,
+    uint16_t bc,
+    uint8_t sizey,
+    uint8_t mode)
+{
+    const uint8_t *mask;
+    uint8_t width = 0;
+    uint8_t scaled = 0;
+    
+    mask = lcd_font_glyph(code, sizey, &width, &scaled);
+    if (mask == NULL) {
+        /* ASCII字符宽度为字号的一半，其余字符与字号相同 */
+        width = (code < 0x80) ? (sizey / 2) : sizey;
+        if (!mode) {
+            lcd_fill(x, y, x + width, y + sizey, bc);
+        }
+        return width;
+    }
+    
+    if (x >= m_width || y >= m_height) {
+        return width;
+    }
+    if (x + width > m_width || y + sizey > m_height) {
+        /* 超出屏幕右边或下边时只显示屏幕内的部分，显存与屏幕保持一致 */
+        if (scaled) {
+            mask = lcd_font_scaled_mask(mask, width, sizey);
+        }
+        lcd_draw_mask_clipped(x, y, width, sizey, mask, fc, bc, mode);
+        return width;
+    }
+    
+    if (!mode) {
+        /* 非叠加方式 */
+        lcd_draw_mask(x, y, width, sizey, mask, scaled, fc, bc);
+    } else {
+        /* 叠加方式，不经过字模缓存，缩小的点阵只在未命中时生成 */
+        if (scaled) {
+            mask = lcd_font_scaled_mask(mask, width, sizey);
+        }
+        lcd_draw_mask_overlay(x, y, width, sizey, mask, fc);
+    }
+    
+    return width;
+}
+
+
+/* 判断是否为支持的字号 */
+static int lcd_font_size_valid(uint8_t sizey)
+{
+    return (sizey == LCD_FONT_SIZE12 || sizey == LCD_FONT_SIZE16 ||
+        sizey == LCD_FONT_SIZE24 || sizey == LCD_FONT_SIZE32);
+}
+
+/***************************************************************
+ * 函数名称: lcd_init
+ * 说    明: Lcd初始化
+ * 参    数: 无
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+unsigned int lcd_init(void)
+{
+    unsigned int delay_msec = 100;
+    unsigned int long_delay_msec = 500;
+    
+#if LCD_ENABLE_SPI
+    LzSpiDeinit(LCD_SPI_BUS);
+    
+    if (SpiIoInit(m_spiBus) != LZ_HARDWARE_SUCCESS) {
+        printf("%s, %d: SpiIoInit failed!\n", __FILE__, __LINE__);
+        return __LINE__;
+    }
+    if (LzSpiInit(LCD_SPI_BUS, m_spiConf) != LZ_HARDWARE_SUCCESS) {
+        printf("%s, %d: LzSpiInit failed!\n", __FILE__, __LINE__);
+        return __LINE__;
+    }
+#else
+    /* 初始化GPIO0_C0 */
+    LzGpioInit(LCD_PIN_CS);
+    LzGpioSetDir(LCD_PIN_CS, LZGPIO_DIR_OUT);
+    LzGpioSetVal(LCD_PIN_CS, LZGPIO_LEVEL_HIGH);
+    /* 初始化GPIO0_C1 */
+    LzGpioInit(LCD_PIN_CLK);
+    LzGpioSetDir(LCD_PIN_CLK, LZGPIO_DIR_OUT);
+    LzGpioSetVal(LCD_PIN_CLK, LZGPIO_LEVEL_LOW);
+    /* 初始化GPIO0_C2 */
+    LzGpioInit(LCD_PIN_MOSI);
+    LzGpioSetDir(LCD_PIN_MOSI, LZGPIO_DIR_OUT);
+    LzGpioSetVal(LCD_PIN_MOSI, LZGPIO_LEVEL_LOW);
+#endif
+    /* 初始化GPIO0_C3 */
+    LzGpioInit(LCD_PIN_RES);
+    LzGpioSetDir(LCD_PIN_RES, LZGPIO_DIR_OUT);
     LzGpioSetVal(LCD_PIN_RES, LZGPIO_LEVEL_HIGH);
     
     /* 初始化GPIO0_C6 */
     LzGpioInit(LCD_PIN_DC);
     LzGpioSetDir(LCD_PIN_DC, LZGPIO_DIR_OUT);
     LzGpioSetVal(LCD_PIN_DC, LZGPIO_LEVEL_LOW);
+#if !LCD_ENABLE_SPI && LCD_GPIO_FAST
+    if (lcd_gpio_fast_init() != 0) {
+        return __LINE__;
+    }
+#endif
     
     /* 重启lcd */
     LCD_RES_Clr();
@@ -527,16 +1291,8 @@ unsigned int lcd_init(void)
     /* 等待LCD 100ms */
     LOS_Msleep(delay_msec);
     /* 启动LCD配置，设置显示和颜色配置 */
-    lcd_wr_reg(0X36);
-    if (USE_HORIZONTAL == 0) {
-        lcd_wr_data8(0x00);
-    } else if (USE_HORIZONTAL == LCD_HORIZONTAL_MODE1) {
-        lcd_wr_data8(0xC0);
-    } else if (USE_HORIZONTAL == LCD_HORIZONTAL_MODE2) {
-        lcd_wr_data8(0x70);
-    } else {
-        lcd_wr_data8(0xA0);
-    }
+    lcd_wr_reg(REG_MEMORY_ACCESS);
+    lcd_wr_data8(m_madctl[m_rotation]);
     lcd_wr_reg(0X3A);
     lcd_wr_data8(0X05);
     /* ST7789S帧刷屏率设置 */
@@ -603,6 +1359,12 @@ unsigned int lcd_init(void)
     lcd_wr_data8(0x20);
     lcd_wr_reg(0x29);
     
+#if LCD_ASYNC_FLUSH
+    if (lcd_flush_task_init() != 0) {
+        return __LINE__;
+    }
+#endif
+    
     return 0;
 }
 
@@ -642,16 +1404,18 @@ unsigned int lcd_deinit(void)
  ***************************************************************/
 void lcd_fill(uint16_t xsta, uint16_t ysta, uint16_t xend, uint16_t yend, uint16_t color)
 {
-    uint16_t i, j;
+    /* 超出屏幕的部分被裁剪 */
+    xend = MIN(xend, m_width);
+    yend = MIN(yend, m_height);
+    if (xend <= xsta || yend <= ysta) {
+        return;
+    }
     
     /* 设置显示范围 */
-    lcd_address_set(xsta, ysta, xend - 1, yend - 1);
+    lcd_window_begin(xsta, ysta, xend - 1, yend - 1);
     /* 填充颜色 */
-    for (i = ysta; i < yend; i++) {
-        for (j = xsta; j < xend; j++) {
-            lcd_wr_data(color);
-        }
-    }
+    lcd_window_fill(color, (uint32_t)(xend - xsta) * (yend - ysta));
+    lcd_window_end();
 }
 
 
@@ -666,9 +1430,38 @@ void lcd_fill(uint16_t xsta, uint16_t ysta, uint16_t xend, uint16_t yend, uint16
  ***************************************************************/
 void lcd_draw_point(uint16_t x, uint16_t y, uint16_t color)
 {
+    if (x >= m_width || y >= m_height) {
+        return;
+    }
     /* 设置光标位置 */
-    lcd_address_set(x, y, x, y);
-    lcd_wr_data(color);
+    lcd_window_begin(x, y, x, y);
+    lcd_window_push(color);
+    lcd_window_end();
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_draw_span
+ * 说    明: 用一个地址窗口填充一段水平或垂直的线段，超出屏幕的
+ *           部分被裁剪
+ * 参    数:
+ *       @x1/y1/x2/y2：线段范围(含边界，x1 <= x2，y1 <= y2)
+ *       @color：线段的颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_draw_span(int x1, int y1, int x2, int y2, uint16_t color)
+{
+    if (x2 < 0 || y2 < 0 || x1 >= m_width || y1 >= m_height) {
+        return;
+    }
+    x1 = (x1 < 0) ? 0 : x1;
+    y1 = (y1 < 0) ? 0 : y1;
+    x2 = (x2 >= m_width) ? (m_width - 1) : x2;
+    y2 = (y2 >= m_height) ? (m_height - 1) : y2;
+    
+    lcd_window_begin(x1, y1, x2, y2);
+    lcd_window_fill(color, (uint32_t)(x2 - x1 + 1) * (y2 - y1 + 1));
+    lcd_window_end();
 }
 
 
@@ -688,6 +1481,8 @@ void lcd_draw_line(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t
     uint16_t t;
     int xerr = 0, yerr = 0, delta_x, delta_y, distance;
     int incx, incy, uRow, uCol;
+    /* 当前水平或垂直线段的起点和终点 */
+    int run_x1, run_y1, run_x2, run_y2;
     
     /* 计算坐标增量 */
     delta_x = x2 - x1;
@@ -724,9 +1519,22 @@ void lcd_draw_line(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t
         distance = delta_y;
     }
     
+    run_x1 = run_x2 = uRow;
+    run_y1 = run_y2 = uCol;
     for (t = 0; t < distance + 1; t++) {
-        /* 画点 */
-        lcd_draw_point(uRow, uCol, color);
+        /* 同一行或同一列上连续的点合并为一段，每段只设置一次窗口 */
+        if (uRow == run_x2 && uCol == run_y2) {
+            /* 重复的点 */
+        } else if (uCol == run_y2 && run_y1 == run_y2) {
+            run_x2 = uRow;
+        } else if (uRow == run_x2 && run_x1 == run_x2) {
+            run_y2 = uCol;
+        } else {
+            lcd_draw_span(MIN(run_x1, run_x2), MIN(run_y1, run_y2),
+                          MAX(run_x1, run_x2), MAX(run_y1, run_y2), color);
+            run_x1 = run_x2 = uRow;
+            run_y1 = run_y2 = uCol;
+        }
         xerr += delta_x;
         yerr += delta_y;
         if (xerr > distance) {
@@ -738,12 +1546,14 @@ void lcd_draw_line(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t
             uCol += incy;
         }
     }
+    lcd_draw_span(MIN(run_x1, run_x2), MIN(run_y1, run_y2),
+                  MAX(run_x1, run_x2), MAX(run_y1, run_y2), color);
 }
 
 
 /***************************************************************
  * 函数名称: lcd_draw_rectangle
- * 说    明: 指定位置画矩形
+ * 说    明: 指定位置画矩形，四条边各用一个地址窗口填充
  * 参    数:
  *       @x1：指定矩形的起始点X坐标
  *       @y1：指定矩形的起始点Y坐标
@@ -754,40 +1564,89 @@ void lcd_draw_line(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t
  ***************************************************************/
 void lcd_draw_rectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color)
 {
-    lcd_draw_line(x1, y1, x2, y1, color);
-    lcd_draw_line(x1, y1, x1, y2, color);
-    lcd_draw_line(x1, y2, x2, y2, color);
-    lcd_draw_line(x2, y1, x2, y2, color);
+    int left = MIN(x1, x2);
+    int right = MAX(x1, x2);
+    int top = MIN(y1, y2);
+    int bottom = MAX(y1, y2);
+    
+    lcd_draw_span(left, top, right, top, color);
+    if (bottom > top) {
+        lcd_draw_span(left, bottom, right, bottom, color);
+    }
+    if (bottom - top > 1) {
+        lcd_draw_span(left, top + 1, left, bottom - 1, color);
+        if (right > left) {
+            lcd_draw_span(right, top + 1, right, bottom - 1, color);
+        }
+    }
 }
 
 
 /***************************************************************
- * 函数名称: lcd_draw_circle
- * 说    明: 指定位置画圆
+ * 函数名称: lcd_fill_rect_outline
+ * 说    明: 指定位置画带边框的实心矩形
  * 参    数:
- *       @x0：指定圆的中心点X坐标
- *       @y0：指定圆的中心点Y坐标
- *       @r：指定圆的半径
- *       @color：指定点的颜色
+ *       @x1：指定矩形的起始点X坐标
+ *       @y1：指定矩形的起始点Y坐标
+ *       @x2：指定矩形的结束点X坐标
+ *       @y2：指定矩形的结束点Y坐标
+ *       @fill_color：矩形内部的颜色
+ *       @line_color：矩形边框的颜色
  * 返 回 值: 无
  ***************************************************************/
-void lcd_draw_circle(uint16_t x0, uint16_t y0, uint8_t r, uint16_t color)
+void lcd_fill_rect_outline(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2,
+                           uint16_t fill_color, uint16_t line_color)
 {
-    int a, b;
+    int left = MIN(x1, x2);
+    int right = MAX(x1, x2);
+    int top = MIN(y1, y2);
+    int bottom = MAX(y1, y2);
+    
+    lcd_draw_rectangle(x1, y1, x2, y2, line_color);
+    if (right - left > 1 && bottom - top > 1) {
+        lcd_draw_span(left + 1, top + 1, right - 1, bottom - 1, fill_color);
+    }
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_draw_circle
+ * 说    明: 指定位置画圆。同一个b值对应的点在相邻的行(列)上连续，
+ *           按八个对称方向各用一个地址窗口填充
+ * 参    数:
+ *       @x0：指定圆的中心点X坐标
+ *       @y0：指定圆的中心点Y坐标
+ *       @r：指定圆的半径
+ *       @color：指定点的颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_draw_circle(uint16_t x0, uint16_t y0, uint8_t r, uint16_t color)
+{
+    int a, b;
+    int a_start, a_end;
     
     a = 0;
     b = r;
     
     while (a <= b) {
-        lcd_draw_point(x0 - b, y0 - a, color);
-        lcd_draw_point(x0 + b, y0 - a, color);
-        lcd_draw_point(x0 - a, y0 + b, color);
-        lcd_draw_point(x0 - a, y0 - b, color);
-        lcd_draw_point(x0 + b, y0 + a, color);
-        lcd_draw_point(x0 + a, y0 - b, color);
-        lcd_draw_point(x0 + a, y0 + b, color);
-        lcd_draw_point(x0 - b, y0 + a, color);
-        a++;
+        /* 找出b值相同的一组点[a_start, a_end] */
+        a_start = a;
+        do {
+            a++;
+        } while (a <= b && (a * a + b * b) <= (r * r));
+        a_end = a - 1;
+        
+        /* 靠近水平方向的四段圆弧 */
+        lcd_draw_span(x0 + a_start, y0 + b, x0 + a_end, y0 + b, color);
+        lcd_draw_span(x0 - a_end, y0 + b, x0 - a_start, y0 + b, color);
+        lcd_draw_span(x0 + a_start, y0 - b, x0 + a_end, y0 - b, color);
+        lcd_draw_span(x0 - a_end, y0 - b, x0 - a_start, y0 - b, color);
+        /* 靠近垂直方向的四段圆弧 */
+        lcd_draw_span(x0 + b, y0 + a_start, x0 + b, y0 + a_end, color);
+        lcd_draw_span(x0 + b, y0 - a_end, x0 + b, y0 - a_start, color);
+        lcd_draw_span(x0 - b, y0 + a_start, x0 - b, y0 + a_end, color);
+        lcd_draw_span(x0 - b, y0 - a_end, x0 - b, y0 - a_start, color);
+        
         /* 判断要画的点是否过远 */
         if ((a * a + b * b) > (r * r)) {
             b--;
@@ -796,6 +1655,53 @@ void lcd_draw_circle(uint16_t x0, uint16_t y0, uint8_t r, uint16_t color)
 }
 
 
+/***************************************************************
+ * 函数名称: lcd_fill_circle
+ * 说    明: 指定位置画实心圆，轮廓与lcd_draw_circle一致，
+ *           每一行用一个地址窗口填充
+ * 参    数:
+ *       @x0：指定圆的中心点X坐标
+ *       @y0：指定圆的中心点Y坐标
+ *       @r：指定圆的半径
+ *       @color：指定圆的颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_fill_circle(uint16_t x0, uint16_t y0, uint8_t r, uint16_t color)
+{
+    int a, b;
+    int a_start, a_end;
+    int i;
+    
+    a = 0;
+    b = r;
+    
+    while (a <= b) {
+        a_start = a;
+        do {
+            a++;
+        } while (a <= b && (a * a + b * b) <= (r * r));
+        a_end = a - 1;
+        
+        /* 距圆心a_start~a_end行的宽度为2b + 1 */
+        for (i = a_start; i <= a_end; i++) {
+            lcd_draw_span(x0 - b, y0 + i, x0 + b, y0 + i, color);
+            if (i != 0) {
+                lcd_draw_span(x0 - b, y0 - i, x0 + b, y0 - i, color);
+            }
+        }
+        /* 距圆心b行的宽度为2a_end + 1，b等于a_end时该行已在上面填充 */
+        if (b > a_end) {
+            lcd_draw_span(x0 - a_end, y0 + b, x0 + a_end, y0 + b, color);
+            lcd_draw_span(x0 - a_end, y0 - b, x0 + a_end, y0 - b, color);
+        }
+        
+        if ((a * a + b * b) > (r * r)) {
+            b--;
+        }
+    }
+}
+
+
 /***************************************************************
  * 函数名称: lcd_show_chinese
  * 说    明: 显示汉字串
@@ -811,26 +1717,40 @@ void lcd_draw_circle(uint16_t x0, uint16_t y0, uint8_t r, uint16_t color)
  ***************************************************************/
 void lcd_show_chinese(uint16_t x, uint16_t y, uint8_t *s, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode)
 {
-    uint8_t buffer[128];
-    uint32_t buffer_len = 0;
-    uint32_t len = strlen(s);
-    
-    memset(buffer, 0, sizeof(buffer));
-    /* utf8格式汉字转化为ascii格式 */
-    chinese_utf8_to_ascii(s, strlen(s), buffer, &buffer_len);
-    
-    for (uint32_t i = 0; i < buffer_len; i += CHINESE_TO_BYTES, x += sizey) {
-        if (sizey == LCD_FONT_SIZE12) {
-            lcd_show_chinese_12x12(x, y, &buffer[i], fc, bc, sizey, mode);
-        } else if (sizey == LCD_FONT_SIZE16) {
-            lcd_show_chinese_16x16(x, y, &buffer[i], fc, bc, sizey, mode);
-        } else if (sizey == LCD_FONT_SIZE24) {
-            lcd_show_chinese_24x24(x, y, &buffer[i], fc, bc, sizey, mode);
-        } else if (sizey == LCD_FONT_SIZE32) {
-            lcd_show_chinese_32x32(x, y, &buffer[i], fc, bc, sizey, mode);
-        } else {
-            return;
+    lcd_draw_text(x, y, s, fc, bc, sizey, mode);
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_draw_text
+ * 说    明: 显示UTF-8字符串，ASCII字符和汉字可以混合显示，
+ *           遇到'\n'时换到下一行的起始X坐标
+ * 参    数:
+ *       @x：指定字符串的起始位置X坐标
+ *       @y：指定字符串的起始位置Y坐标
+ *       @s：指定字符串（utf-8编码）
+ *       @fc: 字的颜色
+ *       @bc: 字的背景色
+ *       @sizey: 字号，可选：12、16、24、32
+ *       @mode: 0为非叠加模式；1为叠加模式
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_draw_text(uint16_t x, uint16_t y, const uint8_t *s, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode)
+{
+    uint16_t x0 = x;
+    uint32_t code;
+    
+    if (!lcd_font_size_valid(sizey)) {
+        return;
+    }
+    
+    while ((code = lcd_utf8_next(&s)) != 0) {
+        if (code == '\n') {
+            x = x0;
+            y += sizey;
+            continue;
         }
+        x += lcd_draw_glyph(x, y, code, fc, bc, sizey, mode);
     }
 }
 
@@ -850,67 +1770,11 @@ void lcd_show_chinese(uint16_t x, uint16_t y, uint8_t *s, uint16_t fc, uint16_t
  ***************************************************************/
 void lcd_show_char(uint16_t x, uint16_t y, uint8_t num, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode)
 {
-    uint8_t temp, sizex, t, m = 0;
-    uint16_t i;
-    uint16_t TypefaceNum; /* 一个字符所占字节大小 */
-    uint16_t x0 = x;
-    uint16_t size_y2x = 2;
-    
-    sizex = sizey / size_y2x;
-    TypefaceNum = (sizex / BYTE_TO_BITS + ((sizex % BYTE_TO_BITS) ? 1 : 0)) * sizey;
-    
-    /* 得到偏移后的值 */
-    num = num - ' ';
-    /* 设置光标位置 */
-    lcd_address_set(x, y, x + sizex - 1, y + sizey - 1);
-    
-    for (i = 0; i < TypefaceNum; i++) {
-        if (sizey == LCD_FONT_SIZE12) {
-            /* 调用6x12字体 */
-            temp = ascii_1206[num][i];
-        } else if (sizey == LCD_FONT_SIZE16) {
-            /* 调用8x16字体 */
-            temp = ascii_1608[num][i];
-        } else if (sizey == LCD_FONT_SIZE24) {
-            /* 调用12x24字体 */
-            temp = ascii_2412[num][i];
-        } else if (sizey == LCD_FONT_SIZE32) {
-            /* 调用16x32字体 */
-            temp = ascii_3216[num][i];
-        } else {
-            return;
-        }
-        
-        for (t = 0; t < BYTE_TO_BITS; t++) {
-            if (!mode) {
-                /* 非叠加模式 */
-                if (temp & (0x01 << t)) {
-                    lcd_wr_data(fc);
-                } else {
-                    lcd_wr_data(bc);
-                }
-                
-                m++;
-                if (m % sizex == 0) {
-                    m = 0;
-                    break;
-                }
-            } else {
-                /* 叠加模式 */
-                if (temp & (0x01 << t)) {
-                    /* 画一个点 */
-                    lcd_draw_point(x, y, fc);
-                }
-                
-                x++;
-                if ((x - x0) == sizex) {
-                    x = x0;
-                    y++;
-                    break;
-                }
-            }
-        }
+    if (!lcd_font_size_valid(sizey)) {
+        return;
     }
+    
+    lcd_draw_glyph(x, y, num, fc, bc, sizey, mode);
 }
 
 
@@ -929,12 +1793,7 @@ void lcd_show_char(uint16_t x, uint16_t y, uint8_t num, uint16_t fc, uint16_t bc
  ***************************************************************/
 void lcd_show_string(uint16_t x, uint16_t y, const uint8_t *p, uint16_t fc, uint16_t bc, uint8_t sizey, uint8_t mode)
 {
-#define X_OFFSET(sizey)         ((sizey) / 2) /* 根据字体大小偏移X轴坐标 */
-    while (*p != '\0') {
-        lcd_show_char(x, y, *p, fc, bc, sizey, mode);
-        x += X_OFFSET(sizey);
-        p++;
-    }
+    lcd_draw_text(x, y, p, fc, bc, sizey, mode);
 }
 
 
@@ -952,24 +1811,16 @@ void lcd_show_string(uint16_t x, uint16_t y, const uint8_t *p, uint16_t fc, uint
  ***************************************************************/
 void lcd_show_int_num(uint16_t x, uint16_t y, uint16_t num, uint8_t len, uint16_t fc, uint16_t bc, uint8_t sizey)
 {
-    uint8_t base = 48; /* ASCII字符'0' */
-    uint8_t power_base = 10;
-    uint8_t power_remainder = 10;
-    uint8_t t, temp;
-    uint8_t enshow = 0;
+    uint8_t cells[LCD_NUM_MAX_LEN + 1];
     uint8_t sizex = sizey / 2;
+    uint8_t t, count;
     
-    for (t = 0; t < len; t++) {
-        temp = (num / mypow(power_base, len - t - 1)) % power_remainder;
-        if (enshow == 0 && t < (len - 1)) {
-            if (temp == 0) {
-                lcd_show_char(x + t * sizex, y, ' ', fc, bc, sizey, 0);
-                continue;
-            } else {
-                enshow = 1;
-            }
-        }
-        lcd_show_char(x + t * sizex, y, temp + base, fc, bc, sizey, 0);
+    if (len > LCD_NUM_MAX_LEN) {
+        len = LCD_NUM_MAX_LEN;
+    }
+    count = lcd_num_format(cells, num, len, 0, 1);
+    for (t = 0; t < count; t++) {
+        lcd_show_char(x + t * sizex, y, cells[t], fc, bc, sizey, 0);
     }
 }
 
@@ -991,26 +1842,24 @@ void lcd_show_float_num1(uint16_t x, uint16_t y, float num, uint8_t len, uint16_
 #define X_OFFSET(sizey)         ((sizey) / 2)   /* 根据字体大小偏移X坐标移动点数 */
 #define FLOAT_TO_INT(num)       ((num) * 100)   /* 将float数值转化为int数值 */
 #define DECIMAL_TOW             2               /* 保留小数点后2个数值 */
-#define CHAR_0                  ((uint8_t)('0'))
-    uint8_t t, temp, sizex;
+    uint8_t cells[LCD_NUM_MAX_LEN + 1];
+    uint8_t t, count, sizex;
     uint16_t num1;
     
+    if (len > LCD_NUM_MAX_LEN) {
+        len = LCD_NUM_MAX_LEN;
+    }
     sizex = X_OFFSET(sizey);
     num1 = FLOAT_TO_INT(num);
-    for (t = 0; t < len; t++) {
-        temp = (num1 / mypow(10, len - t - 1)) % 10;
-        if (t == (len - DECIMAL_TOW)) {
-            lcd_show_char(x + (len - DECIMAL_TOW)*sizex, y, '.', fc, bc, sizey, 0);
-            t++;
-            len += 1;
-        }
-        lcd_show_char(x + t * sizex, y, temp + CHAR_0, fc, bc, sizey, 0);
+    count = lcd_num_format(cells, num1, len, DECIMAL_TOW, 0);
+    for (t = 0; t < count; t++) {
+        lcd_show_char(x + t * sizex, y, cells[t], fc, bc, sizey, 0);
     }
 }
 
 /***************************************************************
  * 函数名称: lcd_show_picture
- * 说    明: 显示图片
+ * 说    明: 显示图片，超出屏幕的部分被裁剪
  * 参    数:
  *       @x：指定图片的起始位置X坐标
  *       @y：指定图片的起始位置X坐标
@@ -1021,16 +1870,472 @@ void lcd_show_float_num1(uint16_t x, uint16_t y, float num, uint8_t len, uint16_
  ***************************************************************/
 void lcd_show_picture(uint16_t x, uint16_t y, uint16_t length, uint16_t width, const uint8_t *pic)
 {
-    uint16_t i, j;
-    uint32_t k = 0;
-    uint32_t unit = 2;
-    
-    lcd_address_set(x, y, x + length - 1, y + width - 1);
-    for (i = 0; i < length; i++) {
-        for (j = 0; j < width; j++) {
-            lcd_wr_data8(pic[k * unit]);
-            lcd_wr_data8(pic[k * unit + 1]);
-            k++;
+    lcd_bitmap_t bitmap = {length, width, 0, 0, pic};
+
+    if (x >= m_width || y >= m_height || length == 0 || width == 0) {
+        return;
+    }
+    lcd_blit((int16_t)x, (int16_t)y, &bitmap, 0, 0, length, width, 0, 0);
+}
+
+
+#if LCD_FB_LINES
+/***************************************************************
+ * 函数名称: lcd_fb_write_rects
+ * 说    明: 将显存中的矩形发送到LCD，每个矩形只设置一次窗口
+ * 参    数:
+ *       @fb：显存
+ *       @fb_y0：显存覆盖的起始行
+ *       @rects：矩形列表
+ *       @num：矩形数目
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_fb_write_rects(const uint8_t *fb, uint16_t fb_y0, const lcd_rect_t *rects, uint8_t num)
+{
+    uint8_t i;
+    uint16_t y;
+    uint32_t offset, width;
+    const lcd_rect_t *r;
+
+    for (i = 0; i < num; i++) {
+        r = &rects[i];
+        width = r->x2 - r->x1 + 1;
+        lcd_address_set(r->x1, r->y1, r->x2, r->y2);
+        if (width == m_width) {
+            /* 整行宽度的矩形在显存中连续存放，一次发送 */
+            offset = (uint32_t)(r->y1 - fb_y0) * m_width * 2;
+            lcd_write_buf(&fb[offset], width * (r->y2 - r->y1 + 1) * 2);
+            continue;
+        }
+        for (y = r->y1; y <= r->y2; y++) {
+            offset = ((uint32_t)(y - fb_y0) * m_width + r->x1) * 2;
+            lcd_write_buf(&fb[offset], width * 2);
         }
     }
 }
+#endif
+
+
+/***************************************************************
+ * 函数名称: lcd_flush
+ * 说    明: 将显存中的脏矩形刷新到LCD，每个脏矩形只设置一次窗口
+ *           未启用显存(LCD_FB_LINES为0)时不做任何操作；启用异步刷新
+ *           时交给刷新任务发送并等待完成
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_flush(void)
+{
+#if LCD_ASYNC_FLUSH
+    lcd_flush_async();
+    lcd_flush_wait(LOS_WAIT_FOREVER);
+#elif LCD_FB_LINES
+    lcd_fb_write_rects(m_fb, m_fb_y0, m_dirty, m_dirty_num);
+    m_dirty_num = 0;
+#endif
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_flush_async
+ * 说    明: 将当前显存交给刷新任务发送，然后切换到另一块显存继续
+ *           绘制。上一次提交的显存还未发送完时先等待。
+ *           未启用异步刷新时等同于lcd_flush
+ * 参    数: 无
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+unsigned int lcd_flush_async(void)
+{
+#if LCD_ASYNC_FLUSH
+    uint8_t *next;
+    const lcd_rect_t *r;
+    uint32_t offset;
+    uint16_t y;
+    uint8_t i;
+
+    if (m_dirty_num == 0) {
+        return 0;
+    }
+    if (LOS_EventRead(&m_flush_event, LCD_EVENT_FLUSH_IDLE,
+        LOS_WAITMODE_AND | LOS_WAITMODE_CLR, LOS_WAIT_FOREVER) != LCD_EVENT_FLUSH_IDLE) {
+        printf("%s, %d: LOS_EventRead failed!\n", __FILE__, __LINE__);
+        return __LINE__;
+    }
+
+    m_flush_job.fb = m_fb;
+    m_flush_job.fb_y0 = m_fb_y0;
+    m_flush_job.dirty_num = m_dirty_num;
+    memcpy(m_flush_job.dirty, m_dirty, sizeof(lcd_rect_t) * m_dirty_num);
+
+    /* 把脏矩形复制到另一块显存，保证切换后两块显存内容一致 */
+    next = (m_fb == m_fb_buf[0]) ? m_fb_buf[1] : m_fb_buf[0];
+    for (i = 0; i < m_dirty_num; i++) {
+        r = &m_dirty[i];
+        for (y = r->y1; y <= r->y2; y++) {
+            offset = ((uint32_t)(y - m_fb_y0) * m_width + r->x1) * 2;
+            memcpy(&next[offset], &m_fb[offset], (r->x2 - r->x1 + 1) * 2);
+        }
+    }
+    m_fb = next;
+    m_dirty_num = 0;
+
+    LOS_SemPost(m_flush_sem);
+    return 0;
+#else
+    lcd_flush();
+    return 0;
+#endif
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_flush_wait
+ * 说    明: 等待已提交的显存发送完成
+ * 参    数:
+ *       @timeout：最长等待的tick数，LOS_WAIT_FOREVER为一直等待
+ * 返 回 值: 返回0为发送完成，反之为超时或失败
+ ***************************************************************/
+unsigned int lcd_flush_wait(uint32_t timeout)
+{
+#if LCD_ASYNC_FLUSH
+    if (LOS_EventRead(&m_flush_event, LCD_EVENT_FLUSH_IDLE,
+        LOS_WAITMODE_AND, timeout) != LCD_EVENT_FLUSH_IDLE) {
+        return __LINE__;
+    }
+#else
+    (void)timeout;
+#endif
+    return 0;
+}
+
+
+#if LCD_ASYNC_FLUSH
+/***************************************************************
+ * 函数名称: lcd_flush_task
+ * 说    明: LCD刷新任务，发送lcd_flush_async提交的显存
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_flush_task(void)
+{
+    while (1) {
+        LOS_SemPend(m_flush_sem, LOS_WAIT_FOREVER);
+        LCD_BUS_LOCK();
+        lcd_fb_write_rects(m_flush_job.fb, m_flush_job.fb_y0, m_flush_job.dirty, m_flush_job.dirty_num);
+        LCD_BUS_UNLOCK();
+        LOS_EventWrite(&m_flush_event, LCD_EVENT_FLUSH_IDLE);
+    }
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_flush_task_init
+ * 说    明: 创建刷新任务及其使用的互斥锁、信号量和事件
+ * 参    数: 无
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+static unsigned int lcd_flush_task_init(void)
+{
+    TSK_INIT_PARAM_S task = {0};
+
+    if (LOS_MuxCreate(&m_bus_mux) != LOS_OK) {
+        printf("%s, %d: LOS_MuxCreate failed!\n", __FILE__, __LINE__);
+        return __LINE__;
+    }
+    if (LOS_SemCreate(0, &m_flush_sem) != LOS_OK) {
+        printf("%s, %d: LOS_SemCreate failed!\n", __FILE__, __LINE__);
+        return __LINE__;
+    }
+    if (LOS_EventInit(&m_flush_event) != LOS_OK) {
+        printf("%s, %d: LOS_EventInit failed!\n", __FILE__, __LINE__);
+        return __LINE__;
+    }
+    LOS_EventWrite(&m_flush_event, LCD_EVENT_FLUSH_IDLE);
+
+    task.pfnTaskEntry = (TSK_ENTRY_FUNC)lcd_flush_task;
+    task.uwStackSize = LCD_FLUSH_TASK_STACK_SIZE;
+    task.pcName = "lcd_flush_task";
+    task.usTaskPrio = LCD_FLUSH_TASK_PRIO;
+    if (LOS_TaskCreate(&m_flush_task_id, &task) != LOS_OK) {
+        printf("%s, %d: LOS_TaskCreate failed!\n", __FILE__, __LINE__);
+        return __LINE__;
+    }
+    return 0;
+}
+#endif
+
+
+/***************************************************************
+ * 函数名称: lcd_fb_set_band
+ * 说    明: 设置分段显存覆盖的起始行，会先刷新当前显存，
+ *           然后用背景色填充新的显存段并标记为脏
+ * 参    数:
+ *       @y：显存段的起始行
+ *       @bc：显存段的背景色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_fb_set_band(uint16_t y, uint16_t bc)
+{
+#if LCD_FB_LINES
+    lcd_flush();
+
+    if (y > m_height - m_fb_lines) {
+        y = m_height - m_fb_lines;
+    }
+    m_fb_y0 = y;
+    lcd_fill(0, m_fb_y0, m_width, m_fb_y0 + m_fb_lines, bc);
+#else
+    (void)y;
+    (void)bc;
+#endif
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_write_cmd
+ * 说    明: 发送一个命令及其参数
+ * 参    数:
+ *       @cmd：命令
+ *       @param：参数
+ *       @len：参数长度
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_write_cmd(uint8_t cmd, const uint8_t *param, size_t len)
+{
+    LCD_BUS_LOCK();
+    lcd_wr_reg(cmd);
+    lcd_write_buf(param, len);
+    LCD_BUS_UNLOCK();
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_scroll_define
+ * 说    明: 按GRAM行设置滚动区域(VSCRDEF)，并将滚动偏移设为0
+ * 参    数:
+ *       @start：滚动区域在逻辑坐标中的起始位置
+ *       @len：滚动区域的长度
+ *       @reverse：逻辑坐标与GRAM行的顺序是否相反
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_scroll_define(uint16_t start, uint16_t len, uint8_t reverse)
+{
+    uint8_t buf[6];
+    uint16_t bfa;
+    
+    m_scroll_tfa = reverse ? (LCD_GRAM_LINES - start - len) : start;
+    m_scroll_vsa = len;
+    m_scroll_reverse = reverse;
+    bfa = LCD_GRAM_LINES - m_scroll_tfa - m_scroll_vsa;
+    buf[0] = UINT16_TO_H(m_scroll_tfa);
+    buf[1] = UINT16_TO_L(m_scroll_tfa);
+    buf[2] = UINT16_TO_H(m_scroll_vsa);
+    buf[3] = UINT16_TO_L(m_scroll_vsa);
+    buf[4] = UINT16_TO_H(bfa);
+    buf[5] = UINT16_TO_L(bfa);
+    lcd_write_cmd(REG_SCROLL_AREA, buf, sizeof(buf));
+    lcd_scroll_set_start(0);
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_scroll_set_area
+ * 说    明: 设置硬件垂直滚动区域(VSCRDEF)，并将滚动偏移设为0。
+ *           ST7789按GRAM行滚动，横屏时滚动方向为水平方向，不支持
+ * 参    数:
+ *       @y：滚动区域的起始行
+ *       @height：滚动区域的行数
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+unsigned int lcd_scroll_set_area(uint16_t y, uint16_t height)
+{
+    if (m_rotation > LCD_HORIZONTAL_MODE1) {
+        return __LINE__;
+    }
+    if (height == 0 || y + height > m_height) {
+        printf("%s, %d: scroll area(%d, %d) is out of range!\n", __FILE__, __LINE__, y, height);
+        return __LINE__;
+    }
+    
+    /* 旋转180度(MY=1)时逻辑行与GRAM行的顺序相反 */
+    lcd_scroll_define(y, height, m_rotation == LCD_HORIZONTAL_MODE1);
+    return 0;
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_hscroll_set_area
+ * 说    明: 横屏时设置硬件水平滚动区域，并将滚动偏移设为0。横屏时
+ *           GRAM的一行对应屏幕的一列，区域内整列(从顶部到底部)一起
+ *           滚动。滚动偏移同样用lcd_scroll_set_start设置
+ * 参    数:
+ *       @x：滚动区域的起始列
+ *       @width：滚动区域的列数
+ * 返 回 值: 返回0为成功，反之为失败(竖屏时不支持)
+ ***************************************************************/
+unsigned int lcd_hscroll_set_area(uint16_t x, uint16_t width)
+{
+    if (m_rotation <= LCD_HORIZONTAL_MODE1) {
+        return __LINE__;
+    }
+    if (width == 0 || x + width > m_width) {
+        printf("%s, %d: scroll area(%d, %d) is out of range!\n", __FILE__, __LINE__, x, width);
+        return __LINE__;
+    }
+    
+    /* MY=1的横屏模式中逻辑列与GRAM行的顺序相反 */
+    lcd_scroll_define(x, width, m_rotation != LCD_HORIZONTAL_MODE2);
+    return 0;
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_scroll_set_start
+ * 说    明: 设置滚动偏移(VSCSAD)：滚动区域中第offset行显示在区域的顶部，
+ *           之前的行接在区域底部显示。水平滚动时第offset列显示在区域
+ *           的左边
+ * 参    数:
+ *       @offset：滚动偏移，相对于滚动区域的起始行(列)
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_scroll_set_start(uint16_t offset)
+{
+    uint8_t buf[2];
+    uint16_t vsp;
+    
+    if (m_scroll_vsa == 0) {
+        return;
+    }
+    
+    offset %= m_scroll_vsa;
+    if (m_scroll_reverse) {
+        offset = (m_scroll_vsa - offset) % m_scroll_vsa;
+    }
+    vsp = m_scroll_tfa + offset;
+    buf[0] = UINT16_TO_H(vsp);
+    buf[1] = UINT16_TO_L(vsp);
+    lcd_write_cmd(REG_SCROLL_START, buf, sizeof(buf));
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_scroll_reset
+ * 说    明: 退出滚动，恢复正常显示
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_scroll_reset(void)
+{
+    m_scroll_vsa = 0;
+    lcd_write_cmd(REG_NORMAL_MODE, NULL, 0);
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_set_rotation
+ * 说    明: 运行时切换屏幕方向：修改MADCTL并更新LCD_W和LCD_H，然后
+ *           用背景色清屏。坐标变换由LCD控制器完成，所有方向的绘图
+ *           都按窗口写入。切换前先把显存刷新到LCD，并退出硬件滚动；
+ *           显存大小不变，行数按新的宽度重新计算
+ * 参    数:
+ *       @rotation：LCD_ROTATION_PORTRAIT等，与USE_HORIZONTAL的取值相同
+ *       @bc：清屏的背景色
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+unsigned int lcd_set_rotation(uint8_t rotation, uint16_t bc)
+{
+    uint8_t madctl;
+    
+    if (rotation >= LCD_ROTATION_NUM) {
+        printf("%s, %d: rotation %d is invalid!\n", __FILE__, __LINE__, rotation);
+        return __LINE__;
+    }
+    
+    /* 显存中的内容按旧方向的坐标存放，先发送完 */
+    lcd_flush();
+    if (m_scroll_vsa != 0) {
+        lcd_scroll_reset();
+    }
+    
+    m_rotation = rotation;
+    m_width = (rotation <= LCD_HORIZONTAL_MODE1) ? LCD_GRAM_COLS : LCD_GRAM_LINES;
+    m_height = (rotation <= LCD_HORIZONTAL_MODE1) ? LCD_GRAM_LINES : LCD_GRAM_COLS;
+#if LCD_FB_LINES
+    m_fb_lines = MIN(LCD_FB_BYTES / (m_width * 2), m_height);
+    m_fb_y0 = MIN(m_fb_y0, m_height - m_fb_lines);
+#endif
+    madctl = m_madctl[rotation];
+    lcd_write_cmd(REG_MEMORY_ACCESS, &madctl, sizeof(madctl));
+    
+    /* GRAM中的内容按新方向显示，清屏使屏幕与显存一致 */
+    lcd_fill(0, 0, m_width, m_height, bc);
+    lcd_flush();
+    return 0;
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_get_rotation
+ * 说    明: 获取当前的屏幕方向
+ * 参    数: 无
+ * 返 回 值: LCD_ROTATION_PORTRAIT等
+ ***************************************************************/
+uint8_t lcd_get_rotation(void)
+{
+    return m_rotation;
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_get_width
+ * 说    明: 获取当前方向的屏幕宽度，即LCD_W
+ * 参    数: 无
+ * 返 回 值: 屏幕宽度
+ ***************************************************************/
+uint16_t lcd_get_width(void)
+{
+    return m_width;
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_get_height
+ * 说    明: 获取当前方向的屏幕高度，即LCD_H
+ * 参    数: 无
+ * 返 回 值: 屏幕高度
+ ***************************************************************/
+uint16_t lcd_get_height(void)
+{
+    return m_height;
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_get_stats
+ * 说    明: 获取总线传输统计
+ * 参    数:
+ *       @stats：存放统计结果
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_get_stats(lcd_stats_t *stats)
+{
+#if LCD_ENABLE_STATS
+    *stats = m_stats;
+#else
+    memset(stats, 0, sizeof(lcd_stats_t));
+#endif
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_reset_stats
+ * 说    明: 清零总线传输统计
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_reset_stats(void)
+{
+#if LCD_ENABLE_STATS
+    memset(&m_stats, 0, sizeof(lcd_stats_t));
+#endif
+}
@@ -0,0 +1,262 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <stdio.h>
+#include <string.h>
+#include "lcd.h"
+#include "lcd_internal.h"
+
+/* RGB565像素的字节数 */
+#define PIXEL_BYTES             2
+
+/* 每字节的位数 */
+#define BYTE_TO_BITS            8
+
+#ifndef MIN
+#define MIN(a, b)               (((a) < (b)) ? (a) : (b))
+#endif
+
+/* 按矩形合并画出的段覆盖到的行(不含)，以段起点在区域中的X坐标为下标 */
+static uint16_t m_blit_done[LCD_SIZE_MAX];
+
+
+/* 像素是否为透明色，透明色已拆为面板字节序的两个字节 */
+static inline int lcd_blit_is_key(const uint8_t *p, uint8_t kh, uint8_t kl)
+{
+    return (p[0] == kh) && (p[1] == kl);
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_blit_same_run
+ * 说    明: 判断一行中[start, end)是否恰好为一段不透明像素：段内没有
+ *           透明色，两侧为透明色或区域边界
+ * 参    数:
+ *       @row：这一行在区域中的第一个像素
+ *       @start/end：段的范围
+ *       @w：区域宽度
+ *       @kh/kl：透明色的高字节和低字节
+ * 返 回 值: 是返回1，否则返回0
+ ***************************************************************/
+static int lcd_blit_same_run(const uint8_t *row, uint16_t start, uint16_t end, uint16_t w,
+                             uint8_t kh, uint8_t kl)
+{
+    uint16_t i;
+
+    if (start > 0 && !lcd_blit_is_key(&row[(start - 1) * PIXEL_BYTES], kh, kl)) {
+        return 0;
+    }
+    if (end < w && !lcd_blit_is_key(&row[end * PIXEL_BYTES], kh, kl)) {
+        return 0;
+    }
+    for (i = start; i < end; i++) {
+        if (lcd_blit_is_key(&row[i * PIXEL_BYTES], kh, kl)) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_blit_key_fb
+ * 说    明: 区域完全落在显存内时，把每段不透明像素直接复制到显存
+ * 参    数:
+ *       @fb：区域左上角在显存中的地址
+ *       @fb_stride：显存每行的字节数
+ *       @src：区域左上角在位图中的地址
+ *       @stride：位图每行的字节数
+ *       @w/h：区域的宽度和高度
+ *       @kh/kl：透明色的高字节和低字节
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_blit_key_fb(uint8_t *fb, uint32_t fb_stride, const uint8_t *src, uint32_t stride,
+                            uint16_t w, uint16_t h, uint8_t kh, uint8_t kl)
+{
+    uint16_t i, j, start;
+
+    for (i = 0; i < h; i++, fb += fb_stride, src += stride) {
+        j = 0;
+        while (j < w) {
+            if (lcd_blit_is_key(&src[j * PIXEL_BYTES], kh, kl)) {
+                j++;
+                continue;
+            }
+            start = j;
+            while (j < w && !lcd_blit_is_key(&src[j * PIXEL_BYTES], kh, kl)) {
+                j++;
+            }
+            memcpy(&fb[start * PIXEL_BYTES], &src[start * PIXEL_BYTES], (j - start) * PIXEL_BYTES);
+        }
+    }
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_blit_key_runs
+ * 说    明: 透明方式显示区域。每行连续的不透明像素为一段，下面若干行
+ *           在同一位置有完全相同的段时合并为一个矩形，每个矩形只设置
+ *           一次窗口，逐行写入像素
+ * 参    数:
+ *       @x/y：区域左上角在屏幕上的坐标
+ *       @src：区域左上角在位图中的地址
+ *       @stride：位图每行的字节数
+ *       @w/h：区域的宽度和高度
+ *       @kh/kl：透明色的高字节和低字节
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_blit_key_runs(uint16_t x, uint16_t y, const uint8_t *src, uint32_t stride,
+                              uint16_t w, uint16_t h, uint8_t kh, uint8_t kl)
+{
+    const uint8_t *row, *line;
+    uint16_t i, j, k, start;
+
+    memset(m_blit_done, 0, w * sizeof(m_blit_done[0]));
+    for (i = 0; i < h; i++) {
+        row = &src[i * stride];
+        j = 0;
+        while (j < w) {
+            if (lcd_blit_is_key(&row[j * PIXEL_BYTES], kh, kl)) {
+                j++;
+                continue;
+            }
+            start = j;
+            while (j < w && !lcd_blit_is_key(&row[j * PIXEL_BYTES], kh, kl)) {
+                j++;
+            }
+            /* 已作为上面某个矩形的一部分画出 */
+            if (m_blit_done[start] > i) {
+                continue;
+            }
+            k = i + 1;
+            while (k < h && lcd_blit_same_run(&src[k * stride], start, j, w, kh, kl)) {
+                k++;
+            }
+            m_blit_done[start] = k;
+
+            lcd_window_begin(x + start, y + i, x + j - 1, y + k - 1);
+            for (line = row; line < &src[k * stride]; line += stride) {
+                lcd_window_write(&line[start * PIXEL_BYTES], j - start);
+            }
+            lcd_window_end();
+        }
+    }
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_blit
+ * 说    明: 显示位图中的一块区域，超出屏幕的部分被裁剪，完全在屏幕
+ *           外时直接返回。不透明时整块区域只设置一次窗口；透明时区域
+ *           完全落在显存内则直接修改显存，否则每行连续的不透明像素为
+ *           一段，下面各行位置相同的段合并为一个矩形，每个矩形只设置
+ *           一次窗口
+ * 参    数:
+ *       @x/y：区域左上角在屏幕上的坐标，可以为负数
+ *       @bitmap：位图
+ *       @sx/sy：区域左上角在位图中的坐标
+ *       @w/h：区域的宽度和高度
+ *       @flags：LCD_BLIT_COLOR_KEY或0
+ *       @key：透明色，flags为0时忽略
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+unsigned int lcd_blit(int16_t x, int16_t y, const lcd_bitmap_t *bitmap, uint16_t sx, uint16_t sy,
+                      uint16_t w, uint16_t h, uint8_t flags, uint16_t key)
+{
+    const uint8_t *src;
+    uint32_t stride, fb_stride;
+    uint8_t *fb;
+    uint16_t i;
+
+    if (bitmap == NULL || bitmap->data == NULL) {
+        printf("%s, %d: bitmap is invalid!\n", __FILE__, __LINE__);
+        return __LINE__;
+    }
+    if (w == 0 || h == 0 || (uint32_t)sx + w > bitmap->width || (uint32_t)sy + h > bitmap->height) {
+        printf("%s, %d: source rect out of bitmap!\n", __FILE__, __LINE__);
+        return __LINE__;
+    }
+
+    /* 完全在屏幕外的对象不做任何处理 */
+    if (x >= (int32_t)LCD_W || y >= (int32_t)LCD_H || x + w <= 0 || y + h <= 0) {
+        return 0;
+    }
+    /* 裁剪到屏幕内 */
+    if (x < 0) {
+        sx += -x;
+        w -= -x;
+        x = 0;
+    }
+    if (y < 0) {
+        sy += -y;
+        h -= -y;
+        y = 0;
+    }
+    w = MIN(w, LCD_W - x);
+    h = MIN(h, LCD_H - y);
+
+    stride = (uint32_t)bitmap->width * PIXEL_BYTES;
+    src = &bitmap->data[sy * stride + (uint32_t)sx * PIXEL_BYTES];
+    if (!(flags & LCD_BLIT_COLOR_KEY)) {
+        lcd_window_begin(x, y, x + w - 1, y + h - 1);
+        if (w == bitmap->width) {
+            lcd_window_write(src, (uint32_t)w * h);
+        } else {
+            for (i = 0; i < h; i++) {
+                lcd_window_write(&src[i * stride], w);
+            }
+        }
+        lcd_window_end();
+        return 0;
+    }
+
+    fb = lcd_fb_region(x, y, x + w - 1, y + h - 1, &fb_stride);
+    if (fb != NULL) {
+        lcd_blit_key_fb(fb, fb_stride, src, stride, w, h, (uint8_t)(key >> BYTE_TO_BITS), (uint8_t)key);
+    } else {
+        lcd_blit_key_runs(x, y, src, stride, w, h, (uint8_t)(key >> BYTE_TO_BITS), (uint8_t)key);
+    }
+    return 0;
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_blit_sprite
+ * 说    明: 显示精灵表中的一个图标，裁剪和透明方式同lcd_blit
+ * 参    数:
+ *       @x/y：图标左上角在屏幕上的坐标，可以为负数
+ *       @sheet：精灵表，cell_w和cell_h不为0
+ *       @index：图标编号
+ *       @flags：LCD_BLIT_COLOR_KEY或0
+ *       @key：透明色，flags为0时忽略
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+unsigned int lcd_blit_sprite(int16_t x, int16_t y, const lcd_bitmap_t *sheet, uint16_t index,
+                             uint8_t flags, uint16_t key)
+{
+    uint16_t cols, rows;
+
+    if (sheet == NULL || sheet->cell_w == 0 || sheet->cell_h == 0) {
+        printf("%s, %d: sprite sheet is invalid!\n", __FILE__, __LINE__);
+        return __LINE__;
+    }
+    cols = sheet->width / sheet->cell_w;
+    rows = sheet->height / sheet->cell_h;
+    if (index >= (uint32_t)cols * rows) {
+        printf("%s, %d: sprite %d out of sheet!\n", __FILE__, __LINE__, index);
+        return __LINE__;
+    }
+    return lcd_blit(x, y, sheet, (index % cols) * sheet->cell_w, (index / cols) * sheet->cell_h,
+                    sheet->cell_w, sheet->cell_h, flags, key);
+}
@@ -0,0 +1,322 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <stdio.h>
+#include <string.h>
+#include "lcd.h"
+#include "lcd_chart.h"
+#include "lcd_internal.h"
+
+#ifndef MIN
+#define MIN(a, b)               (((a) < (b)) ? (a) : (b))
+#endif
+#ifndef MAX
+#define MAX(a, b)               (((a) > (b)) ? (a) : (b))
+#endif
+
+/* 一列像素，按面板字节序存放(高字节在前) */
+static uint8_t m_column[LCD_CHART_MAX_HEIGHT * 2];
+
+/* 样本值对应的行(相对于绘图区域的顶部)，超出范围时取边界 */
+static int16_t lcd_chart_row(const lcd_chart_t *chart, const lcd_chart_series_t *s, float value)
+{
+    if (value <= s->min) {
+        return chart->height - 1;
+    }
+    if (value >= s->max) {
+        return 0;
+    }
+    return (int16_t)((s->max - value) * (chart->height - 1) / (s->max - s->min) + 0.5f);
+}
+
+/* 把列缓冲区中[top, bottom]的行设为color */
+static void lcd_chart_column_set(int16_t top, int16_t bottom, uint16_t color)
+{
+    int16_t row;
+
+    for (row = top; row <= bottom; row++) {
+        m_column[row * 2] = (uint8_t)(color >> 8);
+        m_column[row * 2 + 1] = (uint8_t)color;
+    }
+}
+
+/* 在列缓冲区中画背景和网格线，vgrid为1时整列为网格线 */
+static void lcd_chart_column_clear(const lcd_chart_t *chart, uint8_t vgrid)
+{
+    int16_t row;
+
+    lcd_chart_column_set(0, chart->height - 1, vgrid ? chart->grid : chart->bc);
+    if (chart->grid_step == 0 || vgrid) {
+        return;
+    }
+    /* 水平网格线从底部开始排列 */
+    for (row = chart->height - 1; row >= 0; row -= chart->grid_step) {
+        lcd_chart_column_set(row, row, chart->grid);
+    }
+}
+
+/* 把列缓冲区写到绘图区域的第col列，整列只设置一次地址窗口 */
+static void lcd_chart_column_write(const lcd_chart_t *chart, uint16_t col)
+{
+    uint16_t x = chart->x + col;
+
+    lcd_window_begin(x, chart->y, x, chart->y + chart->height - 1);
+    lcd_window_write(m_column, chart->height);
+    lcd_window_end();
+}
+
+/* 画出背景和水平网格线 */
+static void lcd_chart_draw_background(const lcd_chart_t *chart)
+{
+    int16_t row;
+
+    lcd_fill(chart->x, chart->y, chart->x + chart->width, chart->y + chart->height, chart->bc);
+    if (chart->grid_step == 0) {
+        return;
+    }
+    for (row = chart->height - 1; row >= 0; row -= chart->grid_step) {
+        lcd_fill(chart->x, chart->y + row, chart->x + chart->width, chart->y + row + 1, chart->grid);
+    }
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_chart_init
+ * 说    明: 初始化滚动曲线图并清空绘图区域。每次lcd_chart_update只画
+ *           最新的一列：指定LCD_CHART_HW_SCROLL且为横屏时，用ST7789的
+ *           硬件滚动使最新一列显示在最右边，此时绘图区域内整列(从屏幕
+ *           顶部到底部)一起滚动，这些列中不应再画其他内容，同一时间只
+ *           能有一个曲线图使用硬件滚动；否则按列循环覆盖(扫描模式)，
+ *           最新一列的右边留一列空白
+ * 参    数:
+ *       @chart：曲线图
+ *       @x/y：绘图区域的左上角坐标
+ *       @width/height：绘图区域的宽度和高度，height不超过LCD_CHART_MAX_HEIGHT
+ *       @bc：背景色
+ *       @grid：网格线颜色
+ *       @grid_step：网格线间距，0为不画网格线
+ *       @flags：LCD_CHART_HW_SCROLL或0
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+unsigned int lcd_chart_init(lcd_chart_t *chart, uint16_t x, uint16_t y, uint16_t width, uint16_t height,
+                            uint16_t bc, uint16_t grid, uint8_t grid_step, uint8_t flags)
+{
+    if (width < 2 || height < 2 || height > LCD_CHART_MAX_HEIGHT ||
+        x + width > LCD_W || y + height > LCD_H) {
+        printf("%s, %d: chart area(%d, %d, %d, %d) is invalid!\n", __FILE__, __LINE__, x, y, width, height);
+        return __LINE__;
+    }
+
+    memset(chart, 0, sizeof(lcd_chart_t));
+    chart->x = x;
+    chart->y = y;
+    chart->width = width;
+    chart->height = height;
+    chart->bc = bc;
+    chart->grid = grid;
+    chart->grid_step = grid_step;
+    lcd_chart_clear(chart);
+    if (flags & LCD_CHART_HW_SCROLL) {
+        chart->hw_scroll = (lcd_hscroll_set_area(x, width) == 0);
+    }
+    return 0;
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_chart_deinit
+ * 说    明: 退出曲线图，使用硬件滚动时恢复正常显示并清空绘图区域
+ * 参    数:
+ *       @chart：曲线图
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_chart_deinit(lcd_chart_t *chart)
+{
+    if (chart->hw_scroll) {
+        /* 滚动后GRAM中各列的顺序与显示不同，退出时直接清空 */
+        lcd_scroll_reset();
+        lcd_fill(chart->x, chart->y, chart->x + chart->width, chart->y + chart->height, chart->bc);
+        lcd_flush();
+    }
+    memset(chart, 0, sizeof(lcd_chart_t));
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_chart_set_series
+ * 说    明: 设置曲线的纵轴范围和颜色，超出范围的样本画在边界上
+ * 参    数:
+ *       @chart：曲线图
+ *       @series：曲线编号，0~LCD_CHART_SERIES_MAX-1
+ *       @min：纵轴下限
+ *       @max：纵轴上限
+ *       @color：曲线颜色
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+unsigned int lcd_chart_set_series(lcd_chart_t *chart, uint8_t series, float min, float max, uint16_t color)
+{
+    lcd_chart_series_t *s;
+
+    if (series >= LCD_CHART_SERIES_MAX || !(max > min)) {
+        printf("%s, %d: series %d range is invalid!\n", __FILE__, __LINE__, series);
+        return __LINE__;
+    }
+
+    s = &chart->series[series];
+    s->min = min;
+    s->max = max;
+    s->color = color;
+    s->pending = 0;
+    s->prev_y = -1;
+    chart->series_num = MAX(chart->series_num, series + 1);
+    return 0;
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_chart_push
+ * 说    明: 添加一个样本，只记录到下一列中，不画图。一列中有多个样本
+ *           时画出它们的最小值到最大值，不会丢失尖峰。NaN样本(例如
+ *           传感器读取失败)被忽略
+ * 参    数:
+ *       @chart：曲线图
+ *       @series：曲线编号
+ *       @value：样本值
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_chart_push(lcd_chart_t *chart, uint8_t series, float value)
+{
+    lcd_chart_series_t *s;
+
+    /* NaN与任何值比较都不成立，不能换算成行，直接丢弃 */
+    if (series >= chart->series_num || value != value) {
+        return;
+    }
+
+    s = &chart->series[series];
+    if (s->pending == 0) {
+        s->lo = value;
+        s->hi = value;
+    } else {
+        s->lo = MIN(s->lo, value);
+        s->hi = MAX(s->hi, value);
+    }
+    s->last = value;
+    if (s->pending < UINT16_MAX) {
+        s->pending++;
+    }
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_chart_update
+ * 说    明: 把上次更新以来添加的样本画为新的一列，没有新样本时不画。
+ *           按显示的帧率调用，样本比帧率快时自动抽取为每帧一列
+ * 参    数:
+ *       @chart：曲线图
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_chart_update(lcd_chart_t *chart)
+{
+    lcd_chart_series_t *s;
+    int16_t top, bottom;
+    uint8_t i, pending = 0;
+
+    for (i = 0; i < chart->series_num; i++) {
+        pending |= (chart->series[i].pending != 0);
+    }
+    if (!pending) {
+        return;
+    }
+
+    lcd_chart_column_clear(chart, chart->grid_step != 0 && chart->columns % chart->grid_step == 0);
+    for (i = 0; i < chart->series_num; i++) {
+        s = &chart->series[i];
+        if (s->pending == 0) {
+            /* 没有新样本的曲线保持上一列的值 */
+            if (s->prev_y < 0) {
+                continue;
+            }
+            top = s->prev_y;
+            bottom = s->prev_y;
+        } else {
+            /* 竖线从上一列的值连到本列样本的范围 */
+            top = lcd_chart_row(chart, s, s->hi);
+            bottom = lcd_chart_row(chart, s, s->lo);
+            if (s->prev_y >= 0) {
+                top = MIN(top, s->prev_y);
+                bottom = MAX(bottom, s->prev_y);
+            }
+            s->prev_y = lcd_chart_row(chart, s, s->last);
+            s->pending = 0;
+        }
+        lcd_chart_column_set(top, bottom, s->color);
+    }
+    lcd_chart_column_write(chart, chart->cursor);
+    chart->cursor = (chart->cursor + 1) % chart->width;
+    chart->columns++;
+
+    if (chart->hw_scroll) {
+        /* 新的一列刷新到LCD后，滚动使它显示在最右边 */
+        lcd_flush();
+        lcd_scroll_set_start(chart->cursor);
+    } else {
+        /* 扫描模式下清空下一列，作为新旧数据的分界 */
+        lcd_chart_column_clear(chart, 0);
+        lcd_chart_column_write(chart, chart->cursor);
+    }
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_chart_restart
+ * 说    明: 清空绘图区域，从最左边一列重新开始画曲线，已添加但还没有
+ *           画出的样本保留到下一次lcd_chart_update
+ * 参    数:
+ *       @chart：曲线图
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_chart_restart(lcd_chart_t *chart)
+{
+    uint8_t i;
+
+    for (i = 0; i < LCD_CHART_SERIES_MAX; i++) {
+        chart->series[i].prev_y = -1;
+    }
+    chart->cursor = 0;
+    chart->columns = 0;
+    lcd_chart_draw_background(chart);
+    lcd_flush();
+    if (chart->hw_scroll) {
+        lcd_scroll_set_start(0);
+    }
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_chart_clear
+ * 说    明: 清空绘图区域和待画样本
+ * 参    数:
+ *       @chart：曲线图
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_chart_clear(lcd_chart_t *chart)
+{
+    uint8_t i;
+
+    for (i = 0; i < LCD_CHART_SERIES_MAX; i++) {
+        chart->series[i].pending = 0;
+    }
+    lcd_chart_restart(chart);
+}
@@ -0,0 +1,341 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <stdio.h>
+#include <string.h>
+#include "lcd_color.h"
+
+/* Cortex-M4等带DSP扩展的内核上，饱和加法和字节拆分各用一条SIMD指令 */
+#if defined(__ARM_FEATURE_SIMD32) && __ARM_FEATURE_SIMD32
+#include <arm_acle.h>
+#define LCD_COLOR_SIMD          1
+#else
+#define LCD_COLOR_SIMD          0
+#endif
+
+/* 是否按字成组转换。成组转换依赖小端字节序，大端机器上只逐像素转换 */
+#ifndef LCD_COLOR_SWAR
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+#define LCD_COLOR_SWAR          0
+#else
+#define LCD_COLOR_SWAR          1
+#endif
+#endif
+
+/* 每组的像素数，与抖动矩阵的宽度相同，一行中每组的抖动阈值都一样 */
+#define GROUP_PIXELS            4
+
+/* 抖动矩阵的大小 */
+#define BAYER_SIZE              4
+#define BAYER_MASK              (BAYER_SIZE - 1)
+
+/* 各格式每像素的字节数 */
+#define RGB888_BYTES            3
+#define ARGB8888_BYTES          4
+#define RGB565_BYTES            2
+
+/* 两个16位通道中各有一个像素的R、G、B(0~255)，拼成两个面板字节序的
+ * RGB565像素：低地址字节为R[7:3]G[7:5]，高地址字节为G[4:2]B[7:3]
+ */
+#define PACK2(r, g, b)          (((r) & 0x00F800F8u) | (((g) >> 5) & 0x00070007u) | \
+                                 (((g) << 11) & 0xE000E000u) | (((b) << 5) & 0x1F001F00u))
+
+/* 一个ARGB8888像素直接在字内拼成面板字节序的RGB565，放在低16位 */
+#define PACK_ARGB(p)            ((((p) >> 16) & 0xF8u) | (((p) >> 13) & 0x07u) | \
+                                 (((p) << 3) & 0xE000u) | (((p) << 5) & 0x1F00u))
+
+/* 把字中第0、2个字节和第1、3个字节分别放到两个16位通道中 */
+#if LCD_COLOR_SIMD
+#define EVEN_BYTES(w)           __uxtb16(w)
+#define ODD_BYTES(w)            __uxtb16(__ror((w), 8))
+#else
+#define EVEN_BYTES(w)           ((w) & 0x00FF00FFu)
+#define ODD_BYTES(w)            (((w) >> 8) & 0x00FF00FFu)
+#endif
+
+/* 4x4 Bayer矩阵，0~15。5位通道的阈值为d / 2，6位通道为d / 4 */
+static const uint8_t m_bayer[BAYER_SIZE][BAYER_SIZE] = {
+    {0, 8, 2, 10},
+    {12, 4, 14, 6},
+    {3, 11, 1, 9},
+    {15, 7, 13, 5},
+};
+
+
+static inline uint32_t lcd_color_load(const uint8_t *p)
+{
+    uint32_t w;
+
+    memcpy(&w, p, sizeof(w));
+    return w;
+}
+
+
+static inline void lcd_color_store(uint8_t *p, uint32_t w)
+{
+    memcpy(p, &w, sizeof(w));
+}
+
+
+/* 4个字节分别做无符号饱和加法 */
+static inline uint32_t lcd_color_uqadd8(uint32_t a, uint32_t b)
+{
+#if LCD_COLOR_SIMD
+    return __uqadd8(a, b);
+#else
+    uint32_t sum = ((a & 0x7F7F7F7Fu) + (b & 0x7F7F7F7Fu)) ^ ((a ^ b) & 0x80808080u);
+    uint32_t carry = ((a & b) | ((a | b) & ~sum)) & 0x80808080u;
+
+    return sum | ((carry >> 7) * 0xFFu);
+#endif
+}
+
+
+static inline uint8_t lcd_color_sat(uint8_t v, uint8_t t)
+{
+    return (v > 0xFF - t) ? 0xFF : (uint8_t)(v + t);
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_color_convert_pixels
+ * 说    明: 逐像素转换，用于行末不满一组的像素和大端机器
+ * 参    数:
+ *       @dst：RGB565像素
+ *       @src：源像素
+ *       @count：像素数目
+ *       @format：源像素格式
+ *       @bayer：抖动矩阵中这一行的阈值，NULL为不抖动
+ *       @x：第一个像素的X坐标
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_color_convert_pixels(uint8_t *dst, const uint8_t *src, uint32_t count, uint8_t format,
+                                     const uint8_t *bayer, uint16_t x)
+{
+    uint8_t r, g, b, d;
+    uint32_t i;
+
+    for (i = 0; i < count; i++) {
+        if (format == LCD_COLOR_RGB888) {
+            r = src[0];
+            g = src[1];
+            b = src[2];
+            src += RGB888_BYTES;
+        } else if (format == LCD_COLOR_ARGB8888) {
+            b = src[0];
+            g = src[1];
+            r = src[2];
+            src += ARGB8888_BYTES;
+        } else {
+            r = g = b = *src++;
+        }
+        if (bayer != NULL) {
+            d = bayer[(x + i) & BAYER_MASK];
+            r = lcd_color_sat(r, d >> 1);
+            g = lcd_color_sat(g, d >> 2);
+            b = lcd_color_sat(b, d >> 1);
+        }
+        dst[0] = (uint8_t)((r & 0xF8) | (g >> 5));
+        dst[1] = (uint8_t)(((g << 3) & 0xE0) | (b >> 3));
+        dst += RGB565_BYTES;
+    }
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_color_thresholds
+ * 说    明: 按源像素格式的字节排列展开一组4个像素的抖动阈值，成组
+ *           转换时与源数据逐字饱和相加。RGB888为3个字，ARGB8888为
+ *           每像素1个字，灰度为R/B和G的阈值各1个字
+ * 参    数:
+ *       @tw：抖动阈值，4个字
+ *       @format：源像素格式
+ *       @bayer：抖动矩阵中这一行的阈值
+ *       @x：第一个像素的X坐标
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_color_thresholds(uint32_t *tw, uint8_t format, const uint8_t *bayer, uint16_t x)
+{
+    uint8_t t[GROUP_PIXELS * ARGB8888_BYTES];
+    uint8_t d5, d6;
+    uint8_t i;
+
+    memset(t, 0, sizeof(t));
+    for (i = 0; i < GROUP_PIXELS; i++) {
+        d5 = bayer[(x + i) & BAYER_MASK] >> 1;
+        d6 = bayer[(x + i) & BAYER_MASK] >> 2;
+        if (format == LCD_COLOR_RGB888) {
+            t[i * RGB888_BYTES] = d5;
+            t[i * RGB888_BYTES + 1] = d6;
+            t[i * RGB888_BYTES + 2] = d5;
+        } else if (format == LCD_COLOR_ARGB8888) {
+            t[i * ARGB8888_BYTES] = d5;
+            t[i * ARGB8888_BYTES + 1] = d6;
+            t[i * ARGB8888_BYTES + 2] = d5;
+        } else {
+            t[i] = d5;
+            t[GROUP_PIXELS + i] = d6;
+        }
+    }
+    memcpy(tw, t, sizeof(t));
+}
+
+
+/* 4个RGB888像素：3个字读入，拆成两对R、G、B通道，2个字写出 */
+static inline void lcd_color_rgb888_group(uint8_t *dst, const uint8_t *src, const uint32_t *tw)
+{
+    uint32_t w0 = lcd_color_load(src);
+    uint32_t w1 = lcd_color_load(src + 4);
+    uint32_t w2 = lcd_color_load(src + 8);
+    uint32_t r, g, b;
+
+    if (tw != NULL) {
+        w0 = lcd_color_uqadd8(w0, tw[0]);
+        w1 = lcd_color_uqadd8(w1, tw[1]);
+        w2 = lcd_color_uqadd8(w2, tw[2]);
+    }
+    /* w0 = R0 G0 B0 R1, w1 = G1 B1 R2 G2, w2 = B2 R3 G3 B3 */
+    r = (w0 & 0xFFu) | ((w0 >> 8) & 0x00FF0000u);
+    g = ((w0 >> 8) & 0xFFu) | ((w1 & 0xFFu) << 16);
+    b = ((w0 >> 16) & 0xFFu) | ((w1 & 0xFF00u) << 8);
+    lcd_color_store(dst, PACK2(r, g, b));
+    r = ((w1 >> 16) & 0xFFu) | ((w2 & 0xFF00u) << 8);
+    g = (w1 >> 24) | (w2 & 0x00FF0000u);
+    b = (w2 & 0xFFu) | ((w2 >> 8) & 0x00FF0000u);
+    lcd_color_store(dst + 4, PACK2(r, g, b));
+}
+
+
+/* 4个ARGB8888像素：每像素1个字，在字内拼出RGB565 */
+static inline void lcd_color_argb8888_group(uint8_t *dst, const uint8_t *src, const uint32_t *tw)
+{
+    uint32_t p0 = lcd_color_load(src);
+    uint32_t p1 = lcd_color_load(src + 4);
+    uint32_t p2 = lcd_color_load(src + 8);
+    uint32_t p3 = lcd_color_load(src + 12);
+
+    if (tw != NULL) {
+        p0 = lcd_color_uqadd8(p0, tw[0]);
+        p1 = lcd_color_uqadd8(p1, tw[1]);
+        p2 = lcd_color_uqadd8(p2, tw[2]);
+        p3 = lcd_color_uqadd8(p3, tw[3]);
+    }
+    lcd_color_store(dst, PACK_ARGB(p0) | (PACK_ARGB(p1) << 16));
+    lcd_color_store(dst + 4, PACK_ARGB(p2) | (PACK_ARGB(p3) << 16));
+}
+
+
+/* 4个灰度像素：1个字读入，按奇偶拆成两对通道后重新组合 */
+static inline void lcd_color_gray8_group(uint8_t *dst, const uint8_t *src, const uint32_t *tw)
+{
+    uint32_t w = lcd_color_load(src);
+    uint32_t vr = w;
+    uint32_t vg = w;
+    uint32_t even, odd;
+
+    if (tw != NULL) {
+        vr = lcd_color_uqadd8(w, tw[0]);
+        vg = lcd_color_uqadd8(w, tw[1]);
+    }
+    even = PACK2(EVEN_BYTES(vr), EVEN_BYTES(vg), EVEN_BYTES(vr));
+    odd = PACK2(ODD_BYTES(vr), ODD_BYTES(vg), ODD_BYTES(vr));
+    lcd_color_store(dst, (even & 0xFFFFu) | (odd << 16));
+    lcd_color_store(dst + 4, (even >> 16) | (odd & 0xFFFF0000u));
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_color_run
+ * 说    明: 每种格式一个循环成组转换整组的像素，剩下的逐像素转换
+ * 参    数:
+ *       @dst：RGB565像素
+ *       @src：源像素
+ *       @count：像素数目
+ *       @format：源像素格式
+ *       @bayer：抖动矩阵中这一行的阈值，NULL为不抖动
+ *       @x：第一个像素的X坐标
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+static unsigned int lcd_color_run(uint8_t *dst, const uint8_t *src, uint32_t count, uint8_t format,
+                                  const uint8_t *bayer, uint16_t x)
+{
+    uint32_t tw[GROUP_PIXELS];
+    const uint32_t *dither;
+    uint32_t groups = LCD_COLOR_SWAR ? (count / GROUP_PIXELS) : 0;
+    uint32_t i;
+
+    if (dst == NULL || src == NULL) {
+        printf("%s, %d: buffer is NULL!\n", __FILE__, __LINE__);
+        return __LINE__;
+    }
+    if (format != LCD_COLOR_RGB888 && format != LCD_COLOR_ARGB8888 && format != LCD_COLOR_GRAY8) {
+        printf("%s, %d: color format %d is invalid!\n", __FILE__, __LINE__, format);
+        return __LINE__;
+    }
+
+    if (bayer != NULL) {
+        lcd_color_thresholds(tw, format, bayer, x);
+    }
+    dither = (bayer != NULL) ? tw : NULL;
+    if (format == LCD_COLOR_RGB888) {
+        for (i = 0; i < groups; i++, src += GROUP_PIXELS * RGB888_BYTES, dst += GROUP_PIXELS * RGB565_BYTES) {
+            lcd_color_rgb888_group(dst, src, dither);
+        }
+    } else if (format == LCD_COLOR_ARGB8888) {
+        for (i = 0; i < groups; i++, src += GROUP_PIXELS * ARGB8888_BYTES, dst += GROUP_PIXELS * RGB565_BYTES) {
+            lcd_color_argb8888_group(dst, src, dither);
+        }
+    } else {
+        for (i = 0; i < groups; i++, src += GROUP_PIXELS, dst += GROUP_PIXELS * RGB565_BYTES) {
+            lcd_color_gray8_group(dst, src, dither);
+        }
+    }
+    lcd_color_convert_pixels(dst, src, count - groups * GROUP_PIXELS, format, bayer, x);
+    return 0;
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_color_convert
+ * 说    明: 将一行像素转换为面板字节序的RGB565
+ * 参    数:
+ *       @dst：RGB565像素，count * 2个字节
+ *       @src：源像素
+ *       @count：像素数目
+ *       @format：源像素格式，LCD_COLOR_xxx
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+unsigned int lcd_color_convert(uint8_t *dst, const uint8_t *src, uint32_t count, uint8_t format)
+{
+    return lcd_color_run(dst, src, count, format, NULL, 0);
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_color_convert_dither
+ * 说    明: 将一行像素按4x4有序抖动转换为面板字节序的RGB565
+ * 参    数:
+ *       @dst：RGB565像素，count * 2个字节
+ *       @src：源像素
+ *       @count：像素数目
+ *       @format：源像素格式，LCD_COLOR_xxx
+ *       @x：第一个像素在屏幕上的X坐标
+ *       @y：这一行在屏幕上的Y坐标
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+unsigned int lcd_color_convert_dither(uint8_t *dst, const uint8_t *src, uint32_t count, uint8_t format,
+                                      uint16_t x, uint16_t y)
+{
+    return lcd_color_run(dst, src, count, format, m_bayer[y & BAYER_MASK], x);
+}
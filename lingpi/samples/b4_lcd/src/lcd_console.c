@@ -0,0 +1,335 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include "lcd.h"
+#include "lcd_console.h"
+
+#ifndef MIN
+#define MIN(a, b)               (((a) < (b)) ? (a) : (b))
+#endif
+
+#define CHAR_0                  ((uint8_t)('0'))
+#define CHAR_PRINTABLE_MIN      0x20
+#define CHAR_PRINTABLE_MAX      0x7E
+
+/* 一个字符及其颜色属性 */
+typedef struct {
+    uint8_t ch;
+    uint8_t attr;
+} lcd_console_cell_t;
+
+/* 一行文本 */
+typedef struct {
+    lcd_console_cell_t cells[LCD_CONSOLE_COLS];
+    uint8_t len;
+} lcd_console_line_t;
+
+typedef struct {
+    uint16_t y;                 /* 控制台区域的起始行 */
+    uint16_t rows;              /* 显示的行数 */
+    uint8_t cols;               /* 每行的字符数 */
+    uint8_t sizey;              /* 字号 */
+    uint8_t char_w;             /* 字符宽度 */
+    uint8_t hw_scroll;          /* 是否使用硬件垂直滚动 */
+    uint8_t attr;               /* 当前颜色属性 */
+    uint8_t esc;                /* 收到转义字符，等待属性编号 */
+    uint16_t head;              /* 最早一行所在的槽 */
+    uint16_t count;             /* 已使用的行数(含当前行) */
+    uint8_t drawn;              /* 当前行已画出的字符数 */
+    uint16_t fc[LCD_CONSOLE_ATTRS];
+    uint16_t bc[LCD_CONSOLE_ATTRS];
+    /* 行的环形缓冲区，硬件滚动时第i个槽固定显示在GRAM中的第i行 */
+    lcd_console_line_t lines[LCD_CONSOLE_ROWS];
+} lcd_console_t;
+
+static lcd_console_t m_console;
+
+/* 槽在屏幕上的Y坐标：硬件滚动时槽的位置固定，由滚动偏移决定显示顺序；
+ * 否则按从旧到新的顺序从上往下排列
+ */
+static uint16_t lcd_console_slot_y(uint16_t slot)
+{
+    if (!m_console.hw_scroll) {
+        slot = (slot + m_console.rows - m_console.head) % m_console.rows;
+    }
+    return m_console.y + slot * m_console.sizey;
+}
+
+/* 当前行所在的槽 */
+static uint16_t lcd_console_cur_slot(void)
+{
+    return (m_console.head + m_console.count - 1) % m_console.rows;
+}
+
+/* 画一行中[from, to)的字符，颜色属性相同的连续字符一次画出 */
+static void lcd_console_draw_cells(uint16_t slot, uint8_t from, uint8_t to)
+{
+    const lcd_console_line_t *line = &m_console.lines[slot];
+    uint8_t buf[LCD_CONSOLE_COLS + 1];
+    uint16_t y = lcd_console_slot_y(slot);
+    uint8_t start, attr, n;
+
+    while (from < to) {
+        start = from;
+        attr = line->cells[from].attr;
+        n = 0;
+        while (from < to && line->cells[from].attr == attr) {
+            buf[n++] = line->cells[from++].ch;
+        }
+        buf[n] = '\0';
+        lcd_draw_text(start * m_console.char_w, y, buf, m_console.fc[attr], m_console.bc[attr], m_console.sizey, 0);
+    }
+}
+
+/* 画出整行，行尾用背景色填充 */
+static void lcd_console_draw_line(uint16_t slot)
+{
+    uint16_t y = lcd_console_slot_y(slot);
+    uint8_t len = m_console.lines[slot].len;
+
+    lcd_console_draw_cells(slot, 0, len);
+    lcd_fill(len * m_console.char_w, y, LCD_W, y + m_console.sizey, m_console.bc[0]);
+}
+
+/* 画出当前行还没有画的字符 */
+static void lcd_console_flush_line(void)
+{
+    uint16_t slot = lcd_console_cur_slot();
+
+    lcd_console_draw_cells(slot, m_console.drawn, m_console.lines[slot].len);
+    m_console.drawn = m_console.lines[slot].len;
+}
+
+/* 换行，行数已满时最早的一行滚出 */
+static void lcd_console_newline(void)
+{
+    uint16_t slot, y, i;
+
+    lcd_console_flush_line();
+    m_console.drawn = 0;
+
+    if (m_console.count < m_console.rows) {
+        m_console.count++;
+        m_console.lines[lcd_console_cur_slot()].len = 0;
+        return;
+    }
+
+    /* 最早一行的槽用于新行 */
+    slot = m_console.head;
+    m_console.head = (m_console.head + 1) % m_console.rows;
+    m_console.lines[slot].len = 0;
+
+    if (m_console.hw_scroll) {
+        /* 只清空新行，然后移动滚动偏移，使最早的行显示在顶部 */
+        y = lcd_console_slot_y(slot);
+        lcd_fill(0, y, LCD_W, y + m_console.sizey, m_console.bc[0]);
+        /* 启用显存时先把新行刷新到LCD，再滚动到可见位置 */
+        lcd_flush();
+        lcd_scroll_set_start(m_console.head * m_console.sizey);
+    } else {
+        for (i = 0; i < m_console.rows; i++) {
+            lcd_console_draw_line((m_console.head + i) % m_console.rows);
+        }
+    }
+}
+
+static void lcd_console_putc(uint8_t ch)
+{
+    lcd_console_line_t *line;
+
+    if (m_console.esc) {
+        m_console.esc = 0;
+        if (ch >= CHAR_0 && ch < CHAR_0 + LCD_CONSOLE_ATTRS) {
+            m_console.attr = ch - CHAR_0;
+        }
+        return;
+    }
+
+    if (ch == LCD_CONSOLE_ESC) {
+        m_console.esc = 1;
+        return;
+    } else if (ch == '\n') {
+        lcd_console_newline();
+        return;
+    } else if (ch == '\t') {
+        ch = ' ';
+    } else if (ch < CHAR_PRINTABLE_MIN || ch > CHAR_PRINTABLE_MAX) {
+        return;
+    }
+
+    /* 行已满时自动换行 */
+    line = &m_console.lines[lcd_console_cur_slot()];
+    if (line->len >= m_console.cols) {
+        lcd_console_newline();
+        line = &m_console.lines[lcd_console_cur_slot()];
+    }
+    line->cells[line->len].ch = ch;
+    line->cells[line->len].attr = m_console.attr;
+    line->len++;
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_console_init
+ * 说    明: 初始化控制台，清空[y, y + height)区域。竖屏时使用ST7789的
+ *           硬件垂直滚动，新增一行只画新行并移动滚动起始地址；横屏时
+ *           滚动一行需要重画所有行。控制台区域内不应再画其他内容
+ * 参    数:
+ *       @y：控制台区域的起始行
+ *       @height：控制台区域的行数，按字号取整
+ *       @sizey：字号，可选：12、16、24、32
+ *       @fc：颜色属性0的字的颜色
+ *       @bc：颜色属性0的背景色，也用于清空新行
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+unsigned int lcd_console_init(uint16_t y, uint16_t height, uint8_t sizey, uint16_t fc, uint16_t bc)
+{
+    uint8_t i;
+
+    if (sizey != LCD_FONT_SIZE12 && sizey != LCD_FONT_SIZE16 &&
+        sizey != LCD_FONT_SIZE24 && sizey != LCD_FONT_SIZE32) {
+        printf("%s, %d: font size %d is not supported!\n", __FILE__, __LINE__, sizey);
+        return __LINE__;
+    }
+    if (height < sizey || y + height > LCD_H) {
+        printf("%s, %d: console area(%d, %d) is invalid!\n", __FILE__, __LINE__, y, height);
+        return __LINE__;
+    }
+
+    memset(&m_console, 0, sizeof(m_console));
+    m_console.y = y;
+    m_console.rows = MIN(height / sizey, LCD_CONSOLE_ROWS);
+    m_console.sizey = sizey;
+    m_console.char_w = sizey / 2;
+    m_console.cols = MIN(LCD_W / m_console.char_w, LCD_CONSOLE_COLS);
+    m_console.count = 1;
+    for (i = 0; i < LCD_CONSOLE_ATTRS; i++) {
+        m_console.fc[i] = fc;
+        m_console.bc[i] = bc;
+    }
+
+    lcd_fill(0, y, LCD_W, y + m_console.rows * sizey, bc);
+    lcd_flush();
+    m_console.hw_scroll = (lcd_scroll_set_area(y, m_console.rows * sizey) == 0);
+    return 0;
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_console_deinit
+ * 说    明: 退出控制台，恢复正常显示(不滚动)，控制台的内容保留在屏幕上
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_console_deinit(void)
+{
+    uint16_t i;
+
+    if (m_console.hw_scroll) {
+        /* 退出滚动模式后GRAM按原顺序显示，按从旧到新的顺序重画所有行 */
+        lcd_scroll_reset();
+        m_console.hw_scroll = 0;
+        for (i = 0; i < m_console.rows; i++) {
+            lcd_console_draw_line((m_console.head + i) % m_console.rows);
+        }
+        lcd_flush();
+    }
+    memset(&m_console, 0, sizeof(m_console));
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_console_set_attr
+ * 说    明: 设置颜色属性，文本中用LCD_CONSOLE_ATTR("n")切换
+ * 参    数:
+ *       @attr：属性编号，0~LCD_CONSOLE_ATTRS-1
+ *       @fc：字的颜色
+ *       @bc：字的背景色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_console_set_attr(uint8_t attr, uint16_t fc, uint16_t bc)
+{
+    if (attr >= LCD_CONSOLE_ATTRS) {
+        return;
+    }
+    m_console.fc[attr] = fc;
+    m_console.bc[attr] = bc;
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_console_puts
+ * 说    明: 在控制台追加文本，'\n'换行，超过一行的宽度时自动换行。
+ *           只支持ASCII字符
+ * 参    数:
+ *       @s：文本
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_console_puts(const char *s)
+{
+    if (m_console.rows == 0) {
+        return;
+    }
+
+    while (*s != '\0') {
+        lcd_console_putc((uint8_t)*s++);
+    }
+    lcd_console_flush_line();
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_console_printf
+ * 说    明: 格式化后追加到控制台，单次输出最多LCD_CONSOLE_PRINTF_SIZE个字符
+ * 参    数:
+ *       @fmt：格式字符串
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_console_printf(const char *fmt, ...)
+{
+    char buf[LCD_CONSOLE_PRINTF_SIZE + 1];
+    va_list args;
+
+    va_start(args, fmt);
+    vsnprintf(buf, sizeof(buf), fmt, args);
+    va_end(args);
+    lcd_console_puts(buf);
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_console_clear
+ * 说    明: 清空控制台
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_console_clear(void)
+{
+    if (m_console.rows == 0) {
+        return;
+    }
+
+    memset(m_console.lines, 0, sizeof(m_console.lines));
+    m_console.head = 0;
+    m_console.count = 1;
+    m_console.drawn = 0;
+    lcd_fill(0, m_console.y, LCD_W, m_console.y + m_console.rows * m_console.sizey, m_console.bc[0]);
+    lcd_flush();
+    if (m_console.hw_scroll) {
+        lcd_scroll_set_start(0);
+    }
+}
@@ -0,0 +1,437 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <stdint.h>
+#include <string.h>
+#include "lcd.h"
+#include "lcd_internal.h"
+#include "lcd_font.h"
+
+/* ASCII字体的起始码点和字符数目 */
+#define ASCII_FIRST         0x20
+#define ASCII_COUNT         95
+
+/* 每字节的位数 */
+#define BYTE_TO_BITS        8
+
+/* 4-bpp字模每像素的位数和最大灰度 */
+#define FONT_AA_BPP         4
+#define FONT_AA_LEVEL_MAX   15
+
+/* 一个输出像素在一个方向上最多覆盖的母版像素数，缩小比例不超过2时为3 */
+#define FONT_SPAN_MAX       3
+
+/* 缩小后的一个字模，不大于母版的一个字模 */
+static uint8_t m_scaled_glyph[(LCD_FONT_MASTER_WIDTH + 1) / 2 * LCD_FONT_MASTER_HEIGHT];
+
+/* 一个1-bpp字模的最大字节数 */
+#define FONT_MASK_BYTES     ((LCD_FONT_MASTER_WIDTH + BYTE_TO_BITS - 1) / BYTE_TO_BITS * LCD_FONT_MASTER_HEIGHT)
+
+#if LCD_FONT_MASK_CACHE_NUM
+/* 由母版缩小的1-bpp字模缓存条目，tick为0表示空闲 */
+typedef struct {
+    const uint8_t *master;  /* 母版字模 */
+    uint8_t width;          /* 字模宽度 */
+    uint8_t height;         /* 字模高度 */
+    uint32_t tick;          /* 最近一次使用的时间 */
+} lcd_font_mask_entry_t;
+
+static lcd_font_mask_entry_t m_mask_entries[LCD_FONT_MASK_CACHE_NUM];
+static uint8_t m_mask_data[LCD_FONT_MASK_CACHE_NUM][FONT_MASK_BYTES];
+static uint32_t m_mask_tick = 0;
+#endif
+
+/* 12*6的ASCII码显示。12号字缩小到3/8后笔画粘连，保留手工调整的点阵 */
+static const unsigned char ascii_1206[][12] = {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* " ",0 */
+    {0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00}, /* "!",1 */
+    {0x14, 0x14, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* """,2 */
+    {0x00, 0x00, 0x0A, 0x0A, 0x1F, 0x0A, 0x0A, 0x1F, 0x0A, 0x0A, 0x00, 0x00}, /* "#",3 */
+    {0x00, 0x04, 0x0E, 0x15, 0x05, 0x06, 0x0C, 0x14, 0x15, 0x0E, 0x04, 0x00}, /* "$",4 */
+    {0x00, 0x00, 0x12, 0x15, 0x0D, 0x15, 0x2E, 0x2C, 0x2A, 0x12, 0x00, 0x00}, /* "%",5 */
+    {0x00, 0x00, 0x04, 0x0A, 0x0A, 0x36, 0x15, 0x15, 0x29, 0x16, 0x00, 0x00}, /* "&",6 */
+    {0x02, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* "'",7 */
+    {0x10, 0x08, 0x08, 0x04, 0x04, 0x04, 0x04, 0x04, 0x08, 0x08, 0x10, 0x00}, /* "(",8 */
+    {0x02, 0x04, 0x04, 0x08, 0x08, 0x08, 0x08, 0x08, 0x04, 0x04, 0x02, 0x00}, /* ")",9 */
+    {0x00, 0x00, 0x00, 0x04, 0x15, 0x0E, 0x0E, 0x15, 0x04, 0x00, 0x00, 0x00}, /* "*",10 */
+    {0x00, 0x00, 0x00, 0x08, 0x08, 0x3E, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00}, /* "+",11 */
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x01, 0x00}, /* ",",12 */
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* "-",13 */
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00}, /* ".",14 */
+    {0x00, 0x20, 0x10, 0x10, 0x08, 0x08, 0x04, 0x04, 0x02, 0x02, 0x01, 0x00}, /* "/",15 */
+    {0x00, 0x00, 0x0E, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E, 0x00, 0x00}, /* "0",16 */
+    {0x00, 0x00, 0x04, 0x06, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0E, 0x00, 0x00}, /* "1",17 */
+    {0x00, 0x00, 0x0E, 0x11, 0x11, 0x08, 0x04, 0x02, 0x01, 0x1F, 0x00, 0x00}, /* "2",18 */
+    {0x00, 0x00, 0x0E, 0x11, 0x10, 0x0C, 0x10, 0x10, 0x11, 0x0E, 0x00, 0x00}, /* "3",19 */
+    {0x00, 0x00, 0x08, 0x0C, 0x0C, 0x0A, 0x09, 0x1F, 0x08, 0x1C, 0x00, 0x00}, /* "4",20 */
+    {0x00, 0x00, 0x1F, 0x01, 0x01, 0x0F, 0x11, 0x10, 0x11, 0x0E, 0x00, 0x00}, /* "5",21 */
+    {0x00, 0x00, 0x0C, 0x12, 0x01, 0x0D, 0x13, 0x11, 0x11, 0x0E, 0x00, 0x00}, /* "6",22 */
+    {0x00, 0x00, 0x1E, 0x10, 0x08, 0x08, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00}, /* "7",23 */
+    {0x00, 0x00, 0x0E, 0x11, 0x11, 0x0E, 0x11, 0x11, 0x11, 0x0E, 0x00, 0x00}, /* "8",24 */
+    {0x00, 0x00, 0x0E, 0x11, 0x11, 0x19, 0x16, 0x10, 0x09, 0x06, 0x00, 0x00}, /* "9",25 */
+    {0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00}, /* ":",26 */
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00}, /* ";",27 */
+    {0x00, 0x00, 0x10, 0x08, 0x04, 0x02, 0x02, 0x04, 0x08, 0x10, 0x00, 0x00}, /* "<",28 */
+    {0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00}, /* "=",29 */
+    {0x00, 0x00, 0x02, 0x04, 0x08, 0x10, 0x10, 0x08, 0x04, 0x02, 0x00, 0x00}, /* ">",30 */
+    {0x00, 0x00, 0x0E, 0x11, 0x11, 0x08, 0x04, 0x04, 0x00, 0x04, 0x00, 0x00}, /* "?",31 */
+    {0x00, 0x00, 0x1C, 0x22, 0x29, 0x2D, 0x2D, 0x1D, 0x22, 0x1C, 0x00, 0x00}, /* "@",32 */
+    {0x00, 0x00, 0x04, 0x04, 0x0C, 0x0A, 0x0A, 0x1E, 0x12, 0x33, 0x00, 0x00}, /* "A",33 */
+    {0x00, 0x00, 0x0F, 0x12, 0x12, 0x0E, 0x12, 0x12, 0x12, 0x0F, 0x00, 0x00}, /* "B",34 */
+    {0x00, 0x00, 0x1E, 0x11, 0x01, 0x01, 0x01, 0x01, 0x11, 0x0E, 0x00, 0x00}, /* "C",35 */
+    {0x00, 0x00, 0x0F, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x0F, 0x00, 0x00}, /* "D",36 */
+    {0x00, 0x00, 0x1F, 0x12, 0x0A, 0x0E, 0x0A, 0x02, 0x12, 0x1F, 0x00, 0x00}, /* "E",37 */
+    {0x00, 0x00, 0x1F, 0x12, 0x0A, 0x0E, 0x0A, 0x02, 0x02, 0x07, 0x00, 0x00}, /* "F",38 */
+    {0x00, 0x00, 0x1C, 0x12, 0x01, 0x01, 0x39, 0x11, 0x12, 0x0C, 0x00, 0x00}, /* "G",39 */
+    {0x00, 0x00, 0x33, 0x12, 0x12, 0x1E, 0x12, 0x12, 0x12, 0x33, 0x00, 0x00}, /* "H",40 */
+    {0x00, 0x00, 0x1F, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x1F, 0x00, 0x00}, /* "I",41 */
+    {0x00, 0x00, 0x3E, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x09, 0x07}, /* "J",42 */
+    {0x00, 0x00, 0x37, 0x12, 0x0A, 0x06, 0x0A, 0x12, 0x12, 0x37, 0x00, 0x00}, /* "K",43 */
+    {0x00, 0x00, 0x07, 0x02, 0x02, 0x02, 0x02, 0x02, 0x22, 0x3F, 0x00, 0x00}, /* "L",44 */
+    {0x00, 0x00, 0x3B, 0x1B, 0x1B, 0x1B, 0x15, 0x15, 0x15, 0x35, 0x00, 0x00}, /* "M",45 */
+    {0x00, 0x00, 0x3B, 0x12, 0x16, 0x16, 0x1A, 0x1A, 0x12, 0x17, 0x00, 0x00}, /* "N",46 */
+    {0x00, 0x00, 0x0E, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E, 0x00, 0x00}, /* "O",47 */
+    {0x00, 0x00, 0x0F, 0x12, 0x12, 0x0E, 0x02, 0x02, 0x02, 0x07, 0x00, 0x00}, /* "P",48 */
+    {0x00, 0x00, 0x0E, 0x11, 0x11, 0x11, 0x11, 0x17, 0x19, 0x0E, 0x18, 0x00}, /* "Q",49 */
+    {0x00, 0x00, 0x0F, 0x12, 0x12, 0x0E, 0x0A, 0x12, 0x12, 0x37, 0x00, 0x00}, /* "R",50 */
+    {0x00, 0x00, 0x1E, 0x11, 0x01, 0x06, 0x08, 0x10, 0x11, 0x0F, 0x00, 0x00}, /* "S",51 */
+    {0x00, 0x00, 0x1F, 0x15, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0E, 0x00, 0x00}, /* "T",52 */
+    {0x00, 0x00, 0x33, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x0C, 0x00, 0x00}, /* "U",53 */
+    {0x00, 0x00, 0x33, 0x12, 0x12, 0x0A, 0x0A, 0x0C, 0x04, 0x04, 0x00, 0x00}, /* "V",54 */
+    {0x00, 0x00, 0x15, 0x15, 0x15, 0x15, 0x0E, 0x0A, 0x0A, 0x0A, 0x00, 0x00}, /* "W",55 */
+    {0x00, 0x00, 0x1B, 0x0A, 0x0A, 0x04, 0x04, 0x0A, 0x0A, 0x1B, 0x00, 0x00}, /* "X",56 */
+    {0x00, 0x00, 0x1B, 0x0A, 0x0A, 0x0A, 0x04, 0x04, 0x04, 0x0E, 0x00, 0x00}, /* "Y",57 */
+    {0x00, 0x00, 0x1F, 0x09, 0x08, 0x04, 0x04, 0x02, 0x12, 0x1F, 0x00, 0x00}, /* "Z",58 */
+    {0x1C, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x1C, 0x00}, /* "[",59 */
+    {0x00, 0x02, 0x02, 0x04, 0x04, 0x04, 0x08, 0x08, 0x08, 0x10, 0x10, 0x00}, /* "\",60 */
+    {0x0E, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0E, 0x00}, /* "]",61 */
+    {0x04, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* "^",62 */
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F}, /* "_",63 */
+    {0x02, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* "`",64 */
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x12, 0x1C, 0x12, 0x3C, 0x00, 0x00}, /* "a",65 */
+    {0x00, 0x03, 0x02, 0x02, 0x02, 0x0E, 0x12, 0x12, 0x12, 0x0E, 0x00, 0x00}, /* "b",66 */
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x12, 0x02, 0x12, 0x0C, 0x00, 0x00}, /* "c",67 */
+    {0x00, 0x18, 0x10, 0x10, 0x10, 0x1C, 0x12, 0x12, 0x12, 0x3C, 0x00, 0x00}, /* "d",68 */
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x12, 0x1E, 0x02, 0x1C, 0x00, 0x00}, /* "e",69 */
+    {0x00, 0x18, 0x24, 0x04, 0x04, 0x1E, 0x04, 0x04, 0x04, 0x1E, 0x00, 0x00}, /* "f",70 */
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x12, 0x0C, 0x02, 0x1C, 0x22, 0x1C}, /* "g",71 */
+    {0x00, 0x03, 0x02, 0x02, 0x02, 0x0E, 0x12, 0x12, 0x12, 0x37, 0x00, 0x00}, /* "h",72 */
+    {0x00, 0x04, 0x04, 0x00, 0x00, 0x06, 0x04, 0x04, 0x04, 0x0E, 0x00, 0x00}, /* "i",73 */
+    {0x00, 0x08, 0x08, 0x00, 0x00, 0x0C, 0x08, 0x08, 0x08, 0x08, 0x08, 0x07}, /* "j",74 */
+    {0x00, 0x03, 0x02, 0x02, 0x02, 0x1A, 0x0A, 0x06, 0x0A, 0x13, 0x00, 0x00}, /* "k",75 */
+    {0x00, 0x07, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x1F, 0x00, 0x00}, /* "l",76 */
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x15, 0x15, 0x15, 0x15, 0x00, 0x00}, /* "m",77 */
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x12, 0x12, 0x12, 0x37, 0x00, 0x00}, /* "n",78 */
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x12, 0x12, 0x12, 0x0C, 0x00, 0x00}, /* "o",79 */
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x12, 0x12, 0x12, 0x0E, 0x02, 0x07}, /* "p",80 */
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x12, 0x12, 0x12, 0x1C, 0x10, 0x38}, /* "q",81 */
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x06, 0x02, 0x02, 0x07, 0x00, 0x00}, /* "r",82 */
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x02, 0x0C, 0x10, 0x1E, 0x00, 0x00}, /* "s",83 */
+    {0x00, 0x00, 0x00, 0x04, 0x04, 0x1E, 0x04, 0x04, 0x04, 0x1C, 0x00, 0x00}, /* "t",84 */
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x12, 0x12, 0x12, 0x3C, 0x00, 0x00}, /* "u",85 */
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x0A, 0x0A, 0x04, 0x04, 0x00, 0x00}, /* "v",86 */
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x15, 0x0E, 0x0A, 0x0A, 0x00, 0x00}, /* "w",87 */
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x0A, 0x04, 0x0A, 0x1B, 0x00, 0x00}, /* "x",88 */
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x12, 0x12, 0x0C, 0x08, 0x04, 0x03}, /* "y",89 */
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x08, 0x04, 0x04, 0x1E, 0x00, 0x00}, /* "z",90 */
+    {0x18, 0x08, 0x08, 0x08, 0x08, 0x0C, 0x08, 0x08, 0x08, 0x08, 0x18, 0x00}, /* "{",91 */
+    {0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08}, /* "|",92 */
+    {0x06, 0x04, 0x04, 0x04, 0x04, 0x08, 0x04, 0x04, 0x04, 0x04, 0x06, 0x00}, /* "}",93 */
+    {0x16, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /* "~",94 */
+};
+
+/* 汉字字库的Unicode码点索引，按升序排列，四种字号共用。
+ * 字库由tools/lcd_font_gen.py生成，新增汉字后需重新生成以保持有序，
+ * 第i个码点对应各字号字库中的第i个字模
+ */
+static const uint16_t cjk_index[] = {
+    0x51CC, /* "凌" */
+    0x5C0F, /* "小" */
+    0x6D3E, /* "派" */
+};
+
+/* 汉字数目 */
+#define CJK_GLYPH_NUM       (sizeof(cjk_index) / sizeof(cjk_index[0]))
+
+/* 定义中文字符 12*12 */
+static const unsigned char cjk_1212[][24] = {
+    {
+        0x40, 0x00, 0xF9, 0x03, 0x42, 0x00, 0xFC, 0x07, 0x10, 0x01, 0x28, 0x02, 0xE0, 0x01, 0x14, 0x01,
+        0xAA, 0x00, 0x41, 0x00, 0xB0, 0x01, 0x0C, 0x06, /* "凌",0 */
+    },
+    {
+        0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x24, 0x01, 0x24, 0x02, 0x22, 0x02, 0x22, 0x04,
+        0x21, 0x04, 0x20, 0x00, 0x20, 0x00, 0x38, 0x00, /* "小",1 */
+    },
+    {
+        0x00, 0x03, 0xF2, 0x00, 0x14, 0x02, 0xD0, 0x01, 0x51, 0x01, 0x52, 0x05, 0x50, 0x03, 0x50, 0x01,
+        0x54, 0x01, 0x52, 0x02, 0xD1, 0x02, 0x48, 0x04, /* "派",2 */
+    },
+};
+
+/* 定义中文字符 16*16 */
+static const unsigned char cjk_1616[][32] = {
+    {
+        0x00, 0x02, 0x02, 0x02, 0xC4, 0x1F, 0x04, 0x02, 0x00, 0x02, 0xE0, 0x7F, 0x88, 0x08, 0x48, 0x11,
+        0x24, 0x21, 0x87, 0x0F, 0xC4, 0x08, 0x24, 0x05, 0x04, 0x02, 0x04, 0x05, 0xC4, 0x08, 0x30, 0x30, /* "凌",0 */
+    },
+    {
+        0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x88, 0x08, 0x88, 0x10, 0x88, 0x20,
+        0x84, 0x20, 0x84, 0x40, 0x82, 0x40, 0x81, 0x40, 0x80, 0x00, 0x80, 0x00, 0xA0, 0x00, 0x40, 0x00, /* "小",1 */
+    },
+    {
+        0x00, 0x10, 0x04, 0x3C, 0xE8, 0x03, 0x28, 0x00, 0x21, 0x38, 0xA2, 0x07, 0xA2, 0x04, 0xA8, 0x44,
+        0xA8, 0x24, 0xA4, 0x14, 0xA7, 0x08, 0xA4, 0x08, 0xA4, 0x10, 0x94, 0x22, 0x94, 0x41, 0x88, 0x00, /* "派",2 */
+    },
+};
+
+/* 定义中文字符 24*24 */
+static const unsigned char cjk_2424[][72] = {
+    {
+        0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x00, 0x04, 0x40, 0x00, 0x08, 0xFE, 0x0F, 0x98,
+        0x40, 0x00, 0x50, 0x40, 0x00, 0x40, 0x40, 0x10, 0xC0, 0xFF, 0x3F, 0x20, 0x08, 0x01, 0x20, 0x0C,
+        0x0E, 0x20, 0x12, 0x38, 0x10, 0x19, 0x30, 0x90, 0xF8, 0x03, 0x1A, 0x0C, 0x02, 0x1C, 0x16, 0x01,
+        0x08, 0x92, 0x01, 0x88, 0xA1, 0x00, 0x48, 0x40, 0x00, 0x0C, 0xB0, 0x00, 0x08, 0x18, 0x07, 0x00,
+        0x07, 0x7E, 0xE0, 0x00, 0x10, 0x00, 0x00, 0x00, /* "凌",0 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x10, 0x00, 0x00,
+        0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x80, 0x90, 0x00, 0x80, 0x11, 0x01, 0xC0, 0x10,
+        0x02, 0x40, 0x10, 0x04, 0x60, 0x10, 0x1C, 0x30, 0x10, 0x18, 0x10, 0x10, 0x30, 0x08, 0x10, 0x30,
+        0x04, 0x10, 0x20, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x19, 0x00, 0x00,
+        0x1E, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, /* "小",1 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x08, 0x20, 0x00, 0x1F, 0x60, 0xFC, 0x00, 0x00,
+        0x04, 0x00, 0x00, 0x04, 0x18, 0x82, 0x04, 0x0F, 0x84, 0xE4, 0x00, 0x48, 0xA4, 0x00, 0x48, 0x24,
+        0x31, 0x40, 0x24, 0x19, 0x20, 0x24, 0x07, 0x20, 0x26, 0x01, 0x20, 0x26, 0x01, 0x10, 0x22, 0x02,
+        0x1C, 0x22, 0x02, 0x10, 0x22, 0x04, 0x18, 0x21, 0x0C, 0x18, 0x21, 0x19, 0x98, 0xE0, 0x78, 0x50,
+        0x20, 0x10, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, /* "派",2 */
+    },
+};
+
+/* 定义中文字符 32*32 */
+static const unsigned char cjk_3232[][128] = {
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1C, 0x00,
+        0x04, 0x00, 0x0C, 0x00, 0x08, 0x00, 0x0C, 0x00, 0x30, 0x00, 0x0C, 0x03, 0x70, 0xF2, 0xFF, 0x07,
+        0x60, 0x02, 0x0C, 0x00, 0x20, 0x02, 0x0C, 0x00, 0x00, 0x01, 0x0C, 0x18, 0x00, 0xFF, 0xFF, 0x3F,
+        0x00, 0xC1, 0x20, 0x00, 0x80, 0xC0, 0xC1, 0x01, 0x80, 0x60, 0x00, 0x07, 0x80, 0x30, 0x03, 0x1E,
+        0x40, 0x08, 0x03, 0x1C, 0x40, 0x84, 0x81, 0x18, 0x60, 0xC2, 0xFF, 0x01, 0x20, 0xC0, 0xC0, 0x00,
+        0x3C, 0x60, 0xC1, 0x00, 0x30, 0x30, 0x61, 0x00, 0x30, 0x18, 0x32, 0x00, 0x30, 0x04, 0x36, 0x00,
+        0x30, 0x02, 0x1C, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x37, 0x00, 0x30, 0x80, 0xE1, 0x00,
+        0x00, 0x60, 0xC0, 0x1F, 0x00, 0x1C, 0x00, 0x3F, 0xC0, 0x03, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, /* "凌",0 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x07, 0x00,
+        0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00,
+        0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x82, 0x01, 0x00, 0x00, 0x8E, 0x21, 0x00,
+        0x00, 0x86, 0x41, 0x00, 0x00, 0x87, 0x81, 0x00, 0x00, 0x83, 0x81, 0x01, 0x80, 0x81, 0x01, 0x03,
+        0x80, 0x81, 0x01, 0x06, 0xC0, 0x80, 0x01, 0x0E, 0x40, 0x80, 0x01, 0x1C, 0x60, 0x80, 0x01, 0x1C,
+        0x30, 0x80, 0x01, 0x18, 0x10, 0x80, 0x01, 0x18, 0x08, 0x80, 0x01, 0x10, 0x04, 0x80, 0x01, 0x00,
+        0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x8C, 0x01, 0x00,
+        0x00, 0xF0, 0x01, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "小",1 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0x0F,
+        0xC0, 0x01, 0xF0, 0x0F, 0x80, 0xE1, 0x0F, 0x00, 0x80, 0x61, 0x00, 0x00, 0x00, 0x61, 0x00, 0x04,
+        0x00, 0x64, 0x00, 0x0F, 0x00, 0x64, 0xE0, 0x03, 0x0C, 0x62, 0x1E, 0x00, 0x18, 0x62, 0x26, 0x00,
+        0x38, 0x62, 0x26, 0x00, 0x30, 0x61, 0x26, 0x18, 0x30, 0x21, 0x26, 0x1C, 0x00, 0x21, 0x26, 0x06,
+        0x80, 0x20, 0xA6, 0x01, 0x80, 0x20, 0x46, 0x00, 0x80, 0x20, 0x46, 0x00, 0xC0, 0x30, 0x46, 0x00,
+        0x40, 0x30, 0xC6, 0x00, 0x7C, 0x30, 0x86, 0x00, 0x70, 0x10, 0x86, 0x01, 0x60, 0x18, 0x86, 0x01,
+        0x60, 0x08, 0x06, 0x03, 0x70, 0x08, 0x46, 0x06, 0x70, 0x04, 0x36, 0x0E, 0x70, 0x06, 0x1E, 0x3C,
+        0x70, 0x02, 0x06, 0x18, 0x00, 0x01, 0x02, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "派",2 */
+    },
+};
+
+/* 字体列表，lcd_draw_text按字号和码点在列表中查找字模。data为NULL的字体由母版缩小生成 */
+const lcd_font_t lcd_fonts[] = {
+    {6,  12, ASCII_FIRST, ASCII_COUNT, NULL, ascii_1206[0]},
+    {8,  16, ASCII_FIRST, ASCII_COUNT, NULL, NULL},
+    {12, 24, ASCII_FIRST, ASCII_COUNT, NULL, NULL},
+    {16, 32, ASCII_FIRST, ASCII_COUNT, NULL, NULL},
+    {12, 12, 0, CJK_GLYPH_NUM, cjk_index, cjk_1212[0]},
+    {16, 16, 0, CJK_GLYPH_NUM, cjk_index, cjk_1616[0]},
+    {24, 24, 0, CJK_GLYPH_NUM, cjk_index, cjk_2424[0]},
+    {32, 32, 0, CJK_GLYPH_NUM, cjk_index, cjk_3232[0]},
+};
+
+const uint8_t lcd_fonts_num = sizeof(lcd_fonts) / sizeof(lcd_fonts[0]);
+
+/* 抗锯齿字体列表，32号直接使用母版，data为NULL的字体由母版缩小生成 */
+const lcd_font_aa_t lcd_fonts_aa[] = {
+#if LCD_FONT_AA_SCALED
+    {8,  16, ASCII_FIRST, ASCII_COUNT, NULL},
+    {12, 24, ASCII_FIRST, ASCII_COUNT, NULL},
+#endif
+    {16, 32, ASCII_FIRST, ASCII_COUNT, ascii_aa_3216[0]},
+};
+
+const uint8_t lcd_fonts_aa_num = sizeof(lcd_fonts_aa) / sizeof(lcd_fonts_aa[0]);
+
+
+/* 一个输出像素在某个方向上覆盖的母版像素及各自的重叠长度 */
+typedef struct {
+    uint8_t first;                      /* 第一个重叠的母版像素 */
+    uint8_t num;                        /* 重叠的母版像素数 */
+    uint8_t weight[FONT_SPAN_MAX];      /* 每个母版像素的重叠长度 */
+} lcd_font_span_t;
+
+
+/***************************************************************
+ * 函数名称: lcd_font_spans
+ * 说    明: 计算一个方向上的盒式滤波权重。坐标按整数放大：输出像素t
+ *           覆盖[t * src_len, (t + 1) * src_len)，母版像素s覆盖
+ *           [s * dst_len, (s + 1) * dst_len)，重叠长度即为权重，
+ *           每个输出像素的权重之和为src_len
+ * 参    数:
+ *       @spans：输出，每个输出像素一项
+ *       @dst_len：输出的像素数
+ *       @src_len：母版的像素数
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_font_spans(lcd_font_span_t *spans, uint8_t dst_len, uint8_t src_len)
+{
+    uint16_t lo, hi, s_lo, s_hi;
+    uint8_t t, s;
+
+    for (t = 0; t < dst_len; t++) {
+        lo = (uint16_t)t * src_len;
+        hi = lo + src_len;
+        spans[t].first = (uint8_t)(lo / dst_len);
+        spans[t].num = 0;
+        for (s = spans[t].first; s < src_len && (uint16_t)s * dst_len < hi &&
+             spans[t].num < FONT_SPAN_MAX; s++) {
+            s_lo = (uint16_t)s * dst_len;
+            s_hi = s_lo + dst_len;
+            spans[t].weight[spans[t].num++] = (uint8_t)(((s_hi < hi) ? s_hi : hi) - ((s_lo > lo) ? s_lo : lo));
+        }
+    }
+}
+
+
+/* 读取母版字模中一个像素的覆盖率(0~15) */
+static inline uint8_t lcd_font_master_level(const uint8_t *row, uint8_t x)
+{
+    return (x & 1) ? (row[x / 2] & 0x0F) : (row[x / 2] >> 4);
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_font_scale_to
+ * 说    明: 用盒式滤波把母版中的一个字模缩小为width*height的1-bpp
+ *           或4-bpp字模。每个输出像素是所覆盖母版像素的覆盖率按重叠
+ *           面积加权之和，只有整数乘加；4-bpp四舍五入为0~15级，1-bpp
+ *           覆盖率不低于一半时置位
+ * 参    数:
+ *       @dst：存放缩小后的字模
+ *       @master：母版字模，ascii_aa_3216中的一项
+ *       @width/height：输出字模的宽高，不大于母版
+ *       @bpp：输出每像素的位数，1或4
+ * 返 回 值: 缩小后的字模，1-bpp按lcd_font_t的格式，4-bpp按lcd_font_aa_t的格式
+ ***************************************************************/
+static uint8_t *lcd_font_scale_to(uint8_t *dst, const uint8_t *master, uint8_t width, uint8_t height, uint8_t bpp)
+{
+    lcd_font_span_t xs[LCD_FONT_MASTER_WIDTH];
+    lcd_font_span_t ys[LCD_FONT_MASTER_HEIGHT];
+    const uint8_t *row;
+    uint8_t src_stride = (LCD_FONT_MASTER_WIDTH + 1) / 2;
+    uint8_t dst_stride = (bpp == 1) ? ((width + BYTE_TO_BITS - 1) / BYTE_TO_BITS) : ((width + 1) / 2);
+    /* 每个输出像素的权重之和 */
+    uint32_t weight = (uint32_t)LCD_FONT_MASTER_WIDTH * LCD_FONT_MASTER_HEIGHT;
+    uint32_t acc, part;
+    uint8_t tx, ty, i, j;
+
+    lcd_font_spans(xs, width, LCD_FONT_MASTER_WIDTH);
+    lcd_font_spans(ys, height, LCD_FONT_MASTER_HEIGHT);
+    memset(dst, 0, (uint32_t)dst_stride * height);
+
+    for (ty = 0; ty < height; ty++) {
+        for (tx = 0; tx < width; tx++) {
+            acc = 0;
+            for (j = 0; j < ys[ty].num; j++) {
+                row = master + (ys[ty].first + j) * src_stride;
+                part = 0;
+                for (i = 0; i < xs[tx].num; i++) {
+                    part += lcd_font_master_level(row, xs[tx].first + i) * xs[tx].weight[i];
+                }
+                acc += part * ys[ty].weight[j];
+            }
+            if (bpp == 1) {
+                if (acc * 2 >= weight * FONT_AA_LEVEL_MAX) {
+                    dst[ty * dst_stride + tx / BYTE_TO_BITS] |= (uint8_t)(0x01 << (tx % BYTE_TO_BITS));
+                }
+            } else {
+                dst[ty * dst_stride + tx / 2] |=
+                    (uint8_t)(((acc + weight / 2) / weight) << ((tx & 1) ? 0 : FONT_AA_BPP));
+            }
+        }
+    }
+    return dst;
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_font_scale_glyph
+ * 说    明: 把母版中的一个字模缩小为1-bpp或4-bpp字模，字模缓存未命中
+ *           时调用，结果在下一次调用前有效
+ * 参    数:
+ *       @master：母版字模，ascii_aa_3216中的一项
+ *       @width/height：输出字模的宽高，不大于母版
+ *       @bpp：输出每像素的位数，1或4
+ * 返 回 值: 缩小后的字模，1-bpp按lcd_font_t的格式，4-bpp按lcd_font_aa_t的格式
+ ***************************************************************/
+const uint8_t *lcd_font_scale_glyph(const uint8_t *master, uint8_t width, uint8_t height, uint8_t bpp)
+{
+    return lcd_font_scale_to(m_scaled_glyph, master, width, height, bpp);
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_font_scaled_mask
+ * 说    明: 取母版中的一个字模缩小后的1-bpp点阵。点阵按母版字模和宽高
+ *           缓存，只在未命中时缩小，缓存满时淘汰最近最少使用的条目
+ * 参    数:
+ *       @master：母版字模，ascii_aa_3216中的一项
+ *       @width/height：点阵的宽高，不大于母版
+ * 返 回 值: 1-bpp点阵，按lcd_font_t的格式，在下一次调用前有效
+ ***************************************************************/
+const uint8_t *lcd_font_scaled_mask(const uint8_t *master, uint8_t width, uint8_t height)
+{
+#if LCD_FONT_MASK_CACHE_NUM
+    lcd_font_mask_entry_t *entry;
+    int i, victim = 0;
+
+    for (i = 0; i < LCD_FONT_MASK_CACHE_NUM; i++) {
+        entry = &m_mask_entries[i];
+        if (entry->master == master && entry->width == width && entry->height == height) {
+            entry->tick = ++m_mask_tick;
+            return m_mask_data[i];
+        }
+        /* 空闲条目的tick为0，总是先被选中 */
+        if (entry->tick < m_mask_entries[victim].tick) {
+            victim = i;
+        }
+    }
+
+    entry = &m_mask_entries[victim];
+    entry->master = master;
+    entry->width = width;
+    entry->height = height;
+    entry->tick = ++m_mask_tick;
+    return lcd_font_scale_to(m_mask_data[victim], master, width, height, 1);
+#else
+    return lcd_font_scale_glyph(master, width, height, 1);
+#endif
+}
@@ -0,0 +1,1727 @@
+/*
+ * Copyright 2010, 2012 Adobe Systems Incorporated (http://www.adobe.com/), with Reserved Font Name 'Source'.
+ *
+ * This Font Software is licensed under the SIL Open Font License, Version 1.1.
+ * The license text is in OFL.txt at the root of this sample.
+ */
+/*
+ * 4-bpp抗锯齿ASCII字库，由tools/lcd_font_aa_gen.py从Source Code Pro Bold的字形生成，
+ * 属于该字体的修改版本，按SIL OFL 1.1发布，不适用本工程的Apache-2.0许可证。
+ * 每个像素4位(0为背景色，15为字的颜色)，逐行存放，每行占(width + 1) / 2个字节，
+ * 左边的像素在高4位。该字库是所有ASCII字体的母版，其余字号由lcd_font.c缩小生成
+ */
+#include "lcd_internal.h"
+
+/* 32*16的ASCII码显示 */
+const uint8_t ascii_aa_3216[][256] = {
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* " ",0 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xDF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFC, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xBF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFB, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x8F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF7, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x28, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x5C, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x40, 0x00, 0x00,
+        0x00, 0x00, 0x08, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x60, 0x00, 0x00,
+        0x00, 0x00, 0x01, 0xCF, 0xFC, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "!",1 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x77, 0x50, 0x05, 0x77, 0x74, 0x00,
+        0x00, 0x7F, 0xFF, 0xC0, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xB0, 0x0B, 0xFF, 0xF7, 0x00,
+        0x00, 0x6F, 0xFF, 0xB0, 0x0A, 0xFF, 0xF7, 0x00, 0x00, 0x5F, 0xFF, 0xA0, 0x09, 0xFF, 0xF6, 0x00,
+        0x00, 0x3F, 0xFF, 0x70, 0x07, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0x50, 0x05, 0xFF, 0xF1, 0x00,
+        0x00, 0x0E, 0xFF, 0x30, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x0C, 0xFF, 0x10, 0x00, 0xFF, 0xC0, 0x00,
+        0x00, 0x09, 0xFE, 0x00, 0x00, 0xDF, 0xA0, 0x00, 0x00, 0x02, 0x54, 0x00, 0x00, 0x45, 0x30, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* """,2 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x04, 0x85, 0x00, 0x68, 0x40, 0x00, 0x00, 0x00, 0x09, 0xF8, 0x00, 0xCF, 0x50, 0x00,
+        0x00, 0x00, 0x0B, 0xF6, 0x00, 0xEF, 0x30, 0x00, 0x00, 0x00, 0x0D, 0xF4, 0x01, 0xFF, 0x10, 0x00,
+        0x00, 0x26, 0x6F, 0xF7, 0x67, 0xFF, 0x65, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
+        0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0x7F, 0xC1, 0x19, 0xF9, 0x11, 0x00,
+        0x00, 0x00, 0x8F, 0xA0, 0x0B, 0xF7, 0x00, 0x00, 0x00, 0x22, 0xAF, 0x92, 0x2D, 0xF7, 0x21, 0x00,
+        0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00,
+        0x00, 0x34, 0xFF, 0x64, 0x6F, 0xF4, 0x42, 0x00, 0x00, 0x02, 0xFF, 0x10, 0x5F, 0xD0, 0x00, 0x00,
+        0x00, 0x04, 0xFE, 0x00, 0x6F, 0xB0, 0x00, 0x00, 0x00, 0x05, 0xFC, 0x00, 0x8F, 0x90, 0x00, 0x00,
+        0x00, 0x07, 0xFA, 0x00, 0xAF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "#",3 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x2E, 0xE5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF5, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x2F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x9F, 0xFB, 0x61, 0x00, 0x00,
+        0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xFE, 0x60, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x00,
+        0x00, 0x3F, 0xFF, 0xC5, 0x57, 0xDF, 0x70, 0x00, 0x00, 0x5F, 0xFF, 0x50, 0x00, 0x05, 0x00, 0x00,
+        0x00, 0x3F, 0xFF, 0xE7, 0x10, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFA, 0x40, 0x00, 0x00,
+        0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xFB, 0x20, 0x00, 0x00, 0x00, 0x05, 0xBF, 0xFF, 0xFF, 0xD1, 0x00,
+        0x00, 0x00, 0x00, 0x02, 0x8E, 0xFF, 0xF7, 0x00, 0x00, 0x03, 0x10, 0x00, 0x02, 0xEF, 0xFA, 0x00,
+        0x00, 0x1E, 0xE7, 0x20, 0x03, 0xFF, 0xF9, 0x00, 0x00, 0xAF, 0xFF, 0xFE, 0xEF, 0xFF, 0xF4, 0x00,
+        0x00, 0x7E, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x02, 0x8C, 0xFF, 0xFE, 0xB4, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x3F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF5, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x2F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xC4, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "$",4 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x04, 0x76, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xE5, 0x00, 0x00, 0x19, 0x00,
+        0x08, 0xFF, 0x9C, 0xFE, 0x10, 0x00, 0xCF, 0xB0, 0x0D, 0xFA, 0x02, 0xFF, 0x60, 0x09, 0xFF, 0xA0,
+        0x0F, 0xF8, 0x00, 0xFF, 0x80, 0x7F, 0xF9, 0x00, 0x0E, 0xF9, 0x01, 0xFF, 0x74, 0xFF, 0x80, 0x00,
+        0x0B, 0xFD, 0x16, 0xFF, 0x47, 0xF7, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFB, 0x00, 0x30, 0x00, 0x00,
+        0x00, 0x4C, 0xFE, 0x91, 0x00, 0x34, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x2C, 0xFF, 0xF8, 0x00,
+        0x00, 0x00, 0x2B, 0x30, 0xDF, 0xED, 0xFF, 0x60, 0x00, 0x02, 0xDF, 0x95, 0xFF, 0x40, 0xBF, 0xC0,
+        0x00, 0x3E, 0xFC, 0x07, 0xFF, 0x10, 0x8F, 0xF0, 0x04, 0xEF, 0xD2, 0x07, 0xFF, 0x10, 0x8F, 0xF0,
+        0x0D, 0xFF, 0x30, 0x05, 0xFF, 0x40, 0xBF, 0xC0, 0x03, 0xE6, 0x00, 0x00, 0xDF, 0xEC, 0xFF, 0x60,
+        0x00, 0x10, 0x00, 0x00, 0x2D, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x20, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "%",5 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x5B, 0xDD, 0x91, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFD, 0x10, 0x00, 0x00,
+        0x00, 0x1E, 0xFF, 0xAD, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x5F, 0xFC, 0x04, 0xFF, 0x90, 0x00, 0x00,
+        0x00, 0x7F, 0xFA, 0x05, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x5F, 0xFC, 0x1D, 0xFF, 0x40, 0x00, 0x00,
+        0x00, 0x1F, 0xFF, 0xEF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xA0, 0x01, 0x66, 0x61,
+        0x00, 0x2D, 0xFF, 0xFB, 0x00, 0x05, 0xFF, 0xF1, 0x01, 0xDF, 0xFF, 0xFF, 0x50, 0x0A, 0xFF, 0xB0,
+        0x09, 0xFF, 0xFC, 0xFF, 0xF6, 0x1F, 0xFF, 0x50, 0x0E, 0xFF, 0xA1, 0xDF, 0xFF, 0xCF, 0xFD, 0x00,
+        0x1F, 0xFF, 0x80, 0x2E, 0xFF, 0xFF, 0xF6, 0x00, 0x0E, 0xFF, 0xC0, 0x02, 0xDF, 0xFF, 0xF7, 0x10,
+        0x0A, 0xFF, 0xFD, 0x9A, 0xFF, 0xFF, 0xFF, 0xE2, 0x02, 0xEF, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 0xE0,
+        0x00, 0x2B, 0xFF, 0xFF, 0xE8, 0x12, 0x9F, 0x90, 0x00, 0x00, 0x14, 0x53, 0x00, 0x00, 0x01, 0x20,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "&",6 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x77, 0x77, 0x10, 0x00, 0x00,
+        0x00, 0x00, 0x02, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x10, 0x00, 0x00,
+        0x00, 0x00, 0x01, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xDF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFB, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x8F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF6, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x51, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "'",7 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x01, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFC, 0x10, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x10, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE2, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFA, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x01, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xC0, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x0A, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x0E, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x20, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x0F, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0x30, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x0C, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0x80, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x05, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xF3, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x8F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x06, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFD, 0x20, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x0B, 0xFA, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "(",8 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x07, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xCF, 0xC1, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x01, 0xCF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0x70, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x04, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xF9, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x2F, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0x60, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x07, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xD0, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x05, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x90, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x0C, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x10, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xE1, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x3E, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDF, 0xF9, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x01, 0xAF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* ")",9 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x07, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF1, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x2F, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF3, 0x00, 0x00, 0x00,
+        0x00, 0x8B, 0x73, 0x4F, 0xF4, 0x37, 0xB8, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
+        0x00, 0x18, 0xEF, 0xFF, 0xFF, 0xFE, 0x81, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x70, 0x00, 0x00,
+        0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFA, 0xAF, 0xF5, 0x00, 0x00,
+        0x00, 0x01, 0xDF, 0xC1, 0x1C, 0xFD, 0x10, 0x00, 0x00, 0x05, 0xFE, 0x20, 0x02, 0xEF, 0x50, 0x00,
+        0x00, 0x00, 0x53, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "*",10 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x27, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF6, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x6F, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF6, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x6F, 0xF6, 0x00, 0x00, 0x00, 0x00, 0xAB, 0xBB, 0xDF, 0xFD, 0xBB, 0xBA, 0x00,
+        0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xCE, 0xEE, 0xEF, 0xFE, 0xEE, 0xEC, 0x00,
+        0x00, 0x00, 0x00, 0x6F, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF6, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x6F, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF6, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x49, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "+",11 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x73, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x03, 0xEF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
+        0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x5A, 0xEF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xF2, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x04, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 0xFF, 0x40, 0x00, 0x00,
+        0x00, 0x00, 0x0C, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFD, 0x50, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* ",",12 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBA, 0x00,
+        0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0xCE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEC, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "-",13 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x94, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x05, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
+        0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xB0, 0x00, 0x00,
+        0x00, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* ".",14 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xF8, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xC0, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x10, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x7F, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xF4, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x04, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0x80, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x1E, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFB, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xBF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xE1, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x08, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x4F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xF7, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x01, 0xEF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x0C, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x8F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "/",15 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x01, 0x47, 0x74, 0x10, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xE5, 0x00, 0x00,
+        0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x2E, 0xFF, 0xD7, 0x7D, 0xFF, 0xE2, 0x00,
+        0x00, 0x8F, 0xFE, 0x10, 0x01, 0xEF, 0xF8, 0x00, 0x00, 0xCF, 0xF8, 0x00, 0x00, 0x8F, 0xFC, 0x00,
+        0x01, 0xFF, 0xF5, 0x01, 0x10, 0x5F, 0xFF, 0x10, 0x02, 0xFF, 0xF3, 0x6F, 0xF6, 0x3F, 0xFF, 0x20,
+        0x03, 0xFF, 0xF2, 0xDF, 0xFD, 0x2F, 0xFF, 0x30, 0x03, 0xFF, 0xF2, 0xCF, 0xFC, 0x2F, 0xFF, 0x30,
+        0x02, 0xFF, 0xF3, 0x2A, 0xA2, 0x3F, 0xFF, 0x20, 0x00, 0xFF, 0xF5, 0x00, 0x00, 0x5F, 0xFF, 0x00,
+        0x00, 0xBF, 0xFA, 0x00, 0x00, 0xAF, 0xFB, 0x00, 0x00, 0x6F, 0xFF, 0x30, 0x03, 0xFF, 0xF6, 0x00,
+        0x00, 0x1D, 0xFF, 0xEA, 0xAE, 0xFF, 0xD1, 0x00, 0x00, 0x03, 0xEF, 0xFF, 0xFF, 0xFE, 0x30, 0x00,
+        0x00, 0x00, 0x3C, 0xFF, 0xFF, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x42, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "0",16 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x01, 0x33, 0x10, 0x00, 0x00, 0x00, 0x00, 0x03, 0x9F, 0xFF, 0x60, 0x00, 0x00,
+        0x00, 0x08, 0xEF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00,
+        0x00, 0x07, 0x99, 0xBF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x60, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x6F, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x60, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x6F, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x60, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x6F, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x60, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x6F, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x60, 0x00, 0x00,
+        0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10,
+        0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "1",17 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x04, 0x67, 0x63, 0x00, 0x00, 0x00, 0x00, 0x06, 0xEF, 0xFF, 0xFF, 0xC2, 0x00, 0x00,
+        0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFE, 0x20, 0x00, 0x01, 0xDF, 0xFC, 0x78, 0xCF, 0xFF, 0xA0, 0x00,
+        0x00, 0x1C, 0x60, 0x00, 0x0C, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF2, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xB0, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xF9, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x4F, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFC, 0x10, 0x00, 0x00,
+        0x00, 0x00, 0x6F, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFB, 0x22, 0x33, 0x33, 0x00,
+        0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+        0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "2",18 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x04, 0x67, 0x64, 0x00, 0x00, 0x00, 0x00, 0x07, 0xEF, 0xFF, 0xFF, 0xE6, 0x00, 0x00,
+        0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x5F, 0xFC, 0x87, 0xAF, 0xFF, 0xF2, 0x00,
+        0x00, 0x07, 0x60, 0x00, 0x09, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x2D, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x07, 0xAC, 0xFF, 0xFD, 0x30, 0x00,
+        0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xB1, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x40, 0x00,
+        0x00, 0x00, 0x01, 0x13, 0x7D, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFB, 0x00,
+        0x00, 0x02, 0x00, 0x00, 0x00, 0xDF, 0xFD, 0x00, 0x00, 0x7E, 0x61, 0x00, 0x06, 0xFF, 0xFC, 0x00,
+        0x03, 0xFF, 0xFE, 0xCB, 0xEF, 0xFF, 0xF6, 0x00, 0x03, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x00,
+        0x00, 0x18, 0xDF, 0xFF, 0xFF, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x02, 0x45, 0x41, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "3",19 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x10, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00,
+        0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0x80, 0x00,
+        0x00, 0x00, 0x08, 0xFF, 0xCD, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x2E, 0xFF, 0x80, 0x00,
+        0x00, 0x01, 0xDF, 0xF7, 0x0E, 0xFF, 0x80, 0x00, 0x00, 0x09, 0xFF, 0xC0, 0x0E, 0xFF, 0x80, 0x00,
+        0x00, 0x5F, 0xFE, 0x20, 0x0E, 0xFF, 0x80, 0x00, 0x01, 0xEF, 0xF6, 0x00, 0x0E, 0xFF, 0x80, 0x00,
+        0x0A, 0xFF, 0xFB, 0xBB, 0xBF, 0xFF, 0xDB, 0x60, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x90,
+        0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x01, 0x22, 0x22, 0x22, 0x2E, 0xFF, 0x92, 0x10,
+        0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0x80, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "4",20 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x02, 0x33, 0x33, 0x33, 0x33, 0x30, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x00,
+        0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x00,
+        0x00, 0x0E, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x1F, 0xFF, 0x55, 0x64, 0x10, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF9, 0x10, 0x00,
+        0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0x00, 0x00, 0x07, 0xE9, 0x54, 0x7E, 0xFF, 0xF7, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFD, 0x00,
+        0x00, 0x02, 0x00, 0x00, 0x00, 0xEF, 0xFD, 0x00, 0x00, 0x6E, 0x71, 0x00, 0x09, 0xFF, 0xF9, 0x00,
+        0x02, 0xEF, 0xFE, 0xCB, 0xEF, 0xFF, 0xF2, 0x00, 0x02, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00,
+        0x00, 0x06, 0xDF, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x02, 0x45, 0x41, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "5",21 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x15, 0x77, 0x51, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0x91, 0x00,
+        0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x09, 0xFF, 0xFE, 0x99, 0xCF, 0xE2, 0x00,
+        0x00, 0x3F, 0xFF, 0xB1, 0x00, 0x05, 0x40, 0x00, 0x00, 0x8F, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xDF, 0xFA, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF7, 0x4B, 0xFF, 0xFA, 0x20, 0x00,
+        0x01, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xE3, 0x00, 0x02, 0xFF, 0xFF, 0xFB, 0x8B, 0xFF, 0xFC, 0x00,
+        0x01, 0xFF, 0xFD, 0x30, 0x00, 0x8F, 0xFF, 0x10, 0x00, 0xEF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0x30,
+        0x00, 0xAF, 0xFC, 0x00, 0x00, 0x4F, 0xFF, 0x30, 0x00, 0x5F, 0xFF, 0x50, 0x00, 0xAF, 0xFE, 0x10,
+        0x00, 0x0C, 0xFF, 0xFA, 0x8B, 0xFF, 0xF9, 0x00, 0x00, 0x02, 0xDF, 0xFF, 0xFF, 0xFF, 0xC1, 0x00,
+        0x00, 0x00, 0x19, 0xEF, 0xFF, 0xE8, 0x10, 0x00, 0x00, 0x00, 0x00, 0x13, 0x53, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "6",22 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10,
+        0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0x30, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xE1, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x0C, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x20, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xAF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xF9, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x03, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xF4, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x08, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xF2, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x0A, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "7",23 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x01, 0x57, 0x75, 0x10, 0x00, 0x00, 0x00, 0x00, 0x8E, 0xFF, 0xFF, 0xF9, 0x00, 0x00,
+        0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x2F, 0xFF, 0xA3, 0x28, 0xFF, 0xF2, 0x00,
+        0x00, 0x5F, 0xFE, 0x00, 0x00, 0xCF, 0xF6, 0x00, 0x00, 0x5F, 0xFE, 0x00, 0x00, 0xBF, 0xF5, 0x00,
+        0x00, 0x2F, 0xFF, 0xA2, 0x01, 0xEF, 0xE1, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xAC, 0xFF, 0x50, 0x00,
+        0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x03, 0xCF, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
+        0x00, 0x3E, 0xFE, 0x22, 0x8E, 0xFF, 0xF7, 0x00, 0x00, 0xCF, 0xF5, 0x00, 0x02, 0xCF, 0xFE, 0x00,
+        0x01, 0xFF, 0xF3, 0x00, 0x00, 0x6F, 0xFF, 0x10, 0x01, 0xFF, 0xF7, 0x00, 0x00, 0x8F, 0xFF, 0x10,
+        0x00, 0xBF, 0xFF, 0x95, 0x59, 0xFF, 0xFB, 0x00, 0x00, 0x2E, 0xFF, 0xFF, 0xFF, 0xFF, 0xE2, 0x00,
+        0x00, 0x02, 0x9E, 0xFF, 0xFF, 0xE9, 0x20, 0x00, 0x00, 0x00, 0x00, 0x34, 0x43, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "8",24 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x02, 0x67, 0x62, 0x00, 0x00, 0x00, 0x00, 0x02, 0xBF, 0xFF, 0xFF, 0xB2, 0x00, 0x00,
+        0x00, 0x2E, 0xFF, 0xFF, 0xFF, 0xFE, 0x30, 0x00, 0x00, 0xBF, 0xFF, 0x95, 0x8E, 0xFF, 0xD0, 0x00,
+        0x02, 0xFF, 0xF7, 0x00, 0x04, 0xFF, 0xF5, 0x00, 0x04, 0xFF, 0xF2, 0x00, 0x00, 0xCF, 0xFA, 0x00,
+        0x04, 0xFF, 0xF3, 0x00, 0x00, 0x9F, 0xFE, 0x00, 0x02, 0xFF, 0xF9, 0x00, 0x05, 0xFF, 0xFF, 0x00,
+        0x00, 0xBF, 0xFF, 0xDB, 0xDF, 0xFF, 0xFF, 0x10, 0x00, 0x2D, 0xFF, 0xFF, 0xFE, 0xAF, 0xFF, 0x00,
+        0x00, 0x01, 0x8C, 0xED, 0x81, 0x8F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFB, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF7, 0x00, 0x00, 0x06, 0x70, 0x00, 0x2D, 0xFF, 0xE1, 0x00,
+        0x00, 0x5F, 0xFE, 0xBC, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x00,
+        0x00, 0x06, 0xDF, 0xFF, 0xFD, 0x50, 0x00, 0x00, 0x00, 0x00, 0x02, 0x44, 0x20, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "9",25 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8D, 0xD8, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x08, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
+        0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x90, 0x00, 0x00,
+        0x00, 0x00, 0x01, 0xAF, 0xFA, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x94, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x05, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
+        0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xB0, 0x00, 0x00,
+        0x00, 0x00, 0x02, 0xDF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* ":",26 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8D, 0xD8, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x08, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
+        0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x90, 0x00, 0x00,
+        0x00, 0x00, 0x01, 0xAF, 0xFA, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x73, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x03, 0xEF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
+        0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x5A, 0xEF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xF2, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x04, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 0xFF, 0x40, 0x00, 0x00,
+        0x00, 0x00, 0x0C, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFD, 0x50, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* ";",27 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA2, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xFF, 0xF2, 0x00,
+        0x00, 0x00, 0x00, 0x07, 0xEF, 0xFF, 0xA1, 0x00, 0x00, 0x00, 0x03, 0xCF, 0xFF, 0xD5, 0x00, 0x00,
+        0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x10, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFC, 0x30, 0x00, 0x00, 0x00,
+        0x00, 0x0A, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFB, 0x20, 0x00, 0x00, 0x00,
+        0x00, 0x01, 0x9F, 0xFF, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xDF, 0xFF, 0xC3, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x18, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0xF2, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC2, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "<",28 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
+        0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xAC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCA, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
+        0x00, 0xBD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "=",29 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x2F, 0xE6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xB2, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x1A, 0xFF, 0xFE, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0xFF, 0xFC, 0x30, 0x00, 0x00,
+        0x00, 0x00, 0x01, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xCF, 0xFF, 0xA0, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xBF, 0xFF, 0xA0, 0x00,
+        0x00, 0x00, 0x00, 0x7E, 0xFF, 0xF9, 0x10, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0xFD, 0x40, 0x00, 0x00,
+        0x00, 0x09, 0xFF, 0xFF, 0x81, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC3, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x2F, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* ">",30 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x53, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x6E, 0xFF, 0xFF, 0xD5, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00,
+        0x00, 0x08, 0xFF, 0xDA, 0xDF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x66, 0x00, 0x0C, 0xFF, 0xF0, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0x80, 0x00,
+        0x00, 0x00, 0x00, 0x04, 0xEF, 0xFC, 0x10, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xB1, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xCF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x01, 0x88, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x01, 0x9C, 0xA2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFD, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x0D, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x10, 0x00, 0x00,
+        0x00, 0x00, 0x04, 0xEF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x20, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "?",31 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x14, 0x65, 0x30, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xFF, 0xFF, 0xFC, 0x30, 0x00,
+        0x00, 0x03, 0xEF, 0xFF, 0xDE, 0xFF, 0xE2, 0x00, 0x00, 0x1D, 0xFF, 0x81, 0x00, 0x5E, 0xFA, 0x00,
+        0x00, 0x9F, 0xF7, 0x00, 0x00, 0x06, 0xFF, 0x10, 0x01, 0xEF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0x40,
+        0x05, 0xFF, 0x60, 0x00, 0x00, 0x02, 0xEF, 0x50, 0x09, 0xFF, 0x10, 0x00, 0x6B, 0xEF, 0xFF, 0x50,
+        0x0B, 0xFD, 0x00, 0x2D, 0xFF, 0xFF, 0xFF, 0x50, 0x0C, 0xFB, 0x00, 0xDF, 0xF9, 0x46, 0xFF, 0x50,
+        0x0D, 0xFB, 0x03, 0xFF, 0x90, 0x05, 0xFF, 0x50, 0x0C, 0xFB, 0x04, 0xFF, 0x80, 0x08, 0xFF, 0x50,
+        0x0B, 0xFD, 0x01, 0xFF, 0xFB, 0xCF, 0xFF, 0x50, 0x09, 0xFF, 0x10, 0x8F, 0xFF, 0xFA, 0xDF, 0x50,
+        0x06, 0xFF, 0x50, 0x06, 0xBB, 0x60, 0x47, 0x20, 0x01, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x9F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0x60, 0x00, 0x01, 0x40, 0x00,
+        0x00, 0x04, 0xEF, 0xFD, 0x98, 0xAE, 0xE2, 0x00, 0x00, 0x00, 0x3D, 0xFF, 0xFF, 0xFF, 0xE4, 0x00,
+        0x00, 0x00, 0x00, 0x49, 0xBB, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "@",32 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x03, 0x99, 0x99, 0x30, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x90, 0x00, 0x00,
+        0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0xEF, 0xF3, 0x00, 0x00,
+        0x00, 0x00, 0x8F, 0xF9, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xF5, 0x7F, 0xFC, 0x00, 0x00,
+        0x00, 0x02, 0xFF, 0xF2, 0x3F, 0xFF, 0x20, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x0E, 0xFF, 0x70, 0x00,
+        0x00, 0x0B, 0xFF, 0x90, 0x0B, 0xFF, 0xB0, 0x00, 0x00, 0x1F, 0xFF, 0x50, 0x07, 0xFF, 0xF1, 0x00,
+        0x00, 0x6F, 0xFF, 0xED, 0xDE, 0xFF, 0xF6, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00,
+        0x01, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x10, 0x05, 0xFF, 0xF5, 0x11, 0x11, 0x7F, 0xFF, 0x50,
+        0x09, 0xFF, 0xF1, 0x00, 0x00, 0x3F, 0xFF, 0x90, 0x0E, 0xFF, 0xC0, 0x00, 0x00, 0x0E, 0xFF, 0xE0,
+        0x4F, 0xFF, 0x80, 0x00, 0x00, 0x0A, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "A",33 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x59, 0x99, 0x99, 0x97, 0x51, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x60, 0x00,
+        0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0x75, 0x6B, 0xFF, 0xFA, 0x00,
+        0x00, 0x7F, 0xFF, 0x40, 0x00, 0xEF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0xEF, 0xFA, 0x00,
+        0x00, 0x7F, 0xFF, 0x40, 0x08, 0xFF, 0xF3, 0x00, 0x00, 0x7F, 0xFF, 0xED, 0xFF, 0xFE, 0x50, 0x00,
+        0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFA, 0x40, 0x00, 0x00, 0x7F, 0xFF, 0xCB, 0xCE, 0xFF, 0xF9, 0x00,
+        0x00, 0x7F, 0xFF, 0x40, 0x00, 0x9F, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x2F, 0xFF, 0x70,
+        0x00, 0x7F, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0x40, 0x02, 0xCF, 0xFF, 0x50,
+        0x00, 0x7F, 0xFF, 0xED, 0xEF, 0xFF, 0xFD, 0x10, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0x00,
+        0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0xB7, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "B",34 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x49, 0xCD, 0xDA, 0x40, 0x00, 0x00, 0x00, 0x2B, 0xFF, 0xFF, 0xFF, 0xFA, 0x10,
+        0x00, 0x02, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x0C, 0xFF, 0xFE, 0x85, 0x6C, 0xF7, 0x00,
+        0x00, 0x5F, 0xFF, 0xD2, 0x00, 0x00, 0x40, 0x00, 0x00, 0xBF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x03, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x9F, 0xFF, 0xA0, 0x00, 0x00, 0x20, 0x00, 0x00, 0x2F, 0xFF, 0xFA, 0x20, 0x06, 0xE9, 0x00,
+        0x00, 0x07, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFE, 0x40,
+        0x00, 0x00, 0x04, 0xBF, 0xFF, 0xFF, 0xA2, 0x00, 0x00, 0x00, 0x00, 0x01, 0x35, 0x41, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "C",35 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x99, 0x99, 0x98, 0x63, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xD4, 0x00, 0x00,
+        0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0xFF, 0xFD, 0x78, 0xDF, 0xFF, 0xF4, 0x00,
+        0x00, 0xFF, 0xFC, 0x00, 0x09, 0xFF, 0xFB, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0xDF, 0xFF, 0x20,
+        0x00, 0xFF, 0xFC, 0x00, 0x00, 0x8F, 0xFF, 0x50, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x6F, 0xFF, 0x70,
+        0x00, 0xFF, 0xFC, 0x00, 0x00, 0x5F, 0xFF, 0x80, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x5F, 0xFF, 0x70,
+        0x00, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0x60, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0xCF, 0xFF, 0x30,
+        0x00, 0xFF, 0xFC, 0x00, 0x05, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xFC, 0x12, 0x8F, 0xFF, 0xF6, 0x00,
+        0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x10, 0x00,
+        0x00, 0xFF, 0xFF, 0xFF, 0xD9, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "D",36 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x29, 0x99, 0x99, 0x99, 0x99, 0x97, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00,
+        0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x4F, 0xFF, 0xC8, 0x88, 0x88, 0x86, 0x00,
+        0x00, 0x4F, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x4F, 0xFF, 0x82, 0x22, 0x22, 0x10, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x00,
+        0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x00,
+        0x00, 0x4F, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x4F, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x93, 0x33, 0x33, 0x33, 0x00,
+        0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
+        0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "E",37 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x08, 0x99, 0x99, 0x99, 0x99, 0x99, 0x10, 0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10,
+        0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x00, 0x0D, 0xFF, 0xE8, 0x88, 0x88, 0x88, 0x00,
+        0x00, 0x0D, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x0D, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xE9, 0x99, 0x99, 0x90, 0x00,
+        0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
+        0x00, 0x0D, 0xFF, 0xE8, 0x88, 0x88, 0x80, 0x00, 0x00, 0x0D, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x0D, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x0D, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x0D, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "F",38 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x01, 0x7B, 0xDD, 0xC7, 0x10, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0xE4, 0x00,
+        0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x65, 0x8E, 0xC1, 0x00,
+        0x00, 0xAF, 0xFF, 0xA0, 0x00, 0x03, 0x10, 0x00, 0x01, 0xFF, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00,
+        0x05, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF6, 0x00, 0x25, 0x55, 0x55, 0x10,
+        0x08, 0xFF, 0xF5, 0x00, 0x7F, 0xFF, 0xFF, 0x40, 0x07, 0xFF, 0xF6, 0x00, 0x7F, 0xFF, 0xFF, 0x40,
+        0x06, 0xFF, 0xF8, 0x00, 0x5A, 0xBF, 0xFF, 0x40, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0x40,
+        0x00, 0xEF, 0xFF, 0x40, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x7F, 0xFF, 0xE5, 0x00, 0x3F, 0xFF, 0x40,
+        0x00, 0x0C, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x40, 0x00, 0x02, 0xCF, 0xFF, 0xFF, 0xFF, 0xFD, 0x20,
+        0x00, 0x00, 0x07, 0xDF, 0xFF, 0xFE, 0x71, 0x00, 0x00, 0x00, 0x00, 0x02, 0x44, 0x30, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "G",39 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x99, 0x97, 0x00, 0x00, 0x79, 0x99, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0xBF, 0xFF, 0x00,
+        0x00, 0xFF, 0xFB, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0xBF, 0xFF, 0x00,
+        0x00, 0xFF, 0xFB, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0xBF, 0xFF, 0x00,
+        0x00, 0xFF, 0xFC, 0x33, 0x33, 0xCF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+        0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+        0x00, 0xFF, 0xFB, 0x11, 0x11, 0xBF, 0xFF, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0xBF, 0xFF, 0x00,
+        0x00, 0xFF, 0xFB, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0xBF, 0xFF, 0x00,
+        0x00, 0xFF, 0xFB, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0xBF, 0xFF, 0x00,
+        0x00, 0xFF, 0xFB, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "H",40 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x79, 0x99, 0x99, 0x99, 0x99, 0x97, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00,
+        0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x68, 0x88, 0xEF, 0xFE, 0x88, 0x86, 0x00,
+        0x00, 0x00, 0x00, 0xDF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFD, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xDF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFD, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xDF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFD, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xDF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFD, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xDF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x23, 0x33, 0xEF, 0xFE, 0x33, 0x32, 0x00,
+        0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00,
+        0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "I",41 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x07, 0x99, 0x99, 0x99, 0x99, 0x95, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00,
+        0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x06, 0x88, 0x88, 0x8A, 0xFF, 0xF7, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF7, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF7, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF7, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF7, 0x00,
+        0x00, 0x04, 0x40, 0x00, 0x06, 0xFF, 0xF6, 0x00, 0x00, 0x3E, 0xF7, 0x10, 0x3D, 0xFF, 0xF3, 0x00,
+        0x00, 0xDF, 0xFF, 0xFE, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0xFE, 0x30, 0x00,
+        0x00, 0x03, 0xBF, 0xFF, 0xFF, 0xA2, 0x00, 0x00, 0x00, 0x00, 0x01, 0x45, 0x31, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "J",42 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x89, 0x98, 0x00, 0x00, 0x39, 0x99, 0x70, 0x00, 0xEF, 0xFD, 0x00, 0x01, 0xDF, 0xFF, 0x30,
+        0x00, 0xEF, 0xFD, 0x00, 0x0A, 0xFF, 0xF6, 0x00, 0x00, 0xEF, 0xFD, 0x00, 0x5F, 0xFF, 0xA0, 0x00,
+        0x00, 0xEF, 0xFD, 0x02, 0xEF, 0xFD, 0x10, 0x00, 0x00, 0xEF, 0xFD, 0x0C, 0xFF, 0xF3, 0x00, 0x00,
+        0x00, 0xEF, 0xFD, 0x8F, 0xFF, 0x60, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00,
+        0x00, 0xEF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xFF, 0xFF, 0xF6, 0x00, 0x00,
+        0x00, 0xEF, 0xFF, 0xF7, 0xDF, 0xFD, 0x10, 0x00, 0x00, 0xEF, 0xFF, 0xA0, 0x6F, 0xFF, 0x70, 0x00,
+        0x00, 0xEF, 0xFE, 0x10, 0x0D, 0xFF, 0xE1, 0x00, 0x00, 0xEF, 0xFD, 0x00, 0x06, 0xFF, 0xF9, 0x00,
+        0x00, 0xEF, 0xFD, 0x00, 0x00, 0xDF, 0xFF, 0x20, 0x00, 0xEF, 0xFD, 0x00, 0x00, 0x6F, 0xFF, 0xA0,
+        0x00, 0xEF, 0xFD, 0x00, 0x00, 0x0D, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "K",43 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x09, 0x99, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x0E, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x0E, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x0E, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x0E, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x0E, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x0E, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xD3, 0x33, 0x33, 0x33, 0x10,
+        0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30,
+        0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "L",44 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x99, 0x98, 0x00, 0x00, 0x89, 0x99, 0x00, 0x00, 0xFF, 0xFF, 0x10, 0x01, 0xFF, 0xFF, 0x00,
+        0x00, 0xFF, 0xFF, 0x50, 0x05, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xA0, 0x09, 0xFF, 0xFF, 0x00,
+        0x00, 0xFF, 0xCF, 0xE0, 0x0D, 0xFD, 0xFF, 0x00, 0x00, 0xFF, 0xAE, 0xF3, 0x2F, 0xEB, 0xFF, 0x00,
+        0x00, 0xFF, 0xBB, 0xF7, 0x6F, 0xAC, 0xFF, 0x00, 0x00, 0xFF, 0xC7, 0xFB, 0xAF, 0x6D, 0xFF, 0x00,
+        0x00, 0xFF, 0xD3, 0xFE, 0xEF, 0x2E, 0xFF, 0x00, 0x00, 0xFF, 0xE0, 0xDF, 0xFC, 0x0F, 0xFF, 0x00,
+        0x00, 0xFF, 0xF0, 0x8F, 0xF7, 0x0F, 0xFF, 0x00, 0x00, 0xFF, 0xF0, 0x3F, 0xF2, 0x1F, 0xFF, 0x00,
+        0x00, 0xFF, 0xF0, 0x08, 0x70, 0x1F, 0xFF, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0x00,
+        0x00, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0x00,
+        0x00, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "M",45 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x99, 0x99, 0x00, 0x00, 0x69, 0x99, 0x00, 0x00, 0xEF, 0xFF, 0x50, 0x00, 0x9F, 0xFE, 0x00,
+        0x00, 0xEF, 0xFF, 0xB0, 0x00, 0x9F, 0xFE, 0x00, 0x00, 0xEF, 0xFF, 0xF3, 0x00, 0x9F, 0xFE, 0x00,
+        0x00, 0xEF, 0xFF, 0xF9, 0x00, 0x9F, 0xFE, 0x00, 0x00, 0xEF, 0xFC, 0xFE, 0x10, 0x9F, 0xFE, 0x00,
+        0x00, 0xEF, 0xF7, 0xFF, 0x70, 0x9F, 0xFE, 0x00, 0x00, 0xEF, 0xF5, 0xDF, 0xD0, 0x9F, 0xFE, 0x00,
+        0x00, 0xEF, 0xF7, 0x7F, 0xF4, 0x8F, 0xFE, 0x00, 0x00, 0xEF, 0xF9, 0x1F, 0xFA, 0x6F, 0xFE, 0x00,
+        0x00, 0xEF, 0xF9, 0x09, 0xFF, 0x6F, 0xFE, 0x00, 0x00, 0xEF, 0xF9, 0x03, 0xFF, 0xAF, 0xFE, 0x00,
+        0x00, 0xEF, 0xF9, 0x00, 0xCF, 0xEF, 0xFE, 0x00, 0x00, 0xEF, 0xF9, 0x00, 0x5F, 0xFF, 0xFE, 0x00,
+        0x00, 0xEF, 0xF9, 0x00, 0x0E, 0xFF, 0xFE, 0x00, 0x00, 0xEF, 0xF9, 0x00, 0x07, 0xFF, 0xFE, 0x00,
+        0x00, 0xEF, 0xF9, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "N",46 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x06, 0xBD, 0xDB, 0x60, 0x00, 0x00, 0x00, 0x02, 0xDF, 0xFF, 0xFF, 0xFD, 0x20, 0x00,
+        0x00, 0x1D, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0x00, 0x00, 0x9F, 0xFF, 0xD6, 0x6D, 0xFF, 0xF8, 0x00,
+        0x01, 0xEF, 0xFE, 0x20, 0x02, 0xEF, 0xFE, 0x10, 0x05, 0xFF, 0xF9, 0x00, 0x00, 0x9F, 0xFF, 0x50,
+        0x08, 0xFF, 0xF5, 0x00, 0x00, 0x5F, 0xFF, 0x80, 0x09, 0xFF, 0xF3, 0x00, 0x00, 0x3F, 0xFF, 0x90,
+        0x0A, 0xFF, 0xF3, 0x00, 0x00, 0x3F, 0xFF, 0xA0, 0x0A, 0xFF, 0xF3, 0x00, 0x00, 0x3F, 0xFF, 0xA0,
+        0x08, 0xFF, 0xF5, 0x00, 0x00, 0x5F, 0xFF, 0x80, 0x06, 0xFF, 0xF8, 0x00, 0x00, 0x8F, 0xFF, 0x60,
+        0x02, 0xFF, 0xFD, 0x00, 0x00, 0xDF, 0xFF, 0x20, 0x00, 0xBF, 0xFF, 0x91, 0x19, 0xFF, 0xFB, 0x00,
+        0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x00,
+        0x00, 0x00, 0x4C, 0xFF, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x42, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "O",47 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x79, 0x99, 0x99, 0x98, 0x62, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA1, 0x00,
+        0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xBF, 0xFF, 0x66, 0x68, 0xEF, 0xFF, 0x60,
+        0x00, 0xBF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xA0, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x0E, 0xFF, 0xC0,
+        0x00, 0xBF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xB0, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x80,
+        0x00, 0xBF, 0xFF, 0x99, 0xAC, 0xFF, 0xFF, 0x20, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x00,
+        0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x40, 0x00, 0x00, 0xBF, 0xFF, 0x66, 0x64, 0x20, 0x00, 0x00,
+        0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "P",48 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x17, 0xBD, 0xDB, 0x60, 0x00, 0x00, 0x00, 0x03, 0xDF, 0xFF, 0xFF, 0xFC, 0x10, 0x00,
+        0x00, 0x1E, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x9F, 0xFF, 0xD6, 0x7E, 0xFF, 0xF7, 0x00,
+        0x01, 0xFF, 0xFE, 0x10, 0x03, 0xFF, 0xFD, 0x00, 0x06, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0x30,
+        0x08, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0x60, 0x0A, 0xFF, 0xF3, 0x00, 0x00, 0x5F, 0xFF, 0x70,
+        0x0B, 0xFF, 0xF2, 0x00, 0x00, 0x4F, 0xFF, 0x80, 0x0A, 0xFF, 0xF2, 0x00, 0x00, 0x5F, 0xFF, 0x80,
+        0x09, 0xFF, 0xF4, 0x00, 0x00, 0x6F, 0xFF, 0x60, 0x07, 0xFF, 0xF7, 0x00, 0x00, 0x9F, 0xFF, 0x40,
+        0x03, 0xFF, 0xFC, 0x00, 0x01, 0xEF, 0xFE, 0x10, 0x00, 0xCF, 0xFF, 0x80, 0x1A, 0xFF, 0xF9, 0x00,
+        0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE2, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00,
+        0x00, 0x00, 0x4C, 0xFF, 0xFF, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0x70, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x2E, 0xFF, 0xFC, 0x88, 0x60, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xFF, 0xC0,
+        0x00, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x87, 0x40,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "Q",49 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x89, 0x99, 0x99, 0x98, 0x51, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFE, 0x80, 0x00,
+        0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xDF, 0xFE, 0x66, 0x6A, 0xFF, 0xFF, 0x20,
+        0x00, 0xDF, 0xFD, 0x00, 0x00, 0x7F, 0xFF, 0x50, 0x00, 0xDF, 0xFD, 0x00, 0x00, 0x4F, 0xFF, 0x70,
+        0x00, 0xDF, 0xFD, 0x00, 0x00, 0x6F, 0xFF, 0x60, 0x00, 0xDF, 0xFD, 0x00, 0x05, 0xEF, 0xFF, 0x20,
+        0x00, 0xDF, 0xFF, 0xEE, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0x00,
+        0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0xDF, 0xFD, 0x00, 0xDF, 0xFF, 0x20, 0x00,
+        0x00, 0xDF, 0xFD, 0x00, 0x5F, 0xFF, 0xA0, 0x00, 0x00, 0xDF, 0xFD, 0x00, 0x0C, 0xFF, 0xF4, 0x00,
+        0x00, 0xDF, 0xFD, 0x00, 0x05, 0xFF, 0xFC, 0x00, 0x00, 0xDF, 0xFD, 0x00, 0x00, 0xCF, 0xFF, 0x60,
+        0x00, 0xDF, 0xFD, 0x00, 0x00, 0x4F, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "R",50 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x05, 0xAD, 0xDC, 0x94, 0x00, 0x00, 0x00, 0x02, 0xCF, 0xFF, 0xFF, 0xFF, 0xB2, 0x00,
+        0x00, 0x1D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x6F, 0xFF, 0xD6, 0x57, 0xCF, 0xD1, 0x00,
+        0x00, 0xAF, 0xFF, 0x20, 0x00, 0x05, 0x30, 0x00, 0x00, 0xAF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x7F, 0xFF, 0xFB, 0x50, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFF, 0xFF, 0xFD, 0x71, 0x00, 0x00,
+        0x00, 0x03, 0xDF, 0xFF, 0xFF, 0xFE, 0x70, 0x00, 0x00, 0x00, 0x16, 0xDF, 0xFF, 0xFF, 0xF8, 0x00,
+        0x00, 0x00, 0x00, 0x04, 0xAF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDF, 0xFF, 0x50,
+        0x00, 0x04, 0x30, 0x00, 0x00, 0x7F, 0xFF, 0x60, 0x00, 0x3E, 0xF9, 0x30, 0x02, 0xDF, 0xFF, 0x30,
+        0x02, 0xEF, 0xFF, 0xFE, 0xEF, 0xFF, 0xFB, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0x00,
+        0x00, 0x03, 0xAE, 0xFF, 0xFF, 0xE8, 0x10, 0x00, 0x00, 0x00, 0x00, 0x34, 0x43, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "S",51 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x08, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x80, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0,
+        0x0D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x07, 0x88, 0x88, 0xEF, 0xFE, 0x88, 0x88, 0x70,
+        0x00, 0x00, 0x00, 0xDF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFD, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xDF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFD, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xDF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFD, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xDF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFD, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xDF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFD, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xDF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFD, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xDF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "T",52 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x99, 0x97, 0x00, 0x00, 0x69, 0x99, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0x9F, 0xFF, 0x00,
+        0x00, 0xFF, 0xFB, 0x00, 0x00, 0x9F, 0xFF, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0x9F, 0xFF, 0x00,
+        0x00, 0xFF, 0xFB, 0x00, 0x00, 0x9F, 0xFF, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0x9F, 0xFF, 0x00,
+        0x00, 0xFF, 0xFB, 0x00, 0x00, 0x9F, 0xFF, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0x9F, 0xFF, 0x00,
+        0x00, 0xFF, 0xFB, 0x00, 0x00, 0x9F, 0xFF, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0x9F, 0xFF, 0x00,
+        0x00, 0xFF, 0xFB, 0x00, 0x00, 0x9F, 0xFF, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0xAF, 0xFF, 0x00,
+        0x00, 0xDF, 0xFE, 0x00, 0x00, 0xCF, 0xFD, 0x00, 0x00, 0x9F, 0xFF, 0x80, 0x07, 0xFF, 0xF9, 0x00,
+        0x00, 0x3F, 0xFF, 0xFF, 0xEF, 0xFF, 0xF4, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x00,
+        0x00, 0x00, 0x6D, 0xFF, 0xFF, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x43, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "U",53 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x29, 0x99, 0x70, 0x00, 0x00, 0x06, 0x99, 0x92, 0x0E, 0xFF, 0xF0, 0x00, 0x00, 0x0D, 0xFF, 0xE0,
+        0x09, 0xFF, 0xF4, 0x00, 0x00, 0x1F, 0xFF, 0x90, 0x05, 0xFF, 0xF8, 0x00, 0x00, 0x5F, 0xFF, 0x50,
+        0x01, 0xFF, 0xFC, 0x00, 0x00, 0x9F, 0xFF, 0x10, 0x00, 0xBF, 0xFF, 0x10, 0x00, 0xDF, 0xFB, 0x00,
+        0x00, 0x6F, 0xFF, 0x40, 0x02, 0xFF, 0xF6, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x05, 0xFF, 0xF2, 0x00,
+        0x00, 0x0C, 0xFF, 0xC0, 0x09, 0xFF, 0xC0, 0x00, 0x00, 0x08, 0xFF, 0xF1, 0x0D, 0xFF, 0x80, 0x00,
+        0x00, 0x03, 0xFF, 0xF5, 0x2F, 0xFF, 0x30, 0x00, 0x00, 0x00, 0xDF, 0xF8, 0x5F, 0xFE, 0x00, 0x00,
+        0x00, 0x00, 0x9F, 0xFC, 0x9F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xEF, 0xF5, 0x00, 0x00,
+        0x00, 0x00, 0x1E, 0xFF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xB0, 0x00, 0x00,
+        0x00, 0x00, 0x06, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "V",54 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x59, 0x99, 0x30, 0x00, 0x00, 0x00, 0x99, 0x95, 0x6F, 0xFF, 0x50, 0x00, 0x00, 0x01, 0xFF, 0xF6,
+        0x4F, 0xFF, 0x60, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x2F, 0xFF, 0x70, 0x00, 0x00, 0x03, 0xFF, 0xF2,
+        0x0F, 0xFF, 0x80, 0x06, 0x62, 0x04, 0xFF, 0xF0, 0x0D, 0xFF, 0x90, 0x3F, 0xF8, 0x05, 0xFF, 0xE0,
+        0x0B, 0xFF, 0xA0, 0x6F, 0xFB, 0x05, 0xFF, 0xC0, 0x09, 0xFF, 0xB0, 0xAF, 0xFE, 0x06, 0xFF, 0xA0,
+        0x07, 0xFF, 0xC0, 0xEF, 0xFF, 0x37, 0xFF, 0x80, 0x05, 0xFF, 0xC2, 0xFD, 0xDF, 0x78, 0xFF, 0x60,
+        0x03, 0xFF, 0xD6, 0xFB, 0xBF, 0xA8, 0xFF, 0x40, 0x01, 0xFF, 0xD9, 0xF9, 0x8F, 0xD9, 0xFF, 0x20,
+        0x00, 0xEF, 0xDC, 0xF6, 0x5F, 0xFA, 0xFF, 0x10, 0x00, 0xCF, 0xEF, 0xF3, 0x2F, 0xFE, 0xFE, 0x00,
+        0x00, 0xAF, 0xFF, 0xF0, 0x0E, 0xFF, 0xFC, 0x00, 0x00, 0x8F, 0xFF, 0xC0, 0x0B, 0xFF, 0xFA, 0x00,
+        0x00, 0x6F, 0xFF, 0x90, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "W",55 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x07, 0x99, 0x94, 0x00, 0x00, 0x29, 0x99, 0x70, 0x04, 0xFF, 0xFD, 0x00, 0x00, 0xAF, 0xFF, 0x40,
+        0x00, 0xBF, 0xFF, 0x60, 0x02, 0xFF, 0xFB, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x09, 0xFF, 0xF3, 0x00,
+        0x00, 0x09, 0xFF, 0xF5, 0x1E, 0xFF, 0xA0, 0x00, 0x00, 0x01, 0xEF, 0xFC, 0x7F, 0xFE, 0x20, 0x00,
+        0x00, 0x00, 0x7F, 0xFF, 0xEF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xE1, 0x00, 0x00,
+        0x00, 0x00, 0x07, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
+        0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x02, 0xEF, 0xF8, 0xDF, 0xFE, 0x10, 0x00,
+        0x00, 0x09, 0xFF, 0xF1, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x3F, 0xFF, 0x90, 0x0D, 0xFF, 0xF3, 0x00,
+        0x00, 0xBF, 0xFF, 0x20, 0x05, 0xFF, 0xFB, 0x00, 0x05, 0xFF, 0xF9, 0x00, 0x00, 0xCF, 0xFF, 0x50,
+        0x0D, 0xFF, 0xF2, 0x00, 0x00, 0x4F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "X",56 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x19, 0x99, 0x90, 0x00, 0x00, 0x08, 0x99, 0x91, 0x0A, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0xA0,
+        0x03, 0xFF, 0xFA, 0x00, 0x00, 0x9F, 0xFF, 0x30, 0x00, 0xBF, 0xFF, 0x20, 0x01, 0xEF, 0xFB, 0x00,
+        0x00, 0x4F, 0xFF, 0x80, 0x06, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x0C, 0xFF, 0xB0, 0x00,
+        0x00, 0x04, 0xFF, 0xF5, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xCF, 0xFB, 0xAF, 0xFC, 0x00, 0x00,
+        0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
+        0x00, 0x00, 0x05, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFE, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xDF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFD, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xDF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFD, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xDF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "Y",57 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x49, 0x99, 0x99, 0x99, 0x99, 0x99, 0x20, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30,
+        0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x48, 0x88, 0x88, 0x8C, 0xFF, 0xF9, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0x30, 0x00,
+        0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00,
+        0x00, 0x00, 0x01, 0xDF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xF7, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x4F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xDF, 0xFE, 0x20, 0x00, 0x00, 0x00,
+        0x00, 0x0A, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xC3, 0x33, 0x33, 0x33, 0x10,
+        0x01, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40,
+        0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "Z",58 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
+        0x00, 0x00, 0x08, 0xFF, 0xEE, 0xEE, 0xE0, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x50, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x08, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x50, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x08, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x50, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x08, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x50, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x08, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x50, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x08, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x50, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x08, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x50, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x08, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x50, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x08, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x50, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x08, 0xFF, 0x62, 0x22, 0x20, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
+        0x00, 0x00, 0x07, 0xDD, 0xDD, 0xDD, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "[",59 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x2F, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x06, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xF2, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0xAF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFD, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x0D, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x90, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x02, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF6, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x6F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0x20, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x09, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xD0, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0xDF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFA, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x2F, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x60, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xF2, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "\",60 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+        0x00, 0x0E, 0xEE, 0xEE, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x80, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x05, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x80, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x05, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x80, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x05, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x80, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x05, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x80, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x05, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x80, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x05, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x80, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x05, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x80, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x05, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x80, 0x00, 0x00,
+        0x00, 0x02, 0x22, 0x26, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+        0x00, 0x0D, 0xDD, 0xDD, 0xDD, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "]",61 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xBF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x20, 0x00, 0x00,
+        0x00, 0x00, 0x08, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFD, 0xDF, 0xD0, 0x00, 0x00,
+        0x00, 0x00, 0x4F, 0xF8, 0x8F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xF3, 0x3F, 0xFA, 0x00, 0x00,
+        0x00, 0x01, 0xFF, 0xD0, 0x0D, 0xFF, 0x10, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x08, 0xFF, 0x70, 0x00,
+        0x00, 0x0D, 0xFF, 0x30, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x4F, 0xFC, 0x00, 0x00, 0xCF, 0xF4, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "^",62 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x01, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x10, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20,
+        0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "_",63 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x9D, 0xDD, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFF, 0x80, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x03, 0xEF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF9, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x04, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "`",64 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x38, 0xCE, 0xED, 0x93, 0x00, 0x00, 0x00, 0x4C, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x00,
+        0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x0A, 0xD7, 0x21, 0x29, 0xFF, 0xFA, 0x00,
+        0x00, 0x01, 0x00, 0x00, 0x01, 0xDF, 0xFD, 0x00, 0x00, 0x00, 0x16, 0xAD, 0xFF, 0xFF, 0xFF, 0x00,
+        0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x8F, 0xFF, 0xC7, 0x43, 0xCF, 0xFF, 0x00,
+        0x00, 0xEF, 0xFB, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x01, 0xFF, 0xF9, 0x00, 0x04, 0xEF, 0xFF, 0x00,
+        0x00, 0xEF, 0xFF, 0xB9, 0xCF, 0xFF, 0xFF, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0x00,
+        0x00, 0x08, 0xFF, 0xFF, 0xC4, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x14, 0x42, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "a",65 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xCF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xCF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xCF, 0xFD, 0x18, 0xDE, 0xC7, 0x00, 0x00, 0x00, 0xCF, 0xFE, 0xEF, 0xFF, 0xFF, 0xB0, 0x00,
+        0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xCF, 0xFF, 0xC4, 0x28, 0xFF, 0xFE, 0x00,
+        0x00, 0xCF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0xCF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0x60,
+        0x00, 0xCF, 0xFE, 0x00, 0x00, 0x6F, 0xFF, 0x70, 0x00, 0xCF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0x60,
+        0x00, 0xCF, 0xFE, 0x00, 0x00, 0xAF, 0xFF, 0x30, 0x00, 0xCF, 0xFF, 0x30, 0x04, 0xFF, 0xFE, 0x00,
+        0x00, 0xCF, 0xFF, 0xFC, 0xCF, 0xFF, 0xF7, 0x00, 0x00, 0xCF, 0xFD, 0xFF, 0xFF, 0xFF, 0xB0, 0x00,
+        0x00, 0xCF, 0xF4, 0x7E, 0xFF, 0xF9, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0x44, 0x10, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "b",66 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x01, 0x7B, 0xDE, 0xDA, 0x40, 0x00, 0x00, 0x00, 0x6E, 0xFF, 0xFF, 0xFF, 0xFA, 0x00,
+        0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x2F, 0xFF, 0xFA, 0x32, 0x39, 0xC0, 0x00,
+        0x00, 0x9F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xEF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xBF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE4, 0x00, 0x03, 0xA2, 0x00,
+        0x00, 0x0C, 0xFF, 0xFF, 0xDB, 0xDF, 0xFB, 0x00, 0x00, 0x02, 0xDF, 0xFF, 0xFF, 0xFF, 0xFE, 0x20,
+        0x00, 0x00, 0x18, 0xEF, 0xFF, 0xFE, 0x92, 0x00, 0x00, 0x00, 0x00, 0x02, 0x44, 0x30, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "c",67 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCD, 0xDB, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFC, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFC, 0x00,
+        0x00, 0x00, 0x3A, 0xEE, 0xA2, 0xDF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0xEF, 0xFC, 0x00,
+        0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xCF, 0xFF, 0xA3, 0x38, 0xFF, 0xFC, 0x00,
+        0x02, 0xFF, 0xFC, 0x00, 0x00, 0xEF, 0xFC, 0x00, 0x05, 0xFF, 0xF8, 0x00, 0x00, 0xEF, 0xFC, 0x00,
+        0x07, 0xFF, 0xF6, 0x00, 0x00, 0xEF, 0xFC, 0x00, 0x06, 0xFF, 0xF7, 0x00, 0x00, 0xEF, 0xFC, 0x00,
+        0x04, 0xFF, 0xFA, 0x00, 0x00, 0xEF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0x30, 0x06, 0xFF, 0xFC, 0x00,
+        0x00, 0x9F, 0xFF, 0xFC, 0xDF, 0xFF, 0xFC, 0x00, 0x00, 0x1D, 0xFF, 0xFF, 0xFF, 0xEF, 0xFC, 0x00,
+        0x00, 0x02, 0xBF, 0xFF, 0xE6, 0x5F, 0xFC, 0x00, 0x00, 0x00, 0x02, 0x44, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "d",68 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x05, 0xAD, 0xED, 0x93, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xFF, 0x70, 0x00,
+        0x00, 0x0C, 0xFF, 0xFF, 0xEF, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0x91, 0x02, 0xCF, 0xFC, 0x00,
+        0x00, 0xEF, 0xFC, 0x00, 0x00, 0x4F, 0xFF, 0x10, 0x02, 0xFF, 0xFD, 0xAA, 0xAA, 0xBF, 0xFF, 0x30,
+        0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x03, 0xFF, 0xFE, 0xBB, 0xBB, 0xBB, 0xBB, 0x20,
+        0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0x70, 0x00, 0x00, 0x30, 0x00,
+        0x00, 0x2E, 0xFF, 0xFD, 0x98, 0xAE, 0xE1, 0x00, 0x00, 0x04, 0xEF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
+        0x00, 0x00, 0x2A, 0xFF, 0xFF, 0xFD, 0x71, 0x00, 0x00, 0x00, 0x00, 0x13, 0x54, 0x20, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "e",69 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9E, 0xFF, 0xFE, 0xA2,
+        0x00, 0x00, 0x00, 0x1D, 0xFF, 0xFF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFC, 0xCE, 0xB0,
+        0x00, 0x00, 0x01, 0xFF, 0xFD, 0x20, 0x00, 0x20, 0x00, 0x00, 0x03, 0xFF, 0xF9, 0x00, 0x00, 0x00,
+        0x00, 0x48, 0x8B, 0xFF, 0xFC, 0x99, 0x98, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
+        0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x35, 0x57, 0xFF, 0xFA, 0x55, 0x54, 0x00,
+        0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "f",70 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x39, 0xDE, 0xDA, 0x99, 0x99, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+        0x00, 0x4F, 0xFF, 0xD9, 0xCF, 0xFF, 0xFF, 0xC0, 0x00, 0xAF, 0xFE, 0x10, 0x0B, 0xFF, 0x92, 0x20,
+        0x00, 0xCF, 0xFB, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0xAF, 0xFD, 0x00, 0x09, 0xFF, 0xC0, 0x00,
+        0x00, 0x5F, 0xFF, 0xA4, 0x7F, 0xFF, 0x70, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xFC, 0x10, 0x00,
+        0x00, 0x0A, 0xFE, 0xDF, 0xEC, 0x70, 0x00, 0x00, 0x00, 0x6F, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x9F, 0xFC, 0x66, 0x66, 0x54, 0x10, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x10,
+        0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x9F, 0xF7, 0x78, 0x88, 0x9F, 0xFF, 0xD0,
+        0x03, 0xFF, 0xC0, 0x00, 0x00, 0x0A, 0xFF, 0xD0, 0x04, 0xFF, 0xF6, 0x10, 0x02, 0x7F, 0xFF, 0x70,
+        0x01, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x2A, 0xFF, 0xFF, 0xFF, 0xFB, 0x40, 0x00,
+        0x00, 0x00, 0x14, 0x56, 0x53, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "g",71 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xCF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xCF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xCF, 0xFD, 0x05, 0xBE, 0xEB, 0x30, 0x00, 0x00, 0xCF, 0xFC, 0xAF, 0xFF, 0xFF, 0xE3, 0x00,
+        0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0xCF, 0xFF, 0xE7, 0x47, 0xFF, 0xFE, 0x00,
+        0x00, 0xCF, 0xFF, 0x20, 0x00, 0xCF, 0xFF, 0x10, 0x00, 0xCF, 0xFE, 0x00, 0x00, 0xAF, 0xFF, 0x20,
+        0x00, 0xCF, 0xFE, 0x00, 0x00, 0x9F, 0xFF, 0x20, 0x00, 0xCF, 0xFE, 0x00, 0x00, 0x9F, 0xFF, 0x20,
+        0x00, 0xCF, 0xFE, 0x00, 0x00, 0x9F, 0xFF, 0x20, 0x00, 0xCF, 0xFE, 0x00, 0x00, 0x9F, 0xFF, 0x20,
+        0x00, 0xCF, 0xFE, 0x00, 0x00, 0x9F, 0xFF, 0x20, 0x00, 0xCF, 0xFE, 0x00, 0x00, 0x9F, 0xFF, 0x20,
+        0x00, 0xCF, 0xFE, 0x00, 0x00, 0x9F, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "h",72 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x08, 0xFF, 0xB1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFF, 0xF4, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x01, 0x77, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x69, 0x99, 0x99, 0x99, 0x92, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xF3, 0x00, 0x00,
+        0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x35, 0x55, 0x5A, 0xFF, 0xF3, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x08, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF3, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x08, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF3, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x08, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF3, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x08, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF3, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x08, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "i",73 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x08, 0xFF, 0xB1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFF, 0xF4, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x01, 0x77, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x69, 0x99, 0x99, 0x99, 0x92, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xF3, 0x00, 0x00,
+        0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x35, 0x55, 0x5A, 0xFF, 0xF3, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x08, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF3, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x08, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF3, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x08, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF3, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x08, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF3, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x08, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xF1, 0x00, 0x00,
+        0x00, 0x43, 0x00, 0x4F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0xDF, 0xFE, 0xFF, 0xFF, 0x70, 0x00, 0x00,
+        0x05, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x02, 0x8C, 0xEF, 0xEB, 0x50, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "j",74 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xDD, 0x10, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xBF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xBF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xBF, 0xFF, 0x10, 0x00, 0x59, 0x99, 0x50, 0x00, 0xBF, 0xFF, 0x10, 0x04, 0xFF, 0xFC, 0x10,
+        0x00, 0xBF, 0xFF, 0x10, 0x3E, 0xFF, 0xD1, 0x00, 0x00, 0xBF, 0xFF, 0x12, 0xEF, 0xFD, 0x20, 0x00,
+        0x00, 0xBF, 0xFF, 0x2D, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xDF, 0xFF, 0x50, 0x00, 0x00,
+        0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF6, 0x00, 0x00,
+        0x00, 0xBF, 0xFF, 0xF5, 0xAF, 0xFE, 0x20, 0x00, 0x00, 0xBF, 0xFF, 0x50, 0x2E, 0xFF, 0xC0, 0x00,
+        0x00, 0xBF, 0xFF, 0x10, 0x06, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0x10, 0x00, 0xBF, 0xFF, 0x30,
+        0x00, 0xBF, 0xFF, 0x10, 0x00, 0x2E, 0xFF, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "k",75 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xDD, 0xDD, 0xDD, 0xD5, 0x00, 0x00, 0x00,
+        0x01, 0xFF, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x00,
+        0x00, 0x22, 0x27, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF5, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x06, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF5, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x06, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF5, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x06, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF5, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x06, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF5, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x06, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFB, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x01, 0xEF, 0xFF, 0xDB, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0x00,
+        0x00, 0x00, 0x00, 0x07, 0xEF, 0xFF, 0xFC, 0x10, 0x00, 0x00, 0x00, 0x00, 0x14, 0x54, 0x10, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "l",76 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x07, 0x99, 0x16, 0xDD, 0x60, 0x6D, 0xD8, 0x00, 0x0B, 0xFF, 0x9F, 0xFF, 0xF7, 0xFF, 0xFF, 0x60,
+        0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0B, 0xFF, 0xF7, 0xAF, 0xFE, 0x5C, 0xFF, 0xE0,
+        0x0B, 0xFF, 0xD0, 0x5F, 0xF9, 0x09, 0xFF, 0xE0, 0x0B, 0xFF, 0xC0, 0x5F, 0xF8, 0x08, 0xFF, 0xE0,
+        0x0B, 0xFF, 0xC0, 0x5F, 0xF8, 0x08, 0xFF, 0xE0, 0x0B, 0xFF, 0xC0, 0x5F, 0xF8, 0x08, 0xFF, 0xE0,
+        0x0B, 0xFF, 0xC0, 0x5F, 0xF8, 0x08, 0xFF, 0xE0, 0x0B, 0xFF, 0xC0, 0x5F, 0xF8, 0x08, 0xFF, 0xE0,
+        0x0B, 0xFF, 0xC0, 0x5F, 0xF8, 0x08, 0xFF, 0xE0, 0x0B, 0xFF, 0xC0, 0x5F, 0xF8, 0x08, 0xFF, 0xE0,
+        0x0B, 0xFF, 0xC0, 0x5F, 0xF8, 0x08, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "m",77 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x89, 0x93, 0x05, 0xBE, 0xEA, 0x30, 0x00, 0x00, 0xCF, 0xF7, 0xAF, 0xFF, 0xFF, 0xE3, 0x00,
+        0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0xCF, 0xFF, 0xE7, 0x47, 0xFF, 0xFE, 0x00,
+        0x00, 0xCF, 0xFF, 0x20, 0x00, 0xCF, 0xFF, 0x10, 0x00, 0xCF, 0xFE, 0x00, 0x00, 0xAF, 0xFF, 0x20,
+        0x00, 0xCF, 0xFE, 0x00, 0x00, 0x9F, 0xFF, 0x20, 0x00, 0xCF, 0xFE, 0x00, 0x00, 0x9F, 0xFF, 0x20,
+        0x00, 0xCF, 0xFE, 0x00, 0x00, 0x9F, 0xFF, 0x20, 0x00, 0xCF, 0xFE, 0x00, 0x00, 0x9F, 0xFF, 0x20,
+        0x00, 0xCF, 0xFE, 0x00, 0x00, 0x9F, 0xFF, 0x20, 0x00, 0xCF, 0xFE, 0x00, 0x00, 0x9F, 0xFF, 0x20,
+        0x00, 0xCF, 0xFE, 0x00, 0x00, 0x9F, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "n",78 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x17, 0xBE, 0xEB, 0x71, 0x00, 0x00, 0x00, 0x03, 0xDF, 0xFF, 0xFF, 0xFD, 0x30, 0x00,
+        0x00, 0x2E, 0xFF, 0xFF, 0xFF, 0xFF, 0xE2, 0x00, 0x00, 0xBF, 0xFF, 0x92, 0x29, 0xFF, 0xFB, 0x00,
+        0x02, 0xFF, 0xFC, 0x00, 0x00, 0xCF, 0xFF, 0x20, 0x05, 0xFF, 0xF8, 0x00, 0x00, 0x8F, 0xFF, 0x50,
+        0x06, 0xFF, 0xF6, 0x00, 0x00, 0x6F, 0xFF, 0x60, 0x06, 0xFF, 0xF7, 0x00, 0x00, 0x7F, 0xFF, 0x60,
+        0x03, 0xFF, 0xFA, 0x00, 0x00, 0xAF, 0xFF, 0x30, 0x00, 0xDF, 0xFF, 0x40, 0x04, 0xFF, 0xFD, 0x00,
+        0x00, 0x5F, 0xFF, 0xFC, 0xCF, 0xFF, 0xF5, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
+        0x00, 0x00, 0x5C, 0xFF, 0xFF, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x42, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "o",79 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x89, 0x93, 0x18, 0xDE, 0xC7, 0x00, 0x00, 0x00, 0xCF, 0xFB, 0xEF, 0xFF, 0xFF, 0xB0, 0x00,
+        0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xCF, 0xFF, 0xC4, 0x28, 0xFF, 0xFE, 0x00,
+        0x00, 0xCF, 0xFE, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0xCF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0x60,
+        0x00, 0xCF, 0xFE, 0x00, 0x00, 0x6F, 0xFF, 0x70, 0x00, 0xCF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0x60,
+        0x00, 0xCF, 0xFE, 0x00, 0x00, 0xAF, 0xFF, 0x30, 0x00, 0xCF, 0xFF, 0x30, 0x04, 0xFF, 0xFE, 0x00,
+        0x00, 0xCF, 0xFF, 0xFC, 0xCF, 0xFF, 0xF7, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00,
+        0x00, 0xCF, 0xFD, 0x7E, 0xFF, 0xF9, 0x10, 0x00, 0x00, 0xCF, 0xFE, 0x01, 0x44, 0x10, 0x00, 0x00,
+        0x00, 0xCF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xCF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8A, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "p",80 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x3A, 0xEE, 0xA3, 0x29, 0x98, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xAF, 0xFC, 0x00,
+        0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xCF, 0xFF, 0xA3, 0x38, 0xFF, 0xFC, 0x00,
+        0x02, 0xFF, 0xFC, 0x00, 0x00, 0xEF, 0xFC, 0x00, 0x05, 0xFF, 0xF8, 0x00, 0x00, 0xEF, 0xFC, 0x00,
+        0x07, 0xFF, 0xF6, 0x00, 0x00, 0xEF, 0xFC, 0x00, 0x06, 0xFF, 0xF7, 0x00, 0x00, 0xEF, 0xFC, 0x00,
+        0x04, 0xFF, 0xFA, 0x00, 0x00, 0xEF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0x30, 0x06, 0xFF, 0xFC, 0x00,
+        0x00, 0x9F, 0xFF, 0xFC, 0xDF, 0xFF, 0xFC, 0x00, 0x00, 0x1D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+        0x00, 0x02, 0xBF, 0xFF, 0xE6, 0xDF, 0xFC, 0x00, 0x00, 0x00, 0x02, 0x44, 0x00, 0xEF, 0xFC, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFC, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xA8, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "q",81 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x06, 0x99, 0x40, 0x06, 0xBE, 0xEB, 0x20, 0x00, 0x0A, 0xFF, 0x71, 0xCF, 0xFF, 0xFF, 0x10,
+        0x00, 0x0A, 0xFF, 0x9C, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xFC, 0x76, 0x76, 0x00,
+        0x00, 0x0A, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x0A, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x0A, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x0A, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x0A, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "r",82 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x28, 0xCE, 0xED, 0xA5, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0xD5, 0x00,
+        0x00, 0x2F, 0xFF, 0xFE, 0xDE, 0xFF, 0xF4, 0x00, 0x00, 0x7F, 0xFF, 0x60, 0x00, 0x4B, 0x80, 0x00,
+        0x00, 0x7F, 0xFF, 0xA2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFF, 0xFF, 0xC8, 0x40, 0x00, 0x00,
+        0x00, 0x02, 0xBF, 0xFF, 0xFF, 0xFD, 0x50, 0x00, 0x00, 0x00, 0x03, 0x8D, 0xFF, 0xFF, 0xF7, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x28, 0xFF, 0xFF, 0x10, 0x00, 0x1B, 0x50, 0x00, 0x00, 0xAF, 0xFF, 0x10,
+        0x00, 0xAF, 0xFE, 0x98, 0x8A, 0xFF, 0xFD, 0x00, 0x01, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE4, 0x00,
+        0x00, 0x05, 0xBF, 0xFF, 0xFF, 0xFA, 0x20, 0x00, 0x00, 0x00, 0x01, 0x34, 0x43, 0x10, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "s",83 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0x80, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0x80, 0x00, 0x00, 0x00,
+        0x03, 0x88, 0x9F, 0xFF, 0xC9, 0x99, 0x98, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
+        0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x02, 0x55, 0x7F, 0xFF, 0xA5, 0x55, 0x54, 0x00,
+        0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x3F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE1, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x0B, 0xFF, 0xFE, 0xA9, 0xBC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x10,
+        0x00, 0x00, 0x00, 0x4C, 0xFF, 0xFF, 0xFD, 0x30, 0x00, 0x00, 0x00, 0x00, 0x24, 0x53, 0x10, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "t",84 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x01, 0x99, 0x96, 0x00, 0x00, 0x99, 0x97, 0x00, 0x01, 0xFF, 0xFA, 0x00, 0x00, 0xFF, 0xFB, 0x00,
+        0x01, 0xFF, 0xFA, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x01, 0xFF, 0xFA, 0x00, 0x00, 0xFF, 0xFB, 0x00,
+        0x01, 0xFF, 0xFA, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x01, 0xFF, 0xFA, 0x00, 0x00, 0xFF, 0xFB, 0x00,
+        0x01, 0xFF, 0xFA, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x01, 0xFF, 0xFA, 0x00, 0x00, 0xFF, 0xFB, 0x00,
+        0x01, 0xFF, 0xFB, 0x00, 0x01, 0xFF, 0xFB, 0x00, 0x00, 0xEF, 0xFE, 0x20, 0x1B, 0xFF, 0xFB, 0x00,
+        0x00, 0xBF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFD, 0xAF, 0xFB, 0x00,
+        0x00, 0x08, 0xFF, 0xFF, 0xA1, 0x6F, 0xFB, 0x00, 0x00, 0x00, 0x14, 0x42, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "u",85 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x07, 0x99, 0x90, 0x00, 0x00, 0x08, 0x99, 0x70, 0x06, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0x70,
+        0x01, 0xFF, 0xF9, 0x00, 0x00, 0x7F, 0xFF, 0x10, 0x00, 0xAF, 0xFE, 0x00, 0x00, 0xCF, 0xFB, 0x00,
+        0x00, 0x4F, 0xFF, 0x40, 0x02, 0xFF, 0xF5, 0x00, 0x00, 0x0E, 0xFF, 0x90, 0x07, 0xFF, 0xE0, 0x00,
+        0x00, 0x08, 0xFF, 0xE0, 0x0C, 0xFF, 0x90, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x1F, 0xFF, 0x30, 0x00,
+        0x00, 0x00, 0xCF, 0xF8, 0x5F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFD, 0xAF, 0xF7, 0x00, 0x00,
+        0x00, 0x00, 0x1F, 0xFF, 0xEF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xB0, 0x00, 0x00,
+        0x00, 0x00, 0x04, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "v",86 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x59, 0x99, 0x20, 0x00, 0x00, 0x00, 0x99, 0x95, 0x5F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xF5,
+        0x3F, 0xFF, 0x60, 0x4E, 0xE7, 0x02, 0xFF, 0xF3, 0x0F, 0xFF, 0x80, 0x7F, 0xFA, 0x04, 0xFF, 0xF1,
+        0x0D, 0xFF, 0xA0, 0xAF, 0xFD, 0x06, 0xFF, 0xD0, 0x0A, 0xFF, 0xC0, 0xDE, 0xDF, 0x18, 0xFF, 0xB0,
+        0x08, 0xFF, 0xE1, 0xFC, 0xCF, 0x4A, 0xFF, 0x90, 0x05, 0xFF, 0xF5, 0xFA, 0xAF, 0x7C, 0xFF, 0x60,
+        0x03, 0xFF, 0xF8, 0xF8, 0x8F, 0xAD, 0xFF, 0x40, 0x01, 0xFF, 0xFC, 0xF6, 0x5F, 0xCF, 0xFF, 0x20,
+        0x00, 0xDF, 0xFF, 0xF3, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0xAF, 0xFF, 0xF1, 0x0F, 0xFF, 0xFC, 0x00,
+        0x00, 0x8F, 0xFF, 0xD0, 0x0D, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "w",87 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x02, 0x99, 0x98, 0x00, 0x00, 0x69, 0x99, 0x20, 0x00, 0xAF, 0xFF, 0x50, 0x02, 0xFF, 0xFA, 0x00,
+        0x00, 0x1E, 0xFF, 0xD1, 0x0A, 0xFF, 0xE2, 0x00, 0x00, 0x05, 0xFF, 0xF8, 0x2F, 0xFF, 0x60, 0x00,
+        0x00, 0x00, 0x9F, 0xFF, 0xCF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFF, 0xFF, 0xF3, 0x00, 0x00,
+        0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xFF, 0xB0, 0x00, 0x00,
+        0x00, 0x00, 0xAF, 0xFE, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xF3, 0xBF, 0xFF, 0x30, 0x00,
+        0x00, 0x1E, 0xFF, 0xA0, 0x2E, 0xFF, 0xD1, 0x00, 0x00, 0xAF, 0xFF, 0x20, 0x06, 0xFF, 0xF9, 0x00,
+        0x05, 0xFF, 0xF8, 0x00, 0x00, 0xAF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "x",88 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x07, 0x99, 0x90, 0x00, 0x00, 0x07, 0x99, 0x70, 0x05, 0xFF, 0xF5, 0x00, 0x00, 0x1F, 0xFF, 0x70,
+        0x00, 0xDF, 0xFA, 0x00, 0x00, 0x6F, 0xFF, 0x10, 0x00, 0x7F, 0xFF, 0x20, 0x00, 0xBF, 0xFA, 0x00,
+        0x00, 0x1E, 0xFF, 0x70, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0x08, 0xFF, 0xD0, 0x06, 0xFF, 0xD0, 0x00,
+        0x00, 0x02, 0xFF, 0xF4, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xAF, 0xF9, 0x1F, 0xFF, 0x20, 0x00,
+        0x00, 0x00, 0x3F, 0xFE, 0x5F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xDF, 0xF5, 0x00, 0x00,
+        0x00, 0x00, 0x05, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0x80, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x7F, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFB, 0x00, 0x00, 0x00,
+        0x00, 0x10, 0x18, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00,
+        0x00, 0xAF, 0xFF, 0xFC, 0x10, 0x00, 0x00, 0x00, 0x00, 0xAE, 0xEC, 0x71, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "y",89 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
+        0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x05, 0x55, 0x55, 0xAF, 0xFF, 0xD1, 0x00,
+        0x00, 0x00, 0x00, 0x04, 0xFF, 0xFE, 0x20, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0xF4, 0x00, 0x00,
+        0x00, 0x00, 0x02, 0xDF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0xBF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x7F, 0xFF, 0xFE, 0xEE, 0xEE, 0xEE, 0x20, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20,
+        0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "z",90 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xBE, 0xFF, 0xF0, 0x00,
+        0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFB, 0x10, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xAF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xF5, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x9F, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF7, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x7F, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xF7, 0x00, 0x00, 0x00,
+        0x00, 0x03, 0x59, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFB, 0x40, 0x00, 0x00, 0x00,
+        0x00, 0x0E, 0xFF, 0xFD, 0x70, 0x00, 0x00, 0x00, 0x00, 0x01, 0x27, 0xFF, 0xF4, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x8F, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF7, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x8F, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xF6, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xAF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xF6, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x8F, 0xFC, 0x42, 0x20, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0xFF, 0xF0, 0x00,
+        0x00, 0x00, 0x00, 0x02, 0x8C, 0xDD, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "{",91 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x64, 0x00, 0x00, 0x00, /* "|",92 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xEB, 0x40, 0x00, 0x00, 0x00,
+        0x00, 0x0E, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF9, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x6F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFB, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x7F, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x2F, 0xFF, 0x95, 0x30, 0x00, 0x00, 0x00, 0x00, 0x04, 0xBF, 0xFF, 0xE0, 0x00,
+        0x00, 0x00, 0x00, 0x06, 0xDF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x72, 0x10, 0x00,
+        0x00, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF7, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFA, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x5F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFB, 0x00, 0x00, 0x00,
+        0x00, 0x02, 0x24, 0xCF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xE3, 0x00, 0x00, 0x00,
+        0x00, 0x0D, 0xDD, 0xC9, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "}",93 */
+    },
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x6A, 0x93, 0x00, 0x01, 0xA3, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x91, 0x09, 0xFF, 0x20,
+        0x00, 0x8F, 0xFF, 0xFF, 0xFE, 0xCF, 0xFA, 0x00, 0x02, 0xFF, 0xB1, 0x2B, 0xFF, 0xFF, 0xD1, 0x00,
+        0x00, 0x6C, 0x20, 0x00, 0x6C, 0xD9, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* "~",94 */
+    },
+};
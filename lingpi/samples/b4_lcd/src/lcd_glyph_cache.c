@@ -0,0 +1,263 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <string.h>
+#include "lcd_glyph_cache.h"
+
+#if LCD_GLYPH_CACHE_SIZE
+/* 缓存池的数据块数目 */
+#define GLYPH_BLOCK_NUM         (LCD_GLYPH_CACHE_SIZE / LCD_GLYPH_CACHE_BLOCK)
+/* 数据块链表结束标记 */
+#define GLYPH_BLOCK_NONE        0xFFFF
+
+/* 缓存条目 */
+typedef struct {
+    lcd_glyph_key_t key;
+    uint32_t bytes;         /* 像素数据字节数 */
+    uint32_t tick;          /* 最近一次使用的时间 */
+    uint16_t first;         /* 第一个数据块 */
+    uint16_t blocks;        /* 占用的数据块数目 */
+    uint8_t used;           /* 条目是否有效 */
+} lcd_glyph_entry_t;
+
+/* 缓存池，按数据块分配，一个条目的数据块通过链表串联 */
+static uint8_t m_pool[GLYPH_BLOCK_NUM][LCD_GLYPH_CACHE_BLOCK];
+static uint16_t m_block_next[GLYPH_BLOCK_NUM];
+static uint16_t m_free_head = GLYPH_BLOCK_NONE;
+static uint16_t m_free_num = 0;
+static uint16_t m_budget_blocks = GLYPH_BLOCK_NUM;
+static uint8_t m_pool_ready = 0;
+
+static lcd_glyph_entry_t m_entries[LCD_GLYPH_CACHE_ENTRIES];
+static uint32_t m_tick = 0;
+static lcd_glyph_cache_stats_t m_cache_stats;
+
+static void glyph_cache_prepare(void)
+{
+    uint16_t i;
+
+    if (m_pool_ready) {
+        return;
+    }
+    for (i = 0; i < GLYPH_BLOCK_NUM; i++) {
+        m_block_next[i] = (i + 1 < GLYPH_BLOCK_NUM) ? (i + 1) : GLYPH_BLOCK_NONE;
+    }
+    m_free_head = 0;
+    m_free_num = GLYPH_BLOCK_NUM;
+    m_pool_ready = 1;
+}
+
+
+static void glyph_cache_release(lcd_glyph_entry_t *entry)
+{
+    uint16_t block = entry->first;
+    uint16_t next;
+
+    while (block != GLYPH_BLOCK_NONE) {
+        next = m_block_next[block];
+        m_block_next[block] = m_free_head;
+        m_free_head = block;
+        m_free_num++;
+        block = next;
+    }
+    entry->used = 0;
+    m_cache_stats.used_bytes -= entry->blocks * LCD_GLYPH_CACHE_BLOCK;
+}
+
+
+/* 淘汰最近最少使用的条目，没有可淘汰的条目时返回-1 */
+static int glyph_cache_evict(void)
+{
+    int i, victim = -1;
+
+    for (i = 0; i < LCD_GLYPH_CACHE_ENTRIES; i++) {
+        if (m_entries[i].used && (victim < 0 || m_entries[i].tick < m_entries[victim].tick)) {
+            victim = i;
+        }
+    }
+    if (victim >= 0) {
+        glyph_cache_release(&m_entries[victim]);
+        m_cache_stats.evictions++;
+    }
+    return victim;
+}
+
+
+/* 已占用的数据块数目 */
+static uint16_t glyph_cache_used_blocks(void)
+{
+    return GLYPH_BLOCK_NUM - m_free_num;
+}
+#endif
+
+
+int lcd_glyph_cache_find(const lcd_glyph_key_t *key)
+{
+#if LCD_GLYPH_CACHE_SIZE
+    int i;
+
+    for (i = 0; i < LCD_GLYPH_CACHE_ENTRIES; i++) {
+        if (m_entries[i].used && memcmp(&m_entries[i].key, key, sizeof(lcd_glyph_key_t)) == 0) {
+            m_entries[i].tick = ++m_tick;
+            m_cache_stats.hits++;
+            return i;
+        }
+    }
+    m_cache_stats.misses++;
+#endif
+    return -1;
+}
+
+
+int lcd_glyph_cache_alloc(const lcd_glyph_key_t *key)
+{
+#if LCD_GLYPH_CACHE_SIZE
+    int i, slot = -1;
+    uint32_t bytes = (uint32_t)key->w * key->h * 2;
+    uint16_t need = (bytes + LCD_GLYPH_CACHE_BLOCK - 1) / LCD_GLYPH_CACHE_BLOCK;
+    uint16_t block;
+
+    glyph_cache_prepare();
+    if (bytes == 0 || need > m_budget_blocks) {
+        return -1;
+    }
+
+    /* 淘汰旧条目，直到预算内有足够的数据块 */
+    while (glyph_cache_used_blocks() + need > m_budget_blocks) {
+        if (glyph_cache_evict() < 0) {
+            return -1;
+        }
+    }
+    for (i = 0; i < LCD_GLYPH_CACHE_ENTRIES; i++) {
+        if (!m_entries[i].used) {
+            slot = i;
+            break;
+        }
+    }
+    if (slot < 0) {
+        slot = glyph_cache_evict();
+    }
+
+    /* 从空闲链表取出数据块，保持取出的顺序 */
+    m_entries[slot].first = m_free_head;
+    for (i = 0; i < need; i++) {
+        block = m_free_head;
+        m_free_head = m_block_next[block];
+        if (i == need - 1) {
+            m_block_next[block] = GLYPH_BLOCK_NONE;
+        }
+    }
+    m_free_num -= need;
+
+    lcd_glyph_key_set(&m_entries[slot].key, key->mask, key->w, key->h, key->fc, key->bc, key->bpp);
+    m_entries[slot].bytes = bytes;
+    m_entries[slot].blocks = need;
+    m_entries[slot].tick = ++m_tick;
+    m_entries[slot].used = 1;
+    m_cache_stats.used_bytes += need * LCD_GLYPH_CACHE_BLOCK;
+    return slot;
+#else
+    return -1;
+#endif
+}
+
+
+void lcd_glyph_cache_iter(int entry, lcd_glyph_iter_t *it)
+{
+#if LCD_GLYPH_CACHE_SIZE
+    it->block = m_entries[entry].first;
+    it->remain = m_entries[entry].bytes;
+#else
+    it->remain = 0;
+#endif
+}
+
+
+uint8_t *lcd_glyph_cache_next(lcd_glyph_iter_t *it, uint32_t *len)
+{
+#if LCD_GLYPH_CACHE_SIZE
+    uint8_t *data;
+
+    if (it->remain == 0 || it->block == GLYPH_BLOCK_NONE) {
+        return NULL;
+    }
+    data = m_pool[it->block];
+    *len = (it->remain < LCD_GLYPH_CACHE_BLOCK) ? it->remain : LCD_GLYPH_CACHE_BLOCK;
+    it->remain -= *len;
+    it->block = m_block_next[it->block];
+    return data;
+#else
+    return NULL;
+#endif
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_glyph_cache_set_budget
+ * 说    明: 设置字模缓存可使用的字节数，不超过LCD_GLYPH_CACHE_SIZE，
+ *           超出新预算的条目按最近最少使用淘汰
+ * 参    数:
+ *       @bytes：缓存预算(字节)
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_glyph_cache_set_budget(uint32_t bytes)
+{
+#if LCD_GLYPH_CACHE_SIZE
+    uint32_t blocks = bytes / LCD_GLYPH_CACHE_BLOCK;
+
+    glyph_cache_prepare();
+    m_budget_blocks = (blocks < GLYPH_BLOCK_NUM) ? blocks : GLYPH_BLOCK_NUM;
+    while (glyph_cache_used_blocks() > m_budget_blocks) {
+        glyph_cache_evict();
+    }
+#endif
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_glyph_cache_clear
+ * 说    明: 清空字模缓存
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_glyph_cache_clear(void)
+{
+#if LCD_GLYPH_CACHE_SIZE
+    int i;
+
+    for (i = 0; i < LCD_GLYPH_CACHE_ENTRIES; i++) {
+        if (m_entries[i].used) {
+            glyph_cache_release(&m_entries[i]);
+        }
+    }
+#endif
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_glyph_cache_get_stats
+ * 说    明: 获取字模缓存的命中/未命中统计
+ * 参    数:
+ *       @stats：存放统计结果
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_glyph_cache_get_stats(lcd_glyph_cache_stats_t *stats)
+{
+#if LCD_GLYPH_CACHE_SIZE
+    *stats = m_cache_stats;
+    stats->budget_bytes = (uint32_t)m_budget_blocks * LCD_GLYPH_CACHE_BLOCK;
+#else
+    memset(stats, 0, sizeof(lcd_glyph_cache_stats_t));
+#endif
+}
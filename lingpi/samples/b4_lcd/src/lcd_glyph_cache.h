@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef _LCD_GLYPH_CACHE_H_
+#define _LCD_GLYPH_CACHE_H_
+
+#include <stdint.h>
+#include <string.h>
+#include "lcd.h"
+
+/* 字模缓存的键：同一字模在不同颜色下分别缓存 */
+typedef struct {
+    const uint8_t *mask;    /* 字模数据地址，与宽高和bpp一起唯一标识字体、字号和字符。
+                               由母版缩小的字模为母版字模的地址 */
+    uint16_t w;             /* 字模宽度 */
+    uint16_t h;             /* 字模高度 */
+    uint16_t fc;            /* 字的颜色 */
+    uint16_t bc;            /* 字的背景色 */
+    uint16_t bpp;           /* 字模每像素的位数，1或4 */
+} lcd_glyph_key_t;
+
+/* 设置缓存的键。键用memcmp比较，先清零填充字节 */
+static inline void lcd_glyph_key_set(lcd_glyph_key_t *key, const uint8_t *mask, uint16_t w, uint16_t h,
+                                     uint16_t fc, uint16_t bc, uint16_t bpp)
+{
+    memset(key, 0, sizeof(lcd_glyph_key_t));
+    key->mask = mask;
+    key->w = w;
+    key->h = h;
+    key->fc = fc;
+    key->bc = bc;
+    key->bpp = bpp;
+}
+
+/* 遍历缓存条目数据块的迭代器 */
+typedef struct {
+    uint16_t block;         /* 当前数据块 */
+    uint32_t remain;        /* 剩余字节数 */
+} lcd_glyph_iter_t;
+
+/***************************************************************
+ * 函数名称: lcd_glyph_cache_find
+ * 说    明: 查找字模缓存，命中时更新条目的使用时间
+ * 参    数:
+ *       @key：字模缓存的键
+ * 返 回 值: 命中返回条目编号，未命中返回-1
+ ***************************************************************/
+int lcd_glyph_cache_find(const lcd_glyph_key_t *key);
+
+
+/***************************************************************
+ * 函数名称: lcd_glyph_cache_alloc
+ * 说    明: 为字模分配缓存条目(w * h * 2字节)，空间不足时按最近
+ *           最少使用淘汰旧条目
+ * 参    数:
+ *       @key：字模缓存的键
+ * 返 回 值: 成功返回条目编号，超出缓存预算或未启用缓存返回-1
+ ***************************************************************/
+int lcd_glyph_cache_alloc(const lcd_glyph_key_t *key);
+
+
+/***************************************************************
+ * 函数名称: lcd_glyph_cache_iter
+ * 说    明: 初始化条目数据块的迭代器
+ * 参    数:
+ *       @entry：条目编号
+ *       @it：迭代器
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_glyph_cache_iter(int entry, lcd_glyph_iter_t *it);
+
+
+/***************************************************************
+ * 函数名称: lcd_glyph_cache_next
+ * 说    明: 取出下一个数据块，数据块长度总是偶数(整像素)
+ * 参    数:
+ *       @it：迭代器
+ *       @len：返回数据块的有效长度
+ * 返 回 值: 数据块地址，遍历结束返回NULL
+ ***************************************************************/
+uint8_t *lcd_glyph_cache_next(lcd_glyph_iter_t *it, uint32_t *len);
+
+#endif /* _LCD_GLYPH_CACHE_H_ */
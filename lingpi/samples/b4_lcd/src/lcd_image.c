@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <stdio.h>
+#include <string.h>
+#include "lcd.h"
+#include "lcd_internal.h"
+
+/* 游程编码数据包头 */
+#define RLE_RUN_FLAG            0x80
+#define RLE_COUNT_MASK          0x7F
+
+/* 每字节的位数 */
+#define BYTE_TO_BITS            8
+
+/* 游程编码的解码状态，跨行保持 */
+typedef struct {
+    const uint8_t *p;       /* 下一个待读取的字节 */
+    const uint8_t *end;     /* 数据结尾 */
+    uint8_t run;            /* 当前数据包是否为重复像素 */
+    uint8_t remain;         /* 当前数据包剩余的像素数 */
+    uint16_t color;         /* 重复像素的颜色 */
+} lcd_rle_t;
+
+/* 解码后的一行像素，按面板字节序存放 */
+static uint8_t m_row_buf[LCD_SIZE_MAX * 2];
+
+
+/* 查调色板，越界的索引按黑色处理 */
+static inline uint16_t lcd_image_palette(const lcd_image_t *image, uint8_t index)
+{
+    return (index < image->palette_num) ? image->palette[index] : 0;
+}
+
+
+/* 读取一个像素值：RGB565为2字节，调色板索引为1字节 */
+static uint16_t lcd_image_pixel(const lcd_image_t *image, const uint8_t *p)
+{
+    if (image->format == LCD_IMAGE_RLE) {
+        return ((uint16_t)p[0] << BYTE_TO_BITS) | p[1];
+    }
+    return lcd_image_palette(image, p[0]);
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_image_decode_rle
+ * 说    明: 从游程编码数据中解码一行像素到m_row_buf
+ * 参    数:
+ *       @image：图片资源
+ *       @rle：解码状态
+ * 返 回 值: 返回0为成功，数据损坏返回-1
+ ***************************************************************/
+static int lcd_image_decode_rle(const lcd_image_t *image, lcd_rle_t *rle)
+{
+    uint8_t size = (image->format == LCD_IMAGE_RLE) ? 2 : 1;
+    uint16_t n = 0;
+    uint16_t k, i;
+    uint16_t color;
+    uint8_t head;
+
+    while (n < image->width) {
+        if (rle->remain == 0) {
+            if (rle->p >= rle->end) {
+                return -1;
+            }
+            head = *rle->p++;
+            rle->run = head & RLE_RUN_FLAG;
+            rle->remain = (head & RLE_COUNT_MASK) + 1;
+            if (rle->run) {
+                if (rle->end - rle->p < size) {
+                    return -1;
+                }
+                rle->color = lcd_image_pixel(image, rle->p);
+                rle->p += size;
+            }
+        }
+
+        k = image->width - n;
+        if (k > rle->remain) {
+            k = rle->remain;
+        }
+        if (rle->run) {
+            for (i = n; i < n + k; i++) {
+                m_row_buf[i * 2] = (uint8_t)(rle->color >> BYTE_TO_BITS);
+                m_row_buf[i * 2 + 1] = (uint8_t)rle->color;
+            }
+        } else {
+            if (rle->end - rle->p < (int32_t)k * size) {
+                return -1;
+            }
+            if (size == 2) {
+                memcpy(&m_row_buf[n * 2], rle->p, k * 2);
+                rle->p += k * 2;
+            } else {
+                for (i = n; i < n + k; i++) {
+                    color = lcd_image_palette(image, *rle->p++);
+                    m_row_buf[i * 2] = (uint8_t)(color >> BYTE_TO_BITS);
+                    m_row_buf[i * 2 + 1] = (uint8_t)color;
+                }
+            }
+        }
+        rle->remain -= k;
+        n += k;
+    }
+    return 0;
+}
+
+
+/* 将一行1/2/4/8位调色板索引展开到m_row_buf */
+static void lcd_image_decode_index(const lcd_image_t *image, const uint8_t *src)
+{
+    uint8_t bpp = image->bpp;
+    uint8_t mask = (uint8_t)((1 << bpp) - 1);
+    uint8_t shift = BYTE_TO_BITS;
+    uint16_t color;
+    uint16_t i;
+
+    for (i = 0; i < image->width; i++) {
+        shift -= bpp;
+        color = lcd_image_palette(image, (*src >> shift) & mask);
+        if (shift == 0) {
+            shift = BYTE_TO_BITS;
+            src++;
+        }
+        m_row_buf[i * 2] = (uint8_t)(color >> BYTE_TO_BITS);
+        m_row_buf[i * 2 + 1] = (uint8_t)color;
+    }
+}
+
+
+/* 检查图片资源的格式和数据长度 */
+static int lcd_image_check(const lcd_image_t *image)
+{
+    uint32_t stride;
+
+    switch (image->format) {
+        case LCD_IMAGE_RAW:
+            return (image->data_len >= (uint32_t)image->width * image->height * 2) ? 0 : -1;
+        case LCD_IMAGE_RLE:
+            return 0;
+        case LCD_IMAGE_INDEX:
+            if (image->bpp != 1 && image->bpp != 2 && image->bpp != 4 && image->bpp != 8) {
+                return -1;
+            }
+            stride = ((uint32_t)image->width * image->bpp + BYTE_TO_BITS - 1) / BYTE_TO_BITS;
+            if (image->data_len < stride * image->height) {
+                return -1;
+            }
+            return (image->palette != NULL && image->palette_num > 0) ? 0 : -1;
+        case LCD_IMAGE_INDEX_RLE:
+            return (image->palette != NULL && image->palette_num > 0) ? 0 : -1;
+        default:
+            return -1;
+    }
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_show_image
+ * 说    明: 显示压缩图片。整幅图片只设置一次窗口，每解码一行
+ *           就整行发送；原始格式的图片直接从Flash整块发送
+ * 参    数:
+ *       @x：指定图片的起始位置X坐标
+ *       @y：指定图片的起始位置Y坐标
+ *       @image：图片资源
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+unsigned int lcd_show_image(uint16_t x, uint16_t y, const lcd_image_t *image)
+{
+    lcd_rle_t rle;
+    const uint8_t *src;
+    uint32_t stride;
+    uint16_t row;
+    int ret = 0;
+
+    if (image == NULL || image->width == 0 || image->height == 0) {
+        printf("%s, %d: image is invalid!\n", __FILE__, __LINE__);
+        return __LINE__;
+    }
+    if ((uint32_t)x + image->width > LCD_W || (uint32_t)y + image->height > LCD_H) {
+        printf("%s, %d: image out of screen!\n", __FILE__, __LINE__);
+        return __LINE__;
+    }
+    if (lcd_image_check(image) != 0) {
+        printf("%s, %d: image format %d is invalid!\n", __FILE__, __LINE__, image->format);
+        return __LINE__;
+    }
+
+    lcd_window_begin(x, y, x + image->width - 1, y + image->height - 1);
+    if (image->format == LCD_IMAGE_RAW) {
+        lcd_window_write(image->data, (uint32_t)image->width * image->height);
+        lcd_window_end();
+        return 0;
+    }
+
+    memset(&rle, 0, sizeof(rle));
+    rle.p = image->data;
+    rle.end = image->data + image->data_len;
+    src = image->data;
+    stride = ((uint32_t)image->width * image->bpp + BYTE_TO_BITS - 1) / BYTE_TO_BITS;
+    for (row = 0; row < image->height; row++) {
+        if (image->format == LCD_IMAGE_INDEX) {
+            lcd_image_decode_index(image, src);
+            src += stride;
+        } else if (lcd_image_decode_rle(image, &rle) != 0) {
+            /* 数据损坏时用黑色补齐窗口，保证窗口内的像素数正确 */
+            memset(m_row_buf, 0, sizeof(m_row_buf));
+            ret = __LINE__;
+        }
+        lcd_window_write(m_row_buf, image->width);
+    }
+    lcd_window_end();
+
+    if (ret != 0) {
+        printf("%s, %d: image data is corrupted!\n", __FILE__, __LINE__);
+    }
+    return ret;
+}
@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef _LCD_INTERNAL_H_
+#define _LCD_INTERNAL_H_
+
+#include <stdint.h>
+#include "lcd.h"
+
+/* 4-bpp抗锯齿字体，列表在lcd_font.c中 */
+typedef struct {
+    uint8_t width;                  /* 字模宽度 */
+    uint8_t height;                 /* 字模高度，即字号 */
+    uint16_t first;                 /* 起始码点 */
+    uint16_t count;                 /* 字模数目 */
+    const uint8_t *data;            /* 字模数据，每个字模占(width + 1) / 2 * height个字节，
+                                       NULL表示画字时由母版缩小生成 */
+} lcd_font_aa_t;
+
+extern const lcd_font_aa_t lcd_fonts_aa[];
+extern const uint8_t lcd_fonts_aa_num;
+
+/* ASCII母版字体：32号4-bpp抗锯齿字模，在lcd_font_aa.c中 */
+#define LCD_FONT_MASTER_WIDTH   16
+#define LCD_FONT_MASTER_HEIGHT  32
+extern const uint8_t ascii_aa_3216[][256];
+
+/***************************************************************
+ * 函数名称: lcd_font_scale_glyph
+ * 说    明: 用盒式滤波把母版中的一个字模缩小为1-bpp或4-bpp字模，
+ *           由lcd_font.c实现，抗锯齿字模缓存未命中时调用
+ * 参    数:
+ *       @master：母版字模，ascii_aa_3216中的一项
+ *       @width/height：输出字模的宽高，不大于母版
+ *       @bpp：输出每像素的位数，1或4
+ * 返 回 值: 缩小后的字模，在下一次调用前有效
+ ***************************************************************/
+const uint8_t *lcd_font_scale_glyph(const uint8_t *master, uint8_t width, uint8_t height, uint8_t bpp);
+
+
+/***************************************************************
+ * 函数名称: lcd_font_scaled_mask
+ * 说    明: 取母版中的一个字模缩小后的1-bpp点阵，由lcd_font.c实现。
+ *           点阵按母版字模和宽高缓存(LCD_FONT_MASK_CACHE_NUM)，只在
+ *           未命中时缩小
+ * 参    数:
+ *       @master：母版字模，ascii_aa_3216中的一项
+ *       @width/height：点阵的宽高，不大于母版
+ * 返 回 值: 1-bpp点阵，在下一次调用前有效
+ ***************************************************************/
+const uint8_t *lcd_font_scaled_mask(const uint8_t *master, uint8_t width, uint8_t height);
+
+/* 驱动内部的写窗口接口，由lcd.c实现，供图片解码等模块使用 */
+
+/***************************************************************
+ * 函数名称: lcd_window_begin
+ * 说    明: 开始向指定窗口写像素。窗口完全落在显存内时只写显存并
+ *           标记为脏；否则直接写LCD，与显存重叠的部分同时写入显存
+ * 参    数:
+ *       @x1/y1/x2/y2：窗口范围(含边界)
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_window_begin(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
+
+
+/***************************************************************
+ * 函数名称: lcd_window_push
+ * 说    明: 向当前窗口写一个像素，按行优先移动写入位置
+ * 参    数:
+ *       @color：像素颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_window_push(uint16_t color);
+
+
+/***************************************************************
+ * 函数名称: lcd_window_fill
+ * 说    明: 向当前窗口连续写入count个相同颜色的像素
+ * 参    数:
+ *       @color：像素颜色
+ *       @count：像素数目
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_window_fill(uint16_t color, uint32_t count);
+
+
+/***************************************************************
+ * 函数名称: lcd_window_write
+ * 说    明: 向当前窗口连续写入count个像素，像素按面板字节序存放
+ *           (高字节在前)，直接写LCD时整块数据只占用一次总线传输
+ * 参    数:
+ *       @data：像素数据
+ *       @count：像素数目
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_window_write(const uint8_t *data, uint32_t count);
+
+
+/***************************************************************
+ * 函数名称: lcd_window_end
+ * 说    明: 结束当前窗口，发送行缓冲区中剩余的像素
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_window_end(void);
+
+
+/***************************************************************
+ * 函数名称: lcd_draw_span
+ * 说    明: 用一个地址窗口填充一个矩形，通常为一段水平或垂直的线段，
+ *           超出屏幕的部分被裁剪
+ * 参    数:
+ *       @x1/y1/x2/y2：矩形范围(含边界，x1 <= x2，y1 <= y2)，可以为负数
+ *       @color：填充颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_draw_span(int x1, int y1, int x2, int y2, uint16_t color);
+
+
+/***************************************************************
+ * 函数名称: lcd_fb_region
+ * 说    明: 区域完全落在显存内时将其标记为脏，返回区域左上角像素在
+ *           显存中的地址，调用者随后直接修改显存
+ * 参    数:
+ *       @x1/y1/x2/y2：区域范围(含边界)
+ *       @stride：返回显存每行的字节数
+ * 返 回 值: 显存地址，没有显存或区域不完全在显存内时返回NULL
+ ***************************************************************/
+uint8_t *lcd_fb_region(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint32_t *stride);
+
+
+/***************************************************************
+ * 函数名称: lcd_utf8_next
+ * 说    明: 从UTF-8字符串中解码一个Unicode码点并移动字符串指针，
+ *           非法的字节序列解码为U+FFFD，每次只跳过一个字节
+ * 参    数:
+ *       @s：字符串指针的地址
+ * 返 回 值: Unicode码点，字符串结束返回0
+ ***************************************************************/
+uint32_t lcd_utf8_next(const uint8_t **s);
+
+
+/***************************************************************
+ * 函数名称: lcd_num_format
+ * 说    明: 将整数转换为显示字符，只用除10取余逐位提取数字。
+ *           超出len位的高位数字被舍弃
+ * 参    数:
+ *       @cells：存放显示字符，不加结束符，有小数位时至少len + 1个字节，
+ *                否则至少len个字节
+ *       @value：数值(已按小数位数放大)
+ *       @len：数字位数(含小数位)
+ *       @decimals：小数位数，不为0时在小数位前插入'.'
+ *       @blank：是否将整数部分的前导0显示为空格(个位始终显示)
+ * 返 回 值: 显示字符的个数
+ ***************************************************************/
+uint8_t lcd_num_format(uint8_t *cells, uint32_t value, uint8_t len, uint8_t decimals, uint8_t blank);
+
+
+/***************************************************************
+ * 函数名称: lcd_num_format_int
+ * 说    明: 将有符号整数转换为显示字符，整数部分的前导0显示为空格，
+ *           负号放在最高位数字的左边，没有空位时占用第一个字符
+ * 参    数:
+ *       @cells：存放显示字符，不加结束符，有小数位时至少len + 1个字节，
+ *                否则至少len个字节
+ *       @value：数值(已按小数位数放大)
+ *       @len：数字位数(含小数位)
+ *       @decimals：小数位数
+ * 返 回 值: 显示字符的个数
+ ***************************************************************/
+uint8_t lcd_num_format_int(uint8_t *cells, int32_t value, uint8_t len, uint8_t decimals);
+
+
+/***************************************************************
+ * 函数名称: lcd_num_scale
+ * 说    明: 将小数按小数位数放大为整数，四舍五入
+ * 参    数:
+ *       @value：数值
+ *       @decimals：小数位数
+ * 返 回 值: 放大后的整数
+ ***************************************************************/
+int32_t lcd_num_scale(float value, uint8_t decimals);
+
+#endif /* _LCD_INTERNAL_H_ */
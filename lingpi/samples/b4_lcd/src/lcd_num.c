@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <string.h>
+#include "lcd.h"
+#include "lcd_internal.h"
+
+#define CHAR_0                  ((uint8_t)('0'))
+#define DECIMAL_BASE            10
+
+/***************************************************************
+ * 函数名称: lcd_num_format
+ * 说    明: 将整数转换为显示字符，只用除10取余逐位提取数字。
+ *           超出len位的高位数字被舍弃
+ * 参    数:
+ *       @cells：存放显示字符，不加结束符，有小数位时至少len + 1个字节，
+ *                否则至少len个字节
+ *       @value：数值(已按小数位数放大)
+ *       @len：数字位数(含小数位)
+ *       @decimals：小数位数，不为0时在小数位前插入'.'
+ *       @blank：是否将整数部分的前导0显示为空格(个位始终显示)
+ * 返 回 值: 显示字符的个数
+ ***************************************************************/
+uint8_t lcd_num_format(uint8_t *cells, uint32_t value, uint8_t len, uint8_t decimals, uint8_t blank)
+{
+    uint8_t count = (decimals > 0 && decimals < len) ? (len + 1) : len;
+    uint8_t int_len = (count > len) ? (len - decimals) : len;
+    uint8_t i = count;
+    uint8_t digits = 0;
+
+    /* 从最低位开始向左填充 */
+    while (i > 0) {
+        i--;
+        if (count > len && digits == decimals && i == int_len) {
+            cells[i] = '.';
+            continue;
+        }
+        cells[i] = CHAR_0 + value % DECIMAL_BASE;
+        value /= DECIMAL_BASE;
+        digits++;
+    }
+
+    if (blank) {
+        for (i = 0; i + 1 < int_len && cells[i] == CHAR_0; i++) {
+            cells[i] = ' ';
+        }
+    }
+    return count;
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_num_init
+ * 说    明: 初始化数字控件，第一次设置数值时绘制全部字符
+ * 参    数:
+ *       @num：数字控件
+ *       @x：指定数字的起始位置X坐标
+ *       @y：指定数字的起始位置Y坐标
+ *       @len：数字位数(含小数位)，不超过LCD_NUM_MAX_LEN
+ *       @decimals：小数位数，0为整数
+ *       @fc: 数字的颜色
+ *       @bc: 数字的背景色
+ *       @sizey: 字号，可选：12、16、24、32
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_num_init(lcd_num_t *num, uint16_t x, uint16_t y, uint8_t len, uint8_t decimals,
+                  uint16_t fc, uint16_t bc, uint8_t sizey)
+{
+    memset(num, 0, sizeof(lcd_num_t));
+    num->x = x;
+    num->y = y;
+    num->len = (len > LCD_NUM_MAX_LEN) ? LCD_NUM_MAX_LEN : len;
+    num->decimals = (decimals < num->len) ? decimals : 0;
+    num->fc = fc;
+    num->bc = bc;
+    num->sizey = sizey;
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_num_update
+ * 说    明: 比较新旧显示字符，只重画发生变化的字符
+ * 参    数:
+ *       @num：数字控件
+ *       @cells：新的显示字符
+ *       @count：显示字符的个数
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_num_update(lcd_num_t *num, const uint8_t *cells, uint8_t count)
+{
+    uint16_t sizex = num->sizey / 2;
+    uint8_t i;
+
+    for (i = 0; i < count; i++) {
+        if (num->valid && num->cells[i] == cells[i]) {
+            continue;
+        }
+        lcd_show_char(num->x + i * sizex, num->y, cells[i], num->fc, num->bc, num->sizey, 0);
+        num->cells[i] = cells[i];
+    }
+    num->valid = 1;
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_num_format_int
+ * 说    明: 将有符号整数转换为显示字符，整数部分的前导0显示为空格，
+ *           负号放在最高位数字的左边，没有空位时占用第一个字符
+ * 参    数:
+ *       @cells：存放显示字符，不加结束符，有小数位时至少len + 1个字节，
+ *                否则至少len个字节
+ *       @value：数值(已按小数位数放大)
+ *       @len：数字位数(含小数位)
+ *       @decimals：小数位数
+ * 返 回 值: 显示字符的个数
+ ***************************************************************/
+uint8_t lcd_num_format_int(uint8_t *cells, int32_t value, uint8_t len, uint8_t decimals)
+{
+    uint8_t count;
+    uint8_t i;
+
+    count = lcd_num_format(cells, (value < 0) ? (0u - (uint32_t)value) : (uint32_t)value, len, decimals, 1);
+    if (value < 0) {
+        for (i = 0; i + 1 < count && cells[i] == ' '; i++) {
+        }
+        cells[(i > 0) ? (i - 1) : 0] = '-';
+    }
+    return count;
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_num_scale
+ * 说    明: 将小数按小数位数放大为整数，四舍五入
+ * 参    数:
+ *       @value：数值
+ *       @decimals：小数位数
+ * 返 回 值: 放大后的整数
+ ***************************************************************/
+int32_t lcd_num_scale(float value, uint8_t decimals)
+{
+    float scaled = value;
+    uint8_t i;
+
+    for (i = 0; i < decimals; i++) {
+        scaled *= DECIMAL_BASE;
+    }
+    return (int32_t)((scaled < 0) ? (scaled - 0.5f) : (scaled + 0.5f));
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_num_set_int
+ * 说    明: 设置数字控件显示的整数，只重画发生变化的字符。
+ *           有小数位时value为放大10^decimals倍后的数值
+ * 参    数:
+ *       @num：数字控件
+ *       @value：数值
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_num_set_int(lcd_num_t *num, int32_t value)
+{
+    uint8_t cells[LCD_NUM_MAX_LEN + 1];
+    uint8_t count;
+
+    count = lcd_num_format_int(cells, value, num->len, num->decimals);
+    lcd_num_update(num, cells, count);
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_num_set_float
+ * 说    明: 设置数字控件显示的小数，按小数位数四舍五入
+ * 参    数:
+ *       @num：数字控件
+ *       @value：数值
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_num_set_float(lcd_num_t *num, float value)
+{
+    lcd_num_set_int(num, lcd_num_scale(value, num->decimals));
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_num_invalidate
+ * 说    明: 标记数字控件需要完全重画，用于清屏或被其他内容覆盖之后
+ * 参    数:
+ *       @num：数字控件
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_num_invalidate(lcd_num_t *num)
+{
+    num->valid = 0;
+}
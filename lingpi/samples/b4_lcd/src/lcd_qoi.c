@@ -0,0 +1,382 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <stdio.h>
+#include <string.h>
+#include "lcd.h"
+#include "lcd_color.h"
+#include "lcd_qoi.h"
+#include "lcd_internal.h"
+
+#ifndef MIN
+#define MIN(a, b)               (((a) < (b)) ? (a) : (b))
+#endif
+#ifndef MAX
+#define MAX(a, b)               (((a) > (b)) ? (a) : (b))
+#endif
+
+/* 数据块的标记，前两种占8位，其余占高2位 */
+#define QOI_OP_RGB              0xFE
+#define QOI_OP_RGBA             0xFF
+#define QOI_OP_INDEX            0x00
+#define QOI_OP_DIFF             0x40
+#define QOI_OP_LUMA             0x80
+#define QOI_OP_RUN              0xC0
+#define QOI_MASK_2              0xC0
+
+/* 最近像素表的大小 */
+#define QOI_INDEX_SIZE          64
+
+/* 每像素的通道 */
+#define QOI_R                   0
+#define QOI_G                   1
+#define QOI_B                   2
+#define QOI_A                   3
+
+/* 每字节的位数 */
+#define BYTE_TO_BITS            8
+
+/* 转换为RGB565后的一行像素，只在一次lcd_qoi_flush_line中使用 */
+static uint8_t m_qoi_rgb565[LCD_SIZE_MAX * 2];
+
+/* lcd_show_qoi使用的解码器和读取缓冲区 */
+static lcd_qoi_t m_qoi;
+static uint8_t m_qoi_chunk[LCD_QOI_CHUNK];
+
+
+/* 读取大端的32位整数 */
+static uint32_t lcd_qoi_read32(const uint8_t *p)
+{
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << BYTE_TO_BITS) | p[3];
+}
+
+
+/* 数据块的字节数，由第一个字节决定 */
+static uint8_t lcd_qoi_op_size(uint8_t tag)
+{
+    if (tag == QOI_OP_RGB) {
+        return 4;
+    } else if (tag == QOI_OP_RGBA) {
+        return 5;
+    } else if ((tag & QOI_MASK_2) == QOI_OP_LUMA) {
+        return 2;
+    }
+    return 1;
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_qoi_header
+ * 说    明: 解析文件头，计算每行在屏幕内的像素范围
+ * 参    数:
+ *       @qoi：解码器，文件头在op中
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+static unsigned int lcd_qoi_header(lcd_qoi_t *qoi)
+{
+    const uint8_t *h = qoi->op;
+    int32_t first, last;
+
+    if (h[0] != 'q' || h[1] != 'o' || h[2] != 'i' || h[3] != 'f') {
+        printf("%s, %d: not a qoi image!\n", __FILE__, __LINE__);
+        return __LINE__;
+    }
+    qoi->width = lcd_qoi_read32(&h[4]);
+    qoi->height = lcd_qoi_read32(&h[8]);
+    if (qoi->width == 0 || qoi->height == 0 || (h[12] != 3 && h[12] != 4) || h[13] > 1) {
+        printf("%s, %d: qoi header is invalid!\n", __FILE__, __LINE__);
+        return __LINE__;
+    }
+
+    /* 裁剪到屏幕内的列，只有这些像素需要保存 */
+    first = MAX(0, -(int32_t)qoi->x);
+    last = (int32_t)LCD_W - qoi->x;
+    if (last > 0 && qoi->width < (uint32_t)last) {
+        last = (int32_t)qoi->width;
+    }
+    qoi->vis_first = (uint16_t)first;
+    qoi->vis_num = (last > first) ? (uint16_t)(last - first) : 0;
+    return 0;
+}
+
+
+/* 当前行解码完成，在屏幕内的部分转换为RGB565后用一个窗口发送 */
+static void lcd_qoi_flush_line(lcd_qoi_t *qoi)
+{
+    int32_t sy = (int32_t)qoi->y + (int32_t)qoi->row;
+    uint16_t sx = (uint16_t)(qoi->x + qoi->vis_first);
+
+    if (qoi->vis_num == 0 || sy < 0 || sy >= LCD_H) {
+        return;
+    }
+    if (qoi->flags & LCD_QOI_DITHER) {
+        lcd_color_convert_dither(m_qoi_rgb565, qoi->line, qoi->vis_num, LCD_COLOR_RGB888, sx, (uint16_t)sy);
+    } else {
+        lcd_color_convert(m_qoi_rgb565, qoi->line, qoi->vis_num, LCD_COLOR_RGB888);
+    }
+    lcd_window_begin(sx, (uint16_t)sy, sx + qoi->vis_num - 1, (uint16_t)sy);
+    lcd_window_write(m_qoi_rgb565, qoi->vis_num);
+    lcd_window_end();
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_qoi_put
+ * 说    明: 输出count个当前像素，只保存屏幕内的列，每满一行发送一次
+ * 参    数:
+ *       @qoi：解码器
+ *       @count：像素数，重复像素可以跨行
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_qoi_put(lcd_qoi_t *qoi, uint32_t count)
+{
+    uint32_t n, lo, hi, i;
+    uint8_t *p;
+
+    while (count > 0 && qoi->state == LCD_QOI_STATE_PIXELS) {
+        n = MIN(count, qoi->width - qoi->col);
+        lo = MAX(qoi->col, qoi->vis_first);
+        hi = MIN(qoi->col + n, (uint32_t)qoi->vis_first + qoi->vis_num);
+        for (i = lo; i < hi; i++) {
+            p = &qoi->line[(i - qoi->vis_first) * 3];
+            p[0] = qoi->px[QOI_R];
+            p[1] = qoi->px[QOI_G];
+            p[2] = qoi->px[QOI_B];
+        }
+        qoi->col += n;
+        count -= n;
+
+        if (qoi->col == qoi->width) {
+            lcd_qoi_flush_line(qoi);
+            qoi->col = 0;
+            qoi->row++;
+            if (qoi->row == qoi->height) {
+                qoi->state = LCD_QOI_STATE_DONE;
+            }
+        }
+    }
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_qoi_decode_op
+ * 说    明: 解码一个完整的数据块，更新当前像素和最近像素表
+ * 参    数:
+ *       @qoi：解码器
+ *       @op：数据块，长度为lcd_qoi_op_size(op[0])
+ * 返 回 值: 数据块表示的像素数
+ ***************************************************************/
+static uint32_t lcd_qoi_decode_op(lcd_qoi_t *qoi, const uint8_t *op)
+{
+    uint8_t *px = qoi->px;
+    uint8_t tag = op[0];
+    int8_t dg;
+
+    if (tag == QOI_OP_RGB) {
+        px[QOI_R] = op[1];
+        px[QOI_G] = op[2];
+        px[QOI_B] = op[3];
+    } else if (tag == QOI_OP_RGBA) {
+        px[QOI_R] = op[1];
+        px[QOI_G] = op[2];
+        px[QOI_B] = op[3];
+        px[QOI_A] = op[4];
+    } else {
+        switch (tag & QOI_MASK_2) {
+            case QOI_OP_INDEX:
+                memcpy(px, qoi->index[tag], sizeof(qoi->px));
+                /* 取出的像素已在表中的同一位置 */
+                return 1;
+            case QOI_OP_DIFF:
+                px[QOI_R] += ((tag >> 4) & 0x03) - 2;
+                px[QOI_G] += ((tag >> 2) & 0x03) - 2;
+                px[QOI_B] += (tag & 0x03) - 2;
+                break;
+            case QOI_OP_LUMA:
+                dg = (int8_t)((tag & 0x3F) - 32);
+                px[QOI_R] += dg - 8 + ((op[1] >> 4) & 0x0F);
+                px[QOI_G] += dg;
+                px[QOI_B] += dg - 8 + (op[1] & 0x0F);
+                break;
+            default:
+                /* 重复像素不改变当前像素，表中已有该像素 */
+                return (uint32_t)(tag & 0x3F) + 1;
+        }
+    }
+
+    memcpy(qoi->index[(px[QOI_R] * 3 + px[QOI_G] * 5 + px[QOI_B] * 7 + px[QOI_A] * 11) % QOI_INDEX_SIZE],
+           px, sizeof(qoi->px));
+    return 1;
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_qoi_begin
+ * 说    明: 初始化QOI解码器，图片可以部分超出屏幕，超出的部分被裁剪
+ * 参    数:
+ *       @qoi：解码器
+ *       @x：图片左上角的X坐标
+ *       @y：图片左上角的Y坐标
+ *       @flags：LCD_QOI_DITHER或0
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_qoi_begin(lcd_qoi_t *qoi, int16_t x, int16_t y, uint8_t flags)
+{
+    if (qoi == NULL) {
+        return;
+    }
+
+    qoi->x = x;
+    qoi->y = y;
+    qoi->flags = flags;
+    qoi->state = LCD_QOI_STATE_HEADER;
+    qoi->width = 0;
+    qoi->height = 0;
+    qoi->col = 0;
+    qoi->row = 0;
+    qoi->vis_first = 0;
+    qoi->vis_num = 0;
+    qoi->op_len = 0;
+    qoi->px[QOI_R] = 0;
+    qoi->px[QOI_G] = 0;
+    qoi->px[QOI_B] = 0;
+    qoi->px[QOI_A] = 0xFF;
+    memset(qoi->index, 0, sizeof(qoi->index));
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_qoi_feed
+ * 说    明: 送入一段QOI数据，解码出的每一整行立即显示。完整的数据块
+ *           直接从data中解码，只有跨段的数据块才暂存到解码器中
+ * 参    数:
+ *       @qoi：解码器
+ *       @data：数据
+ *       @len：数据长度，可以为任意值
+ * 返 回 值: 返回0为成功，数据错误返回非0，之后的数据不再解码
+ ***************************************************************/
+unsigned int lcd_qoi_feed(lcd_qoi_t *qoi, const uint8_t *data, uint32_t len)
+{
+    unsigned int ret;
+    uint32_t n;
+    uint8_t size;
+
+    if (qoi == NULL || (data == NULL && len > 0)) {
+        printf("%s, %d: qoi or data is null!\n", __FILE__, __LINE__);
+        return __LINE__;
+    }
+    if (qoi->state == LCD_QOI_STATE_ERROR) {
+        return __LINE__;
+    }
+
+    if (qoi->state == LCD_QOI_STATE_HEADER) {
+        n = MIN(len, (uint32_t)(LCD_QOI_HEADER_SIZE - qoi->op_len));
+        memcpy(&qoi->op[qoi->op_len], data, n);
+        qoi->op_len += (uint8_t)n;
+        data += n;
+        len -= n;
+        if (qoi->op_len < LCD_QOI_HEADER_SIZE) {
+            return 0;
+        }
+        qoi->op_len = 0;
+        ret = lcd_qoi_header(qoi);
+        if (ret != 0) {
+            qoi->state = LCD_QOI_STATE_ERROR;
+            return ret;
+        }
+        qoi->state = LCD_QOI_STATE_PIXELS;
+    }
+
+    /* 补齐上一段留下的数据块 */
+    if (qoi->op_len > 0 && qoi->state == LCD_QOI_STATE_PIXELS) {
+        size = lcd_qoi_op_size(qoi->op[0]);
+        n = MIN(len, (uint32_t)(size - qoi->op_len));
+        memcpy(&qoi->op[qoi->op_len], data, n);
+        qoi->op_len += (uint8_t)n;
+        data += n;
+        len -= n;
+        if (qoi->op_len < size) {
+            return 0;
+        }
+        qoi->op_len = 0;
+        lcd_qoi_put(qoi, lcd_qoi_decode_op(qoi, qoi->op));
+    }
+
+    while (len > 0 && qoi->state == LCD_QOI_STATE_PIXELS) {
+        size = lcd_qoi_op_size(data[0]);
+        if (len < size) {
+            memcpy(qoi->op, data, len);
+            qoi->op_len = (uint8_t)len;
+            return 0;
+        }
+        lcd_qoi_put(qoi, lcd_qoi_decode_op(qoi, data));
+        data += size;
+        len -= size;
+    }
+    return 0;
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_qoi_done
+ * 说    明: 判断图片的所有像素是否已经显示
+ * 参    数:
+ *       @qoi：解码器
+ * 返 回 值: 全部显示返回1，否则返回0
+ ***************************************************************/
+uint8_t lcd_qoi_done(const lcd_qoi_t *qoi)
+{
+    return (qoi != NULL && qoi->state == LCD_QOI_STATE_DONE) ? 1 : 0;
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_show_qoi
+ * 说    明: 通过回调函数分段读取QOI图片并显示，每次读取LCD_QOI_CHUNK
+ *           个字节，读到所有像素后返回，不再读取文件的结束标记
+ * 参    数:
+ *       @x：图片左上角的X坐标
+ *       @y：图片左上角的Y坐标
+ *       @read：读取数据的回调函数
+ *       @ctx：传给回调函数的参数，例如文件描述符或套接字的地址
+ *       @flags：LCD_QOI_DITHER或0
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+unsigned int lcd_show_qoi(int16_t x, int16_t y, lcd_qoi_read_t read, void *ctx, uint8_t flags)
+{
+    unsigned int ret;
+    int n;
+
+    if (read == NULL) {
+        printf("%s, %d: read is null!\n", __FILE__, __LINE__);
+        return __LINE__;
+    }
+
+    lcd_qoi_begin(&m_qoi, x, y, flags);
+    while (!lcd_qoi_done(&m_qoi)) {
+        n = read(ctx, m_qoi_chunk, sizeof(m_qoi_chunk));
+        if (n < 0) {
+            printf("%s, %d: read failed(%d)!\n", __FILE__, __LINE__, n);
+            return __LINE__;
+        } else if (n == 0) {
+            printf("%s, %d: qoi image is truncated at row %u!\n", __FILE__, __LINE__, (unsigned int)m_qoi.row);
+            return __LINE__;
+        }
+        ret = lcd_qoi_feed(&m_qoi, m_qoi_chunk, (uint32_t)n);
+        if (ret != 0) {
+            return ret;
+        }
+    }
+    return 0;
+}
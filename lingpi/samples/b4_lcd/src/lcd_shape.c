@@ -0,0 +1,480 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <stdio.h>
+#include "lcd.h"
+#include "lcd_internal.h"
+
+#ifndef MIN
+#define MIN(a, b)               (((a) < (b)) ? (a) : (b))
+#endif
+
+#if (LCD_POLY_MAX_VERTICES < 4) || (LCD_POLY_MAX_VERTICES > 255)
+#error "LCD_POLY_MAX_VERTICES must be in 4 ~ 255"
+#endif
+
+/* 顶点坐标的小数位数，内部坐标以1/256像素为单位，像素中心为整数坐标 */
+#define POLY_SUB_SHIFT          8
+#define POLY_SUB_ONE            (1 << POLY_SUB_SHIFT)
+
+/* 正弦表的小数位数 */
+#define SIN_SHIFT               14
+
+/* 圆弧用弦近似时，弦高不超过1/4像素：r * (1 - cos(d / 2)) ≈ r * d * d / 8 / 3283 <= 1/4 */
+#define ARC_STEP_LIMIT          6566
+#define ARC_STEP_MAX            30
+#define ARC_STEP_MIN            2
+
+#define DEGREE_90               90
+#define DEGREE_180              180
+#define DEGREE_360              360
+
+/* 顶点，以1/256像素为单位 */
+typedef struct {
+    int32_t x;
+    int32_t y;
+} lcd_poly_vertex_t;
+
+/* 边表中的一条边，交点X坐标为x + err / dy，每条扫描线用整数DDA递推 */
+typedef struct {
+    int32_t x;                  /* 交点X坐标的整数部分 */
+    int32_t err;                /* 交点X坐标的小数部分，0 <= err < dy */
+    int32_t quot;               /* 每条扫描线X坐标增量的整数部分 */
+    int32_t rem;                /* 每条扫描线X坐标增量的余数，0 <= rem < dy */
+    int32_t dy;                 /* 边的高度 */
+    int16_t row;                /* 边经过的第一条扫描线 */
+    int16_t end;                /* 边经过的最后一条扫描线 + 1 */
+} lcd_poly_edge_t;
+
+/* sin(0 ~ 90度)，放大2^14倍 */
+static const int16_t m_sin_table[DEGREE_90 + 1] = {
+        0,   286,   572,   857,  1143,  1428,  1713,  1997,  2280,  2563,
+     2845,  3126,  3406,  3686,  3964,  4240,  4516,  4790,  5063,  5334,
+     5604,  5872,  6138,  6402,  6664,  6924,  7182,  7438,  7692,  7943,
+     8192,  8438,  8682,  8923,  9162,  9397,  9630,  9860, 10087, 10311,
+    10531, 10749, 10963, 11174, 11381, 11585, 11786, 11982, 12176, 12365,
+    12551, 12733, 12911, 13085, 13255, 13421, 13583, 13741, 13894, 14044,
+    14189, 14330, 14466, 14598, 14726, 14849, 14968, 15082, 15191, 15296,
+    15396, 15491, 15582, 15668, 15749, 15826, 15897, 15964, 16026, 16083,
+    16135, 16182, 16225, 16262, 16294, 16322, 16344, 16362, 16374, 16382,
+    16384,
+};
+
+static lcd_poly_vertex_t m_poly_vertices[LCD_POLY_MAX_VERTICES];
+/* 边表，按第一条扫描线排序 */
+static lcd_poly_edge_t m_poly_edges[LCD_POLY_MAX_VERTICES];
+/* 活动边的下标 */
+static uint8_t m_poly_active[LCD_POLY_MAX_VERTICES];
+/* 当前扫描线与活动边的交点(像素列) */
+static int32_t m_poly_cross[LCD_POLY_MAX_VERTICES];
+
+
+/* 向下取整的除法，b > 0 */
+static int32_t lcd_poly_floor_div(int64_t a, int32_t b, int32_t *rem)
+{
+    int64_t q = a / b;
+    int64_t r = a - q * b;
+
+    if (r < 0) {
+        q--;
+        r += b;
+    }
+    if (rem != NULL) {
+        *rem = (int32_t)r;
+    }
+    return (int32_t)q;
+}
+
+
+/* 1/256像素坐标向下取整为像素 */
+static int32_t lcd_poly_floor(int32_t v)
+{
+    return lcd_poly_floor_div(v, POLY_SUB_ONE, NULL);
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_poly_add_edge
+ * 说    明: 把一条边按第一条扫描线插入边表，水平边和完全在屏幕上下
+ *           两侧的边被忽略。边经过中心Y坐标满足ymin <= y < ymax的行
+ * 参    数:
+ *       @a/b：边的两个端点
+ *       @num：边表中已有的边数
+ *       @height：屏幕高度
+ * 返 回 值: 边表中的边数
+ ***************************************************************/
+static uint8_t lcd_poly_add_edge(const lcd_poly_vertex_t *a, const lcd_poly_vertex_t *b, uint8_t num, int32_t height)
+{
+    const lcd_poly_vertex_t *t;
+    lcd_poly_edge_t edge;
+    int32_t row, end, dx;
+    uint8_t i;
+
+    if (a->y == b->y) {
+        return num;
+    }
+    if (a->y > b->y) {
+        t = a;
+        a = b;
+        b = t;
+    }
+    row = lcd_poly_floor(a->y + POLY_SUB_ONE - 1);
+    end = lcd_poly_floor(b->y + POLY_SUB_ONE - 1);
+    row = (row < 0) ? 0 : row;
+    end = (end > height) ? height : end;
+    if (row >= end) {
+        return num;
+    }
+
+    dx = b->x - a->x;
+    edge.dy = b->y - a->y;
+    edge.row = (int16_t)row;
+    edge.end = (int16_t)end;
+    edge.x = a->x + lcd_poly_floor_div((int64_t)dx * (row * POLY_SUB_ONE - a->y), edge.dy, &edge.err);
+    edge.quot = lcd_poly_floor_div((int64_t)dx * POLY_SUB_ONE, edge.dy, &edge.rem);
+
+    for (i = num; i > 0 && m_poly_edges[i - 1].row > edge.row; i--) {
+        m_poly_edges[i] = m_poly_edges[i - 1];
+    }
+    m_poly_edges[i] = edge;
+    return num + 1;
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_poly_fill
+ * 说    明: 扫描线填充多边形：建立按起始行排序的边表，逐行维护活动边，
+ *           交点排序后每两个交点之间的一段用一个窗口填充
+ * 参    数:
+ *       @v：顶点数组，以1/256像素为单位
+ *       @num：顶点数目
+ *       @color：填充颜色
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_poly_fill(const lcd_poly_vertex_t *v, uint8_t num, uint16_t color)
+{
+    lcd_poly_edge_t *e;
+    int32_t height = LCD_H;
+    int32_t row, c;
+    uint8_t edges = 0;
+    uint8_t next = 0;
+    uint8_t active = 0;
+    uint8_t i, j;
+
+    for (i = 0; i < num; i++) {
+        edges = lcd_poly_add_edge(&v[i], &v[(i + 1 == num) ? 0 : (i + 1)], edges, height);
+    }
+    if (edges == 0) {
+        return;
+    }
+
+    for (row = m_poly_edges[0].row; next < edges || active > 0; row++) {
+        /* 加入从这一行开始的边，去掉已经结束的边 */
+        while (next < edges && m_poly_edges[next].row == row) {
+            m_poly_active[active++] = next++;
+        }
+        for (i = 0, j = 0; i < active; i++) {
+            if (m_poly_edges[m_poly_active[i]].end > row) {
+                m_poly_active[j++] = m_poly_active[i];
+            }
+        }
+        active = j;
+
+        /* 交点取像素中心不小于交点的第一列，按列插入排序 */
+        for (i = 0; i < active; i++) {
+            e = &m_poly_edges[m_poly_active[i]];
+            c = lcd_poly_floor(e->x + ((e->err > 0) ? POLY_SUB_ONE : (POLY_SUB_ONE - 1)));
+            for (j = i; j > 0 && m_poly_cross[j - 1] > c; j--) {
+                m_poly_cross[j] = m_poly_cross[j - 1];
+            }
+            m_poly_cross[j] = c;
+
+            e->x += e->quot;
+            e->err += e->rem;
+            if (e->err >= e->dy) {
+                e->err -= e->dy;
+                e->x++;
+            }
+        }
+        for (i = 0; i + 1 < active; i += 2) {
+            if (m_poly_cross[i + 1] > m_poly_cross[i]) {
+                lcd_draw_span(m_poly_cross[i], row, m_poly_cross[i + 1] - 1, row, color);
+            }
+        }
+    }
+}
+
+
+/* sin(angle)，angle以度为单位，结果放大2^14倍 */
+static int32_t lcd_shape_sin(int32_t angle)
+{
+    angle %= DEGREE_360;
+    if (angle < 0) {
+        angle += DEGREE_360;
+    }
+    if (angle <= DEGREE_90) {
+        return m_sin_table[angle];
+    }
+    if (angle <= DEGREE_180) {
+        return m_sin_table[DEGREE_180 - angle];
+    }
+    if (angle <= DEGREE_180 + DEGREE_90) {
+        return -m_sin_table[angle - DEGREE_180];
+    }
+    return -m_sin_table[DEGREE_360 - angle];
+}
+
+
+static int32_t lcd_shape_cos(int32_t angle)
+{
+    return lcd_shape_sin(angle + DEGREE_90);
+}
+
+
+/* len * s / 2^14，四舍五入 */
+static int32_t lcd_shape_mul(int32_t len, int32_t s)
+{
+    int64_t v = (int64_t)len * s;
+
+    if (v >= 0) {
+        return (int32_t)((v + (1 << (SIN_SHIFT - 1))) >> SIN_SHIFT);
+    }
+    return -(int32_t)((-v + (1 << (SIN_SHIFT - 1))) >> SIN_SHIFT);
+}
+
+
+/* 以(cx, cy)为圆心，半径为r像素的圆上angle度处的顶点 */
+static void lcd_shape_point(lcd_poly_vertex_t *v, int32_t cx, int32_t cy, uint16_t r, int32_t angle)
+{
+    int32_t len = (int32_t)r * POLY_SUB_ONE;
+
+    v->x = cx + lcd_shape_mul(len, lcd_shape_cos(angle));
+    v->y = cy + lcd_shape_mul(len, lcd_shape_sin(angle));
+}
+
+
+/* 圆弧上angle度处的顶点。圆弧用每step度一段的弦近似，angle不是step的
+ * 整数倍时取弦上的对应位置，使同一圆上任意一段圆弧的边界都落在同一条折线上
+ */
+static void lcd_shape_arc_point(lcd_poly_vertex_t *v, int32_t cx, int32_t cy, uint16_t r, int32_t angle,
+                                int32_t step)
+{
+    lcd_poly_vertex_t next;
+    int32_t rem;
+
+    lcd_poly_floor_div(angle, step, &rem);
+    lcd_shape_point(v, cx, cy, r, angle - rem);
+    if (rem == 0) {
+        return;
+    }
+    lcd_shape_point(&next, cx, cy, r, angle - rem + step);
+    v->x += lcd_poly_floor_div((int64_t)(next.x - v->x) * rem * 2 + step, step * 2, NULL);
+    v->y += lcd_poly_floor_div((int64_t)(next.y - v->y) * rem * 2 + step, step * 2, NULL);
+}
+
+
+/* 从start到end顺时针扫过的角度，start与end相等时为0，相差360度的整数倍时为360 */
+static int32_t lcd_shape_sweep(int16_t start, int16_t end)
+{
+    int32_t sweep = ((int32_t)end - start) % DEGREE_360;
+
+    if (sweep < 0) {
+        sweep += DEGREE_360;
+    }
+    if (sweep == 0 && end != start) {
+        sweep = DEGREE_360;
+    }
+    return sweep;
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_shape_arc
+ * 说    明: 填充圆环的一段，r_in为0时为扇形。每段弦对应的角度按外半径
+ *           选择，使弦高不超过1/4像素；顶点都落在按该角度的整数倍
+ *           划分的同一条折线上，所以部分重叠的两段圆弧边界一致，可以
+ *           互相覆盖。顶点数超过LCD_POLY_MAX_VERTICES时拆为多个多边形，
+ *           相邻多边形的公共边不会重复填充
+ * 参    数:
+ *       @x0/y0：圆心坐标
+ *       @r_out/r_in：外半径和内半径
+ *       @start：起始角度
+ *       @sweep：扫过的角度
+ *       @color：填充颜色
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_shape_arc(int16_t x0, int16_t y0, uint16_t r_out, uint16_t r_in, int32_t start, int32_t sweep,
+                          uint16_t color)
+{
+    int32_t angles[LCD_POLY_MAX_VERTICES];
+    int32_t cx = (int32_t)x0 * POLY_SUB_ONE;
+    int32_t cy = (int32_t)y0 * POLY_SUB_ONE;
+    int32_t end = start + sweep;
+    int32_t step = ARC_STEP_MAX;
+    int32_t max_seg, seg, rem, i;
+    uint8_t n;
+
+    if (r_out == 0 || sweep <= 0) {
+        return;
+    }
+    /* 步长取360的约数，使相差360度整数倍的角度得到同一个顶点 */
+    while (step > ARC_STEP_MIN && ((int32_t)r_out * step * step > ARC_STEP_LIMIT || DEGREE_360 % step != 0)) {
+        step--;
+    }
+    max_seg = (r_in > 0) ? (LCD_POLY_MAX_VERTICES / 2 - 1) : (LCD_POLY_MAX_VERTICES - 2);
+
+    while (start < end) {
+        /* 这一段圆弧上各顶点的角度 */
+        angles[0] = start;
+        for (seg = 0; seg < max_seg && angles[seg] < end; seg++) {
+            lcd_poly_floor_div(angles[seg], step, &rem);
+            angles[seg + 1] = MIN(angles[seg] - rem + step, end);
+        }
+
+        n = 0;
+        if (r_in == 0) {
+            m_poly_vertices[n].x = cx;
+            m_poly_vertices[n].y = cy;
+            n++;
+        }
+        for (i = 0; i <= seg; i++) {
+            lcd_shape_arc_point(&m_poly_vertices[n++], cx, cy, r_out, angles[i], step);
+        }
+        for (i = (r_in > 0) ? seg : -1; i >= 0; i--) {
+            lcd_shape_arc_point(&m_poly_vertices[n++], cx, cy, r_in, angles[i], step);
+        }
+        lcd_poly_fill(m_poly_vertices, n, color);
+
+        start = angles[seg];
+    }
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_fill_triangle
+ * 说    明: 画实心三角形，填充规则同lcd_fill_polygon
+ * 参    数:
+ *       @x0/y0、x1/y1、x2/y2：三个顶点的坐标，可以为负数
+ *       @color：填充颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_fill_triangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color)
+{
+    lcd_point_t points[3] = {{x0, y0}, {x1, y1}, {x2, y2}};
+
+    lcd_fill_polygon(points, 3, color);
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_fill_polygon
+ * 说    明: 画实心多边形。按奇偶规则填充中心落在多边形内的像素，
+ *           相邻多边形的公共边不会重复填充；每条扫描线上的每一段
+ *           只设置一次窗口，超出屏幕的部分被裁剪
+ * 参    数:
+ *       @points：顶点数组，首尾自动相连
+ *       @num：顶点数目，3 ~ LCD_POLY_MAX_VERTICES
+ *       @color：填充颜色
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+unsigned int lcd_fill_polygon(const lcd_point_t *points, uint8_t num, uint16_t color)
+{
+    uint8_t i;
+
+    if (points == NULL || num < 3 || num > LCD_POLY_MAX_VERTICES) {
+        printf("%s, %d: polygon with %d vertices is invalid!\n", __FILE__, __LINE__, num);
+        return __LINE__;
+    }
+
+    for (i = 0; i < num; i++) {
+        m_poly_vertices[i].x = (int32_t)points[i].x * POLY_SUB_ONE;
+        m_poly_vertices[i].y = (int32_t)points[i].y * POLY_SUB_ONE;
+    }
+    lcd_poly_fill(m_poly_vertices, num, color);
+    return 0;
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_fill_pie
+ * 说    明: 画实心扇形。角度以度为单位，0度指向右方，顺时针增加，
+ *           从start顺时针画到end，两者相等时不画；圆弧用弦近似，
+ *           误差不超过1/4像素
+ * 参    数:
+ *       @x0/y0：圆心坐标，可以为负数
+ *       @r：半径
+ *       @start：起始角度
+ *       @end：结束角度
+ *       @color：填充颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_fill_pie(int16_t x0, int16_t y0, uint16_t r, int16_t start, int16_t end, uint16_t color)
+{
+    lcd_shape_arc(x0, y0, r, 0, start, lcd_shape_sweep(start, end), color);
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_fill_arc
+ * 说    明: 画有宽度的圆弧(圆环的一段)，角度规则同lcd_fill_pie，
+ *           宽度不小于半径时即为扇形
+ * 参    数:
+ *       @x0/y0：圆心坐标，可以为负数
+ *       @r：外半径
+ *       @width：圆弧宽度，内半径为r - width
+ *       @start：起始角度
+ *       @end：结束角度
+ *       @color：填充颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_fill_arc(int16_t x0, int16_t y0, uint16_t r, uint16_t width, int16_t start, int16_t end, uint16_t color)
+{
+    uint16_t r_in = (width < r) ? (r - width) : 0;
+
+    if (width == 0) {
+        return;
+    }
+    lcd_shape_arc(x0, y0, r, r_in, start, lcd_shape_sweep(start, end), color);
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_fill_needle
+ * 说    明: 画仪表指针：底边中点在圆心、宽度为width、指向angle方向
+ *           的实心三角形，顶点坐标精确到1/256像素
+ * 参    数:
+ *       @x0/y0：圆心坐标，可以为负数
+ *       @len：指针长度
+ *       @width：指针底边宽度
+ *       @angle：指针方向，角度规则同lcd_fill_pie
+ *       @color：填充颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_fill_needle(int16_t x0, int16_t y0, uint16_t len, uint16_t width, int16_t angle, uint16_t color)
+{
+    int32_t cx = (int32_t)x0 * POLY_SUB_ONE;
+    int32_t cy = (int32_t)y0 * POLY_SUB_ONE;
+    /* 底边的一半，以1/256像素为单位 */
+    int32_t half = (int32_t)width * (POLY_SUB_ONE / 2);
+    int32_t s = lcd_shape_sin(angle);
+    int32_t c = lcd_shape_cos(angle);
+    lcd_poly_vertex_t v[3];
+
+    lcd_shape_point(&v[0], cx, cy, len, angle);
+    v[1].x = cx - lcd_shape_mul(half, s);
+    v[1].y = cy + lcd_shape_mul(half, c);
+    v[2].x = cx + lcd_shape_mul(half, s);
+    v[2].y = cy - lcd_shape_mul(half, c);
+    lcd_poly_fill(v, 3, color);
+}
@@ -0,0 +1,323 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <string.h>
+#include "lcd.h"
+#include "lcd_internal.h"
+#include "lcd_glyph_cache.h"
+
+/* 混合查找表的级数，与4-bpp字模的灰度级数相同 */
+#define LCD_AA_LEVELS           16
+#define LCD_AA_LEVEL_MAX        (LCD_AA_LEVELS - 1)
+
+/* 抗锯齿字模每像素的位数 */
+#define LCD_AA_BPP              4
+
+/* 抗锯齿字模的最大像素数(32*16) */
+#define LCD_AA_GLYPH_PIXELS     512
+
+/* UTF-8字符的最大字节数 */
+#define UTF8_CHAR_MAX           4
+
+/* RGB565的各通道 */
+#define RGB565_R(c)             (((c) >> 11) & 0x1F)
+#define RGB565_G(c)             (((c) >> 5) & 0x3F)
+#define RGB565_B(c)             ((c) & 0x1F)
+
+/* 一组字的颜色和背景色对应的混合查找表，像素按面板字节序存放 */
+typedef struct {
+    uint16_t fc;
+    uint16_t bc;
+    uint32_t stamp;             /* 最近一次使用的时间，0为未使用 */
+    uint8_t pixels[LCD_AA_LEVELS * 2];
+} lcd_aa_lut_t;
+
+static lcd_aa_lut_t m_aa_luts[LCD_AA_LUT_NUM];
+static uint32_t m_aa_clock = 0;
+
+/* 超出字模缓存预算时展开的字模，整个字模一次写入窗口 */
+static uint8_t m_aa_glyph[LCD_AA_GLYPH_PIXELS * 2];
+
+/***************************************************************
+ * 函数名称: lcd_aa_lut_build
+ * 说    明: 计算16级混合查找表，第a级为背景色与字的颜色按a:15混合。
+ *           乘法只在建表时进行，画字时每个像素只查表
+ * 参    数:
+ *       @lut：混合查找表，fc和bc已设置
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_aa_lut_build(lcd_aa_lut_t *lut)
+{
+    uint16_t fr = RGB565_R(lut->fc), fg = RGB565_G(lut->fc), fb = RGB565_B(lut->fc);
+    uint16_t br = RGB565_R(lut->bc), bg = RGB565_G(lut->bc), bb = RGB565_B(lut->bc);
+    uint16_t a, r, g, b, color;
+
+    for (a = 0; a < LCD_AA_LEVELS; a++) {
+        r = (br * (LCD_AA_LEVEL_MAX - a) + fr * a + LCD_AA_LEVEL_MAX / 2) / LCD_AA_LEVEL_MAX;
+        g = (bg * (LCD_AA_LEVEL_MAX - a) + fg * a + LCD_AA_LEVEL_MAX / 2) / LCD_AA_LEVEL_MAX;
+        b = (bb * (LCD_AA_LEVEL_MAX - a) + fb * a + LCD_AA_LEVEL_MAX / 2) / LCD_AA_LEVEL_MAX;
+        color = (uint16_t)((r << 11) | (g << 5) | b);
+        lut->pixels[a * 2] = (uint8_t)(color >> 8);
+        lut->pixels[a * 2 + 1] = (uint8_t)color;
+    }
+}
+
+/***************************************************************
+ * 函数名称: lcd_aa_lut_get
+ * 说    明: 查找字的颜色和背景色对应的混合查找表，没有时替换最久
+ *           未使用的一个
+ * 参    数:
+ *       @fc: 字的颜色
+ *       @bc: 字的背景色
+ * 返 回 值: 查找表的像素数据
+ ***************************************************************/
+static const uint8_t *lcd_aa_lut_get(uint16_t fc, uint16_t bc)
+{
+    lcd_aa_lut_t *lut;
+    uint8_t i, victim = 0;
+
+    m_aa_clock++;
+    for (i = 0; i < LCD_AA_LUT_NUM; i++) {
+        lut = &m_aa_luts[i];
+        if (lut->stamp != 0 && lut->fc == fc && lut->bc == bc) {
+            lut->stamp = m_aa_clock;
+            return lut->pixels;
+        }
+        if (lut->stamp < m_aa_luts[victim].stamp) {
+            victim = i;
+        }
+    }
+
+    lut = &m_aa_luts[victim];
+    lut->fc = fc;
+    lut->bc = bc;
+    lut->stamp = m_aa_clock;
+    lcd_aa_lut_build(lut);
+    return lut->pixels;
+}
+
+/* 查找字号对应的抗锯齿字体 */
+static const lcd_font_aa_t *lcd_aa_font_find(uint8_t sizey)
+{
+    uint8_t i;
+
+    for (i = 0; i < lcd_fonts_aa_num; i++) {
+        if (lcd_fonts_aa[i].height == sizey &&
+            (uint32_t)lcd_fonts_aa[i].width * lcd_fonts_aa[i].height <= LCD_AA_GLYPH_PIXELS) {
+            return &lcd_fonts_aa[i];
+        }
+    }
+    return NULL;
+}
+
+/* 按混合查找表把4-bpp字模展开为RGB565像素写入字模缓存条目 */
+static void lcd_aa_expand(const lcd_font_aa_t *font, const uint8_t *glyph, const uint8_t *lut, int entry)
+{
+    uint16_t stride = (font->width + 1) / 2;
+    uint16_t px = 0, py = 0;
+    const uint8_t *pixel;
+    uint32_t i, len = 0;
+    uint8_t *data;
+    uint8_t b;
+    lcd_glyph_iter_t it;
+
+    lcd_glyph_cache_iter(entry, &it);
+    while ((data = lcd_glyph_cache_next(&it, &len)) != NULL) {
+        for (i = 0; i < len; i += 2) {
+            b = glyph[py * stride + px / 2];
+            pixel = &lut[((px & 1) ? (b & 0x0F) : (b >> 4)) * 2];
+            data[i] = pixel[0];
+            data[i + 1] = pixel[1];
+            if (++px == font->width) {
+                px = 0;
+                py++;
+            }
+        }
+    }
+}
+
+/***************************************************************
+ * 函数名称: lcd_aa_draw_clipped
+ * 说    明: 显示超出屏幕右边或下边的4-bpp字模，用一个裁剪后的窗口
+ *           只写入屏幕内的像素，与其他图形一样经过显存
+ * 参    数:
+ *       @x/y：字符的起始位置，在屏幕内
+ *       @font：抗锯齿字体
+ *       @glyph：字模数据
+ *       @lut：混合查找表
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_aa_draw_clipped(uint16_t x, uint16_t y, const lcd_font_aa_t *font, const uint8_t *glyph,
+                                const uint8_t *lut)
+{
+    uint16_t stride = (font->width + 1) / 2;
+    uint16_t vw = lcd_get_width() - x;
+    uint16_t vh = lcd_get_height() - y;
+    const uint8_t *pixel;
+    uint16_t row, col;
+    uint8_t b;
+
+    vw = (vw < font->width) ? vw : font->width;
+    vh = (vh < font->height) ? vh : font->height;
+    lcd_window_begin(x, y, x + vw - 1, y + vh - 1);
+    for (row = 0; row < vh; row++) {
+        for (col = 0; col < vw; col++) {
+            b = glyph[row * stride + col / 2];
+            pixel = &lut[((col & 1) ? (b & 0x0F) : (b >> 4)) * 2];
+            lcd_window_push((uint16_t)((pixel[0] << 8) | pixel[1]));
+        }
+    }
+    lcd_window_end();
+}
+
+/***************************************************************
+ * 函数名称: lcd_aa_draw_glyph
+ * 说    明: 显示一个4-bpp字模，整个字模只设置一次窗口。展开后的像素
+ *           存入字模缓存，再次显示相同的字模和颜色时直接整块发送；
+ *           由母版缩小的字模只在缓存未命中时生成
+ * 参    数:
+ *       @x：字符的起始位置X坐标
+ *       @y：字符的起始位置Y坐标
+ *       @font：抗锯齿字体
+ *       @glyph：字模数据，font->data为NULL时为母版字模
+ *       @fc: 字的颜色
+ *       @bc: 字的背景色
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_aa_draw_glyph(uint16_t x, uint16_t y, const lcd_font_aa_t *font, const uint8_t *glyph,
+                              uint16_t fc, uint16_t bc)
+{
+    lcd_glyph_key_t key;
+    lcd_glyph_iter_t it;
+    const uint8_t *lut;
+    const uint8_t *pixel;
+    uint8_t *dst = m_aa_glyph;
+    uint32_t len = 0;
+    uint8_t *data;
+    uint16_t row, col;
+    uint8_t b;
+    int entry;
+
+    if (x >= lcd_get_width() || y >= lcd_get_height()) {
+        return;
+    }
+    if (x + font->width > lcd_get_width() || y + font->height > lcd_get_height()) {
+        /* 超出屏幕右边或下边时只显示屏幕内的部分，显存与屏幕保持一致 */
+        if (font->data == NULL) {
+            glyph = lcd_font_scale_glyph(glyph, font->width, font->height, LCD_AA_BPP);
+        }
+        lcd_aa_draw_clipped(x, y, font, glyph, lcd_aa_lut_get(fc, bc));
+        return;
+    }
+
+    lcd_glyph_key_set(&key, glyph, font->width, font->height, fc, bc, LCD_AA_BPP);
+    lcd_window_begin(x, y, x + font->width - 1, y + font->height - 1);
+    entry = lcd_glyph_cache_find(&key);
+    if (entry < 0) {
+        if (font->data == NULL) {
+            glyph = lcd_font_scale_glyph(glyph, font->width, font->height, LCD_AA_BPP);
+        }
+        lut = lcd_aa_lut_get(fc, bc);
+        entry = lcd_glyph_cache_alloc(&key);
+        if (entry >= 0) {
+            lcd_aa_expand(font, glyph, lut, entry);
+        }
+    }
+
+    if (entry >= 0) {
+        lcd_glyph_cache_iter(entry, &it);
+        while ((data = lcd_glyph_cache_next(&it, &len)) != NULL) {
+            lcd_window_write(data, len / 2);
+        }
+        lcd_window_end();
+        return;
+    }
+
+    /* 超出缓存预算时展开到m_aa_glyph */
+    for (row = 0; row < font->height; row++) {
+        for (col = 0; col < font->width; col += 2) {
+            b = *glyph++;
+            pixel = &lut[(b >> 4) * 2];
+            *dst++ = pixel[0];
+            *dst++ = pixel[1];
+            if (col + 1 < font->width) {
+                pixel = &lut[(b & 0x0F) * 2];
+                *dst++ = pixel[0];
+                *dst++ = pixel[1];
+            }
+        }
+    }
+    lcd_window_write(m_aa_glyph, (uint32_t)font->width * font->height);
+    lcd_window_end();
+}
+
+/***************************************************************
+ * 函数名称: lcd_draw_text_aa
+ * 说    明: 用4-bpp抗锯齿字库显示UTF-8字符串，字的边缘按覆盖率与背景色
+ *           混合。没有抗锯齿字库的字号和非ASCII字符按lcd_draw_text的
+ *           非叠加模式显示。遇到'\n'时换到下一行的起始X坐标
+ * 参    数:
+ *       @x：指定字符串的起始位置X坐标
+ *       @y：指定字符串的起始位置Y坐标
+ *       @s：指定字符串
+ *       @fc: 字的颜色
+ *       @bc: 字的背景色
+ *       @sizey: 字号，抗锯齿字库为16、24、32
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_draw_text_aa(uint16_t x, uint16_t y, const uint8_t *s, uint16_t fc, uint16_t bc, uint8_t sizey)
+{
+    const lcd_font_aa_t *font = lcd_aa_font_find(sizey);
+    const uint8_t *glyph;
+    const uint8_t *p;
+    uint8_t buf[UTF8_CHAR_MAX + 1];
+    uint16_t x0 = x;
+    uint32_t code;
+    uint8_t i;
+
+    if (font == NULL) {
+        lcd_draw_text(x, y, s, fc, bc, sizey, 0);
+        return;
+    }
+
+    p = s;
+    while ((code = lcd_utf8_next(&s)) != 0) {
+        if (code == '\n') {
+            x = x0;
+            y += sizey;
+        } else if (code >= 0x80) {
+            /* 汉字等没有抗锯齿字模的字符，把这个字符的字节交给lcd_draw_text */
+            for (i = 0; p + i < s; i++) {
+                buf[i] = p[i];
+            }
+            buf[i] = '\0';
+            lcd_draw_text(x, y, buf, fc, bc, sizey, 0);
+            x += sizey;
+        } else {
+            if (code >= font->first && code < font->first + font->count) {
+                /* 由母版缩小的字体以母版字模作为缓存的键 */
+                if (font->data == NULL) {
+                    glyph = ascii_aa_3216[code - font->first];
+                } else {
+                    glyph = font->data + (code - font->first) * ((font->width + 1) / 2 * font->height);
+                }
+                lcd_aa_draw_glyph(x, y, font, glyph, fc, bc);
+            } else {
+                lcd_fill(x, y, x + font->width, y + font->height, bc);
+            }
+            x += font->width;
+        }
+        p = s;
+    }
+}
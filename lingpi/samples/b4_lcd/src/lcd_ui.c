@@ -0,0 +1,794 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <stdio.h>
+#include <string.h>
+#include "lcd.h"
+#include "lcd_ui.h"
+#include "lcd_internal.h"
+
+#ifndef MIN
+#define MIN(a, b)               (((a) < (b)) ? (a) : (b))
+#endif
+#ifndef MAX
+#define MAX(a, b)               (((a) > (b)) ? (a) : (b))
+#endif
+
+/* 合并两个失效矩形时，多重画的像素少于这个数目就合并 */
+#define LCD_UI_MERGE_PIXELS     6
+
+/* 矩形，坐标包含边界 */
+typedef struct {
+    uint16_t x1;
+    uint16_t y1;
+    uint16_t x2;
+    uint16_t y2;
+} lcd_ui_rect_t;
+
+/* 失效矩形列表 */
+static lcd_ui_rect_t m_ui_dirty[LCD_UI_DIRTY_MAX];
+static uint8_t m_ui_dirty_num = 0;
+
+
+static uint32_t lcd_ui_rect_area(const lcd_ui_rect_t *r)
+{
+    return (uint32_t)(r->x2 - r->x1 + 1) * (r->y2 - r->y1 + 1);
+}
+
+
+static void lcd_ui_rect_union(const lcd_ui_rect_t *a, const lcd_ui_rect_t *b, lcd_ui_rect_t *out)
+{
+    out->x1 = MIN(a->x1, b->x1);
+    out->y1 = MIN(a->y1, b->y1);
+    out->x2 = MAX(a->x2, b->x2);
+    out->y2 = MAX(a->y2, b->y2);
+}
+
+
+/* 求两个矩形的交集，不相交时返回0 */
+static int lcd_ui_rect_clip(const lcd_ui_rect_t *a, const lcd_ui_rect_t *b, lcd_ui_rect_t *out)
+{
+    lcd_ui_rect_t r;
+
+    r.x1 = MAX(a->x1, b->x1);
+    r.y1 = MAX(a->y1, b->y1);
+    r.x2 = MIN(a->x2, b->x2);
+    r.y2 = MIN(a->y2, b->y2);
+    if (r.x1 > r.x2 || r.y1 > r.y2) {
+        return 0;
+    }
+    if (out != NULL) {
+        *out = r;
+    }
+    return 1;
+}
+
+
+static int lcd_ui_rect_contains(const lcd_ui_rect_t *a, const lcd_ui_rect_t *b)
+{
+    return b->x1 >= a->x1 && b->y1 >= a->y1 && b->x2 <= a->x2 && b->y2 <= a->y2;
+}
+
+
+static void lcd_ui_widget_rect(const lcd_ui_widget_t *widget, lcd_ui_rect_t *r)
+{
+    r->x1 = widget->x;
+    r->y1 = widget->y;
+    r->x2 = widget->x + widget->w - 1;
+    r->y2 = widget->y + widget->h - 1;
+}
+
+
+/* 控件和所有上级控件是否都显示 */
+static int lcd_ui_shown(const lcd_ui_widget_t *widget)
+{
+    for (; widget != NULL; widget = widget->parent) {
+        if (!widget->visible) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_ui_next
+ * 说    明: 按绘制顺序取下一个控件：先画父控件，再按添加顺序画子控件
+ * 参    数:
+ *       @widget：当前控件
+ *       @root：根控件
+ *       @descend：是否进入当前控件的子控件
+ * 返 回 值: 下一个控件，没有时返回NULL
+ ***************************************************************/
+static lcd_ui_widget_t *lcd_ui_next(lcd_ui_widget_t *widget, const lcd_ui_widget_t *root, int descend)
+{
+    if (descend && widget->child != NULL) {
+        return widget->child;
+    }
+    while (widget != root && widget->next == NULL) {
+        widget = widget->parent;
+    }
+    return (widget == root) ? NULL : widget->next;
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_ui_dirty_add
+ * 说    明: 添加失效矩形，裁剪到屏幕内。合并后多重画的像素很少时与
+ *           已有矩形合并；列表已满时合并浪费像素最少的两个矩形
+ * 参    数:
+ *       @x1/y1/x2/y2：矩形范围(含边界)
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_ui_dirty_add(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
+{
+    lcd_ui_rect_t r = {x1, y1, MIN(x2, LCD_W - 1), MIN(y2, LCD_H - 1)};
+    lcd_ui_rect_t u;
+    uint8_t i = 0, j;
+    uint8_t best_i = 0, best_j = 0;
+    int32_t cost, best_cost = -1;
+
+    if (r.x1 > r.x2 || r.y1 > r.y2) {
+        return;
+    }
+    while (i < m_ui_dirty_num) {
+        lcd_ui_rect_union(&m_ui_dirty[i], &r, &u);
+        if (lcd_ui_rect_area(&u) <= lcd_ui_rect_area(&m_ui_dirty[i]) + lcd_ui_rect_area(&r) + LCD_UI_MERGE_PIXELS) {
+            r = u;
+            m_ui_dirty[i] = m_ui_dirty[--m_ui_dirty_num];
+            i = 0;
+        } else {
+            i++;
+        }
+    }
+
+    if (m_ui_dirty_num == LCD_UI_DIRTY_MAX) {
+        /* 新矩形暂放在列表末尾之后，一起参与两两比较 */
+        for (i = 0; i < m_ui_dirty_num; i++) {
+            for (j = i + 1; j <= m_ui_dirty_num; j++) {
+                lcd_ui_rect_union(&m_ui_dirty[i], (j == m_ui_dirty_num) ? &r : &m_ui_dirty[j], &u);
+                cost = (int32_t)lcd_ui_rect_area(&u) - (int32_t)lcd_ui_rect_area(&m_ui_dirty[i]) -
+                    (int32_t)lcd_ui_rect_area((j == m_ui_dirty_num) ? &r : &m_ui_dirty[j]);
+                if (best_cost < 0 || cost < best_cost) {
+                    best_i = i;
+                    best_j = j;
+                    best_cost = (cost < 0) ? 0 : cost;
+                }
+            }
+        }
+        if (best_j == m_ui_dirty_num) {
+            lcd_ui_rect_union(&m_ui_dirty[best_i], &r, &m_ui_dirty[best_i]);
+            return;
+        }
+        lcd_ui_rect_union(&m_ui_dirty[best_i], &m_ui_dirty[best_j], &m_ui_dirty[best_i]);
+        m_ui_dirty[best_j] = r;
+        return;
+    }
+
+    m_ui_dirty[m_ui_dirty_num++] = r;
+}
+
+
+/* 控件显示时将它的一部分标记为失效 */
+static void lcd_ui_dirty_widget(const lcd_ui_widget_t *widget, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
+{
+    if (lcd_ui_shown(widget)) {
+        lcd_ui_dirty_add(x1, y1, x2, y2);
+    }
+}
+
+
+/* 初始化控件的公共部分并加到父控件的子控件末尾 */
+static void lcd_ui_widget_init(lcd_ui_widget_t *widget, lcd_ui_panel_t *parent, uint8_t type,
+                               uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+{
+    lcd_ui_widget_t **link;
+
+    memset(widget, 0, sizeof(lcd_ui_widget_t));
+    widget->x = x;
+    widget->y = y;
+    widget->w = w;
+    widget->h = h;
+    widget->type = type;
+    widget->visible = 1;
+    if (parent != NULL) {
+        widget->parent = &parent->base;
+        for (link = &parent->base.child; *link != NULL; link = &(*link)->next) {
+        }
+        *link = widget;
+    }
+    lcd_ui_dirty_widget(widget, x, y, x + w - 1, y + h - 1);
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_ui_need_rect
+ * 说    明: 计算重画控件与r相交的部分时实际会画出的范围。文字按整个
+ *           字符重画，压缩图片和曲线图只能整体重画，其他控件可以精确
+ *           裁剪到r
+ * 参    数:
+ *       @widget：控件
+ *       @r：失效矩形，与控件相交
+ *       @need：返回重画的范围
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_ui_need_rect(const lcd_ui_widget_t *widget, const lcd_ui_rect_t *r, lcd_ui_rect_t *need)
+{
+    const lcd_ui_label_t *label;
+    uint16_t cw, c0, c1;
+
+    lcd_ui_widget_rect(widget, need);
+    switch (widget->type) {
+        case LCD_UI_LABEL:
+        case LCD_UI_NUMBER:
+            label = (const lcd_ui_label_t *)widget;
+            cw = label->sizey / 2;
+            c0 = (MAX(r->x1, widget->x) - widget->x) / cw;
+            c1 = (MIN(r->x2, need->x2) - widget->x) / cw;
+            need->x1 = widget->x + c0 * cw;
+            need->x2 = widget->x + (c1 + 1) * cw - 1;
+            break;
+        case LCD_UI_IMAGE:
+        case LCD_UI_CHART:
+            break;
+        default:
+            lcd_ui_rect_clip(r, need, need);
+            break;
+    }
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_ui_expand
+ * 说    明: 扩大失效矩形，直到与它相交的控件重画时不会画到矩形外面，
+ *           保证矩形内按控件树顺序重画后，上层控件不会被下层覆盖
+ * 参    数:
+ *       @root：根控件
+ *       @r：失效矩形
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_ui_expand(lcd_ui_widget_t *root, lcd_ui_rect_t *r)
+{
+    lcd_ui_widget_t *widget;
+    lcd_ui_rect_t box, need;
+    int changed = 1;
+
+    while (changed) {
+        changed = 0;
+        for (widget = root; widget != NULL; widget = lcd_ui_next(widget, root, widget->visible)) {
+            lcd_ui_widget_rect(widget, &box);
+            if (!widget->visible || !lcd_ui_rect_clip(r, &box, NULL)) {
+                continue;
+            }
+            lcd_ui_need_rect(widget, r, &need);
+            if (!lcd_ui_rect_contains(r, &need)) {
+                lcd_ui_rect_union(r, &need, r);
+                changed = 1;
+            }
+        }
+    }
+    r->x2 = MIN(r->x2, LCD_W - 1);
+    r->y2 = MIN(r->y2, LCD_H - 1);
+}
+
+
+/* 重画文字控件中与clip相交的字符，超出文字长度的字符画为空格 */
+static void lcd_ui_draw_label(const lcd_ui_label_t *label, const lcd_ui_rect_t *clip)
+{
+    char buf[LCD_UI_TEXT_MAX + 1];
+    uint16_t cw = label->sizey / 2;
+    uint16_t c0 = (clip->x1 - label->base.x) / cw;
+    uint16_t c1 = (clip->x2 - label->base.x) / cw;
+    uint16_t i;
+
+    for (i = c0; i <= c1; i++) {
+        buf[i - c0] = (i < label->len) ? label->text[i] : ' ';
+    }
+    buf[c1 - c0 + 1] = '\0';
+    if (label->flags & LCD_UI_TEXT_AA) {
+        lcd_draw_text_aa(label->base.x + c0 * cw, label->base.y, (const uint8_t *)buf, label->fc, label->bc,
+                         label->sizey);
+    } else {
+        lcd_draw_text(label->base.x + c0 * cw, label->base.y, (const uint8_t *)buf, label->fc, label->bc,
+                      label->sizey, 0);
+    }
+}
+
+
+/* 重画进度条中与clip相交的部分 */
+static void lcd_ui_draw_bar(const lcd_ui_bar_t *bar, const lcd_ui_rect_t *clip)
+{
+    uint16_t split = bar->base.x + bar->fill;
+
+    if (clip->x1 < split) {
+        lcd_fill(clip->x1, clip->y1, MIN(clip->x2 + 1, split), clip->y2 + 1, bar->fc);
+    }
+    if (clip->x2 >= split) {
+        lcd_fill(MAX(clip->x1, split), clip->y1, clip->x2 + 1, clip->y2 + 1, bar->bc);
+    }
+}
+
+
+/* 重画图标中与clip相交的部分 */
+static void lcd_ui_draw_icon(const lcd_ui_icon_t *icon, const lcd_ui_rect_t *clip)
+{
+    const lcd_bitmap_t *bitmap = icon->bitmap;
+    uint16_t sx = 0, sy = 0;
+    uint16_t cols;
+
+    if (bitmap->cell_w != 0 && bitmap->cell_h != 0) {
+        cols = bitmap->width / bitmap->cell_w;
+        sx = (icon->index % cols) * bitmap->cell_w;
+        sy = (icon->index / cols) * bitmap->cell_h;
+    }
+    lcd_blit((int16_t)clip->x1, (int16_t)clip->y1, bitmap, sx + clip->x1 - icon->base.x,
+             sy + clip->y1 - icon->base.y, clip->x2 - clip->x1 + 1, clip->y2 - clip->y1 + 1,
+             icon->flags, icon->key);
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_ui_draw
+ * 说    明: 重画控件中与clip相交的部分
+ * 参    数:
+ *       @widget：控件
+ *       @clip：重画范围，已裁剪到控件内
+ * 返 回 值: 无
+ ***************************************************************/
+static void lcd_ui_draw(lcd_ui_widget_t *widget, const lcd_ui_rect_t *clip)
+{
+    switch (widget->type) {
+        case LCD_UI_PANEL:
+            lcd_fill(clip->x1, clip->y1, clip->x2 + 1, clip->y2 + 1, ((lcd_ui_panel_t *)widget)->bc);
+            break;
+        case LCD_UI_LABEL:
+        case LCD_UI_NUMBER:
+            lcd_ui_draw_label((const lcd_ui_label_t *)widget, clip);
+            break;
+        case LCD_UI_BAR:
+            lcd_ui_draw_bar((const lcd_ui_bar_t *)widget, clip);
+            break;
+        case LCD_UI_ICON:
+            lcd_ui_draw_icon((const lcd_ui_icon_t *)widget, clip);
+            break;
+        case LCD_UI_IMAGE:
+            lcd_show_image(widget->x, widget->y, ((lcd_ui_image_t *)widget)->image);
+            break;
+        case LCD_UI_CHART:
+            lcd_chart_restart(&((lcd_ui_chart_t *)widget)->chart);
+            break;
+        default:
+            break;
+    }
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_ui_panel_init
+ * 说    明: 初始化容器并加入父控件，父控件为NULL时作为根控件
+ * 参    数:
+ *       @panel：容器
+ *       @parent：父控件
+ *       @x/y/w/h：范围
+ *       @bc：背景色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_ui_panel_init(lcd_ui_panel_t *panel, lcd_ui_panel_t *parent, uint16_t x, uint16_t y,
+                       uint16_t w, uint16_t h, uint16_t bc)
+{
+    panel->bc = bc;
+    lcd_ui_widget_init(&panel->base, parent, LCD_UI_PANEL, x, y, w, h);
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_ui_label_init
+ * 说    明: 初始化文字控件并加入父控件
+ * 参    数:
+ *       @label：文字控件
+ *       @parent：父控件
+ *       @x/y：左上角坐标
+ *       @cols：字符数，不超过LCD_UI_TEXT_MAX
+ *       @sizey：字号，可选：12、16、24、32
+ *       @fc：字的颜色
+ *       @bc：背景色
+ *       @flags：LCD_UI_TEXT_AA或0
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+unsigned int lcd_ui_label_init(lcd_ui_label_t *label, lcd_ui_panel_t *parent, uint16_t x, uint16_t y,
+                               uint8_t cols, uint8_t sizey, uint16_t fc, uint16_t bc, uint8_t flags)
+{
+    if (cols == 0 || cols > LCD_UI_TEXT_MAX) {
+        printf("%s, %d: cols %d is invalid!\n", __FILE__, __LINE__, cols);
+        return __LINE__;
+    }
+    if (sizey != LCD_FONT_SIZE12 && sizey != LCD_FONT_SIZE16 && sizey != LCD_FONT_SIZE24 &&
+        sizey != LCD_FONT_SIZE32) {
+        printf("%s, %d: sizey %d is invalid!\n", __FILE__, __LINE__, sizey);
+        return __LINE__;
+    }
+    label->fc = fc;
+    label->bc = bc;
+    label->sizey = sizey;
+    label->flags = flags;
+    label->cols = cols;
+    label->len = 0;
+    label->text[0] = '\0';
+    lcd_ui_widget_init(&label->base, parent, LCD_UI_LABEL, x, y, cols * (sizey / 2), sizey);
+    return 0;
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_ui_label_set_text
+ * 说    明: 设置文字，只把与原来不同的字符标记为失效
+ * 参    数:
+ *       @label：文字控件
+ *       @text：ASCII文字，超出cols的部分被截断
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_ui_label_set_text(lcd_ui_label_t *label, const char *text)
+{
+    uint16_t cw = label->sizey / 2;
+    uint8_t len = (uint8_t)strnlen(text, label->cols);
+    uint8_t first = label->cols, last = 0;
+    uint8_t i;
+    char old, now;
+
+    for (i = 0; i < label->cols; i++) {
+        old = (i < label->len) ? label->text[i] : ' ';
+        now = (i < len) ? text[i] : ' ';
+        if (old != now) {
+            first = MIN(first, i);
+            last = i;
+        }
+    }
+    memcpy(label->text, text, len);
+    label->text[len] = '\0';
+    label->len = len;
+    if (first <= last) {
+        lcd_ui_dirty_widget(&label->base, label->base.x + first * cw, label->base.y,
+                            label->base.x + (last + 1) * cw - 1, label->base.y + label->base.h - 1);
+    }
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_ui_label_set_color
+ * 说    明: 设置文字颜色，颜色改变时整个控件失效
+ * 参    数:
+ *       @label：文字控件
+ *       @fc：字的颜色
+ *       @bc：背景色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_ui_label_set_color(lcd_ui_label_t *label, uint16_t fc, uint16_t bc)
+{
+    if (label->fc == fc && label->bc == bc) {
+        return;
+    }
+    label->fc = fc;
+    label->bc = bc;
+    lcd_ui_invalidate(&label->base);
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_ui_number_init
+ * 说    明: 初始化数字控件并加入父控件
+ * 参    数:
+ *       @number：数字控件
+ *       @parent：父控件
+ *       @x/y：左上角坐标
+ *       @len：数字位数(含小数位)，不超过LCD_NUM_MAX_LEN
+ *       @decimals：小数位数，0为整数
+ *       @sizey：字号，可选：12、16、24、32
+ *       @fc：数字的颜色
+ *       @bc：背景色
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+unsigned int lcd_ui_number_init(lcd_ui_number_t *number, lcd_ui_panel_t *parent, uint16_t x, uint16_t y,
+                                uint8_t len, uint8_t decimals, uint8_t sizey, uint16_t fc, uint16_t bc)
+{
+    uint8_t cols;
+    unsigned int ret;
+
+    if (len == 0 || len > LCD_NUM_MAX_LEN) {
+        printf("%s, %d: len %d is invalid!\n", __FILE__, __LINE__, len);
+        return __LINE__;
+    }
+    number->digits = len;
+    number->decimals = (decimals < len) ? decimals : 0;
+    cols = (number->decimals > 0) ? (len + 1) : len;
+    ret = lcd_ui_label_init(&number->label, parent, x, y, cols, sizey, fc, bc, 0);
+    if (ret == 0) {
+        number->label.base.type = LCD_UI_NUMBER;
+    }
+    return ret;
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_ui_number_set_int
+ * 说    明: 设置整数，只把变化的数字标记为失效。有小数位时value为
+ *           放大10^decimals倍后的数值
+ * 参    数:
+ *       @number：数字控件
+ *       @value：数值
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_ui_number_set_int(lcd_ui_number_t *number, int32_t value)
+{
+    /* 数字、小数点和结束符 */
+    uint8_t cells[LCD_NUM_MAX_LEN + 2];
+    uint8_t count;
+
+    count = lcd_num_format_int(cells, value, number->digits, number->decimals);
+    cells[count] = '\0';
+    lcd_ui_label_set_text(&number->label, (const char *)cells);
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_ui_number_set_float
+ * 说    明: 设置小数，按小数位数四舍五入
+ * 参    数:
+ *       @number：数字控件
+ *       @value：数值
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_ui_number_set_float(lcd_ui_number_t *number, float value)
+{
+    lcd_ui_number_set_int(number, lcd_num_scale(value, number->decimals));
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_ui_bar_init
+ * 说    明: 初始化进度条并加入父控件，初始值为min
+ * 参    数:
+ *       @bar：进度条
+ *       @parent：父控件
+ *       @x/y/w/h：范围
+ *       @min/max：数值范围
+ *       @fc：已完成部分的颜色
+ *       @bc：未完成部分的颜色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_ui_bar_init(lcd_ui_bar_t *bar, lcd_ui_panel_t *parent, uint16_t x, uint16_t y, uint16_t w,
+                     uint16_t h, float min, float max, uint16_t fc, uint16_t bc)
+{
+    bar->fc = fc;
+    bar->bc = bc;
+    bar->min = min;
+    bar->max = max;
+    bar->fill = 0;
+    lcd_ui_widget_init(&bar->base, parent, LCD_UI_BAR, x, y, w, h);
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_ui_bar_set_value
+ * 说    明: 设置数值，只把已完成部分变化的几列标记为失效
+ * 参    数:
+ *       @bar：进度条
+ *       @value：数值，超出范围时按边界显示
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_ui_bar_set_value(lcd_ui_bar_t *bar, float value)
+{
+    uint16_t fill;
+
+    if (bar->max <= bar->min || value <= bar->min) {
+        fill = 0;
+    } else if (value >= bar->max) {
+        fill = bar->base.w;
+    } else {
+        fill = (uint16_t)((value - bar->min) * bar->base.w / (bar->max - bar->min) + 0.5f);
+    }
+    if (fill == bar->fill) {
+        return;
+    }
+    lcd_ui_dirty_widget(&bar->base, bar->base.x + MIN(fill, bar->fill), bar->base.y,
+                        bar->base.x + MAX(fill, bar->fill) - 1, bar->base.y + bar->base.h - 1);
+    bar->fill = fill;
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_ui_icon_init
+ * 说    明: 初始化图标并加入父控件。位图为精灵表时显示第index个图标，
+ *           否则显示整幅位图
+ * 参    数:
+ *       @icon：图标
+ *       @parent：父控件
+ *       @x/y：左上角坐标
+ *       @bitmap：位图或精灵表
+ *       @index：精灵表中的图标编号
+ *       @flags：LCD_BLIT_COLOR_KEY或0，透明时透出父控件的背景
+ *       @key：透明色
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_ui_icon_init(lcd_ui_icon_t *icon, lcd_ui_panel_t *parent, uint16_t x, uint16_t y,
+                      const lcd_bitmap_t *bitmap, uint16_t index, uint8_t flags, uint16_t key)
+{
+    uint16_t w = bitmap->width, h = bitmap->height;
+
+    if (bitmap->cell_w != 0 && bitmap->cell_h != 0) {
+        w = bitmap->cell_w;
+        h = bitmap->cell_h;
+    }
+    icon->bitmap = bitmap;
+    icon->index = index;
+    icon->flags = flags;
+    icon->key = key;
+    lcd_ui_widget_init(&icon->base, parent, LCD_UI_ICON, x, y, w, h);
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_ui_icon_set_index
+ * 说    明: 切换精灵表中的图标，编号改变时整个图标失效
+ * 参    数:
+ *       @icon：图标
+ *       @index：图标编号
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_ui_icon_set_index(lcd_ui_icon_t *icon, uint16_t index)
+{
+    if (icon->index == index) {
+        return;
+    }
+    icon->index = index;
+    lcd_ui_invalidate(&icon->base);
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_ui_image_init
+ * 说    明: 初始化压缩图片并加入父控件，图片失效时整幅重画
+ * 参    数:
+ *       @image：图片控件
+ *       @parent：父控件
+ *       @x/y：左上角坐标
+ *       @res：图片资源
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_ui_image_init(lcd_ui_image_t *image, lcd_ui_panel_t *parent, uint16_t x, uint16_t y,
+                       const lcd_image_t *res)
+{
+    image->image = res;
+    lcd_ui_widget_init(&image->base, parent, LCD_UI_IMAGE, x, y, res->width, res->height);
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_ui_chart_init
+ * 说    明: 初始化曲线图并加入父控件。曲线图按扫描方式(不使用硬件
+ *           滚动)自行逐列绘制，lcd_ui_render调用lcd_chart_update画出
+ *           新样本；曲线图失效时清空重画。曲线图上不应放置其他控件
+ * 参    数:
+ *       @chart：曲线图控件
+ *       @parent：父控件
+ *       @x/y/w/h：绘图区域
+ *       @bc：背景色
+ *       @grid：网格线颜色
+ *       @grid_step：网格线间距，0为不画网格线
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+unsigned int lcd_ui_chart_init(lcd_ui_chart_t *chart, lcd_ui_panel_t *parent, uint16_t x, uint16_t y,
+                               uint16_t w, uint16_t h, uint16_t bc, uint16_t grid, uint8_t grid_step)
+{
+    unsigned int ret;
+
+    ret = lcd_chart_init(&chart->chart, x, y, w, h, bc, grid, grid_step, 0);
+    if (ret != 0) {
+        return ret;
+    }
+    lcd_ui_widget_init(&chart->base, parent, LCD_UI_CHART, x, y, w, h);
+    return 0;
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_ui_set_visible
+ * 说    明: 显示或隐藏控件，状态改变时控件所在的区域失效
+ * 参    数:
+ *       @widget：控件
+ *       @visible：1为显示，0为隐藏
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_ui_set_visible(lcd_ui_widget_t *widget, uint8_t visible)
+{
+    visible = visible ? 1 : 0;
+    if (widget->visible == visible) {
+        return;
+    }
+    widget->visible = visible;
+    if (lcd_ui_shown(widget->parent)) {
+        lcd_ui_dirty_add(widget->x, widget->y, widget->x + widget->w - 1, widget->y + widget->h - 1);
+    }
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_ui_invalidate
+ * 说    明: 标记控件所在的区域失效，下次lcd_ui_render时重画，用于
+ *           屏幕被控件树以外的内容覆盖之后
+ * 参    数:
+ *       @widget：控件
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_ui_invalidate(lcd_ui_widget_t *widget)
+{
+    lcd_ui_dirty_widget(widget, widget->x, widget->y, widget->x + widget->w - 1, widget->y + widget->h - 1);
+}
+
+
+/***************************************************************
+ * 函数名称: lcd_ui_render
+ * 说    明: 重画所有失效区域并刷新到LCD。相交的失效区域先合并，每个
+ *           区域内按控件树的顺序只重画与它相交的部分，没有失效区域时
+ *           只画曲线图的新样本
+ * 参    数:
+ *       @root：根控件
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_ui_render(lcd_ui_panel_t *root)
+{
+    lcd_ui_widget_t *top = &root->base;
+    lcd_ui_widget_t *widget;
+    lcd_ui_rect_t box, clip;
+    uint8_t i, j;
+
+    /* 扩大后的矩形可能相交，相交的合并后重新扩大，避免同一处画两次 */
+    for (i = 0; i < m_ui_dirty_num; i++) {
+        lcd_ui_expand(top, &m_ui_dirty[i]);
+    }
+    i = 0;
+    while (i < m_ui_dirty_num) {
+        for (j = i + 1; j < m_ui_dirty_num; j++) {
+            if (lcd_ui_rect_clip(&m_ui_dirty[i], &m_ui_dirty[j], NULL)) {
+                break;
+            }
+        }
+        if (j == m_ui_dirty_num) {
+            i++;
+            continue;
+        }
+        lcd_ui_rect_union(&m_ui_dirty[i], &m_ui_dirty[j], &m_ui_dirty[i]);
+        m_ui_dirty[j] = m_ui_dirty[--m_ui_dirty_num];
+        lcd_ui_expand(top, &m_ui_dirty[i]);
+        i = 0;
+    }
+
+    for (i = 0; i < m_ui_dirty_num; i++) {
+        for (widget = top; widget != NULL; widget = lcd_ui_next(widget, top, widget->visible)) {
+            lcd_ui_widget_rect(widget, &box);
+            if (widget->visible && lcd_ui_rect_clip(&m_ui_dirty[i], &box, &clip)) {
+                lcd_ui_draw(widget, &clip);
+            }
+        }
+    }
+    m_ui_dirty_num = 0;
+
+    if (top->visible) {
+        for (widget = top; widget != NULL; widget = lcd_ui_next(widget, top, widget->visible)) {
+            if (widget->visible && widget->type == LCD_UI_CHART) {
+                lcd_chart_update(&((lcd_ui_chart_t *)widget)->chart);
+            }
+        }
+    }
+    lcd_flush();
+}
@@ -0,0 +1,583 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <stddef.h>
+#include "picture.h"
+
+/* 由gImage_lingzhi量化为256色后生成：
+ * python3 tools/lcd_image_gen.py --c-array src/picture.c --size 210x62 \
+ *     --colors 256 --name gImage_lingzhi_rle > src/picture_rle.c
+ */
+
+/* 210x62, LCD_IMAGE_INDEX_RLE, 原始大小26040字节, 编码后8690字节 */
+static const uint16_t gImage_lingzhi_rle_palette[256] = {
+    0x0000, 0x03B5, 0x03F6, 0x03F8, 0x03F9, 0x0438, 0x043A, 0x043C,
+    0x0478, 0x047A, 0x049C, 0x0840, 0x0BF8, 0x0C36, 0x0C3A, 0x0C57,
+    0x0C7B, 0x1060, 0x1082, 0x13F6, 0x149A, 0x18A1, 0x18C3, 0x1BF8,
+    0x1C36, 0x1C57, 0x20E2, 0x2104, 0x24D8, 0x2944, 0x2C56, 0x2C57,
+    0x2C59, 0x3145, 0x3185, 0x33F4, 0x3478, 0x39A6, 0x39C7, 0x3C14,
+    0x3C76, 0x3CD8, 0x41E7, 0x4228, 0x44D6, 0x44D8, 0x4A49, 0x4C32,
+    0x4C36, 0x4C75, 0x4CB3, 0x4D19, 0x5289, 0x5433, 0x5473, 0x54B4,
+    0x54D6, 0x5AAA, 0x5AEB, 0x5C55, 0x5C73, 0x5CD8, 0x5D18, 0x5D59,
+    0x5D7C, 0x630B, 0x6453, 0x6495, 0x64B6, 0x64D4, 0x6516, 0x6B4C,
+    0x6B8E, 0x6CD3, 0x6CD6, 0x6CF6, 0x6CF8, 0x6D36, 0x6D38, 0x6D56,
+    0x6D78, 0x6DBA, 0x6DDC, 0x6DFD, 0x7474, 0x74D4, 0x7514, 0x7558,
+    0x7576, 0x7598, 0x763C, 0x7B8D, 0x7BCF, 0x7CF6, 0x7D36, 0x7DB9,
+    0x7DDA, 0x7DDC, 0x840F, 0x8539, 0x8558, 0x8576, 0x8578, 0x857A,
+    0x85D9, 0x863A, 0x863D, 0x867C, 0x867E, 0x8C30, 0x8CD4, 0x8D34,
+    0x8D76, 0x8DBA, 0x8DD9, 0x8DFB, 0x8E7A, 0x8E9E, 0x9471, 0x9558,
+    0x95FC, 0x965B, 0x965C, 0x969C, 0x96DC, 0x96DE, 0x96F8, 0x9CB2,
+    0x9D96, 0x9DB9, 0x9DE1, 0x9E1A, 0x9E20, 0x9E23, 0x9E60, 0x9E62,
+    0x9E64, 0x9E78, 0x9E87, 0x9E9D, 0x9F1E, 0x9F3E, 0xA4F3, 0xA534,
+    0xA5A8, 0xA5DB, 0xA5E4, 0xA620, 0xA624, 0xA627, 0xA63B, 0xA65C,
+    0xA680, 0xA69B, 0xA6BB, 0xA6DE, 0xA75E, 0xAD55, 0xADE2, 0xADF8,
+    0xAE21, 0xAE23, 0xAE25, 0xAE27, 0xAE62, 0xAE64, 0xAE7B, 0xAE80,
+    0xAE9D, 0xAEBB, 0xAEBD, 0xAEFE, 0xAF3E, 0xAFBE, 0xB595, 0xB621,
+    0xB629, 0xB65C, 0xB67B, 0xB680, 0xB687, 0xB6BB, 0xB6BD, 0xB6D8,
+    0xB6FC, 0xB6FE, 0xB70D, 0xBDD6, 0xBE18, 0xBE69, 0xBE79, 0xBE8C,
+    0xBEAA, 0xBEAD, 0xBECA, 0xBEEB, 0xBEEF, 0xBEFC, 0xBEFE, 0xBF3E,
+    0xBF5E, 0xBF77, 0xBF9E, 0xBFDF, 0xC67B, 0xC69B, 0xC6DD, 0xC70C,
+    0xC730, 0xCE17, 0xCE59, 0xCEBB, 0xCECB, 0xCECD, 0xCEF0, 0xCF1E,
+    0xCF5E, 0xCF7E, 0xCF97, 0xCFBE, 0xD679, 0xD699, 0xD6DB, 0xD6FD,
+    0xD70D, 0xD750, 0xD7DE, 0xDF10, 0xDF1B, 0xDF1D, 0xDF36, 0xDF50,
+    0xDF71, 0xDF73, 0xDF7E, 0xE796, 0xE7B3, 0xE7B5, 0xE7B7, 0xE7BD,
+    0xEF3C, 0xEF5E, 0xEF7E, 0xEFB5, 0xEFB8, 0xEFDE, 0xEFF5, 0xF77C,
+    0xF77E, 0xF79C, 0xF7BE, 0xF7D7, 0xF7D9, 0xF7DB, 0xF7DC, 0xF7DE,
+};
+
+static const uint8_t gImage_lingzhi_rle_data[8178] = {
+    0x00, 0xFA, 0x81, 0xFF, 0x84, 0xFE, 0x88, 0xFF, 0x84, 0xFE, 0x96, 0xFF, 0x83, 0xFE, 0x00, 0xFF,
+    0x81, 0xFA, 0x84, 0xFF, 0x02, 0xFE, 0xFD, 0xFE, 0x93, 0xFF, 0x00, 0xF8, 0xC3, 0xFF, 0x00, 0xFA,
+    0x85, 0xFF, 0x00, 0xFA, 0xB4, 0xFF, 0x04, 0xFA, 0xFF, 0xFE, 0xFC, 0xFB, 0x81, 0xFC, 0x82, 0xFD,
+    0x82, 0xFC, 0x00, 0xFD, 0x82, 0xFE, 0x82, 0xFD, 0x81, 0xFC, 0x81, 0xFD, 0x92, 0xFE, 0x81, 0xFD,
+    0x83, 0xFC, 0x00, 0xFD, 0x86, 0xFE, 0x00, 0xFD, 0x81, 0xFC, 0x81, 0xFF, 0x00, 0xFA, 0x92, 0xFF,
+    0x00, 0xFA, 0x85, 0xFF, 0x00, 0xFA, 0xC4, 0xFF, 0x00, 0xF8, 0xB1, 0xFF, 0x81, 0xFE, 0x03, 0xFB,
+    0xE9, 0xD0, 0xE1, 0x89, 0xE7, 0x81, 0xE3, 0x82, 0xE7, 0x86, 0xE3, 0x00, 0xE7, 0x82, 0xE0, 0x82,
+    0xE3, 0x88, 0xE7, 0x83, 0xE3, 0x00, 0xE0, 0x81, 0xE7, 0x86, 0xE1, 0x02, 0xD0, 0xE9, 0xFD, 0x93,
+    0xFF, 0x00, 0xFA, 0x84, 0xFF, 0x00, 0xFA, 0x99, 0xFF, 0x00, 0xFA, 0xA2, 0xFF, 0x81, 0xFA, 0x00,
+    0xFF, 0x81, 0xFA, 0xA6, 0xFF, 0x00, 0xFA, 0x8E, 0xFF, 0x04, 0xFE, 0xFC, 0xEC, 0xC1, 0xA3, 0x81,
+    0xA2, 0x00, 0x90, 0x82, 0xA2, 0x81, 0xA1, 0x81, 0xA2, 0x83, 0xA3, 0x83, 0xA2, 0x89, 0xA1, 0x8E,
+    0xA2, 0x01, 0xA1, 0x88, 0x81, 0x94, 0x82, 0xA2, 0x82, 0xA3, 0x02, 0xB0, 0xC1, 0xF4, 0x93, 0xFF,
+    0x00, 0xFA, 0xFF, 0xFF, 0x06, 0xFE, 0xFD, 0xEC, 0xBF, 0x90, 0x94, 0xA1, 0x81, 0x85, 0x81, 0xA0,
+    0x81, 0x93, 0x81, 0xA0, 0x82, 0x85, 0x85, 0xA0, 0x81, 0x93, 0x91, 0xA0, 0x82, 0x85, 0x00, 0x93,
+    0x81, 0x86, 0x01, 0x87, 0x93, 0x81, 0x86, 0x81, 0x93, 0x04, 0xA1, 0x92, 0x90, 0xC1, 0xF4, 0x96,
+    0xFF, 0x00, 0xFA, 0x81, 0xFF, 0x01, 0xFA, 0xF8, 0x96, 0xFF, 0x00, 0xF8, 0x9E, 0xFF, 0x00, 0xFA,
+    0xC1, 0xFF, 0x06, 0xFE, 0xED, 0xBF, 0x90, 0xA1, 0xA5, 0xA4, 0x81, 0xA7, 0x00, 0x98, 0x81, 0xA7,
+    0x00, 0x98, 0x85, 0xA7, 0x86, 0x98, 0x85, 0xA7, 0x87, 0x98, 0x82, 0xA7, 0x82, 0x87, 0x85, 0x98,
+    0x81, 0xA7, 0x06, 0x98, 0xB3, 0xA0, 0x94, 0xC2, 0xEE, 0xFE, 0x94, 0xFF, 0x05, 0xFA, 0xFF, 0xFA,
+    0x9D, 0x6D, 0xDE, 0x9A, 0xFF, 0x00, 0xFA, 0xA4, 0xFF, 0x81, 0xFA, 0xA6, 0xFF, 0x01, 0xF8, 0xFA,
+    0x81, 0xFF, 0x00, 0xFA, 0x8B, 0xFF, 0x07, 0xEE, 0xBF, 0x92, 0x85, 0xA0, 0x84, 0xA0, 0x93, 0x82,
+    0x98, 0x00, 0x93, 0x82, 0xA0, 0x00, 0x93, 0x83, 0xA0, 0x82, 0x93, 0x83, 0xA0, 0x82, 0x85, 0x01,
+    0x98, 0x86, 0x81, 0x98, 0x88, 0x86, 0x02, 0x98, 0x86, 0x98, 0x81, 0x86, 0x81, 0x93, 0x82, 0x98,
+    0x06, 0x93, 0x98, 0xA0, 0x85, 0xC2, 0xEE, 0xFE, 0x92, 0xFF, 0x00, 0xFA, 0x82, 0xFF, 0x04, 0xDC,
+    0x2E, 0x1B, 0x90, 0xE4, 0x95, 0xFF, 0x02, 0xF2, 0xDD, 0xF1, 0x81, 0xFF, 0x00, 0xFA, 0xA0, 0xFF,
+    0x01, 0xF8, 0xFA, 0xA5, 0xFF, 0x81, 0xFA, 0x04, 0xDD, 0x6F, 0x76, 0xBB, 0xFA, 0x8D, 0xFF, 0x06,
+    0xEE, 0xC1, 0x90, 0xA0, 0xA4, 0xA0, 0xA7, 0x81, 0x98, 0x00, 0xA7, 0x81, 0x98, 0x8D, 0xA7, 0x00,
+    0xA0, 0x82, 0xA1, 0x86, 0x98, 0x83, 0xA7, 0x84, 0x98, 0x03, 0xA7, 0xA0, 0xA1, 0xAF, 0x84, 0xA7,
+    0x04, 0xA0, 0x85, 0xC2, 0xF3, 0xFE, 0x96, 0xFF, 0x05, 0xAE, 0x1D, 0x16, 0x22, 0x9D, 0xFA, 0x93,
+    0xFF, 0x03, 0xFA, 0x2B, 0x25, 0x76, 0xA1, 0xFF, 0x05, 0xE4, 0x9D, 0x62, 0x5C, 0xBB, 0xFA, 0x9D,
+    0xFF, 0x81, 0xF7, 0x00, 0xF8, 0x81, 0xFF, 0x07, 0xF7, 0xE4, 0x8E, 0x3A, 0x12, 0x00, 0x34, 0xBC,
+    0x8C, 0xFF, 0x05, 0xFE, 0xF3, 0xC0, 0x85, 0xA0, 0xA7, 0x87, 0x98, 0x83, 0xA7, 0x83, 0xA0, 0x00,
+    0x84, 0x82, 0x98, 0x00, 0xA7, 0x81, 0x98, 0x81, 0xA7, 0x05, 0x84, 0x98, 0xA7, 0x86, 0x84, 0x98,
+    0x81, 0xA7, 0x86, 0x98, 0x06, 0xA7, 0xAF, 0xA1, 0xA2, 0xA1, 0xAF, 0xA0, 0x81, 0xAF, 0x05, 0xA0,
+    0xA1, 0x94, 0xBD, 0xEB, 0xFE, 0x8A, 0xFF, 0x00, 0xF2, 0x85, 0xFF, 0x00, 0xF8, 0x83, 0xFF, 0x02,
+    0xAE, 0x1B, 0x12, 0x81, 0x1B, 0x00, 0x6F, 0x91, 0xFF, 0x09, 0xFA, 0xFF, 0x7F, 0x12, 0x16, 0x34,
+    0x7F, 0xDF, 0xFF, 0xFA, 0x9C, 0xFF, 0x05, 0xE4, 0x62, 0x21, 0x16, 0x12, 0x1D, 0x81, 0xFF, 0x00,
+    0xFA, 0x83, 0xFF, 0x00, 0xFA, 0x93, 0xFF, 0x0A, 0xFA, 0xFF, 0xDC, 0x48, 0x76, 0xF1, 0xFA, 0xDD,
+    0x76, 0x2E, 0x12, 0x82, 0x16, 0x02, 0x2A, 0xDE, 0xFA, 0x8B, 0xFF, 0x05, 0xFE, 0xED, 0xC2, 0xA0,
+    0x98, 0xA7, 0x88, 0x98, 0x82, 0x93, 0x82, 0xA0, 0x81, 0xA4, 0x00, 0x93, 0x83, 0x98, 0x06, 0x93,
+    0xA0, 0x93, 0xA4, 0x93, 0x84, 0xA7, 0x81, 0xA4, 0x01, 0x93, 0x82, 0x85, 0xA0, 0x03, 0x93, 0xA0,
+    0x85, 0x92, 0x81, 0x90, 0x00, 0x85, 0x81, 0xA0, 0x06, 0x85, 0xA5, 0x94, 0xA2, 0xD5, 0xFB, 0xFE,
+    0x8C, 0xFF, 0x01, 0xF8, 0xFA, 0x81, 0xFF, 0x00, 0xF2, 0x81, 0xFF, 0x08, 0xF8, 0xFF, 0xF2, 0x6F,
+    0x1B, 0x16, 0x00, 0x21, 0x9D, 0x8F, 0xFF, 0x00, 0xFA, 0x82, 0xFF, 0x01, 0x3A, 0x1D, 0x82, 0x16,
+    0x03, 0x3A, 0xE5, 0xFF, 0xF8, 0x85, 0xFF, 0x00, 0xF8, 0x90, 0xFF, 0x00, 0xFA, 0x82, 0xFF, 0x06,
+    0x9D, 0x22, 0x00, 0x1B, 0x16, 0x3A, 0xE4, 0x86, 0xFF, 0x01, 0xF8, 0xFA, 0x92, 0xFF, 0x0A, 0xBC,
+    0x34, 0x16, 0x2E, 0x8F, 0x76, 0x2B, 0x16, 0x12, 0x25, 0x1D, 0x81, 0x16, 0x00, 0x76, 0x8D, 0xFF,
+    0x05, 0xFE, 0xED, 0xC2, 0xA0, 0x98, 0xA7, 0x86, 0x98, 0x00, 0xA7, 0x82, 0x98, 0x81, 0xA7, 0x03,
+    0xA0, 0x82, 0x9E, 0x82, 0x84, 0xA0, 0x81, 0xA1, 0x00, 0x85, 0x82, 0x9E, 0x00, 0xA0, 0x83, 0x85,
+    0x87, 0xA1, 0x01, 0xA4, 0xA5, 0x81, 0x94, 0x83, 0x88, 0x06, 0x92, 0x82, 0x92, 0xC2, 0xF3, 0xFD,
+    0xFE, 0x8D, 0xFF, 0x00, 0xF8, 0x85, 0xFF, 0x06, 0xBB, 0x5B, 0x12, 0x16, 0x22, 0x5B, 0xDE, 0x8F,
+    0xFF, 0x00, 0xFA, 0x81, 0xFF, 0x07, 0xF2, 0x39, 0x12, 0x0B, 0x12, 0x1B, 0x41, 0xDD, 0x81, 0xFF,
+    0x00, 0xFA, 0x81, 0xFF, 0x00, 0xFA, 0x81, 0xFF, 0x00, 0xF8, 0x94, 0xFF, 0x01, 0xDD, 0x48, 0x81,
+    0x1A, 0x0A, 0x39, 0xD1, 0xFA, 0xFF, 0xF7, 0xBC, 0xAE, 0x9D, 0xAE, 0xF2, 0xFA, 0x82, 0xFF, 0x00,
+    0xFA, 0x8E, 0xFF, 0x0A, 0xDD, 0x3A, 0x11, 0x16, 0x22, 0x2A, 0x16, 0x0B, 0x25, 0x47, 0x48, 0x81,
+    0x1B, 0x01, 0x2E, 0xDD, 0x8D, 0xFF, 0x05, 0xFE, 0xED, 0xC2, 0xA0, 0x98, 0xA7, 0x81, 0x98, 0x81,
+    0xA7, 0x82, 0x98, 0x07, 0xA7, 0x98, 0xB3, 0xA7, 0x98, 0xA0, 0x94, 0xA2, 0x81, 0xA3, 0x81, 0xC0,
+    0x02, 0xC2, 0xC3, 0xD4, 0x81, 0xCF, 0x01, 0xD5, 0xC0, 0x81, 0xE0, 0x03, 0xD4, 0xC1, 0xCF, 0xD0,
+    0x83, 0xC4, 0x82, 0xBA, 0x02, 0xD5, 0xBA, 0xC3, 0x81, 0xBA, 0x00, 0xC4, 0x81, 0xC3, 0x01, 0xBA,
+    0xC4, 0x81, 0xD0, 0x03, 0xBA, 0xD0, 0xFC, 0xFE, 0x89, 0xFF, 0x00, 0xFA, 0x81, 0xFF, 0x02, 0xFA,
+    0xFF, 0xF8, 0x81, 0xFF, 0x00, 0xF8, 0x81, 0xFF, 0x06, 0x9D, 0x22, 0x16, 0x0B, 0x2B, 0x7F, 0xDD,
+    0x92, 0xFF, 0x81, 0xFA, 0x01, 0x9D, 0x21, 0x81, 0x16, 0x02, 0x2E, 0x9D, 0xFA, 0x88, 0xFF, 0x00,
+    0xFA, 0x93, 0xFF, 0x0D, 0xF7, 0x8F, 0x2B, 0x11, 0x48, 0xF7, 0xE4, 0xAE, 0x6D, 0x3A, 0x2A, 0x1D,
+    0x2E, 0x9D, 0x81, 0xFF, 0x00, 0xF8, 0x8B, 0xFF, 0x05, 0xF5, 0xFA, 0xFF, 0xF7, 0xE5, 0x3A, 0x81,
+    0x12, 0x82, 0x16, 0x07, 0x12, 0x2A, 0x8E, 0xD1, 0x48, 0x12, 0x34, 0x9D, 0x8E, 0xFF, 0x05, 0xFE,
+    0xF3, 0xC0, 0x85, 0xA0, 0xA7, 0x84, 0xA0, 0x82, 0xA7, 0x07, 0x98, 0xB3, 0x98, 0x84, 0x94, 0xBD,
+    0xCF, 0xE8, 0x82, 0xEC, 0x00, 0xF3, 0x81, 0xF6, 0x81, 0xFB, 0x00, 0xFC, 0x82, 0xFD, 0x05, 0xFE,
+    0xEF, 0xD8, 0xA9, 0x74, 0x9A, 0x81, 0x7C, 0x82, 0x9A, 0x81, 0xB7, 0x83, 0x7E, 0x81, 0xC9, 0x82,
+    0x7E, 0x81, 0x89, 0x00, 0xC9, 0x81, 0xFF, 0x81, 0xF8, 0x89, 0xFF, 0x81, 0xFA, 0x82, 0xFF, 0x00,
+    0xFA, 0x82, 0xFF, 0x05, 0x7F, 0x1D, 0x16, 0x1D, 0x76, 0xE5, 0x8F, 0xFF, 0x00, 0xFA, 0x82, 0xFF,
+    0x06, 0xFA, 0xFF, 0xFA, 0x6D, 0x1D, 0x25, 0x9D, 0x84, 0xFF, 0x04, 0xD1, 0xBB, 0xF8, 0xFA, 0xF7,
+    0x96, 0xFF, 0x08, 0xD2, 0x3A, 0x11, 0x2B, 0x5B, 0x2B, 0x1B, 0x11, 0x16, 0x81, 0x12, 0x04, 0x1B,
+    0x34, 0xF8, 0xFF, 0xF8, 0x8F, 0xFF, 0x0A, 0x8F, 0x16, 0x12, 0x15, 0x16, 0x12, 0x11, 0x2A, 0x9F,
+    0xF0, 0x7F, 0x81, 0x1B, 0x01, 0x90, 0xF8, 0x8E, 0xFF, 0x05, 0xFE, 0xED, 0xC0, 0x85, 0xA0, 0xA7,
+    0x81, 0xA0, 0x00, 0xA1, 0x81, 0xA0, 0x81, 0xA7, 0x81, 0x98, 0x05, 0x84, 0xA0, 0xB4, 0xE0, 0xEC,
+    0xFB, 0x81, 0xFD, 0x85, 0xFE, 0x84, 0xFF, 0x02, 0xF5, 0xC8, 0x57, 0x81, 0x24, 0x00, 0x1F, 0x82,
+    0x20, 0x00, 0x1F, 0x86, 0x1E, 0x81, 0x18, 0x09, 0x1E, 0x1F, 0x23, 0x27, 0x56, 0xC5, 0xFF, 0xF8,
+    0xF1, 0xFA, 0x86, 0xFF, 0x05, 0xF8, 0xBB, 0x48, 0x47, 0x7F, 0xDD, 0x83, 0xFF, 0x06, 0xFA, 0xFF,
+    0xF1, 0xBB, 0x76, 0x34, 0xAE, 0x81, 0xFF, 0x00, 0xFA, 0x93, 0xFF, 0x10, 0xDE, 0x48, 0x3A, 0x9F,
+    0xF8, 0x9F, 0xBC, 0xFA, 0xFF, 0xDD, 0x41, 0x34, 0x7F, 0x76, 0x48, 0xAE, 0xF8, 0x93, 0xFF, 0x07,
+    0xFA, 0xAE, 0x2E, 0x15, 0x12, 0x15, 0x12, 0x2A, 0x81, 0x39, 0x04, 0x1D, 0x1B, 0x12, 0x22, 0xDE,
+    0x8F, 0xFF, 0x03, 0xFA, 0xFF, 0x39, 0x12, 0x81, 0x16, 0x09, 0x11, 0x1B, 0x2B, 0x8F, 0xFF, 0xD1,
+    0x2A, 0x16, 0x76, 0xE4, 0x82, 0xFF, 0x00, 0xF8, 0x8B, 0xFF, 0x06, 0xFE, 0xF3, 0xC0, 0x85, 0xA0,
+    0xA7, 0x93, 0x82, 0xA0, 0x00, 0xA7, 0x83, 0x98, 0x05, 0x82, 0xB4, 0xE8, 0xF6, 0xFD, 0xFE, 0x89,
+    0xFF, 0x07, 0xF5, 0xFF, 0xEF, 0xC8, 0x59, 0x23, 0x01, 0x0D, 0x81, 0x05, 0x00, 0x08, 0x83, 0x05,
+    0x82, 0x0F, 0x01, 0x05, 0x06, 0x82, 0x05, 0x07, 0x0C, 0x13, 0x33, 0x74, 0xE2, 0xFF, 0xFA, 0xF8,
+    0x87, 0xFF, 0x0A, 0xF2, 0x3A, 0x16, 0x0B, 0x12, 0x34, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0x82, 0xFF,
+    0x02, 0xBC, 0x3A, 0xDC, 0x81, 0xFF, 0x00, 0xFA, 0x92, 0xFF, 0x11, 0xDD, 0x62, 0x3A, 0xBC, 0xFA,
+    0x76, 0x34, 0xAE, 0xFF, 0xF8, 0xBB, 0x22, 0x12, 0x25, 0x21, 0x00, 0x1B, 0xAE, 0x8D, 0xFF, 0x02,
+    0xF8, 0xDE, 0xF7, 0x81, 0xFF, 0x02, 0xBC, 0x62, 0x2A, 0x81, 0x12, 0x0A, 0x15, 0x3A, 0x8E, 0xE4,
+    0xF7, 0x7F, 0x22, 0x15, 0x1B, 0x5C, 0xF1, 0x8C, 0xFF, 0x02, 0xF7, 0xFF, 0xF9, 0x81, 0xF7, 0x00,
+    0x3A, 0x81, 0x15, 0x09, 0x16, 0x11, 0x39, 0xD1, 0xFF, 0xE6, 0x2A, 0x15, 0x34, 0xD1, 0x90, 0xFF,
+    0x05, 0xFE, 0xF3, 0xC0, 0x85, 0x98, 0xA7, 0x81, 0x98, 0x82, 0xA7, 0x82, 0x98, 0x05, 0xA7, 0xA5,
+    0xC3, 0xEC, 0xFC, 0xFE, 0x8A, 0xFF, 0x81, 0xEF, 0x05, 0xCB, 0x50, 0x18, 0x0D, 0x19, 0x08, 0x85,
+    0x09, 0x82, 0x08, 0x00, 0x06, 0x81, 0x07, 0x81, 0x09, 0x05, 0x06, 0x05, 0x29, 0x7D, 0xE2, 0xF5,
+    0x82, 0xFF, 0x00, 0xFE, 0x86, 0xFF, 0x02, 0xF2, 0x8F, 0x26, 0x81, 0x16, 0x01, 0x22, 0xE4, 0x81,
+    0xFF, 0x00, 0xFA, 0x81, 0xFF, 0x04, 0xFA, 0xFF, 0xBC, 0x3A, 0xE4, 0x81, 0xFF, 0x00, 0xFA, 0x81,
+    0xFF, 0x00, 0xFA, 0x8E, 0xFF, 0x12, 0xF1, 0x90, 0x2A, 0xDD, 0xDF, 0x76, 0x2E, 0x9D, 0xFF, 0xF8,
+    0xF7, 0x9D, 0x1B, 0x12, 0x1B, 0x39, 0x2E, 0x16, 0x9D, 0x8C, 0xFF, 0x07, 0xF8, 0xBC, 0x90, 0xE4,
+    0xF0, 0x8E, 0x2A, 0x15, 0x82, 0x16, 0x09, 0x2E, 0xDC, 0xFF, 0xF9, 0xD1, 0x39, 0x12, 0x1B, 0x41,
+    0xF8, 0x81, 0xFF, 0x00, 0xFA, 0x8E, 0xFF, 0x02, 0xF7, 0xBC, 0x25, 0x81, 0x1D, 0x0A, 0x48, 0xDC,
+    0xF0, 0xFF, 0xBB, 0x12, 0x16, 0x25, 0x5B, 0xBC, 0xF8, 0x82, 0xFF, 0x00, 0xFA, 0x8A, 0xFF, 0x05,
+    0xFE, 0xF3, 0xC0, 0x9E, 0x93, 0xA7, 0x82, 0x98, 0x84, 0xA0, 0x06, 0x93, 0x85, 0xCF, 0xFB, 0xFE,
+    0xFF, 0xFA, 0x88, 0xFF, 0x06, 0xFA, 0xEF, 0xAD, 0x52, 0x1E, 0x01, 0x0D, 0x81, 0x06, 0x00, 0x09,
+    0x84, 0x06, 0x81, 0x09, 0x02, 0x0E, 0x04, 0x07, 0x81, 0x0A, 0x04, 0x05, 0x0F, 0x24, 0x8D, 0xDB,
+    0x8D, 0xFF, 0x05, 0xF2, 0x9D, 0x3A, 0x2E, 0x6D, 0xE5, 0x85, 0xFF, 0x04, 0xFA, 0xD1, 0x5B, 0xF7,
+    0xFA, 0x8F, 0xFF, 0x00, 0xF2, 0x81, 0xFF, 0x08, 0xF2, 0xAE, 0x2E, 0x9D, 0xAE, 0x5C, 0x25, 0x7F,
+    0xF7, 0x81, 0xFF, 0x08, 0xDD, 0x62, 0x16, 0x15, 0x41, 0xD1, 0x2A, 0x1D, 0xF0, 0x85, 0xFF, 0x00,
+    0xFA, 0x85, 0xFF, 0x14, 0xE5, 0x5C, 0x25, 0x6F, 0x5C, 0x2A, 0x2E, 0x39, 0x48, 0x22, 0x16, 0x2A,
+    0xBB, 0xFF, 0xDC, 0x3A, 0x22, 0x1D, 0x5B, 0xE5, 0xFA, 0x8E, 0xFF, 0x01, 0xF5, 0xF8, 0x82, 0xFF,
+    0x03, 0xBC, 0x76, 0x8E, 0xE5, 0x82, 0xFF, 0x08, 0xAE, 0x25, 0x0B, 0x16, 0x1B, 0x2A, 0x8F, 0xFF,
+    0xFA, 0x88, 0xFF, 0x00, 0xFA, 0x82, 0xFF, 0x05, 0xFE, 0xF3, 0xBF, 0x94, 0xA7, 0xB3, 0x81, 0xA7,
+    0x01, 0x98, 0xA7, 0x82, 0xA0, 0x04, 0xA7, 0xA4, 0x85, 0xCF, 0xF4, 0x8C, 0xFF, 0x06, 0xCA, 0x52,
+    0x1F, 0x19, 0x14, 0x07, 0x06, 0x81, 0x09, 0x84, 0x06, 0x81, 0x09, 0x08, 0x0E, 0x04, 0x07, 0x09,
+    0x05, 0x02, 0x1C, 0x6B, 0xDB, 0x8F, 0xFF, 0x03, 0xF8, 0xDD, 0xD2, 0xE4, 0x82, 0xFF, 0x00, 0xFA,
+    0x83, 0xFF, 0x01, 0xDD, 0x8E, 0x90, 0xFF, 0x00, 0xF2, 0x82, 0xFF, 0x07, 0xDD, 0x34, 0x2E, 0x5B,
+    0x2E, 0x12, 0x62, 0xF1, 0x81, 0xFF, 0x09, 0xD1, 0xF0, 0x34, 0x11, 0x25, 0x8E, 0x76, 0x25, 0x48,
+    0xFA, 0x82, 0xFF, 0x00, 0xFA, 0x85, 0xFF, 0x00, 0xFA, 0x81, 0xFF, 0x13, 0xD2, 0x39, 0x1B, 0x3A,
+    0x7F, 0xBB, 0xBC, 0xDD, 0x48, 0x1A, 0x15, 0x11, 0x6D, 0xF7, 0x5B, 0x2B, 0x6D, 0xBB, 0xD2, 0xF8,
+    0x94, 0xFF, 0x01, 0xF5, 0xF8, 0x84, 0xFF, 0x09, 0xE4, 0x8E, 0x48, 0x15, 0x11, 0x1A, 0x2E, 0xF7,
+    0xFF, 0xFA, 0x85, 0xFF, 0x00, 0xF8, 0x84, 0xFF, 0x05, 0xFE, 0xF3, 0xC1, 0x90, 0xA0, 0xA7, 0x82,
+    0x98, 0x85, 0xA0, 0x02, 0x94, 0xCF, 0xFB, 0x84, 0xFF, 0x00, 0xFE, 0x81, 0xFF, 0x00, 0xF5, 0x82,
+    0xFF, 0x05, 0xDB, 0x52, 0x1F, 0x01, 0x05, 0x14, 0x81, 0x07, 0x01, 0x0A, 0x09, 0x84, 0x06, 0x81,
+    0x09, 0x08, 0x06, 0x09, 0x07, 0x03, 0x02, 0x24, 0x6C, 0xDB, 0xF5, 0x98, 0xFF, 0x04, 0xF7, 0xFF,
+    0xDE, 0xAE, 0x8F, 0x81, 0xFF, 0x00, 0xFA, 0x90, 0xFF, 0x01, 0xF2, 0xBC, 0x81, 0x25, 0x00, 0x48,
+    0x81, 0x3A, 0x00, 0xBC, 0x81, 0xFF, 0x09, 0xDC, 0xDD, 0x9F, 0x1B, 0x12, 0x2B, 0x9D, 0x2A, 0x16,
+    0x76, 0x81, 0xFA, 0x8B, 0xFF, 0x10, 0x8F, 0x1D, 0x0B, 0x39, 0xD2, 0xFF, 0xF0, 0x9D, 0x25, 0x12,
+    0x16, 0x1B, 0x7F, 0xFA, 0xD1, 0xBC, 0xDE, 0x91, 0xFF, 0x00, 0xFA, 0x87, 0xFF, 0x00, 0xFA, 0x83,
+    0xFF, 0x06, 0xFA, 0xD1, 0x3A, 0x11, 0x16, 0x15, 0x9F, 0x82, 0xFF, 0x02, 0xFA, 0xF2, 0xFA, 0x87,
+    0xFF, 0x04, 0xFE, 0xEB, 0xBF, 0x90, 0xA0, 0x82, 0x98, 0x81, 0xA7, 0x00, 0xA0, 0x81, 0xA7, 0x04,
+    0x98, 0xA7, 0x94, 0xE0, 0xFB, 0x84, 0xFF, 0x00, 0xFE, 0x81, 0xFF, 0x0B, 0xFA, 0xF5, 0xEF, 0xD8,
+    0x61, 0x1E, 0x19, 0x05, 0x06, 0x07, 0x09, 0x0A, 0x81, 0x09, 0x81, 0x06, 0x00, 0x05, 0x83, 0x06,
+    0x07, 0x05, 0x0A, 0x08, 0x13, 0x24, 0x6A, 0xDB, 0xF5, 0x97, 0xFF, 0x00, 0xF8, 0x81, 0xFF, 0x03,
+    0xBC, 0x48, 0x2A, 0x5C, 0x87, 0xFF, 0x00, 0xF5, 0x88, 0xFF, 0x00, 0xFA, 0x81, 0xFF, 0x14, 0xFA,
+    0xDE, 0xDD, 0xBC, 0x2E, 0x7F, 0x48, 0x9D, 0xDC, 0x9F, 0xFF, 0xBB, 0x1A, 0x1D, 0x2B, 0x62, 0x25,
+    0x12, 0x25, 0x48, 0xDE, 0x8B, 0xFF, 0x00, 0x5C, 0x81, 0x16, 0x09, 0x34, 0xDE, 0xFF, 0xF1, 0x2A,
+    0x11, 0x15, 0x11, 0x39, 0xF0, 0x81, 0xFF, 0x00, 0xF8, 0x9B, 0xFF, 0x00, 0xFA, 0x81, 0xFF, 0x00,
+    0xF8, 0x81, 0xFF, 0x0A, 0xF7, 0x76, 0x11, 0x16, 0x15, 0x5C, 0xE4, 0xFA, 0xDD, 0xDE, 0xF7, 0x84,
+    0xFF, 0x00, 0xF2, 0x81, 0xFF, 0x06, 0xFE, 0xFC, 0xE9, 0xBF, 0x90, 0x85, 0xB3, 0x82, 0xA7, 0x81,
+    0xA4, 0x01, 0xA7, 0x98, 0x81, 0xA7, 0x02, 0x92, 0xD5, 0xFC, 0x84, 0xFF, 0x81, 0xFE, 0x81, 0xFF,
+    0x06, 0xEF, 0xCB, 0x53, 0x17, 0x02, 0x10, 0x14, 0x81, 0x06, 0x81, 0x0A, 0x01, 0x07, 0x09, 0x81,
+    0x06, 0x00, 0x05, 0x83, 0x06, 0x05, 0x08, 0x05, 0x0D, 0x29, 0x78, 0xEA, 0x9B, 0xFF, 0x08, 0xF0,
+    0x34, 0x16, 0x11, 0x39, 0xAE, 0x7F, 0x9F, 0xF7, 0x90, 0xFF, 0x0F, 0xF1, 0xFF, 0xE5, 0x2A, 0x6F,
+    0xD1, 0x21, 0x2E, 0x5B, 0xD1, 0xF8, 0xDC, 0x21, 0x11, 0x12, 0x1B, 0x81, 0x21, 0x03, 0x1B, 0x2B,
+    0xD1, 0xF2, 0x88, 0xFF, 0x0A, 0xFA, 0xF1, 0x48, 0x12, 0x1B, 0x26, 0xD3, 0xFA, 0xF0, 0x21, 0x15,
+    0x81, 0x1A, 0x04, 0x62, 0xDC, 0xFA, 0xFF, 0xFA, 0x81, 0xFF, 0x00, 0xFA, 0x9C, 0xFF, 0x04, 0xFA,
+    0xF0, 0xE4, 0x5B, 0x1B, 0x82, 0x15, 0x07, 0x2B, 0x2E, 0x1D, 0x22, 0x47, 0xDE, 0xFF, 0xF8, 0x84,
+    0xFF, 0x07, 0xFE, 0xFD, 0xEB, 0xC1, 0x95, 0x90, 0x94, 0x85, 0x81, 0x94, 0x81, 0xA2, 0x06, 0x94,
+    0x85, 0xA0, 0x85, 0x90, 0xE3, 0xFC, 0x85, 0xFF, 0x06, 0xFE, 0xFF, 0xF5, 0xCB, 0x51, 0x20, 0x0C,
+    0x82, 0x06, 0x00, 0x09, 0x82, 0x0A, 0x01, 0x07, 0x09, 0x86, 0x06, 0x04, 0x08, 0x0D, 0x1E, 0x6A,
+    0xE2, 0x81, 0xFF, 0x00, 0xFA, 0x99, 0xFF, 0x08, 0xDD, 0x1B, 0x12, 0x1B, 0x25, 0x2A, 0x12, 0x5C,
+    0xDD, 0x91, 0xFF, 0x0A, 0xF1, 0x6D, 0x41, 0xF7, 0xF0, 0x34, 0x12, 0x7F, 0xF7, 0xFF, 0xDD, 0x81,
+    0x2E, 0x03, 0x8F, 0xDC, 0xF0, 0xE4, 0x81, 0xDC, 0x00, 0xE4, 0x8A, 0xFF, 0x0A, 0xF2, 0x62, 0x16,
+    0x0B, 0x3A, 0xE4, 0xFF, 0xDE, 0x5C, 0x21, 0x11, 0x81, 0x21, 0x03, 0x26, 0xDC, 0xFF, 0xF8, 0x92,
+    0xFF, 0x81, 0xFA, 0x83, 0xFF, 0x00, 0xF7, 0x81, 0xF0, 0x11, 0xF8, 0xDD, 0x9F, 0xAE, 0x6D, 0x2B,
+    0x25, 0x16, 0x1D, 0x15, 0x1A, 0x12, 0x16, 0x12, 0x16, 0x0B, 0x22, 0xAE, 0x82, 0xFF, 0x00, 0xFA,
+    0x84, 0xFF, 0x02, 0xF9, 0xE6, 0xC4, 0x81, 0xC1, 0x00, 0xBF, 0x85, 0xC1, 0x04, 0xC2, 0xD4, 0xD6,
+    0xE6, 0xFD, 0x86, 0xFF, 0x04, 0xF5, 0xCB, 0x69, 0x1E, 0x04, 0x81, 0x10, 0x81, 0x06, 0x00, 0x09,
+    0x81, 0x0A, 0x82, 0x09, 0x85, 0x06, 0x81, 0x08, 0x02, 0x1C, 0x5A, 0xCB, 0x81, 0xFF, 0x00, 0xF8,
+    0x98, 0xFF, 0x03, 0xF2, 0xFF, 0xAE, 0x25, 0x81, 0x12, 0x03, 0x16, 0x1B, 0x2A, 0xAE, 0x83, 0xFF,
+    0x00, 0xFA, 0x8B, 0xFF, 0x04, 0xF8, 0xFF, 0x9D, 0x2E, 0xDD, 0x81, 0xFF, 0x08, 0xAE, 0x5B, 0xF1,
+    0xF7, 0xDD, 0x48, 0x6D, 0x80, 0xF8, 0x81, 0xFF, 0x00, 0xFA, 0x8E, 0xFF, 0x0D, 0xBC, 0x41, 0x2E,
+    0x8E, 0xF2, 0xFF, 0xFA, 0xDE, 0x5B, 0x1A, 0x11, 0x39, 0x76, 0xDC, 0x81, 0x7F, 0x02, 0xD2, 0xFF,
+    0xF8, 0x92, 0xFF, 0x18, 0xFA, 0xDE, 0xBB, 0x7F, 0x6D, 0x3A, 0x39, 0x2A, 0x1B, 0x21, 0x16, 0x11,
+    0x15, 0x11, 0x1A, 0x12, 0x11, 0x1D, 0x2E, 0x34, 0x39, 0x2B, 0x26, 0x8F, 0xF8, 0x88, 0xFF, 0x04,
+    0xFD, 0xFC, 0xFB, 0xFC, 0xFB, 0x84, 0xFC, 0x82, 0xFB, 0x02, 0xF4, 0xFC, 0xFE, 0x84, 0xFF, 0x81,
+    0xF5, 0x06, 0xDB, 0x6A, 0x24, 0x02, 0x04, 0x0A, 0x07, 0x87, 0x09, 0x85, 0x06, 0x05, 0x0F, 0x18,
+    0x5A, 0xCB, 0xEF, 0xFF, 0x82, 0xFE, 0x96, 0xFF, 0x04, 0xFA, 0xFF, 0xDD, 0x2B, 0x12, 0x81, 0x16,
+    0x05, 0x1B, 0x21, 0x76, 0xF7, 0xFF, 0xF7, 0x81, 0xFF, 0x00, 0xF5, 0x8C, 0xFF, 0x03, 0xD2, 0x3A,
+    0x90, 0xF2, 0x81, 0xFF, 0x03, 0xF8, 0xFA, 0xDE, 0xDD, 0x81, 0x41, 0x00, 0xDD, 0x81, 0xFF, 0x00,
+    0xF7, 0x85, 0xFF, 0x00, 0xFA, 0x8A, 0xFF, 0x02, 0xDE, 0xDD, 0xF2, 0x83, 0xFF, 0x09, 0xDD, 0x5B,
+    0x21, 0x2B, 0x8E, 0x21, 0x12, 0x1D, 0x2B, 0x9D, 0x92, 0xFF, 0x06, 0xFA, 0xD1, 0x5B, 0x21, 0x12,
+    0x16, 0x12, 0x81, 0x16, 0x82, 0x12, 0x02, 0x1B, 0x22, 0x2A, 0x81, 0x16, 0x09, 0x12, 0x3A, 0xD1,
+    0xFF, 0xDE, 0xDC, 0x80, 0xF2, 0xFF, 0xFA, 0x89, 0xFF, 0x82, 0xFE, 0x84, 0xFF, 0x86, 0xFE, 0x82,
+    0xFF, 0x07, 0xF5, 0xEF, 0xCB, 0x6B, 0x28, 0x02, 0x09, 0x10, 0x87, 0x06, 0x81, 0x09, 0x83, 0x06,
+    0x81, 0x05, 0x03, 0x19, 0x5A, 0xC8, 0xEF, 0x81, 0xFF, 0x81, 0xFE, 0x00, 0xF9, 0x8A, 0xFF, 0x00,
+    0xFA, 0x81, 0xFF, 0x00, 0xF8, 0x82, 0xFF, 0x08, 0xFA, 0xDE, 0xF2, 0xFF, 0xFA, 0xFF, 0xBB, 0x3A,
+    0x1B, 0x82, 0x12, 0x03, 0x21, 0x5B, 0xF0, 0xF8, 0x83, 0xFF, 0x00, 0xFA, 0x8C, 0xFF, 0x03, 0x76,
+    0x41, 0xDE, 0xFA, 0x83, 0xFF, 0x0A, 0xDC, 0x3A, 0x2B, 0xDD, 0xF1, 0xBB, 0x76, 0x5C, 0x8E, 0xFF,
+    0xFA, 0x91, 0xFF, 0x00, 0xFA, 0x82, 0xFF, 0x0A, 0xFA, 0xAE, 0x2A, 0x1A, 0x1B, 0x21, 0x22, 0x16,
+    0x0B, 0x76, 0xF1, 0x91, 0xFF, 0x01, 0xAE, 0x2E, 0x81, 0x1B, 0x00, 0x16, 0x81, 0x1B, 0x0B, 0x00,
+    0x12, 0x16, 0x21, 0x39, 0x5C, 0x9D, 0x7F, 0x22, 0x15, 0x16, 0x7F, 0x9F, 0xFF, 0x09, 0xFE, 0xFF,
+    0xFA, 0xFF, 0xF5, 0xDB, 0x6B, 0x1C, 0x0F, 0x08, 0x81, 0x06, 0x00, 0x09, 0x87, 0x06, 0x00, 0x09,
+    0x81, 0x06, 0x06, 0x09, 0x03, 0x01, 0x20, 0x53, 0xC8, 0xEF, 0x81, 0xFF, 0x83, 0xFE, 0x88, 0xFF,
+    0x00, 0xFA, 0x85, 0xFF, 0x03, 0xF8, 0xAE, 0x48, 0xAE, 0x81, 0xFF, 0x0E, 0xF8, 0x7F, 0x2B, 0x16,
+    0x12, 0x1B, 0x16, 0x11, 0x16, 0x34, 0x48, 0x8F, 0xDD, 0xFF, 0xFA, 0x8C, 0xFF, 0x04, 0xFA, 0x9D,
+    0x3A, 0x76, 0xFA, 0x83, 0xFF, 0x0A, 0xDE, 0x48, 0x2B, 0x7F, 0x9D, 0x48, 0x2A, 0x1B, 0x16, 0x25,
+    0x8E, 0x93, 0xFF, 0x04, 0xD1, 0xFF, 0xFA, 0xDD, 0x5B, 0x81, 0x1B, 0x02, 0x5B, 0xAE, 0x48, 0x81,
+    0x1B, 0x01, 0x5C, 0xF1, 0x81, 0xFF, 0x00, 0xFA, 0x8D, 0xFF, 0x06, 0xDE, 0x5B, 0x2B, 0x5B, 0x8F,
+    0xAE, 0x6F, 0x83, 0x76, 0x08, 0xAE, 0xDE, 0xF0, 0xFF, 0x8E, 0x21, 0x16, 0x1B, 0xBC, 0x8E, 0xFF,
+    0x84, 0xFE, 0x8B, 0xFF, 0x00, 0xFE, 0x81, 0xFF, 0x0A, 0xF5, 0xE2, 0x6C, 0x1C, 0x01, 0x05, 0x09,
+    0x06, 0x05, 0x09, 0x06, 0x83, 0x08, 0x82, 0x06, 0x07, 0x09, 0x06, 0x09, 0x0E, 0x02, 0x19, 0x53,
+    0xAD, 0x83, 0xFF, 0x00, 0xF5, 0x82, 0xFE, 0x8D, 0xFF, 0x05, 0xF1, 0xBC, 0x76, 0x2E, 0x26, 0xBB,
+    0x81, 0xFF, 0x06, 0xF2, 0x7F, 0x16, 0x1B, 0x2B, 0x2A, 0x1B, 0x81, 0x15, 0x04, 0x1D, 0x15, 0x1B,
+    0x39, 0xDE, 0x8C, 0xFF, 0x04, 0xFA, 0xF8, 0x76, 0x5B, 0xDD, 0x83, 0xFF, 0x05, 0xFA, 0x8F, 0x1D,
+    0x21, 0x48, 0x22, 0x81, 0x12, 0x00, 0x16, 0x81, 0x12, 0x02, 0x2A, 0xF0, 0xFA, 0x90, 0xFF, 0x0D,
+    0xD3, 0x5C, 0xFF, 0xFA, 0xF7, 0x6D, 0x1A, 0x22, 0x48, 0xDE, 0x47, 0x12, 0x1D, 0x6E, 0x91, 0xFF,
+    0x04, 0x9F, 0x3A, 0x7F, 0xF1, 0xFA, 0x81, 0xFF, 0x03, 0xF8, 0xFF, 0xF7, 0xF0, 0x82, 0xFF, 0x06,
+    0xF7, 0x76, 0x16, 0x12, 0x22, 0xF0, 0xFA, 0x8D, 0xFF, 0x83, 0xFE, 0x8C, 0xFF, 0x08, 0xEF, 0xFF,
+    0xF5, 0xDB, 0x6C, 0x20, 0x0F, 0x05, 0x06, 0x81, 0x09, 0x82, 0x06, 0x81, 0x08, 0x81, 0x05, 0x83,
+    0x06, 0x08, 0x14, 0x0E, 0x13, 0x1E, 0x52, 0xAD, 0xEF, 0xFF, 0xFA, 0x82, 0xFF, 0x82, 0xF5, 0x8C,
+    0xFF, 0x06, 0xE4, 0x5C, 0x22, 0x16, 0x1D, 0x76, 0xF1, 0x81, 0xFF, 0x0F, 0xF2, 0xF0, 0xAE, 0xD1,
+    0xAE, 0x2E, 0x0B, 0x22, 0x5B, 0x76, 0x39, 0x11, 0x12, 0xBC, 0xFF, 0xFA, 0x8A, 0xFF, 0x01, 0xFA,
+    0xFF, 0x81, 0xDE, 0x83, 0xFF, 0x0E, 0xF8, 0xBC, 0x34, 0x12, 0x16, 0x15, 0x21, 0x62, 0x6D, 0x34,
+    0x1B, 0x16, 0x0B, 0xDE, 0xFA, 0x90, 0xFF, 0x02, 0xBC, 0x25, 0xE5, 0x81, 0xFA, 0x08, 0x7F, 0x21,
+    0x0B, 0x21, 0x80, 0x25, 0x16, 0x34, 0xE4, 0x91, 0xFF, 0x02, 0xDD, 0x9D, 0xF2, 0x85, 0xFF, 0x00,
+    0xFA, 0x81, 0xFF, 0x06, 0xFA, 0xFF, 0xDE, 0x47, 0x12, 0x11, 0x2B, 0x81, 0xFF, 0x00, 0xFA, 0x9C,
+    0xFF, 0x81, 0xF5, 0x05, 0xEF, 0xDB, 0x6A, 0x20, 0x02, 0x0F, 0x83, 0x09, 0x8A, 0x06, 0x05, 0x05,
+    0x13, 0x1E, 0x51, 0xCA, 0xEF, 0x95, 0xFF, 0x05, 0x8E, 0x16, 0x00, 0x1D, 0x62, 0xE4, 0x85, 0xFF,
+    0x0A, 0xAE, 0x39, 0x11, 0x22, 0x9D, 0xF7, 0xF0, 0x47, 0x1B, 0x12, 0xAE, 0x94, 0xFF, 0x0D, 0xF0,
+    0x62, 0x12, 0x16, 0x1B, 0x25, 0x9F, 0xF8, 0xFA, 0x48, 0x12, 0x16, 0x11, 0xDE, 0x91, 0xFF, 0x12,
+    0xF1, 0x1B, 0x3A, 0xAE, 0x8E, 0x2A, 0x15, 0x21, 0x5C, 0x8E, 0x16, 0x21, 0x7F, 0xFF, 0xF2, 0xFF,
+    0xFA, 0xFF, 0xF8, 0x8B, 0xFF, 0x00, 0xFA, 0x8D, 0xFF, 0x04, 0xBB, 0x2A, 0x15, 0x11, 0x48, 0x9D,
+    0xFF, 0x0D, 0xFA, 0xF8, 0xFF, 0xF5, 0xE2, 0x5A, 0x24, 0x0C, 0x10, 0x06, 0x05, 0x06, 0x09, 0x07,
+    0x8A, 0x06, 0x04, 0x03, 0x19, 0x40, 0x9C, 0xF5, 0x81, 0xFF, 0x00, 0xFE, 0x93, 0xFF, 0x00, 0xBC,
+    0x81, 0x3A, 0x01, 0x76, 0xF8, 0x82, 0xFF, 0x08, 0xFA, 0xFF, 0xFA, 0xDD, 0x41, 0x1B, 0x12, 0x21,
+    0x39, 0x81, 0x5B, 0x03, 0x21, 0x0B, 0x22, 0xDD, 0x8B, 0xFF, 0x02, 0xFA, 0xFF, 0xFA, 0x81, 0xFF,
+    0x00, 0xF8, 0x82, 0xFF, 0x02, 0xD1, 0x2A, 0x12, 0x81, 0x16, 0x08, 0x39, 0x6F, 0xDC, 0xFF, 0x5B,
+    0x16, 0x1B, 0x1D, 0xDE, 0x91, 0xFF, 0x0C, 0xF8, 0x2E, 0x12, 0x2A, 0x22, 0x11, 0x12, 0x26, 0x8E,
+    0x2A, 0x12, 0x3A, 0xDE, 0x84, 0xFF, 0x01, 0xF1, 0xE4, 0x8D, 0xFF, 0x01, 0xFA, 0xF8, 0x86, 0xFF,
+    0x03, 0xFA, 0xFF, 0xDD, 0x3A, 0x81, 0x15, 0x02, 0x12, 0x76, 0xFA, 0x9C, 0xFF, 0x81, 0xFA, 0x0C,
+    0xFF, 0xE2, 0x7C, 0x29, 0x04, 0x0E, 0x10, 0x06, 0x0D, 0x05, 0x09, 0x07, 0x06, 0x85, 0x09, 0x81,
+    0x07, 0x81, 0x06, 0x04, 0x14, 0x40, 0xAC, 0xEF, 0xFF, 0x81, 0xFD, 0x81, 0xFE, 0x90, 0xFF, 0x00,
+    0xFA, 0x81, 0xFF, 0x02, 0xDE, 0xBC, 0xE4, 0x83, 0xFF, 0x11, 0xFA, 0xFF, 0xDE, 0x76, 0x1D, 0x1B,
+    0x34, 0x2E, 0x21, 0x16, 0x1B, 0x16, 0x12, 0x2B, 0x9F, 0xFA, 0xFF, 0xF2, 0x90, 0xFF, 0x01, 0xF7,
+    0x5C, 0x81, 0x12, 0x0A, 0x16, 0x12, 0x22, 0x16, 0x5B, 0xAE, 0x39, 0x15, 0x12, 0x39, 0xF8, 0x91,
+    0xFF, 0x0D, 0xF2, 0x8E, 0x1D, 0x00, 0x12, 0x16, 0x1A, 0x15, 0x3A, 0x1A, 0x3A, 0xD1, 0xFF, 0xF2,
+    0x83, 0xFF, 0x02, 0xBB, 0xAE, 0xF2, 0x8A, 0xFF, 0x81, 0xFA, 0x89, 0xFF, 0x07, 0xE4, 0x62, 0x22,
+    0x11, 0x15, 0x16, 0x9D, 0xFA, 0x9E, 0xFF, 0x06, 0xE2, 0x74, 0x2C, 0x13, 0x04, 0x0A, 0x07, 0x81,
+    0x09, 0x81, 0x06, 0x00, 0x07, 0x81, 0x09, 0x00, 0x06, 0x81, 0x09, 0x00, 0x0A, 0x81, 0x07, 0x05,
+    0x06, 0x0F, 0x13, 0x40, 0xAC, 0xE2, 0x81, 0xFF, 0x01, 0xFE, 0xFD, 0x81, 0xFE, 0x84, 0xFF, 0x00,
+    0xF8, 0x88, 0xFF, 0x00, 0xF1, 0x81, 0xFF, 0x00, 0xF8, 0x83, 0xFF, 0x00, 0xF2, 0x81, 0xFF, 0x0A,
+    0xFA, 0xFF, 0xF1, 0xBB, 0x26, 0x15, 0x48, 0xD1, 0x7F, 0x2A, 0x12, 0x83, 0x16, 0x02, 0x2B, 0x7F,
+    0xFA, 0x8A, 0xFF, 0x00, 0xF5, 0x81, 0xFF, 0x00, 0xF5, 0x81, 0xFF, 0x02, 0xFA, 0xF0, 0x34, 0x81,
+    0x16, 0x0B, 0x1D, 0x2B, 0x25, 0x21, 0x1D, 0x3A, 0x21, 0x16, 0x1B, 0x7F, 0xFF, 0xF8, 0x91, 0xFF,
+    0x0B, 0xE4, 0x2E, 0x1A, 0x1D, 0x12, 0x21, 0x5C, 0x8E, 0x9D, 0xD2, 0xFF, 0xFA, 0x82, 0xFF, 0x03,
+    0xDE, 0xAE, 0x48, 0x7F, 0x8F, 0xFF, 0x00, 0xF2, 0x86, 0xFF, 0x02, 0x8E, 0x1B, 0x12, 0x81, 0x16,
+    0x01, 0x1B, 0xBC, 0x95, 0xFF, 0x00, 0xFA, 0x84, 0xFF, 0x09, 0xFE, 0xFF, 0xF5, 0xDB, 0x6B, 0x2C,
+    0x13, 0x0F, 0x10, 0x04, 0x81, 0x07, 0x81, 0x06, 0x00, 0x07, 0x82, 0x09, 0x02, 0x05, 0x08, 0x09,
+    0x81, 0x07, 0x05, 0x10, 0x0E, 0x13, 0x3F, 0xAC, 0xF5, 0x83, 0xFF, 0x00, 0xFA, 0x81, 0xFE, 0x96,
+    0xFF, 0x00, 0xEF, 0x81, 0xFF, 0x11, 0xF8, 0xFF, 0xDD, 0x3A, 0x11, 0x41, 0x8E, 0x9D, 0x48, 0x25,
+    0x1D, 0x26, 0x2B, 0x22, 0x16, 0x12, 0x22, 0x7F, 0x91, 0xFF, 0x0D, 0xF2, 0x6D, 0x16, 0x12, 0x48,
+    0xD2, 0xD1, 0x6D, 0x15, 0x21, 0x15, 0x0B, 0x34, 0xDD, 0x8F, 0xFF, 0x00, 0xF5, 0x83, 0xFF, 0x06,
+    0xDD, 0x8E, 0x48, 0x2A, 0x26, 0xD2, 0xF1, 0x83, 0xFF, 0x06, 0xF5, 0xE5, 0xBB, 0x48, 0x22, 0x3A,
+    0xD2, 0x95, 0xFF, 0x08, 0xF1, 0x7F, 0x25, 0x11, 0x1A, 0x11, 0x1A, 0x47, 0xDC, 0x81, 0xFF, 0x00,
+    0xF8, 0x93, 0xFF, 0x81, 0xFA, 0x82, 0xFF, 0x07, 0xFE, 0xFF, 0xE2, 0x6C, 0x29, 0x18, 0x0F, 0x06,
+    0x83, 0x07, 0x82, 0x06, 0x82, 0x09, 0x09, 0x1C, 0x08, 0x07, 0x0A, 0x07, 0x04, 0x1F, 0x33, 0x8D,
+    0xEF, 0x82, 0xFF, 0x81, 0xFA, 0x99, 0xFF, 0x00, 0xF5, 0x81, 0xFF, 0x13, 0xF8, 0xFA, 0xF8, 0x9D,
+    0x6D, 0xBB, 0xF7, 0xF9, 0xDE, 0xBC, 0xBE, 0xDF, 0xF1, 0xAE, 0x39, 0x1B, 0x16, 0x5B, 0xDF, 0xFA,
+    0x90, 0xFF, 0x07, 0xD3, 0x49, 0x76, 0xAE, 0xD1, 0x5C, 0x1D, 0x1A, 0x81, 0x11, 0x04, 0x34, 0xAE,
+    0xFA, 0xFF, 0xF7, 0x92, 0xFF, 0x07, 0xFA, 0xF7, 0xDC, 0x41, 0x12, 0x2B, 0x3A, 0x5C, 0x81, 0x62,
+    0x07, 0x5B, 0x34, 0x26, 0x25, 0x16, 0x1D, 0x6D, 0xF1, 0x94, 0xFF, 0x02, 0xDD, 0x48, 0x1B, 0x81,
+    0x12, 0x03, 0x11, 0x1A, 0x41, 0xBC, 0x82, 0xFF, 0x00, 0xFA, 0x98, 0xFF, 0x0A, 0xF5, 0xE2, 0x7D,
+    0x2D, 0x01, 0x03, 0x09, 0x06, 0x07, 0x0A, 0x07, 0x84, 0x06, 0x0A, 0x09, 0x06, 0x09, 0x08, 0x07,
+    0x0E, 0x0C, 0x17, 0x3F, 0x8C, 0xEF, 0x95, 0xFF, 0x81, 0xFA, 0x87, 0xFF, 0x81, 0xF5, 0x06, 0xFF,
+    0xF8, 0xFA, 0xFF, 0xF2, 0xF9, 0xFE, 0x82, 0xFF, 0x00, 0xFA, 0x81, 0xFF, 0x06, 0xF8, 0xFF, 0xF8,
+    0x8F, 0x2B, 0x2E, 0x9F, 0x92, 0xFF, 0x00, 0xFA, 0x81, 0xFF, 0x09, 0xDE, 0x62, 0x1D, 0x1B, 0x16,
+    0x2E, 0x9D, 0xF8, 0xFF, 0xFA, 0x96, 0xFF, 0x01, 0x9D, 0x41, 0x81, 0x21, 0x02, 0x1A, 0x15, 0x16,
+    0x81, 0x1A, 0x04, 0x15, 0x12, 0x16, 0x3A, 0xDD, 0x94, 0xFF, 0x08, 0x6F, 0x2E, 0x1D, 0x1B, 0x25,
+    0x41, 0x7F, 0xD1, 0xF2, 0x9A, 0xFF, 0x0A, 0xFA, 0xFF, 0xF5, 0xDB, 0x7D, 0x2C, 0x19, 0x03, 0x0D,
+    0x06, 0x09, 0x81, 0x0A, 0x00, 0x07, 0x86, 0x06, 0x08, 0x0D, 0x09, 0x10, 0x04, 0x17, 0x40, 0xAB,
+    0xEF, 0xF5, 0xB2, 0xFF, 0x03, 0xDE, 0xD2, 0xF1, 0xF2, 0x95, 0xFF, 0x04, 0xE5, 0xBC, 0x6F, 0xAE,
+    0xDE, 0x9B, 0xFF, 0x01, 0xF7, 0xDE, 0x82, 0xDD, 0x07, 0xD1, 0x8E, 0x62, 0x47, 0x34, 0x3A, 0x6F,
+    0xF2, 0x94, 0xFF, 0x05, 0xD2, 0x6F, 0x8F, 0xD1, 0xF0, 0xFA, 0x9A, 0xFF, 0x00, 0xFA, 0x82, 0xFF,
+    0x06, 0xF5, 0xE2, 0x75, 0x33, 0x02, 0x0F, 0x10, 0x81, 0x09, 0x82, 0x0A, 0x00, 0x09, 0x87, 0x06,
+    0x07, 0x09, 0x05, 0x17, 0x3D, 0xAB, 0xEF, 0xFF, 0xF5, 0x84, 0xFF, 0x81, 0xFE, 0x83, 0xFF, 0x81,
+    0xFE, 0x81, 0xFF, 0x82, 0xFE, 0x86, 0xFF, 0x81, 0xF5, 0x83, 0xFF, 0x01, 0xEF, 0xF5, 0x83, 0xFF,
+    0x00, 0xF5, 0x88, 0xFF, 0x00, 0xF5, 0x83, 0xFF, 0x00, 0xFA, 0x94, 0xFF, 0x00, 0xF5, 0x8A, 0xFF,
+    0x00, 0xF5, 0x9C, 0xFF, 0x00, 0xFA, 0x81, 0xFF, 0x01, 0xFA, 0xF8, 0x82, 0xFF, 0x02, 0xFA, 0xFF,
+    0xF9, 0x8F, 0xFF, 0x00, 0xF2, 0x81, 0xFF, 0x81, 0xFA, 0x81, 0xFF, 0x02, 0xF7, 0xFA, 0xF9, 0x98,
+    0xFF, 0x00, 0xFA, 0x81, 0xFF, 0x08, 0xE2, 0x7D, 0x33, 0x0C, 0x0F, 0x05, 0x06, 0x09, 0x0A, 0x81,
+    0x07, 0x01, 0x0A, 0x09, 0x86, 0x06, 0x05, 0x09, 0x0D, 0x13, 0x2D, 0x9B, 0xEF, 0x81, 0xFF, 0x00,
+    0xFE, 0x83, 0xFF, 0x00, 0xFE, 0x81, 0xFC, 0x81, 0xFD, 0x81, 0xFE, 0x86, 0xFC, 0x00, 0xFD, 0x85,
+    0xFF, 0x81, 0xF5, 0x83, 0xFF, 0x00, 0xEF, 0x82, 0xF5, 0x82, 0xFF, 0x82, 0xF5, 0x82, 0xFF, 0x00,
+    0xF5, 0x83, 0xFF, 0x00, 0xFA, 0x94, 0xFF, 0x00, 0xF5, 0x85, 0xFF, 0x85, 0xF5, 0x01, 0xFF, 0xF5,
+    0x92, 0xFF, 0x00, 0xF5, 0x81, 0xFF, 0x00, 0xF5, 0x81, 0xFF, 0x00, 0xF5, 0xAA, 0xFF, 0x82, 0xF5,
+    0x95, 0xFF, 0x02, 0xE2, 0x7D, 0x33, 0x81, 0x05, 0x00, 0x10, 0x81, 0x06, 0x01, 0x09, 0x0A, 0x81,
+    0x07, 0x81, 0x09, 0x85, 0x06, 0x05, 0x08, 0x0F, 0x0D, 0x2D, 0x8B, 0xEF, 0x82, 0xFF, 0x00, 0xFE,
+    0x82, 0xFF, 0x04, 0xFE, 0xEB, 0xE9, 0xEC, 0xE8, 0x82, 0xE9, 0x83, 0xE8, 0x08, 0xEC, 0xE8, 0xE7,
+    0xED, 0xFD, 0xFF, 0xFA, 0xF1, 0xCD, 0x84, 0xB5, 0x00, 0xCD, 0x82, 0xB5, 0x08, 0xB6, 0xB5, 0xB1,
+    0xCD, 0xCE, 0xB5, 0x9A, 0xAA, 0xB6, 0x82, 0xB5, 0x08, 0xD3, 0xDE, 0xBE, 0xC5, 0xCD, 0xCE, 0xC5,
+    0xB2, 0xCC, 0x81, 0xB5, 0x82, 0xAA, 0x81, 0xB5, 0x81, 0xAA, 0x87, 0xB5, 0x02, 0xDF, 0xCE, 0xB1,
+    0x82, 0xB2, 0x01, 0xCE, 0xDF, 0x81, 0xCE, 0x81, 0xC5, 0x83, 0xB6, 0x81, 0xB5, 0x81, 0xB8, 0x81,
+    0xB6, 0x01, 0xAA, 0xB8, 0x81, 0xB5, 0x81, 0xCD, 0x81, 0xB5, 0x81, 0xCD, 0x06, 0xCC, 0xCE, 0xA8,
+    0xB9, 0xB6, 0x97, 0xAA, 0x82, 0xB5, 0x0D, 0xB8, 0xB6, 0xB5, 0xCC, 0xD2, 0xBE, 0xA8, 0xB6, 0xAA,
+    0xA8, 0xB6, 0xAA, 0xA8, 0xAA, 0x87, 0xB6, 0x81, 0xAA, 0x03, 0xB6, 0xAA, 0xB6, 0xAA, 0x81, 0xB6,
+    0x82, 0xA8, 0x06, 0xAA, 0xB6, 0xB9, 0xAA, 0x97, 0xB2, 0xA8, 0x81, 0xB6, 0x03, 0xC5, 0xC7, 0xB9,
+    0x8B, 0x81, 0xAB, 0x01, 0xB6, 0xAA, 0x82, 0xB6, 0x00, 0xCD, 0x8A, 0xFF, 0x07, 0xF5, 0xE2, 0x8C,
+    0x33, 0x0C, 0x03, 0x10, 0x06, 0x81, 0x09, 0x81, 0x07, 0x81, 0x09, 0x00, 0x07, 0x81, 0x09, 0x84,
+    0x06, 0x07, 0x05, 0x02, 0x33, 0x75, 0xE2, 0xFF, 0xFA, 0xF9, 0x84, 0xFF, 0x01, 0xFD, 0xD6, 0x81,
+    0xB0, 0x00, 0xA3, 0x82, 0xB0, 0x84, 0xB4, 0x06, 0x95, 0xA3, 0xD6, 0xFB, 0xFE, 0xF5, 0xE5, 0x87,
+    0xA6, 0x05, 0xB5, 0x99, 0xA6, 0xAA, 0xB2, 0x99, 0x81, 0xA6, 0x05, 0xAA, 0x9B, 0xAA, 0xA8, 0x9A,
+    0xA6, 0x81, 0xB2, 0x01, 0xA9, 0xB8, 0x81, 0xA6, 0x07, 0xB5, 0x99, 0xB1, 0xB2, 0x9A, 0x8B, 0x9A,
+    0x8B, 0x81, 0x9A, 0x81, 0x8B, 0x81, 0xA6, 0x81, 0x99, 0x85, 0xA6, 0x00, 0xB1, 0x81, 0xB5, 0x82,
+    0xA6, 0x82, 0xB2, 0x81, 0x99, 0x03, 0xAA, 0xA8, 0x96, 0xA6, 0x82, 0x9A, 0x01, 0x8B, 0xA9, 0x83,
+    0x9A, 0x01, 0xB2, 0xBE, 0x81, 0xB7, 0x04, 0xBE, 0xB2, 0xBC, 0xCE, 0xA8, 0x81, 0x9B, 0x06, 0x8B,
+    0xB9, 0x96, 0xA6, 0x9A, 0xA9, 0x8B, 0x81, 0xB1, 0x81, 0xCC, 0x07, 0xB2, 0xB6, 0xB1, 0xA8, 0xB6,
+    0xA8, 0x97, 0xB6, 0x81, 0xA8, 0x85, 0xB2, 0x87, 0xA8, 0x00, 0xAA, 0x81, 0xB6, 0x07, 0xA8, 0x99,
+    0xB1, 0xAA, 0xB6, 0xA8, 0xB2, 0xB1, 0x81, 0xA8, 0x02, 0x97, 0x99, 0xAB, 0x81, 0x8B, 0x81, 0xA9,
+    0x82, 0xA8, 0x01, 0xB1, 0xFA, 0x88, 0xFF, 0x05, 0xF5, 0xE2, 0x7D, 0x33, 0x18, 0x05, 0x86, 0x06,
+    0x83, 0x09, 0x81, 0x06, 0x81, 0x09, 0x81, 0x06, 0x04, 0x0F, 0x2C, 0x7B, 0xE2, 0xF5, 0x87, 0xFF,
+    0x02, 0xFB, 0xD5, 0x90, 0x82, 0xA1, 0x81, 0x94, 0x82, 0xA0, 0x06, 0xA1, 0x85, 0x94, 0xA2, 0xBF,
+    0xEE, 0xFE, 0x81, 0xFF, 0x03, 0xEF, 0xB9, 0xEF, 0xDB, 0x82, 0xEF, 0x05, 0xDB, 0xC7, 0xD9, 0xC7,
+    0xC6, 0xD8, 0x81, 0xEF, 0x03, 0xE2, 0xCB, 0x8D, 0xC8, 0x81, 0xCA, 0x04, 0xDB, 0xF5, 0xEF, 0xAC,
+    0xDB, 0x81, 0xEF, 0x0B, 0xC7, 0xC8, 0xEF, 0xC7, 0xAC, 0x9C, 0xAC, 0xCB, 0xDB, 0xE2, 0xAD, 0xCB,
+    0x82, 0xE2, 0x00, 0x9C, 0x82, 0xE2, 0x04, 0xC8, 0xEF, 0xD9, 0xE2, 0xD9, 0x81, 0xE2, 0x02, 0xEF,
+    0xDB, 0xD8, 0x81, 0xDB, 0x09, 0xE2, 0xC8, 0xD8, 0xB6, 0xDB, 0xD9, 0xEF, 0xAD, 0x9C, 0xCA, 0x81,
+    0xAC, 0x81, 0xCB, 0x01, 0xEF, 0xF5, 0x81, 0xEF, 0x05, 0xE2, 0xEF, 0xF5, 0xEA, 0xF5, 0xE2, 0x81,
+    0xAC, 0x06, 0xCB, 0xB9, 0xE2, 0xDB, 0xE2, 0x9C, 0xDB, 0x81, 0xE2, 0x00, 0xF5, 0x81, 0xFF, 0x81,
+    0xF5, 0x81, 0xFF, 0x08, 0xE2, 0xFA, 0xFF, 0xFA, 0xFF, 0xFA, 0xF5, 0xFF, 0xFA, 0x81, 0xFF, 0x01,
+    0xE2, 0xFF, 0x81, 0xF5, 0x06, 0xE2, 0xF5, 0xFF, 0xE2, 0xFF, 0xF5, 0xEA, 0x81, 0xFF, 0x01, 0xF5,
+    0xFF, 0x81, 0xFA, 0x02, 0xFF, 0xFA, 0xEA, 0x81, 0xF5, 0x81, 0xEF, 0x02, 0xF5, 0xE2, 0xEF, 0x81,
+    0xFF, 0x01, 0xF2, 0xFA, 0x87, 0xFF, 0x00, 0xF9, 0x81, 0xFF, 0x04, 0xE2, 0x8C, 0x33, 0x14, 0x05,
+    0x89, 0x06, 0x01, 0x09, 0x0A, 0x81, 0x09, 0x07, 0x06, 0x05, 0x03, 0x0E, 0x24, 0x7D, 0xDB, 0xF5,
+    0x88, 0xFF, 0x05, 0xFB, 0xD5, 0x9E, 0xAF, 0xA0, 0x98, 0x81, 0xA0, 0x82, 0x98, 0x82, 0xA0, 0x03,
+    0x94, 0xC2, 0xEE, 0xFE, 0x81, 0xFF, 0x03, 0xA9, 0x5F, 0xDB, 0xEF, 0x81, 0xF5, 0x21, 0xDB, 0x83,
+    0x48, 0x43, 0x36, 0x3B, 0x4B, 0xDB, 0xEF, 0xD8, 0x51, 0x31, 0x23, 0x35, 0x49, 0xAB, 0xEF, 0xD7,
+    0x59, 0x7D, 0xDB, 0xC6, 0x57, 0xB9, 0xC6, 0x96, 0x3B, 0x3C, 0x38, 0x43, 0xB5, 0xD9, 0x61, 0x68,
+    0x81, 0xEF, 0x0A, 0x9C, 0x57, 0xC7, 0xEF, 0xDB, 0x45, 0xC5, 0xEF, 0xDB, 0x81, 0xA6, 0x81, 0xE2,
+    0x12, 0xB9, 0x64, 0xDB, 0xEF, 0x97, 0x35, 0x3B, 0x35, 0x42, 0xC6, 0xEF, 0x7B, 0x36, 0x3B, 0x43,
+    0x31, 0x36, 0x9C, 0xEF, 0x81, 0xFF, 0x02, 0xF5, 0xEF, 0xF5, 0x81, 0xFF, 0x0C, 0xF5, 0xDB, 0x3D,
+    0x30, 0x31, 0x3C, 0x70, 0xEF, 0xDB, 0x58, 0x9B, 0xE2, 0xEF, 0x99, 0xFF, 0x00, 0xFA, 0x83, 0xFF,
+    0x00, 0xF2, 0x81, 0xFF, 0x00, 0xF8, 0x83, 0xFF, 0x81, 0xF5, 0x04, 0xFF, 0xF5, 0xFF, 0xEF, 0xF5,
+    0x8C, 0xFF, 0x02, 0xEF, 0x8C, 0x33, 0x81, 0x03, 0x82, 0x06, 0x00, 0x09, 0x86, 0x06, 0x00, 0x09,
+    0x81, 0x06, 0x81, 0x09, 0x04, 0x02, 0x03, 0x29, 0x6A, 0xE2, 0x8A, 0xFF, 0x01, 0xFB, 0xD4, 0x81,
+    0xAF, 0x01, 0xA7, 0x98, 0x81, 0xA0, 0x82, 0x98, 0x00, 0xA7, 0x81, 0xA0, 0x02, 0x94, 0xC2, 0xEE,
+    0x82, 0xFF, 0x03, 0x7A, 0x46, 0xD8, 0xEF, 0x81, 0xF5, 0x2E, 0xDB, 0x70, 0x67, 0xD8, 0xC8, 0x7A,
+    0x3C, 0xCA, 0xEF, 0xC7, 0x3E, 0x6C, 0xCB, 0xC7, 0x37, 0x99, 0xF5, 0xD9, 0x4E, 0x7D, 0xE2, 0x73,
+    0x44, 0xDB, 0xE2, 0xEA, 0xD8, 0xC6, 0x71, 0x44, 0xE2, 0xF5, 0x60, 0x67, 0xE2, 0xF5, 0xAC, 0x43,
+    0xB2, 0xF5, 0xDB, 0x35, 0xA6, 0xEF, 0xD9, 0x55, 0x64, 0x81, 0xE2, 0x06, 0x8B, 0x42, 0xDB, 0xE2,
+    0x83, 0x4A, 0xC6, 0x81, 0xDB, 0x81, 0xF5, 0x08, 0x99, 0x4B, 0x97, 0xD8, 0x9B, 0x57, 0xAA, 0xEF,
+    0xFA, 0x86, 0xFF, 0x04, 0xE2, 0x4A, 0x71, 0xC7, 0xE2, 0x81, 0xFF, 0x04, 0xE2, 0x42, 0xAA, 0xEF,
+    0xF5, 0x84, 0xFF, 0x00, 0xFA, 0x89, 0xFF, 0x00, 0xF5, 0x96, 0xFF, 0x02, 0xF5, 0xD7, 0xE4, 0x88,
+    0xFF, 0x00, 0xF5, 0x81, 0xFF, 0x00, 0xFA, 0x81, 0xFF, 0x06, 0xEF, 0xAC, 0x33, 0x14, 0x0D, 0x06,
+    0x09, 0x81, 0x06, 0x00, 0x10, 0x86, 0x06, 0x09, 0x09, 0x03, 0x06, 0x10, 0x05, 0x0C, 0x29, 0x6C,
+    0xDB, 0xF5, 0x81, 0xFA, 0x87, 0xFF, 0x06, 0xFE, 0xF6, 0xD4, 0xAF, 0xA0, 0xA7, 0x98, 0x81, 0xA0,
+    0x82, 0x98, 0x00, 0xA7, 0x81, 0xA0, 0x02, 0x94, 0xC2, 0xEE, 0x81, 0xFF, 0x03, 0xF5, 0xAB, 0x46,
+    0xD9, 0x82, 0xF5, 0x02, 0xE2, 0x70, 0x64, 0x81, 0xE2, 0x06, 0x9C, 0x2F, 0xCB, 0xF5, 0xC7, 0x4E,
+    0x8C, 0x81, 0xE2, 0x35, 0x36, 0x74, 0xEF, 0xD8, 0x3F, 0x7C, 0xDB, 0x54, 0x72, 0xE2, 0xF5, 0xFF,
+    0xF5, 0xEF, 0x71, 0x5D, 0xF5, 0xE2, 0x67, 0x71, 0xEA, 0xFF, 0xCA, 0x4C, 0xB6, 0xEF, 0xD8, 0x3B,
+    0xB9, 0xEF, 0xD8, 0x4B, 0x45, 0xC8, 0xE2, 0xAA, 0x57, 0xDB, 0xE2, 0x71, 0x4B, 0xD9, 0xE2, 0xEF,
+    0xFF, 0xF5, 0x73, 0x57, 0xE2, 0xEF, 0xC8, 0x4B, 0xAA, 0xFF, 0x81, 0xFA, 0x85, 0xFF, 0x09, 0xEF,
+    0x43, 0x97, 0xE2, 0xFF, 0xEF, 0xFF, 0xF5, 0x42, 0xB9, 0x81, 0xEF, 0x01, 0xFF, 0xF7, 0x8B, 0xFF,
+    0x02, 0xF2, 0xD3, 0xF5, 0x83, 0xFF, 0x00, 0xF5, 0x81, 0xFF, 0x00, 0xFA, 0x82, 0xFF, 0x01, 0xF8,
+    0xF5, 0x81, 0xFF, 0x00, 0xFA, 0x81, 0xFF, 0x81, 0xF5, 0x00, 0xEF, 0x81, 0xFF, 0x02, 0xE4, 0x8F,
+    0xB7, 0x83, 0xFF, 0x00, 0xEF, 0x88, 0xFF, 0x05, 0xEF, 0xAB, 0x3E, 0x17, 0x0D, 0x09, 0x81, 0x0A,
+    0x02, 0x07, 0x06, 0x09, 0x86, 0x06, 0x81, 0x09, 0x08, 0x10, 0x05, 0x0C, 0x29, 0x6B, 0xCB, 0xF5,
+    0xFF, 0xFA, 0x88, 0xFF, 0x03, 0xFE, 0xF6, 0xD4, 0xAF, 0x82, 0x98, 0x81, 0xA0, 0x81, 0x98, 0x83,
+    0xA0, 0x02, 0x94, 0xC2, 0xEE, 0x81, 0xFF, 0x03, 0xF5, 0x9B, 0x44, 0xE2, 0x81, 0xFF, 0x22, 0xF5,
+    0xE2, 0x5E, 0x91, 0xEF, 0xE2, 0xC8, 0x36, 0xE2, 0xF5, 0xA6, 0x57, 0x9B, 0xEF, 0xE2, 0x45, 0xA9,
+    0xFF, 0xD9, 0x3E, 0x75, 0x7A, 0x54, 0xD8, 0xE2, 0xFF, 0xF8, 0xF5, 0xE2, 0x4A, 0x97, 0xFF, 0xEF,
+    0x60, 0x73, 0x81, 0xF5, 0x15, 0xB9, 0x4C, 0xB6, 0xF5, 0xC8, 0x3B, 0xC7, 0xE2, 0xCA, 0x57, 0x2F,
+    0x7A, 0xE2, 0xAA, 0x44, 0xCB, 0xE2, 0x7A, 0x64, 0xDB, 0xEF, 0xF5, 0x81, 0xFF, 0x07, 0x79, 0x4D,
+    0xD8, 0xEF, 0xB9, 0x4B, 0xB5, 0xFF, 0x81, 0xFA, 0x81, 0xFF, 0x07, 0xFA, 0xFF, 0xFA, 0xFF, 0xEF,
+    0x35, 0x79, 0xEF, 0x81, 0xFF, 0x05, 0xFA, 0xFF, 0x42, 0xAA, 0xE2, 0xEF, 0x83, 0xFF, 0x00, 0xF5,
+    0x84, 0xFF, 0x07, 0xFA, 0xFF, 0xFA, 0xEF, 0xD3, 0x6E, 0xEA, 0xF5, 0x8C, 0xFF, 0x81, 0xFA, 0x84,
+    0xFF, 0x04, 0xF5, 0xFF, 0xF7, 0xD2, 0xF7, 0x81, 0xFA, 0x87, 0xFF, 0x00, 0xF5, 0x81, 0xFF, 0x05,
+    0xEF, 0xB9, 0x3F, 0x17, 0x03, 0x08, 0x82, 0x09, 0x02, 0x0A, 0x09, 0x07, 0x81, 0x09, 0x83, 0x06,
+    0x81, 0x09, 0x06, 0x10, 0x05, 0x02, 0x1F, 0x61, 0xDB, 0xF5, 0x86, 0xFF, 0x00, 0xF5, 0x83, 0xFF,
+    0x04, 0xFE, 0xF3, 0xC3, 0x87, 0xA7, 0x81, 0x98, 0x82, 0xA0, 0x00, 0xA7, 0x83, 0xA0, 0x08, 0x94,
+    0xC2, 0xEE, 0xFE, 0xFF, 0xF5, 0x8B, 0x44, 0xEA, 0x81, 0xFF, 0x03, 0xF5, 0xEF, 0x70, 0x77, 0x81,
+    0xE2, 0x06, 0xAC, 0x2F, 0xDB, 0xF5, 0xDF, 0x4B, 0xAA, 0x81, 0xFF, 0x09, 0x89, 0xAC, 0xEA, 0xD8,
+    0x3F, 0x6C, 0x4C, 0x78, 0xE2, 0xEF, 0x82, 0xFF, 0x06, 0xC6, 0x3B, 0xC8, 0xFF, 0xEF, 0x60, 0x67,
+    0x81, 0xF5, 0x0E, 0x9C, 0x3D, 0xB9, 0xEF, 0xDB, 0x43, 0xB9, 0xE2, 0xDB, 0x57, 0x35, 0x5F, 0xE2,
+    0x8B, 0x46, 0x81, 0xE2, 0x10, 0x83, 0x5D, 0xD9, 0xEF, 0xF5, 0xFA, 0xFF, 0x7B, 0x44, 0xD8, 0xEF,
+    0xCB, 0x57, 0xB5, 0xFF, 0xFA, 0xF8, 0x85, 0xFF, 0x03, 0xEF, 0x3B, 0x7A, 0xEF, 0x83, 0xFF, 0x05,
+    0x42, 0xAA, 0xE2, 0xEF, 0xF5, 0xFE, 0x87, 0xFF, 0x00, 0xF5, 0x81, 0xFF, 0x06, 0xF5, 0xB5, 0x55,
+    0xD9, 0xEF, 0xF5, 0xFF, 0x81, 0xF5, 0x05, 0xFA, 0xF5, 0xFF, 0xF5, 0xFF, 0xF2, 0x85, 0xFF, 0x03,
+    0xF5, 0xE2, 0xEF, 0xF5, 0x87, 0xFF, 0x00, 0xE2, 0x81, 0xEF, 0x00, 0xF5, 0x81, 0xFF, 0x81, 0xFE,
+    0x06, 0xFF, 0xEF, 0xB9, 0x40, 0x1F, 0x0C, 0x0F, 0x82, 0x06, 0x81, 0x09, 0x02, 0x0A, 0x07, 0x0A,
+    0x86, 0x09, 0x05, 0x06, 0x05, 0x20, 0x53, 0xCB, 0xF5, 0x81, 0xFF, 0x81, 0xFA, 0x83, 0xFF, 0x08,
+    0xF5, 0xFF, 0xFE, 0xFF, 0xFE, 0xFC, 0xE7, 0xBD, 0x85, 0x82, 0x98, 0x01, 0xA0, 0xA1, 0x85, 0xA0,
+    0x08, 0xA1, 0xC2, 0xF3, 0xFE, 0xFF, 0xF5, 0xAB, 0x4B, 0xD9, 0x82, 0xFF, 0x0B, 0xEF, 0x80, 0x81,
+    0xF5, 0xE2, 0x9C, 0x2F, 0xC8, 0xF5, 0xDF, 0x65, 0xB8, 0x81, 0xFF, 0x03, 0xE2, 0xEF, 0xFF, 0xE2,
+    0x81, 0x3F, 0x03, 0x3B, 0xCE, 0xE2, 0xF5, 0x82, 0xFF, 0x02, 0x5F, 0x4B, 0xDB, 0x81, 0xEF, 0x0A,
+    0x5A, 0x51, 0xDB, 0xEF, 0xAD, 0x3E, 0xAB, 0xE2, 0xAD, 0x2F, 0xAB, 0x81, 0xE2, 0x82, 0x57, 0x15,
+    0xCA, 0x8B, 0x46, 0xDB, 0xE2, 0x72, 0x5D, 0xD9, 0xEF, 0xF5, 0xFF, 0xF5, 0x7C, 0x46, 0xDB, 0xE2,
+    0xAC, 0x38, 0xA9, 0xF5, 0xFF, 0xFA, 0x84, 0xFF, 0x81, 0xE2, 0x03, 0x38, 0x75, 0xE2, 0xF5, 0x81,
+    0xFF, 0x02, 0xEA, 0x3B, 0x9B, 0x81, 0xDB, 0x00, 0x9F, 0x81, 0x80, 0x14, 0x81, 0xC6, 0xEF, 0xE2,
+    0xB6, 0x71, 0x67, 0x73, 0x7A, 0xE2, 0xC8, 0x60, 0x23, 0x61, 0xAB, 0xE2, 0xC8, 0x83, 0xB6, 0x83,
+    0x78, 0x81, 0xE2, 0x07, 0xB9, 0x81, 0x89, 0x72, 0x89, 0xE2, 0xEF, 0xB6, 0x81, 0x7A, 0x81, 0x72,
+    0x04, 0xC7, 0xEF, 0xDB, 0xA8, 0xD7, 0x81, 0xEF, 0x04, 0x79, 0x72, 0x7A, 0x61, 0xD8, 0x81, 0xFF,
+    0x00, 0xF9, 0x81, 0xFF, 0x05, 0xC5, 0x57, 0x27, 0x23, 0x19, 0x18, 0x81, 0x0F, 0x04, 0x08, 0x0F,
+    0x05, 0x04, 0x0E, 0x83, 0x0F, 0x00, 0x05, 0x82, 0x0D, 0x06, 0x13, 0x1E, 0x53, 0xCB, 0xEF, 0xFF,
+    0xF9, 0x85, 0xFF, 0x0E, 0xF5, 0xFE, 0xFD, 0xFC, 0xFD, 0xFC, 0xF3, 0xD6, 0x95, 0x84, 0x86, 0x98,
+    0xA7, 0xA0, 0xA1, 0x86, 0xA0, 0x07, 0xC2, 0xF3, 0xFE, 0xFF, 0xF5, 0x9A, 0x4B, 0xD9, 0x82, 0xFF,
+    0x0B, 0xE2, 0x65, 0x77, 0xEF, 0xE2, 0xAB, 0x49, 0xDB, 0xFF, 0xCD, 0x55, 0xB9, 0x81, 0xFF, 0x06,
+    0xEF, 0xF5, 0xF2, 0xD8, 0x3E, 0x27, 0x4E, 0x81, 0xEF, 0x18, 0xE2, 0xFF, 0xF9, 0xEF, 0x3C, 0x79,
+    0xE2, 0xF5, 0xEF, 0x51, 0x2D, 0x65, 0x70, 0x50, 0x28, 0xAC, 0xE2, 0xAD, 0x2C, 0xAB, 0xE2, 0xCB,
+    0x57, 0x7A, 0x46, 0x81, 0x9B, 0x10, 0x4D, 0xCB, 0xEF, 0x96, 0x45, 0x73, 0x83, 0xB2, 0xFF, 0xEF,
+    0x7C, 0x46, 0xAB, 0x78, 0x51, 0x37, 0xA9, 0x87, 0xFF, 0x24, 0xF5, 0xE2, 0x31, 0x3E, 0x8B, 0xA6,
+    0xE5, 0xFF, 0xEA, 0x43, 0x8D, 0xCB, 0x9C, 0x55, 0x70, 0x71, 0x4B, 0x73, 0xE2, 0xCB, 0x64, 0x54,
+    0x73, 0x4C, 0x3E, 0xE2, 0xAC, 0x60, 0x28, 0x50, 0x8C, 0xE2, 0x7B, 0x43, 0x64, 0x3B, 0x42, 0x81,
+    0xDB, 0x02, 0x64, 0x4A, 0x67, 0x81, 0x44, 0x12, 0xCB, 0xE2, 0x9B, 0x31, 0x51, 0x3F, 0x31, 0x7B,
+    0xE2, 0xC8, 0x4E, 0xC6, 0xEF, 0xCA, 0x43, 0x4C, 0x5F, 0x31, 0x7B, 0x81, 0xFF, 0x03, 0xFA, 0xFF,
+    0xEA, 0xBE, 0x81, 0x6F, 0x01, 0x56, 0x45, 0x84, 0x4F, 0x84, 0x50, 0x85, 0x4F, 0x03, 0x58, 0x89,
+    0xDB, 0xEF, 0x81, 0xF5, 0x81, 0xFE, 0x82, 0xFF, 0x81, 0xFE, 0x00, 0xFD, 0x81, 0xFB, 0x08, 0xF6,
+    0xE8, 0xE0, 0xBD, 0xA2, 0x94, 0x93, 0x98, 0xA7, 0x86, 0xA0, 0x81, 0x93, 0x08, 0xA0, 0xC2, 0xF3,
+    0xFE, 0xFF, 0xF5, 0x9B, 0x44, 0xE2, 0x81, 0xFF, 0x0E, 0xF5, 0xE2, 0x65, 0x81, 0xEF, 0xE2, 0xAB,
+    0x32, 0xDB, 0xFF, 0xDE, 0x56, 0xC7, 0xFF, 0xF2, 0x81, 0xF5, 0x05, 0xFF, 0xD8, 0x2C, 0x28, 0x4C,
+    0xDB, 0x81, 0xE2, 0x2A, 0xFF, 0xF8, 0xC8, 0x36, 0xCB, 0xEF, 0xFF, 0xF5, 0x51, 0x2D, 0x58, 0x65,
+    0x50, 0x2F, 0xB8, 0xEF, 0xAD, 0x2D, 0xB6, 0xEF, 0xCB, 0x46, 0xAA, 0x81, 0x59, 0x7D, 0x3E, 0xCB,
+    0xEF, 0x99, 0x2F, 0x45, 0x55, 0x80, 0xFF, 0xEF, 0x7C, 0x38, 0xB9, 0x30, 0x3E, 0x7A, 0xDB, 0x87,
+    0xFF, 0x1D, 0xF5, 0xE2, 0x36, 0x49, 0x4B, 0x6E, 0xCC, 0xFA, 0xF2, 0x49, 0x8D, 0xCB, 0x8B, 0x57,
+    0xCA, 0xE2, 0x73, 0x64, 0xE2, 0xCB, 0x46, 0xA8, 0xF5, 0xAC, 0x37, 0xD9, 0xF5, 0xAA, 0x46, 0xD8,
+    0x81, 0xEF, 0x0B, 0x97, 0x58, 0xCB, 0xD8, 0x54, 0xD8, 0xDB, 0x4F, 0x8B, 0xEF, 0xD8, 0x2F, 0x81,
+    0xE2, 0x01, 0x96, 0x66, 0x81, 0xCB, 0x08, 0x4E, 0x78, 0xE2, 0x9C, 0x57, 0x97, 0xF5, 0xCA, 0x36,
+    0x81, 0xDB, 0x01, 0x66, 0x83, 0x84, 0xFF, 0x04, 0xE6, 0xB7, 0xDA, 0xEE, 0xDA, 0x84, 0xC9, 0x82,
+    0xDA, 0x82, 0xC9, 0x84, 0xDA, 0x01, 0xC9, 0xDA, 0x81, 0xED, 0x03, 0xEB, 0xE6, 0xED, 0xEE, 0x81,
+    0xEB, 0x0E, 0xE6, 0xE9, 0xE7, 0xD0, 0xD6, 0xCF, 0xC0, 0xBD, 0xA5, 0xA1, 0x93, 0xA0, 0xA7, 0xB3,
+    0xA7, 0x86, 0xA0, 0x81, 0x98, 0x02, 0xA0, 0xC2, 0xEE, 0x81, 0xFF, 0x12, 0xF5, 0x9A, 0x38, 0xD9,
+    0xF5, 0xFF, 0xF5, 0xE2, 0x5E, 0x77, 0xEF, 0xE2, 0xAC, 0x35, 0xCA, 0xF5, 0xC5, 0x55, 0xB9, 0x81,
+    0xFF, 0x09, 0xF5, 0xEF, 0xFF, 0xE5, 0x33, 0x40, 0x31, 0xC8, 0xE2, 0xF5, 0x81, 0xFF, 0x28, 0x81,
+    0x4B, 0xE2, 0xFF, 0xFE, 0xF5, 0x61, 0x52, 0xDB, 0xE2, 0xAB, 0x56, 0xC5, 0xF5, 0xAD, 0x30, 0xC6,
+    0xEF, 0xCB, 0x50, 0xAA, 0xB6, 0x4E, 0x6B, 0x3E, 0xDB, 0xEF, 0xB2, 0x46, 0xAD, 0xDB, 0xF5, 0xFF,
+    0xEF, 0x7C, 0x3E, 0xD8, 0x63, 0x60, 0xDB, 0xEF, 0x88, 0xFF, 0x1C, 0xEF, 0x45, 0x69, 0xDB, 0xEA,
+    0xFF, 0xF8, 0xFA, 0x32, 0xAD, 0xDB, 0xB9, 0x63, 0xAA, 0xCB, 0x5F, 0x63, 0xEF, 0xDB, 0x56, 0xB1,
+    0xE2, 0xCB, 0x9A, 0xEA, 0xFF, 0xB8, 0x56, 0xD9, 0x81, 0xF5, 0x1E, 0x99, 0x4D, 0xCB, 0xF2, 0x9F,
+    0xE2, 0xCB, 0x58, 0x7A, 0xEF, 0xD8, 0x23, 0xCB, 0xE2, 0xBC, 0x66, 0xCB, 0xDB, 0x57, 0x91, 0xEF,
+    0xAD, 0x59, 0xA8, 0xFF, 0xC8, 0x2F, 0xD8, 0xF5, 0xB5, 0xC5, 0x81, 0xFF, 0x04, 0xFE, 0xFD, 0xED,
+    0xC1, 0x95, 0x81, 0x8A, 0x00, 0x95, 0x83, 0x8A, 0x82, 0x88, 0x88, 0x8A, 0x81, 0xB4, 0x00, 0x88,
+    0x81, 0x94, 0x81, 0xA2, 0x04, 0x94, 0xA2, 0xA5, 0xA3, 0xA5, 0x81, 0xA2, 0x00, 0x94, 0x81, 0x85,
+    0x01, 0x93, 0x84, 0x81, 0x93, 0x00, 0x98, 0x81, 0xA7, 0x85, 0x98, 0x81, 0xA0, 0x81, 0x98, 0x09,
+    0xA0, 0xC2, 0xF3, 0xFE, 0xFF, 0xF5, 0xAB, 0x4C, 0xD9, 0xF5, 0x81, 0xFF, 0x0B, 0xEF, 0x66, 0x81,
+    0xF5, 0xEF, 0xC8, 0x30, 0xDB, 0xF5, 0xDF, 0x4E, 0xB9, 0x81, 0xFF, 0x11, 0xD7, 0xEA, 0xFF, 0xF1,
+    0x3E, 0x6C, 0x3B, 0x78, 0xEF, 0xF5, 0xF8, 0xFA, 0x5D, 0x73, 0xEF, 0xFF, 0xF9, 0xF8, 0x81, 0x61,
+    0x16, 0xE2, 0xEF, 0xC8, 0x5D, 0xCD, 0xFF, 0xCB, 0x3D, 0xC6, 0xE2, 0xCB, 0x59, 0x99, 0xDB, 0x4E,
+    0x3F, 0x38, 0xCB, 0xE2, 0x81, 0x46, 0xCB, 0xEF, 0x81, 0xFF, 0x07, 0xEF, 0x99, 0x50, 0xD9, 0x71,
+    0x59, 0xE2, 0xF5, 0x86, 0xFF, 0x17, 0xFA, 0xFF, 0xE2, 0x36, 0x6B, 0xE2, 0xF5, 0xFF, 0xF8, 0xFA,
+    0x32, 0x9C, 0xDB, 0xAB, 0x44, 0x60, 0x72, 0x55, 0x77, 0xE2, 0xCB, 0x56, 0xCD, 0xFF, 0x81, 0xE2,
+    0x04, 0xFA, 0xFF, 0xB8, 0x49, 0xD9, 0x81, 0xF5, 0x1C, 0x99, 0x4D, 0xCB, 0xFF, 0xF2, 0xEF, 0xCB,
+    0x68, 0x7A, 0xEF, 0xD9, 0x27, 0xCB, 0xEF, 0xB1, 0x63, 0xDB, 0xE2, 0x5E, 0x91, 0xFF, 0xCA, 0x57,
+    0xDF, 0xFF, 0xDB, 0x3C, 0xD8, 0xFF, 0x81, 0xF5, 0x81, 0xFF, 0x04, 0xFE, 0xFC, 0xF6, 0xC3, 0x94,
+    0x81, 0x87, 0x01, 0x86, 0x87, 0x83, 0x86, 0x83, 0x98, 0x81, 0x86, 0x84, 0x98, 0x82, 0x86, 0x00,
+    0xA7, 0x81, 0xB3, 0x01, 0x98, 0x93, 0x81, 0x84, 0x81, 0x93, 0x00, 0x98, 0x82, 0xA7, 0x00, 0x98,
+    0x83, 0xA7, 0x81, 0x98, 0x00, 0x93, 0x85, 0x98, 0x01, 0xA0, 0xA7, 0x81, 0x98, 0x02, 0xA0, 0xC2,
+    0xEE, 0x81, 0xFF, 0x04, 0xF5, 0x8B, 0x44, 0xD8, 0xFA, 0x81, 0xF5, 0x1C, 0xE2, 0x64, 0x77, 0xEF,
+    0xE2, 0xB9, 0x35, 0xDB, 0xF5, 0xCD, 0x4E, 0xAA, 0xE2, 0xF5, 0x66, 0xAA, 0xFA, 0xD7, 0x4E, 0x75,
+    0x91, 0x54, 0xD9, 0xEF, 0xFF, 0xE5, 0x43, 0xB9, 0xE2, 0x82, 0xFF, 0x18, 0x64, 0x52, 0xDB, 0xEF,
+    0xC7, 0x55, 0xBE, 0xFF, 0xD8, 0x30, 0xC6, 0xEF, 0xCB, 0x59, 0x97, 0xEF, 0x6A, 0x28, 0x3F, 0xDB,
+    0xEF, 0x97, 0x4E, 0xCB, 0xE2, 0x81, 0xFF, 0x06, 0xEF, 0x7B, 0x57, 0xDB, 0xA8, 0x46, 0xAB, 0x89,
+    0xFF, 0x04, 0xEF, 0x45, 0x7B, 0xE2, 0xEF, 0x81, 0xFF, 0x0D, 0xFA, 0x32, 0x9C, 0xE2, 0x9B, 0x44,
+    0x73, 0x99, 0x96, 0xD7, 0xF5, 0xCA, 0x56, 0xCD, 0x82, 0xE2, 0x25, 0xF5, 0xFF, 0xB8, 0x49, 0xD9,
+    0xF5, 0xEF, 0x99, 0x59, 0xE2, 0xF5, 0xFF, 0xEF, 0xCB, 0x59, 0x73, 0xE2, 0xC7, 0x27, 0xCB, 0xE2,
+    0x83, 0x63, 0xDB, 0xE2, 0x5D, 0x91, 0xFF, 0xCA, 0x4F, 0xB1, 0xF2, 0xDB, 0x36, 0xD7, 0xFF, 0xEF,
+    0xF5, 0x81, 0xFF, 0x06, 0xFA, 0xFE, 0xE9, 0xBD, 0x85, 0x98, 0xA4, 0x84, 0x98, 0x00, 0xA7, 0x8C,
+    0x98, 0x83, 0x93, 0x81, 0x98, 0x84, 0xA7, 0x82, 0x98, 0x81, 0x93, 0x87, 0x98, 0x00, 0xA7, 0x82,
+    0x98, 0x81, 0xA0, 0x04, 0x98, 0x93, 0xA0, 0xC2, 0xF4, 0x82, 0xFF, 0x02, 0x99, 0x4B, 0xD9, 0x81,
+    0xFF, 0x03, 0xF5, 0xE2, 0x65, 0x77, 0x81, 0xEF, 0x18, 0xB9, 0x2F, 0xE2, 0xFF, 0xB6, 0x4E, 0x9C,
+    0xEF, 0xE2, 0x37, 0x79, 0xF5, 0xD9, 0x3E, 0x75, 0xDB, 0x43, 0x6A, 0xE2, 0xEF, 0x96, 0x46, 0xCB,
+    0xE2, 0xF5, 0x81, 0xFF, 0x1D, 0x67, 0x52, 0xE2, 0xEF, 0xC8, 0x4B, 0xD3, 0xF5, 0xCB, 0x30, 0xB6,
+    0xF5, 0xDB, 0x4E, 0xB2, 0xEF, 0xCA, 0x27, 0x3D, 0xCB, 0xE2, 0x89, 0x4E, 0xCB, 0xE2, 0xF5, 0xFF,
+    0xF5, 0x79, 0x4D, 0x81, 0xE2, 0x02, 0x57, 0x68, 0xF5, 0x87, 0xFF, 0x03, 0xF5, 0xE2, 0x49, 0x79,
+    0x81, 0xE2, 0x81, 0xFF, 0x36, 0xFA, 0x32, 0xAD, 0xE2, 0xAB, 0x63, 0xC8, 0xE2, 0xC8, 0xEA, 0xF5,
+    0xC8, 0x5E, 0xCC, 0xF5, 0xDB, 0x99, 0xF5, 0xFF, 0xB6, 0x55, 0xEA, 0xFF, 0xEF, 0x96, 0x58, 0xE2,
+    0xFA, 0xFF, 0xE2, 0xDB, 0x57, 0x7A, 0xEF, 0xC7, 0x2F, 0xCB, 0xE2, 0x96, 0x64, 0xDB, 0xE2, 0x4D,
+    0x91, 0xEF, 0xCB, 0x58, 0xB1, 0xF5, 0xCB, 0x36, 0xD9, 0xEF, 0xB9, 0xC7, 0x82, 0xFF, 0x05, 0xFE,
+    0xF3, 0xC0, 0x85, 0x93, 0xA7, 0x83, 0x93, 0x00, 0xA0, 0x8B, 0x93, 0x00, 0xA7, 0x82, 0xB3, 0x81,
+    0xA7, 0x81, 0xB3, 0x83, 0x98, 0x82, 0x93, 0x00, 0x84, 0x83, 0x93, 0x00, 0xA0, 0x82, 0xA7, 0x85,
+    0x98, 0x81, 0xA0, 0x04, 0x98, 0x93, 0xA1, 0xC2, 0xF4, 0x81, 0xFF, 0x03, 0xF5, 0x8B, 0x4D, 0xCA,
+    0x82, 0xEF, 0x02, 0xE2, 0x65, 0x66, 0x81, 0xE2, 0x34, 0xAB, 0x36, 0xCA, 0xEF, 0xC5, 0x46, 0x8D,
+    0xE2, 0xDB, 0x32, 0x74, 0xEF, 0xE2, 0x46, 0x75, 0xE2, 0x72, 0x38, 0xCB, 0xDB, 0x58, 0x50, 0xCB,
+    0xE2, 0xEF, 0xFF, 0xF5, 0x60, 0x53, 0xDB, 0xE2, 0x9C, 0x55, 0xB5, 0xF5, 0xCB, 0x43, 0xB5, 0xF5,
+    0xDB, 0x4B, 0xB2, 0xEF, 0xE2, 0x38, 0x46, 0xE2, 0xEF, 0x97, 0x4C, 0xCB, 0xEF, 0xF5, 0x81, 0xFF,
+    0x06, 0x89, 0x55, 0xEA, 0xEF, 0x69, 0x5E, 0xEA, 0x88, 0xFF, 0x1C, 0xEF, 0x37, 0x79, 0xE2, 0xEF,
+    0xFF, 0xFA, 0xF2, 0x49, 0x8D, 0xE2, 0xAA, 0x57, 0xC8, 0xE2, 0x78, 0x91, 0xDB, 0xCB, 0x64, 0xB1,
+    0xF5, 0x9B, 0x4B, 0xE2, 0xEA, 0xB6, 0x4B, 0xC6, 0x81, 0xF5, 0x1E, 0x9F, 0x56, 0xDB, 0xF5, 0xFF,
+    0xEF, 0xDB, 0x4F, 0x7A, 0xEF, 0xC6, 0x36, 0xCB, 0xE2, 0xA8, 0x64, 0xCA, 0xDB, 0x4F, 0x81, 0xEF,
+    0xAD, 0x4F, 0xB9, 0xEF, 0x9C, 0x32, 0xCA, 0xDB, 0x68, 0x83, 0x83, 0xFF, 0x04, 0xED, 0xC0, 0x85,
+    0x98, 0xB3, 0x81, 0xA7, 0x82, 0xA0, 0x8A, 0xAF, 0x04, 0xB3, 0x82, 0x9E, 0x93, 0xA0, 0x83, 0x93,
+    0x84, 0xA7, 0x83, 0xA4, 0x83, 0xA7, 0x88, 0x98, 0x06, 0xA7, 0xA0, 0x98, 0x93, 0xA1, 0xC2, 0xF4,
+    0x81, 0xFF, 0x03, 0xF5, 0x8B, 0x37, 0x69, 0x81, 0x7B, 0x81, 0xCB, 0x20, 0x5F, 0x4E, 0x6A, 0x75,
+    0x60, 0x38, 0x9C, 0xE2, 0xAB, 0x46, 0x51, 0x74, 0x7B, 0x32, 0x74, 0xE2, 0xC8, 0x4D, 0x9B, 0xE2,
+    0xC7, 0x44, 0x8C, 0xAD, 0x4F, 0x50, 0x7B, 0x8B, 0xB5, 0xD7, 0xF5, 0x5F, 0x60, 0x81, 0xE2, 0x1F,
+    0xC8, 0x56, 0xB7, 0xEF, 0xC8, 0x3B, 0xCD, 0xFF, 0xD9, 0x66, 0xB2, 0xF5, 0xEF, 0x69, 0x4A, 0xDB,
+    0xEF, 0x9F, 0x3B, 0x79, 0x89, 0xB2, 0xEA, 0xFF, 0x99, 0x5D, 0xEA, 0xEF, 0xAA, 0x6F, 0xD7, 0xFA,
+    0x85, 0xFF, 0x23, 0xFA, 0xF5, 0xEF, 0x35, 0x5E, 0x96, 0x9F, 0xCD, 0xF8, 0xFF, 0x49, 0x8C, 0xE2,
+    0xB6, 0x4B, 0x78, 0x9B, 0x4E, 0x71, 0xDB, 0xCB, 0x59, 0x66, 0x7A, 0x60, 0x46, 0xDB, 0xE2, 0x9C,
+    0x4D, 0x73, 0xD9, 0xEF, 0xA6, 0x6F, 0xE2, 0x81, 0xFF, 0x06, 0xF5, 0xDB, 0x65, 0x64, 0x96, 0x77,
+    0x3C, 0x81, 0xDB, 0x10, 0x96, 0x66, 0xCB, 0xE2, 0x58, 0x83, 0xEF, 0xAD, 0x58, 0xB8, 0xEF, 0xAC,
+    0x37, 0x68, 0x79, 0x46, 0x72, 0x83, 0xFF, 0x02, 0xED, 0xC0, 0xA0, 0x81, 0x98, 0x01, 0x93, 0xA7,
+    0x82, 0xA0, 0x84, 0xAF, 0x82, 0xA0, 0x82, 0xAF, 0x02, 0xA0, 0xA4, 0xB3, 0x82, 0xA0, 0x82, 0xA7,
+    0x88, 0xA0, 0x01, 0x93, 0xA0, 0x8A, 0x98, 0x07, 0xA7, 0xA0, 0x98, 0xA0, 0xA1, 0xC2, 0xEE, 0xFE,
+    0x81, 0xFF, 0x08, 0xC7, 0x36, 0x4D, 0x58, 0x65, 0xDB, 0xE2, 0xAA, 0x4D, 0x81, 0x44, 0x0E, 0x4D,
+    0x66, 0xE2, 0xEF, 0xC8, 0x78, 0x4A, 0x42, 0x58, 0x4F, 0xCA, 0xEF, 0xD9, 0x72, 0xC6, 0x81, 0xF5,
+    0x27, 0x81, 0x69, 0xCB, 0x58, 0x4B, 0x45, 0x55, 0x70, 0xD3, 0xFF, 0x83, 0x73, 0xDB, 0xEF, 0xCA,
+    0x70, 0xE4, 0xFF, 0xE2, 0x65, 0xD7, 0xFF, 0xE2, 0x83, 0xCD, 0xFF, 0xF5, 0xD8, 0x81, 0xEF, 0xFF,
+    0xDF, 0x4A, 0x63, 0x54, 0x6F, 0xE5, 0xF5, 0xB8, 0x71, 0x81, 0xFF, 0x03, 0xDB, 0x72, 0xD3, 0xFA,
+    0x87, 0xFF, 0x26, 0xF5, 0x56, 0x6E, 0x55, 0x54, 0xCC, 0xF8, 0xFF, 0x56, 0x9C, 0xF5, 0xEA, 0x5E,
+    0x64, 0x4D, 0x4B, 0xAA, 0xEF, 0xE2, 0x68, 0x5E, 0x5D, 0x4F, 0x68, 0xE2, 0xF5, 0xDB, 0x58, 0x5D,
+    0xA6, 0xEF, 0xCE, 0x80, 0xEF, 0xFF, 0xFA, 0xFF, 0xE2, 0x89, 0x81, 0x6E, 0x01, 0x54, 0x5E, 0x81,
+    0xEF, 0x0D, 0xB1, 0x9F, 0xE2, 0xEF, 0x80, 0xB2, 0xF5, 0xCB, 0x68, 0xC6, 0xF5, 0xE2, 0x65, 0x55,
+    0x81, 0x5E, 0x00, 0xB8, 0x82, 0xFF, 0x04, 0xFE, 0xE9, 0xC0, 0xA1, 0x86, 0x81, 0xA7, 0x85, 0x98,
+    0x82, 0xA0, 0x01, 0x93, 0xA0, 0x82, 0x93, 0x87, 0xA0, 0x00, 0xA7, 0x85, 0xA0, 0x81, 0xA7, 0x89,
+    0x98, 0x00, 0xA7, 0x83, 0x98, 0x81, 0xA0, 0x81, 0xA7, 0x02, 0xA1, 0xC2, 0xF4, 0x82, 0xFE, 0x92,
+    0xFF, 0x02, 0xF5, 0xEF, 0xF5, 0x86, 0xFF, 0x81, 0xF5, 0x81, 0xEF, 0x00, 0xF5, 0x84, 0xFF, 0x00,
+    0xF5, 0x8F, 0xFF, 0x00, 0xF5, 0x82, 0xFF, 0x81, 0xF5, 0x83, 0xFF, 0x01, 0xEF, 0xF5, 0x81, 0xFF,
+    0x81, 0xF5, 0x8B, 0xFF, 0x81, 0xF5, 0x83, 0xFF, 0x01, 0xF5, 0xEF, 0x81, 0xFF, 0x81, 0xF5, 0x97,
+    0xFF, 0x81, 0xF5, 0x81, 0xFF, 0x81, 0xF5, 0x8C, 0xFF, 0x00, 0xF5, 0x86, 0xFF, 0x03, 0xFE, 0xEB,
+    0xBF, 0xA2, 0x83, 0x93, 0x00, 0x85, 0x85, 0xA0, 0x8B, 0x85, 0x86, 0x94, 0x83, 0x85, 0x88, 0xA0,
+    0x83, 0x85, 0x81, 0xA0, 0x81, 0x92, 0x04, 0x9E, 0x92, 0x90, 0xBF, 0xEB, 0x82, 0xFE, 0x99, 0xFF,
+    0x81, 0xFA, 0xA5, 0xFF, 0x81, 0xF5, 0x81, 0xFF, 0x81, 0xF5, 0x92, 0xFF, 0x00, 0xF5, 0xB7, 0xFF,
+    0x02, 0xF4, 0xE1, 0xD5, 0x81, 0xC3, 0x00, 0xC2, 0x82, 0xC0, 0x00, 0xC2, 0x81, 0xC0, 0x01, 0xBF,
+    0xC1, 0x8F, 0xBF, 0x8E, 0xC0, 0x83, 0xBF, 0x82, 0xC0, 0x83, 0xBF, 0x02, 0xC1, 0xD6, 0xF9, 0x9C,
+    0xFF, 0x00, 0xFA, 0xA6, 0xFF, 0x00, 0xF5, 0xD0, 0xFF, 0x02, 0xFE, 0xF4, 0xED, 0x82, 0xF6, 0x83,
+    0xED, 0x81, 0xF3, 0x81, 0xF4, 0x00, 0xEE, 0x9A, 0xF3, 0x84, 0xEE, 0x82, 0xF3, 0x81, 0xED, 0x81,
+    0xEE, 0x00, 0xF3, 0x81, 0xEE, 0x00, 0xFC, 0x86, 0xFF, 0x00, 0xF5, 0x84, 0xFF, 0x00, 0xF5, 0xAA,
+    0xFF, 0x00, 0xFE, 0xDD, 0xFF, 0x00, 0xFE, 0x82, 0xFD, 0x86, 0xFE, 0x82, 0xFF, 0x98, 0xFE, 0x88,
+    0xFF, 0x83, 0xFE, 0x82, 0xFF, 0x81, 0xFE, 0x9F, 0xFF, 0x00, 0xFE, 0xF7, 0xFF, 0x83, 0xFE, 0xB6,
+    0xFF, 0x00, 0xFA, 0x83, 0xFF, 0x81, 0xF5, 0x83, 0xFF, 0x81, 0xF5, 0x8C, 0xFF, 0x00, 0xF5, 0x81,
+    0xFF, 0x01, 0xF5, 0xFE, 0x84, 0xFF, 0x00, 0xF5, 0xA2, 0xFF, 0x00, 0xFA, 0x96, 0xFF, 0x00, 0xFA,
+    0xB3, 0xFF,
+};
+
+const lcd_image_t gImage_lingzhi_rle = {
+    .width = 210,
+    .height = 62,
+    .format = LCD_IMAGE_INDEX_RLE,
+    .bpp = 8,
+    .palette_num = 256,
+    .palette = gImage_lingzhi_rle_palette,
+    .data = gImage_lingzhi_rle_data,
+    .data_len = sizeof(gImage_lingzhi_rle_data),
+};
@@ -0,0 +1,386 @@
+#!/usr/bin/env python3
+# Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""
+从TrueType等宽字体生成4-bpp抗锯齿ASCII母版字库(src/lcd_font_aa.c)。
+驱动启动时由src/lcd_font.c把母版缩小为其余字号，只需生成最大的一个字号。
+
+不依赖第三方库：直接解析TTF的glyf轮廓，按非零环绕规则做扫描线填充，
+每个像素在垂直方向取SUBROWS条子扫描线、水平方向按精确长度计算覆盖率，
+再量化为0~15。字模宽度为字号的一半，与1-bpp的ASCII字库相同。
+字模逐行存放，每行占(width + 1) / 2个字节，左边的像素在高4位。
+
+版权声明取自字体name表的Copyright项，可用--copyright覆盖；许可证名称和
+许可证文件由--license、--license-file指定，许可证文件须随字库一起发布。
+
+用法：
+    python3 lcd_font_aa_gen.py --ttf SourceCodePro-Bold.ttf \
+        --size 32 --source "Source Code Pro Bold" > ../src/lcd_font_aa.c
+"""
+
+import argparse
+import struct
+import sys
+
+# 每个像素的子扫描线数
+SUBROWS = 16
+# 二次贝塞尔曲线的分段数
+CURVE_STEPS = 8
+ASCII_FIRST = 0x20
+ASCII_LAST = 0x7E
+
+# 字库是字体的修改版本，文件头写入字体本身的版权和许可证，而不是本工程的Apache-2.0
+LICENSE = """/*
+ * %(copyright)s
+ *
+ * This Font Software is licensed under the %(license)s.
+ * The license text is in %(license_file)s at the root of this sample.
+ */"""
+
+
+class TrueType:
+    """只读取生成字模需要的表：head、hhea、hmtx、cmap、loca、glyf"""
+
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            self.data = f.read()
+        num = struct.unpack(">H", self.data[4:6])[0]
+        self.tables = {}
+        for i in range(num):
+            tag, _, off, length = struct.unpack(">4sIII", self.data[12 + 16 * i:28 + 16 * i])
+            self.tables[tag.decode("latin-1")] = (off, length)
+        if "glyf" not in self.tables:
+            raise ValueError("%s没有glyf表(只支持TrueType轮廓)" % path)
+
+        head = self.tables["head"][0]
+        self.units_per_em = self.u16(head + 18)
+        loc_format = self.s16(head + 50)
+        hhea = self.tables["hhea"][0]
+        self.ascender = self.s16(hhea + 4)
+        self.descender = self.s16(hhea + 6)
+        num_hmetrics = self.u16(hhea + 34)
+        num_glyphs = self.u16(self.tables["maxp"][0] + 4)
+
+        hmtx = self.tables["hmtx"][0]
+        self.advances = [self.u16(hmtx + 4 * i) for i in range(num_hmetrics)]
+
+        loca = self.tables["loca"][0]
+        if loc_format == 0:
+            self.loca = [self.u16(loca + 2 * i) * 2 for i in range(num_glyphs + 1)]
+        else:
+            self.loca = [self.u32(loca + 4 * i) for i in range(num_glyphs + 1)]
+        self.cmap = self.parse_cmap()
+        self.copyright = self.name_string(0)
+
+    def u16(self, off):
+        return struct.unpack(">H", self.data[off:off + 2])[0]
+
+    def s16(self, off):
+        return struct.unpack(">h", self.data[off:off + 2])[0]
+
+    def u32(self, off):
+        return struct.unpack(">I", self.data[off:off + 4])[0]
+
+    def name_string(self, name_id):
+        """读取name表中的字符串，优先Windows Unicode编码，没有时返回空串"""
+        if "name" not in self.tables:
+            return ""
+        base = self.tables["name"][0]
+        strings = base + self.u16(base + 4)
+        found = ""
+        for i in range(self.u16(base + 2)):
+            rec = base + 6 + 12 * i
+            platform, encoding, _, nid, length, off = struct.unpack(">HHHHHH", self.data[rec:rec + 12])
+            if nid != name_id:
+                continue
+            raw = self.data[strings + off:strings + off + length]
+            if platform == 3 and encoding in (0, 1):
+                return raw.decode("utf-16-be")
+            if platform == 1 and not found:
+                found = raw.decode("latin-1")
+        return found
+
+    def parse_cmap(self):
+        """解析Unicode BMP的format 4子表"""
+        base = self.tables["cmap"][0]
+        for i in range(self.u16(base + 2)):
+            platform = self.u16(base + 4 + 8 * i)
+            encoding = self.u16(base + 6 + 8 * i)
+            off = base + self.u32(base + 8 + 8 * i)
+            if (platform, encoding) in ((3, 1), (0, 3)) and self.u16(off) == 4:
+                break
+        else:
+            raise ValueError("没有找到format 4的Unicode cmap")
+
+        segs = self.u16(off + 6) // 2
+        ends = off + 14
+        starts = ends + 2 * segs + 2
+        deltas = starts + 2 * segs
+        ranges = deltas + 2 * segs
+        cmap = {}
+        for s in range(segs):
+            end = self.u16(ends + 2 * s)
+            start = self.u16(starts + 2 * s)
+            delta = self.u16(deltas + 2 * s)
+            range_off = self.u16(ranges + 2 * s)
+            for code in range(start, min(end, 0xFFFE) + 1):
+                if range_off == 0:
+                    glyph = (code + delta) & 0xFFFF
+                else:
+                    glyph = self.u16(ranges + 2 * s + range_off + 2 * (code - start))
+                    if glyph != 0:
+                        glyph = (glyph + delta) & 0xFFFF
+                cmap[code] = glyph
+        return cmap
+
+    def advance(self, glyph):
+        return self.advances[min(glyph, len(self.advances) - 1)]
+
+    def contours(self, glyph):
+        """返回字形的轮廓列表，每个轮廓为[(x, y, 是否在曲线上)]"""
+        off = self.tables["glyf"][0] + self.loca[glyph]
+        if self.loca[glyph + 1] == self.loca[glyph]:
+            return []
+        num = self.s16(off)
+        if num < 0:
+            return self.composite(off + 10)
+
+        p = off + 10
+        end_pts = [self.u16(p + 2 * i) for i in range(num)]
+        p += 2 * num
+        p += 2 + self.u16(p)
+        count = end_pts[-1] + 1 if num else 0
+
+        flags = []
+        while len(flags) < count:
+            flag = self.data[p]
+            p += 1
+            repeat = 1
+            if flag & 0x08:
+                repeat += self.data[p]
+                p += 1
+            flags.extend([flag] * repeat)
+
+        def coords(short_bit, same_bit):
+            nonlocal p
+            values = []
+            value = 0
+            for flag in flags[:count]:
+                if flag & short_bit:
+                    delta = self.data[p]
+                    p += 1
+                    value += delta if flag & same_bit else -delta
+                elif not flag & same_bit:
+                    value += self.s16(p)
+                    p += 2
+                values.append(value)
+            return values
+
+        xs = coords(0x02, 0x10)
+        ys = coords(0x04, 0x20)
+        result = []
+        start = 0
+        for end in end_pts:
+            result.append([(xs[i], ys[i], flags[i] & 1) for i in range(start, end + 1)])
+            start = end + 1
+        return result
+
+    def composite(self, p):
+        """组合字形：按偏移和缩放合并各部件的轮廓"""
+        result = []
+        while True:
+            flags = self.u16(p)
+            glyph = self.u16(p + 2)
+            p += 4
+            if flags & 0x01:
+                dx, dy = self.s16(p), self.s16(p + 2)
+                p += 4
+            else:
+                dx, dy = struct.unpack(">bb", self.data[p:p + 2])
+                p += 2
+            a, b, c, d = 1.0, 0.0, 0.0, 1.0
+            if flags & 0x08:
+                a = d = self.s16(p) / 16384.0
+                p += 2
+            elif flags & 0x40:
+                a, d = self.s16(p) / 16384.0, self.s16(p + 2) / 16384.0
+                p += 4
+            elif flags & 0x80:
+                a, b, c, d = [self.s16(p + 2 * i) / 16384.0 for i in range(4)]
+                p += 8
+            for contour in self.contours(glyph):
+                result.append([(a * x + c * y + dx, b * x + d * y + dy, on) for x, y, on in contour])
+            if not flags & 0x20:
+                return result
+
+
+def flatten(contour):
+    """把二次B样条轮廓展开为闭合折线"""
+    n = len(contour)
+    if n == 0:
+        return []
+    # 从一个曲线上的点开始，连续两个控制点之间插入隐含的曲线上的点
+    start = next((i for i in range(n) if contour[i][2]), None)
+    if start is None:
+        x0 = (contour[0][0] + contour[1][0]) / 2.0
+        y0 = (contour[0][1] + contour[1][1]) / 2.0
+        pts = [(x0, y0, 1)] + contour[1:] + contour[:1]
+    else:
+        pts = contour[start:] + contour[:start]
+    pts = pts + [pts[0]]
+
+    out = [(pts[0][0], pts[0][1])]
+    ctrl = None
+    for x, y, on in pts[1:]:
+        if on:
+            if ctrl is None:
+                out.append((x, y))
+            else:
+                out.extend(quad(out[-1], ctrl, (x, y)))
+                ctrl = None
+        else:
+            if ctrl is not None:
+                mid = ((ctrl[0] + x) / 2.0, (ctrl[1] + y) / 2.0)
+                out.extend(quad(out[-1], ctrl, mid))
+            ctrl = (x, y)
+    if ctrl is not None:
+        out.extend(quad(out[-1], ctrl, out[0]))
+    return out
+
+
+def quad(p0, p1, p2):
+    pts = []
+    for i in range(1, CURVE_STEPS + 1):
+        t = i / float(CURVE_STEPS)
+        u = 1.0 - t
+        pts.append((u * u * p0[0] + 2 * u * t * p1[0] + t * t * p2[0],
+                    u * u * p0[1] + 2 * u * t * p1[1] + t * t * p2[1]))
+    return pts
+
+
+def rasterize(edges, width, height):
+    """按非零环绕规则计算每个像素的覆盖率(0.0~1.0)"""
+    cover = [[0.0] * width for _ in range(height)]
+    for row in range(height * SUBROWS):
+        y = (row + 0.5) / SUBROWS
+        crossings = []
+        for (x0, y0), (x1, y1) in edges:
+            if (y0 <= y < y1) or (y1 <= y < y0):
+                x = x0 + (y - y0) * (x1 - x0) / (y1 - y0)
+                crossings.append((x, 1 if y1 > y0 else -1))
+        crossings.sort()
+        winding = 0
+        line = cover[row // SUBROWS]
+        for i, (x, direction) in enumerate(crossings):
+            winding += direction
+            if winding == 0 or i + 1 >= len(crossings):
+                continue
+            # [x, next_x)在轮廓内，按长度累加到各像素
+            left = max(x, 0.0)
+            right = min(crossings[i + 1][0], float(width))
+            while left < right:
+                px = int(left)
+                step = min(right, px + 1.0) - left
+                line[px] += step / SUBROWS
+                left += step
+    return cover
+
+
+def render(font, code, size, gamma):
+    """生成一个字符的4-bpp字模，返回字节列表"""
+    width = size // 2
+    glyph = font.cmap.get(code, 0)
+    # 按行高和字宽中较紧的一个缩放，字形在字模中居中
+    scale = min(size / float(font.ascender - font.descender), width / float(font.advance(glyph)))
+    baseline = round((size + (font.ascender + font.descender) * scale) / 2.0)
+    xoff = (width - font.advance(glyph) * scale) / 2.0
+
+    edges = []
+    for contour in font.contours(glyph):
+        pts = [(x * scale + xoff, baseline - y * scale) for x, y in flatten(contour)]
+        edges.extend(zip(pts, pts[1:]))
+    cover = rasterize(edges, width, size)
+
+    stride = (width + 1) // 2
+    data = [0] * (stride * size)
+    for y in range(size):
+        for x in range(width):
+            level = int(round(min(cover[y][x], 1.0) ** gamma * 15))
+            data[y * stride + x // 2] |= level << (4 if x % 2 == 0 else 0)
+    return data
+
+
+def emit(font, size, source, gamma, notice):
+    out = [LICENSE % notice]
+    out.append("/*")
+    out.append(" * 4-bpp抗锯齿ASCII字库，由tools/lcd_font_aa_gen.py从%s的字形生成，" % source)
+    out.append(" * 属于该字体的修改版本，按%s发布，不适用本工程的Apache-2.0许可证。" % notice["short"])
+    out.append(" * 每个像素4位(0为背景色，15为字的颜色)，逐行存放，每行占(width + 1) / 2个字节，")
+    out.append(" * 左边的像素在高4位。该字库是所有ASCII字体的母版，其余字号由lcd_font.c缩小生成")
+    out.append(" */")
+    out.append('#include "lcd_internal.h"')
+    width = size // 2
+    nbytes = (width + 1) // 2 * size
+    out.append("")
+    out.append("/* %d*%d的ASCII码显示 */" % (size, width))
+    out.append("const uint8_t ascii_aa_%d%02d[][%d] = {" % (size, width, nbytes))
+    for i, code in enumerate(range(ASCII_FIRST, ASCII_LAST + 1)):
+        data = render(font, code, size, gamma)
+        comment = ' /* "%s",%d */' % (chr(code), i)
+        if nbytes <= 16:
+            out.append("    {" + ", ".join("0x%02X" % v for v in data) + "}," + comment)
+            continue
+        out.append("    {")
+        for k in range(0, nbytes, 16):
+            line = ", ".join("0x%02X" % v for v in data[k:k + 16]) + ","
+            if k + 16 >= nbytes:
+                line += comment
+            out.append("        " + line)
+        out.append("    },")
+    out.append("};")
+    return "\n".join(out) + "\n"
+
+
+def main():
+    parser = argparse.ArgumentParser(description="生成4-bpp抗锯齿ASCII字库")
+    parser.add_argument("--ttf", required=True, help="TrueType等宽字体文件")
+    parser.add_argument("--size", type=int, default=32,
+                        help="母版字号，须与lcd_internal.h中的LCD_FONT_MASTER_HEIGHT一致，默认32")
+    parser.add_argument("--gamma", type=float, default=1.0,
+                        help="覆盖率的指数，小于1时笔画更粗，默认1.0")
+    parser.add_argument("--source", help="写入注释的字体名称，默认为文件名")
+    parser.add_argument("--copyright", help="字体的版权声明，默认取自name表")
+    parser.add_argument("--license", default="SIL Open Font License, Version 1.1",
+                        help="字体的许可证名称，默认SIL OFL 1.1")
+    parser.add_argument("--license-short", default="SIL OFL 1.1", help="注释中使用的许可证简称")
+    parser.add_argument("--license-file", default="OFL.txt", help="随字库发布的许可证文件，默认OFL.txt")
+    args = parser.parse_args()
+
+    font = TrueType(args.ttf)
+    source = args.source or args.ttf.replace("\\", "/").split("/")[-1]
+    notice = {
+        "copyright": args.copyright or font.copyright,
+        "license": args.license,
+        "short": args.license_short,
+        "license_file": args.license_file,
+    }
+    if not notice["copyright"]:
+        sys.stderr.write("字体没有版权声明，请用--copyright指定\n")
+        return 1
+    sys.stdout.write(emit(font, args.size, source, args.gamma, notice))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,144 @@
+#!/usr/bin/env python3
+# Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""
+从BDF点阵字体生成src/lcd_font.c中的汉字字库。
+
+生成的字库按Unicode码点升序排列，cjk_index[]为各字号共用的索引，
+lcd.c中通过二分查找定位字模。字模格式与原有字库一致：逐行存放，
+每行占(size + 7) / 8个字节，低位在前。
+
+用法：
+    python3 lcd_font_gen.py --font 12:song12.bdf --font 16:song16.bdf \
+        --font 24:song24.bdf --font 32:song32.bdf --text "小凌派" > cjk.inc
+"""
+
+import argparse
+import sys
+
+
+def parse_bdf(path):
+    """解析BDF字体，返回(字体上沿, {码点: (宽, 高, x偏移, y偏移, 行数据列表)})"""
+    glyphs = {}
+    ascent = 0
+    with open(path, encoding="latin-1") as f:
+        lines = iter(f.read().splitlines())
+    code = None
+    bbx = None
+    for line in lines:
+        words = line.split()
+        if not words:
+            continue
+        if words[0] == "FONT_ASCENT":
+            ascent = int(words[1])
+        elif words[0] == "ENCODING":
+            code = int(words[1])
+        elif words[0] == "BBX":
+            bbx = [int(v) for v in words[1:5]]
+        elif words[0] == "BITMAP":
+            rows = []
+            for row in lines:
+                if row.startswith("ENDCHAR"):
+                    break
+                rows.append(int(row, 16) << (32 - len(row) * 4))
+            if code is not None and bbx is not None:
+                glyphs[code] = (bbx[0], bbx[1], bbx[2], bbx[3], rows)
+            code = None
+            bbx = None
+    return ascent, glyphs
+
+
+def rasterize(ascent, glyph, size):
+    """将BDF字形放入size*size的字模，返回字节列表"""
+    width, height, xoff, yoff, rows = glyph
+    stride = (size + 7) // 8
+    mask = [0] * (stride * size)
+    top = ascent - (height + yoff)
+    for row in range(height):
+        y = top + row
+        if y < 0 or y >= size:
+            continue
+        for col in range(width):
+            x = xoff + col
+            if x < 0 or x >= size:
+                continue
+            if rows[row] & (1 << (31 - col)):
+                mask[y * stride + x // 8] |= 1 << (x % 8)
+    return mask
+
+
+def emit(codes, fonts):
+    out = []
+    out.append("/* 汉字字库的Unicode码点索引，按升序排列，四种字号共用。")
+    out.append(" * 字库由tools/lcd_font_gen.py生成，新增汉字后需重新生成以保持有序，")
+    out.append(" * 第i个码点对应各字号字库中的第i个字模")
+    out.append(" */")
+    out.append("static const uint16_t cjk_index[] = {")
+    for code in codes:
+        out.append('    0x%04X, /* "%s" */' % (code, chr(code)))
+    out.append("};")
+    out.append("")
+    out.append("/* 汉字数目 */")
+    out.append("#define CJK_GLYPH_NUM       (sizeof(cjk_index) / sizeof(cjk_index[0]))")
+    for size in sorted(fonts):
+        ascent, glyphs = fonts[size]
+        nbytes = (size + 7) // 8 * size
+        out.append("")
+        out.append("/* 定义中文字符 %d*%d */" % (size, size))
+        out.append("static const unsigned char cjk_%d%d[][%d] = {" % (size, size, nbytes))
+        for i, code in enumerate(codes):
+            mask = rasterize(ascent, glyphs[code], size)
+            out.append("    {")
+            for k in range(0, nbytes, 16):
+                line = ", ".join("0x%02X" % v for v in mask[k:k + 16]) + ","
+                if k + 16 >= nbytes:
+                    line += ' /* "%s",%d */' % (chr(code), i)
+                out.append("        " + line)
+            out.append("    },")
+        out.append("};")
+    return "\n".join(out) + "\n"
+
+
+def main():
+    parser = argparse.ArgumentParser(description="生成src/lcd_font.c的汉字字库")
+    parser.add_argument("--font", action="append", required=True,
+                        help="字号:BDF文件，例如16:song16.bdf，可重复指定")
+    parser.add_argument("--text", default="", help="需要生成的汉字")
+    parser.add_argument("--text-file", help="包含需要生成的汉字的UTF-8文本文件")
+    args = parser.parse_args()
+
+    text = args.text
+    if args.text_file:
+        with open(args.text_file, encoding="utf-8") as f:
+            text += f.read()
+    # 去重并按码点排序，保证lcd.c中可以二分查找
+    codes = sorted({ord(c) for c in text if ord(c) >= 0x80})
+
+    fonts = {}
+    for spec in args.font:
+        size, path = spec.split(":", 1)
+        fonts[int(size)] = parse_bdf(path)
+
+    for size, (_, glyphs) in fonts.items():
+        missing = [chr(c) for c in codes if c not in glyphs]
+        if missing:
+            sys.stderr.write("%d号字体缺少字形: %s\n" % (size, "".join(missing)))
+            return 1
+
+    sys.stdout.write(emit(codes, fonts))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,252 @@
+#!/usr/bin/env python3
+# Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""
+将图片转换为lcd_image.h中的lcd_image_t图片资源。
+
+支持的编码格式(与lcd_image.h中的定义一致)：
+    raw       RGB565原始数据，高字节在前
+    rle       RGB565游程编码
+    index     调色板索引，每像素1/2/4/8位，每行按字节对齐，高位在前
+    index_rle 8位调色板索引的游程编码
+
+游程编码的每个数据包以1个字节开头：最高位为1表示后面的1个像素重复
+(低7位 + 1)次；最高位为0表示后面跟着(低7位 + 1)个原样像素。
+
+输入可以是PPM(P6)图片、安装了Pillow时的常见图片格式，或者原有的
+C数组图片(--c-array，需同时指定--size)。--colors用于将颜色数量化到
+指定数目以内(有损)，默认自动选择数据最小的无损格式。
+
+用法：
+    python3 tools/lcd_image_gen.py logo.png --name gImage_logo > logo_image.c
+    python3 tools/lcd_image_gen.py --c-array src/picture.c --size 210x62 \
+        --colors 16 --name gImage_lingzhi_rle > picture_rle.c
+"""
+
+import argparse
+import re
+import sys
+
+FORMATS = ("raw", "rle", "index", "index_rle")
+FORMAT_MACROS = {
+    "raw": "LCD_IMAGE_RAW",
+    "rle": "LCD_IMAGE_RLE",
+    "index": "LCD_IMAGE_INDEX",
+    "index_rle": "LCD_IMAGE_INDEX_RLE",
+}
+RLE_MAX = 128
+
+
+def rgb_to_565(r, g, b):
+    return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+
+
+def load_ppm(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    fields = []
+    pos = 0
+    while len(fields) < 4:
+        m = re.compile(rb"\s*(#[^\n]*\n\s*)*(\S+)").match(data, pos)
+        fields.append(m.group(2))
+        pos = m.end()
+    if fields[0] != b"P6" or int(fields[3]) != 255:
+        raise ValueError("只支持8位的P6格式PPM图片")
+    width, height = int(fields[1]), int(fields[2])
+    raw = data[pos + 1:pos + 1 + width * height * 3]
+    pixels = [rgb_to_565(raw[i], raw[i + 1], raw[i + 2]) for i in range(0, len(raw), 3)]
+    return width, height, pixels
+
+
+def load_image(path):
+    if path.lower().endswith((".ppm", ".pnm")):
+        return load_ppm(path)
+    from PIL import Image
+    img = Image.open(path).convert("RGB")
+    pixels = [rgb_to_565(r, g, b) for (r, g, b) in img.getdata()]
+    return img.width, img.height, pixels
+
+
+def load_c_array(path, size):
+    width, height = (int(v) for v in size.lower().split("x"))
+    with open(path, encoding="utf-8", errors="ignore") as f:
+        text = f.read()
+    body = text[text.index("{") + 1:]
+    data = [int(v, 16) for v in re.findall(r"0[xX]([0-9a-fA-F]{2})", body)]
+    if len(data) < width * height * 2:
+        raise ValueError("C数组的数据长度小于图片大小")
+    pixels = [(data[i] << 8) | data[i + 1] for i in range(0, width * height * 2, 2)]
+    return width, height, pixels
+
+
+def quantize(pixels, colors):
+    """中位切分量化，返回量化后的像素"""
+    def channels(c):
+        return ((c >> 11) & 0x1F, (c >> 5) & 0x3F, c & 0x1F)
+
+    boxes = [sorted(set(pixels))]
+    while len(boxes) < colors:
+        boxes.sort(key=len, reverse=True)
+        box = boxes[0]
+        if len(box) < 2:
+            break
+        ranges = [max(channels(c)[k] for c in box) - min(channels(c)[k] for c in box) for k in range(3)]
+        axis = ranges.index(max(ranges))
+        box.sort(key=lambda c: channels(c)[axis])
+        boxes[0:1] = [box[:len(box) // 2], box[len(box) // 2:]]
+
+    mapping = {}
+    for box in boxes:
+        avg = [sum(channels(c)[k] for c in box) // len(box) for k in range(3)]
+        color = (avg[0] << 11) | (avg[1] << 5) | avg[2]
+        for c in box:
+            mapping[c] = color
+    return [mapping[c] for c in pixels]
+
+
+def rle_encode(values, emit_value):
+    out = bytearray()
+    i = 0
+    literal = []
+
+    def flush_literal():
+        while literal:
+            chunk = literal[:RLE_MAX]
+            del literal[:RLE_MAX]
+            out.append(len(chunk) - 1)
+            for v in chunk:
+                out.extend(emit_value(v))
+
+    while i < len(values):
+        run = 1
+        while i + run < len(values) and run < RLE_MAX and values[i + run] == values[i]:
+            run += 1
+        if run >= 2:
+            flush_literal()
+            out.append(0x80 | (run - 1))
+            out.extend(emit_value(values[i]))
+            i += run
+        else:
+            literal.append(values[i])
+            i += 1
+    flush_literal()
+    return bytes(out)
+
+
+def pack_index(indices, width, bpp):
+    out = bytearray()
+    for row in range(0, len(indices), width):
+        byte = 0
+        bits = 0
+        for idx in indices[row:row + width]:
+            byte = (byte << bpp) | idx
+            bits += bpp
+            if bits == 8:
+                out.append(byte)
+                byte = 0
+                bits = 0
+        if bits:
+            out.append(byte << (8 - bits))
+    return bytes(out)
+
+
+def encode(width, pixels, fmt):
+    """返回(调色板, 每像素位数, 数据)，格式不适用时返回None"""
+    be16 = lambda c: bytes(((c >> 8) & 0xFF, c & 0xFF))
+    if fmt == "raw":
+        return [], 16, b"".join(be16(c) for c in pixels)
+    if fmt == "rle":
+        return [], 16, rle_encode(pixels, be16)
+
+    palette = sorted(set(pixels))
+    if len(palette) > 256:
+        return None
+    lookup = {c: i for i, c in enumerate(palette)}
+    indices = [lookup[c] for c in pixels]
+    if fmt == "index":
+        bpp = next(b for b in (1, 2, 4, 8) if len(palette) <= (1 << b))
+        return palette, bpp, pack_index(indices, width, bpp)
+    return palette, 8, rle_encode(indices, lambda v: bytes((v,)))
+
+
+def emit(name, width, height, fmt, palette, bpp, data):
+    out = []
+    out.append("/* %dx%d, %s, 原始大小%d字节, 编码后%d字节 */" %
+               (width, height, FORMAT_MACROS[fmt], width * height * 2, len(data) + len(palette) * 2))
+    if palette:
+        out.append("static const uint16_t %s_palette[%d] = {" % (name, len(palette)))
+        for k in range(0, len(palette), 8):
+            out.append("    " + ", ".join("0x%04X" % c for c in palette[k:k + 8]) + ",")
+        out.append("};")
+        out.append("")
+    out.append("static const uint8_t %s_data[%d] = {" % (name, len(data)))
+    for k in range(0, len(data), 16):
+        out.append("    " + ", ".join("0x%02X" % v for v in data[k:k + 16]) + ",")
+    out.append("};")
+    out.append("")
+    out.append("const lcd_image_t %s = {" % name)
+    out.append("    .width = %d," % width)
+    out.append("    .height = %d," % height)
+    out.append("    .format = %s," % FORMAT_MACROS[fmt])
+    out.append("    .bpp = %d," % bpp)
+    out.append("    .palette_num = %d," % len(palette))
+    out.append("    .palette = %s," % ("%s_palette" % name if palette else "NULL"))
+    out.append("    .data = %s_data," % name)
+    out.append("    .data_len = sizeof(%s_data)," % name)
+    out.append("};")
+    return "\n".join(out) + "\n"
+
+
+def main():
+    parser = argparse.ArgumentParser(description="生成lcd_image_t图片资源")
+    parser.add_argument("image", nargs="?", help="输入图片(PPM或Pillow支持的格式)")
+    parser.add_argument("--c-array", help="从原有的RGB565 C数组读取图片")
+    parser.add_argument("--size", help="C数组图片的尺寸，例如210x62")
+    parser.add_argument("--name", required=True, help="生成的lcd_image_t变量名")
+    parser.add_argument("--format", choices=FORMATS + ("auto",), default="auto", help="编码格式")
+    parser.add_argument("--colors", type=int, default=0, help="将颜色量化到指定数目以内(有损)")
+    args = parser.parse_args()
+
+    if args.c_array:
+        if not args.size:
+            parser.error("--c-array需要同时指定--size")
+        width, height, pixels = load_c_array(args.c_array, args.size)
+    elif args.image:
+        width, height, pixels = load_image(args.image)
+    else:
+        parser.error("需要指定输入图片或--c-array")
+
+    if args.colors:
+        pixels = quantize(pixels, args.colors)
+
+    candidates = FORMATS if args.format == "auto" else (args.format,)
+    best = None
+    for fmt in candidates:
+        result = encode(width, pixels, fmt)
+        if result is None:
+            continue
+        size = len(result[2]) + len(result[0]) * 2
+        if best is None or size < best[0]:
+            best = (size, fmt, result)
+    if best is None:
+        sys.stderr.write("颜色数目超过256，不能使用调色板格式，请指定--colors\n")
+        return 1
+
+    _, fmt, (palette, bpp, data) = best
+    sys.stdout.write(emit(args.name, width, height, fmt, palette, bpp, data))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
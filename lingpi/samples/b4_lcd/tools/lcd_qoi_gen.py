@@ -0,0 +1,122 @@
+#!/usr/bin/env python3
+# Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""
+将图片编码为QOI文件，供lcd_qoi_feed()/lcd_show_qoi()从网络或文件系统
+流式解码显示，设备上不需要整幅图片的内存。
+
+QOI是无损格式，每个像素按与前一个像素的差值、最近出现过的像素表或
+重复次数编码，解码只需要少量整数运算。输出为RGB三通道，Alpha不保存。
+
+输入可以是PPM(P6)图片，或者安装了Pillow时的常见图片格式。
+
+用法：
+    python3 tools/lcd_qoi_gen.py signage.png -o signage.qoi
+"""
+
+import argparse
+import re
+import sys
+
+QOI_OP_INDEX = 0x00
+QOI_OP_DIFF = 0x40
+QOI_OP_LUMA = 0x80
+QOI_OP_RUN = 0xC0
+QOI_OP_RGB = 0xFE
+QOI_RUN_MAX = 62
+QOI_END = bytes([0, 0, 0, 0, 0, 0, 0, 1])
+
+
+def load_ppm(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    fields = []
+    pos = 0
+    while len(fields) < 4:
+        m = re.compile(rb"\s*(#[^\n]*\n\s*)*(\S+)").match(data, pos)
+        fields.append(m.group(2))
+        pos = m.end()
+    if fields[0] != b"P6" or int(fields[3]) != 255:
+        raise ValueError("只支持8位的P6格式PPM图片")
+    width, height = int(fields[1]), int(fields[2])
+    raw = data[pos + 1:pos + 1 + width * height * 3]
+    pixels = [tuple(raw[i:i + 3]) for i in range(0, len(raw), 3)]
+    return width, height, pixels
+
+
+def load_image(path):
+    if path.lower().endswith((".ppm", ".pnm")):
+        return load_ppm(path)
+    from PIL import Image
+    img = Image.open(path).convert("RGB")
+    return img.width, img.height, list(img.getdata())
+
+
+def wrap(v):
+    """8位差值按有符号数处理"""
+    return (v + 128) % 256 - 128
+
+
+def encode(width, height, pixels):
+    out = bytearray(b"qoif")
+    out += width.to_bytes(4, "big") + height.to_bytes(4, "big")
+    out += bytes([3, 0])
+    index = [None] * 64
+    prev = (0, 0, 0)
+    run = 0
+    for i, px in enumerate(pixels):
+        if px == prev:
+            run += 1
+            if run == QOI_RUN_MAX or i == len(pixels) - 1:
+                out.append(QOI_OP_RUN | (run - 1))
+                run = 0
+            continue
+        if run:
+            out.append(QOI_OP_RUN | (run - 1))
+            run = 0
+        r, g, b = px
+        h = (r * 3 + g * 5 + b * 7 + 255 * 11) % 64
+        if index[h] == px:
+            out.append(QOI_OP_INDEX | h)
+        else:
+            index[h] = px
+            dr, dg, db = wrap(r - prev[0]), wrap(g - prev[1]), wrap(b - prev[2])
+            if -2 <= dr <= 1 and -2 <= dg <= 1 and -2 <= db <= 1:
+                out.append(QOI_OP_DIFF | ((dr + 2) << 4) | ((dg + 2) << 2) | (db + 2))
+            elif -32 <= dg <= 31 and -8 <= dr - dg <= 7 and -8 <= db - dg <= 7:
+                out.append(QOI_OP_LUMA | (dg + 32))
+                out.append(((dr - dg + 8) << 4) | (db - dg + 8))
+            else:
+                out += bytes([QOI_OP_RGB, r, g, b])
+        prev = px
+    out += QOI_END
+    return bytes(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="将图片编码为QOI文件")
+    parser.add_argument("image", help="输入图片(PPM或Pillow支持的格式)")
+    parser.add_argument("-o", "--output", required=True, help="输出的QOI文件")
+    args = parser.parse_args()
+
+    width, height, pixels = load_image(args.image)
+    data = encode(width, height, pixels)
+    with open(args.output, "wb") as f:
+        f.write(data)
+    sys.stderr.write("%dx%d, %d字节(RGB565原始数据%d字节)\n" % (width, height, len(data), width * height * 2))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/* 主机仿真用的hal_base.h，只提供LCD驱动用到的GPIO寄存器，寄存器写入由lcd_sim.c解析 */
+#ifndef _HAL_BASE_H_
+#define _HAL_BASE_H_
+
+#include <stdint.h>
+
+#define LZ_SIM_GPIO_PORT_NUM    2
+
+struct GPIO_REG {
+    volatile uint32_t SWPORT_DR_L;
+    volatile uint32_t SWPORT_DR_H;
+    volatile uint32_t SWPORT_DDR_L;
+    volatile uint32_t SWPORT_DDR_H;
+};
+
+extern struct GPIO_REG g_lz_sim_gpio[LZ_SIM_GPIO_PORT_NUM];
+
+#define GPIO0                   (&g_lz_sim_gpio[0])
+#define GPIO1                   (&g_lz_sim_gpio[1])
+
+void lz_sim_write_reg(volatile uint32_t *reg, uint32_t val);
+
+#define WRITE_REG(REG, VAL)     lz_sim_write_reg(&(REG), (VAL))
+
+#endif /* _HAL_BASE_H_ */
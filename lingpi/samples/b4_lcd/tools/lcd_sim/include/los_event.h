@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/* 主机仿真用的los_event.h */
+#ifndef _LOS_EVENT_H
+#define _LOS_EVENT_H
+
+#include "los_task.h"
+
+#define LOS_WAITMODE_AND        4
+#define LOS_WAITMODE_OR         2
+#define LOS_WAITMODE_CLR        1
+
+typedef struct {
+    uint32_t uwEventID;
+} EVENT_CB_S;
+
+unsigned int LOS_EventInit(EVENT_CB_S *eventCB);
+unsigned int LOS_EventRead(EVENT_CB_S *eventCB, uint32_t eventMask, uint32_t mode, uint32_t timeout);
+unsigned int LOS_EventWrite(EVENT_CB_S *eventCB, uint32_t events);
+unsigned int LOS_EventClear(EVENT_CB_S *eventCB, uint32_t events);
+
+#endif /* _LOS_EVENT_H */
@@ -0,0 +1,25 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/* 主机仿真用的los_mux.h */
+#ifndef _LOS_MUX_H
+#define _LOS_MUX_H
+
+#include "los_task.h"
+
+unsigned int LOS_MuxCreate(unsigned int *muxHandle);
+unsigned int LOS_MuxPend(unsigned int muxHandle, uint32_t timeout);
+unsigned int LOS_MuxPost(unsigned int muxHandle);
+
+#endif /* _LOS_MUX_H */
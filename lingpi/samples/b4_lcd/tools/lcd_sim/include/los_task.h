@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/* 主机仿真用的los_task.h，任务由los_shim.c映射为pthread */
+#ifndef _LOS_TASK_H
+#define _LOS_TASK_H
+
+#include <stdint.h>
+
+#define LOS_OK                  0
+#define LOS_NOK                 1
+#define LOS_WAIT_FOREVER        0xFFFFFFFF
+#define LOS_NO_WAIT             0
+
+typedef void *(*TSK_ENTRY_FUNC)(void *arg);
+
+typedef struct {
+    TSK_ENTRY_FUNC pfnTaskEntry;
+    uint16_t usTaskPrio;
+    uint32_t uwArg;
+    uint32_t uwStackSize;
+    char *pcName;
+} TSK_INIT_PARAM_S;
+
+unsigned int LOS_TaskCreate(unsigned int *taskID, TSK_INIT_PARAM_S *initParam);
+unsigned int LOS_Msleep(uint32_t msecs);
+
+#endif /* _LOS_TASK_H */
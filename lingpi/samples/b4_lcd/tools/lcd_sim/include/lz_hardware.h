@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/* 主机仿真用的lz_hardware.h，只声明LCD驱动用到的接口，由lcd_sim.c实现 */
+#ifndef _LZ_HARDWARE_H_
+#define _LZ_HARDWARE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include "los_task.h"
+
+#define LZ_HARDWARE_SUCCESS     0
+#define LZ_HARDWARE_FAILURE     1
+
+#define LZGPIO_LEVEL_LOW        0
+#define LZGPIO_LEVEL_HIGH       1
+#define LZGPIO_LEVEL_KEEP       2
+
+#define LZGPIO_DIR_IN           0
+#define LZGPIO_DIR_OUT          1
+#define LZGPIO_DIR_KEEP         2
+
+#define GPIO0_PC0               16
+#define GPIO0_PC1               17
+#define GPIO0_PC2               18
+#define GPIO0_PC3               19
+#define GPIO0_PC6               22
+#define INVALID_GPIO            0xFFFF
+#define LZ_SIM_GPIO_NUM         160
+
+#define MUX_FUNC4               4
+#define PULL_UP                 1
+#define DRIVE_KEEP              0
+
+#define FUNC_ID_SPI0            0
+#define FUNC_MODE_M1            1
+
+#define SPI_PERWORD_8BITS       8
+#define SPI_MSB                 0
+#define SPI_MODE_3              3
+#define SPI_CMS_ONE_CYCLES      1
+
+typedef uint32_t LzGpioName;
+
+typedef struct {
+    uint32_t gpio;
+    uint32_t func;
+    uint32_t type;
+    uint32_t drv;
+    uint32_t dir;
+    uint32_t val;
+} PinIo;
+
+typedef struct {
+    PinIo cs;
+    PinIo clk;
+    PinIo mosi;
+    PinIo miso;
+    uint32_t id;
+    uint32_t mode;
+} SpiBusIo;
+
+typedef struct {
+    uint32_t bitsPerWord;
+    uint32_t firstBit;
+    uint32_t mode;
+    uint32_t csm;
+    uint32_t speed;
+    bool isSlave;
+} LzSpiConfig;
+
+unsigned int LzGpioInit(LzGpioName gpio);
+unsigned int LzGpioDeinit(LzGpioName gpio);
+unsigned int LzGpioSetDir(LzGpioName gpio, uint32_t dir);
+unsigned int LzGpioSetVal(LzGpioName gpio, uint32_t val);
+
+unsigned int SpiIoInit(SpiBusIo bus);
+unsigned int LzSpiInit(unsigned int id, LzSpiConfig conf);
+unsigned int LzSpiDeinit(unsigned int id);
+unsigned int LzSpiWrite(unsigned int id, unsigned int cs, const void *buf, unsigned int len);
+
+#endif /* _LZ_HARDWARE_H_ */
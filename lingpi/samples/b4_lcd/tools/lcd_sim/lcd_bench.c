@@ -0,0 +1,967 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*
+ * LCD驱动的主机基准测试：在ST7789仿真后端上运行一组典型的绘图场景，
+ * 输出每个场景的总线传输次数、字节数、估算的总线时间和屏幕内容的CRC32。
+ * CRC32用于比较优化前后的显示结果是否一致。
+ */
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "lcd.h"
+#include "picture.h"
+#include "lcd_console.h"
+#include "lcd_chart.h"
+#include "lcd_ui.h"
+#include "lcd_qoi.h"
+#include "lcd_sim.h"
+
+/* 与lcd.c的默认值一致，由Makefile的SPI和FAST变量覆盖 */
+#ifndef LCD_ENABLE_SPI
+#define LCD_ENABLE_SPI      0
+#endif
+#ifndef LCD_GPIO_FAST
+#define LCD_GPIO_FAST       1
+#endif
+
+#define NSEC_PER_MSEC       1000000
+#define NSEC_PER_SEC        1000000000ULL
+
+/* 随机图形的数目 */
+#define BENCH_LINE_NUM      200
+#define BENCH_CIRCLE_NUM    40
+#define BENCH_RECT_NUM      40
+/* 数字控件的更新次数 */
+#define BENCH_NUM_UPDATES   100
+/* 控制台输出的行数 */
+#define BENCH_CONSOLE_LINES 100
+/* 曲线图的更新次数和每次更新之间的样本数 */
+#define BENCH_CHART_UPDATES 400
+#define BENCH_CHART_SAMPLES 4
+#define BENCH_CHART_MARGIN  20
+/* 状态栏动画：精灵表中图标的大小和帧数，状态栏的图标数，动画帧数 */
+#define BENCH_SPRITE_SIZE   24
+#define BENCH_SPRITE_FRAMES 4
+#define BENCH_SPRITE_SLOTS  4
+#define BENCH_SPRITE_STEPS  60
+#define BENCH_SPRITE_KEY    LCD_MAGENTA
+#define BENCH_SPRITE_BAR    LCD_DARKBLUE
+/* 仪表盘的更新次数，曲线图的起始行 */
+#define BENCH_UI_FRAMES     200
+#define BENCH_UI_CHART_Y    120
+/* QOI图片：logo的尺寸，lcd_qoi_feed每段的最大字节数 */
+#define BENCH_QOI_W         210
+#define BENCH_QOI_H         62
+#define BENCH_QOI_SEG_MAX   64
+/* 仪表：更新次数，圆心Y坐标，刻度圆弧的外半径和宽度，起始角度和扫过的角度，
+ * 指针的长度和宽度，饼图的圆心Y坐标和半径
+ */
+#define BENCH_GAUGE_FRAMES  60
+#define BENCH_GAUGE_Y       120
+#define BENCH_GAUGE_R       100
+#define BENCH_GAUGE_WIDTH   14
+#define BENCH_GAUGE_START   135
+#define BENCH_GAUGE_SWEEP   270
+#define BENCH_NEEDLE_LEN    78
+#define BENCH_NEEDLE_WIDTH  8
+#define BENCH_PIE_Y         270
+#define BENCH_PIE_R         40
+
+typedef struct {
+    const char *name;
+    void (*run)(void);
+} bench_scene_t;
+
+static uint32_t m_seed = 1;
+
+/* 固定种子的伪随机数，保证每次运行的图形相同 */
+static uint16_t bench_rand(uint16_t range)
+{
+    m_seed = m_seed * 1103515245 + 12345;
+    return (uint16_t)((m_seed >> 16) % range);
+}
+
+static void scene_fill(void)
+{
+    lcd_fill(0, 0, LCD_W, LCD_H, LCD_BLUE);
+    lcd_fill(0, 0, LCD_W / 2, LCD_H / 2, LCD_RED);
+    lcd_fill(LCD_W / 4, LCD_H / 4, LCD_W * 3 / 4, LCD_H * 3 / 4, LCD_GREEN);
+}
+
+static void scene_text(void)
+{
+    uint16_t y;
+
+    for (y = 0; y + LCD_FONT_SIZE16 <= LCD_H; y += LCD_FONT_SIZE16) {
+        lcd_show_string(0, y, (const uint8_t *)"Welcome to XiaoLingPai!", LCD_RED, LCD_WHITE, LCD_FONT_SIZE16, 0);
+    }
+}
+
+static void scene_text_overlay(void)
+{
+    uint16_t y;
+
+    for (y = 0; y + LCD_FONT_SIZE24 <= LCD_H; y += LCD_FONT_SIZE24) {
+        lcd_show_string(0, y, (const uint8_t *)"0123456789ABCDEF", LCD_BLUE, LCD_WHITE, LCD_FONT_SIZE24, 1);
+    }
+}
+
+static void scene_text24(void)
+{
+    uint16_t y;
+
+    for (y = 0; y + LCD_FONT_SIZE24 <= LCD_H; y += LCD_FONT_SIZE24) {
+        lcd_draw_text(0, y, (const uint8_t *)"Temp 23.5C RH 61%", LCD_BLUE, LCD_WHITE, LCD_FONT_SIZE24, 0);
+    }
+}
+
+static void scene_text24_aa(void)
+{
+    uint16_t y;
+
+    for (y = 0; y + LCD_FONT_SIZE24 <= LCD_H; y += LCD_FONT_SIZE24) {
+        lcd_draw_text_aa(0, y, (const uint8_t *)"Temp 23.5C RH 61%", LCD_BLUE, LCD_WHITE, LCD_FONT_SIZE24);
+    }
+}
+
+static void scene_chinese(void)
+{
+    uint8_t text[] = "小凌派";
+
+    lcd_show_chinese(0, 0, text, LCD_RED, LCD_WHITE, LCD_FONT_SIZE12, 0);
+    lcd_show_chinese(0, 20, text, LCD_RED, LCD_WHITE, LCD_FONT_SIZE16, 0);
+    lcd_show_chinese(0, 40, text, LCD_RED, LCD_WHITE, LCD_FONT_SIZE24, 0);
+    lcd_show_chinese(0, 70, text, LCD_RED, LCD_WHITE, LCD_FONT_SIZE32, 1);
+}
+
+static void scene_lines(void)
+{
+    uint16_t i;
+
+    for (i = 0; i < BENCH_LINE_NUM; i++) {
+        lcd_draw_line(bench_rand(LCD_W), bench_rand(LCD_H), bench_rand(LCD_W), bench_rand(LCD_H), bench_rand(0xFFFF));
+    }
+}
+
+static void scene_circles(void)
+{
+    uint16_t i;
+    uint8_t r;
+
+    for (i = 0; i < BENCH_CIRCLE_NUM; i++) {
+        r = (uint8_t)(bench_rand(40) + 5);
+        if (i & 1) {
+            lcd_fill_circle(r + bench_rand(LCD_W - 2 * r), r + bench_rand(LCD_H - 2 * r), r, bench_rand(0xFFFF));
+        } else {
+            lcd_draw_circle(r + bench_rand(LCD_W - 2 * r), r + bench_rand(LCD_H - 2 * r), r, bench_rand(0xFFFF));
+        }
+    }
+}
+
+static void scene_rects(void)
+{
+    uint16_t i, x, y;
+
+    for (i = 0; i < BENCH_RECT_NUM; i++) {
+        x = bench_rand(LCD_W - 40);
+        y = bench_rand(LCD_H - 40);
+        if (i & 1) {
+            lcd_fill_rect_outline(x, y, x + bench_rand(40), y + bench_rand(40), LCD_YELLOW, LCD_BLACK);
+        } else {
+            lcd_draw_rectangle(x, y, x + bench_rand(40), y + bench_rand(40), bench_rand(0xFFFF));
+        }
+    }
+}
+
+static void scene_picture(void)
+{
+    lcd_show_picture(15, 0, 210, 62, gImage_lingzhi);
+}
+
+static void scene_image(void)
+{
+    lcd_show_image(15, 100, &gImage_lingzhi_rle);
+}
+
+static void scene_numbers(void)
+{
+    lcd_num_t num;
+    uint16_t i;
+
+    lcd_num_init(&num, 80, 150, 6, 2, LCD_BLACK, LCD_WHITE, LCD_FONT_SIZE16);
+    for (i = 0; i < BENCH_NUM_UPDATES; i++) {
+        lcd_num_set_float(&num, i * 0.11f);
+        lcd_flush();
+    }
+}
+
+static void scene_console(void)
+{
+    uint16_t i;
+
+    if (lcd_console_init(0, LCD_H, LCD_FONT_SIZE16, LCD_BLACK, LCD_WHITE) != 0) {
+        return;
+    }
+    lcd_console_set_attr(1, LCD_RED, LCD_WHITE);
+    for (i = 0; i < BENCH_CONSOLE_LINES; i++) {
+        lcd_console_printf("[%3u] temp=" LCD_CONSOLE_ATTR("1") "%u.%u" LCD_CONSOLE_ATTR("0") " C\n",
+                           i, 20 + i % 10, i % 7);
+    }
+    lcd_console_deinit();
+}
+
+/* 对照：每输出一行都用lcd_show_string重画所有行 */
+static void scene_console_redraw(void)
+{
+    static char lines[LCD_SIZE_MAX / LCD_FONT_SIZE16][LCD_CONSOLE_COLS + 1];
+    uint16_t rows = LCD_H / LCD_FONT_SIZE16;
+    uint16_t i, j, n = 0;
+
+    for (i = 0; i < BENCH_CONSOLE_LINES; i++) {
+        if (n == rows) {
+            memmove(lines[0], lines[1], sizeof(lines[0]) * (rows - 1));
+            n--;
+        }
+        snprintf(lines[n++], sizeof(lines[0]), "[%3u] temp=%u.%u C", i, 20 + i % 10, i % 7);
+        for (j = 0; j < n; j++) {
+            lcd_fill(0, j * LCD_FONT_SIZE16, LCD_W, (j + 1) * LCD_FONT_SIZE16, LCD_WHITE);
+            lcd_show_string(0, j * LCD_FONT_SIZE16, (const uint8_t *)lines[j], LCD_BLACK, LCD_WHITE,
+                            LCD_FONT_SIZE16, 0);
+        }
+    }
+}
+
+/* 模拟的温度(20~30℃，三角波加噪声)和光照(0~1000lux，随机阶跃) */
+static void bench_sensor(uint16_t t, float *temp, float *lux)
+{
+    static float level = 500.0f;
+    uint16_t phase = t % 200;
+
+    *temp = 20.0f + ((phase < 100) ? phase : (200 - phase)) / 10.0f + bench_rand(100) / 100.0f;
+    if (bench_rand(50) == 0) {
+        level = bench_rand(1000);
+    }
+    *lux = level + bench_rand(40);
+}
+
+static void scene_chart(void)
+{
+    lcd_chart_t chart;
+    float temp, lux;
+    uint16_t i, j;
+
+    if (lcd_chart_init(&chart, 0, BENCH_CHART_MARGIN, LCD_W, LCD_H - 2 * BENCH_CHART_MARGIN,
+                       LCD_BLACK, LCD_GRAY, 20, LCD_CHART_HW_SCROLL) != 0) {
+        return;
+    }
+    lcd_chart_set_series(&chart, 0, 15.0f, 35.0f, LCD_RED);
+    lcd_chart_set_series(&chart, 1, 0.0f, 1100.0f, LCD_YELLOW);
+    for (i = 0; i < BENCH_CHART_UPDATES; i++) {
+        for (j = 0; j < BENCH_CHART_SAMPLES; j++) {
+            bench_sensor(i * BENCH_CHART_SAMPLES + j, &temp, &lux);
+            lcd_chart_push(&chart, 0, temp);
+            lcd_chart_push(&chart, 1, lux);
+        }
+        lcd_chart_update(&chart);
+        lcd_flush();
+    }
+    lcd_chart_deinit(&chart);
+}
+
+/* 对照：每次更新都清空绘图区域，用lcd_draw_line重画整条曲线 */
+static void scene_chart_redraw(void)
+{
+    static uint16_t ys[2][LCD_SIZE_MAX];
+    uint16_t top = BENCH_CHART_MARGIN;
+    uint16_t height = LCD_H - 2 * BENCH_CHART_MARGIN;
+    uint16_t i, j, n = 0;
+    float temp, lux;
+
+    for (i = 0; i < BENCH_CHART_UPDATES; i++) {
+        for (j = 0; j < BENCH_CHART_SAMPLES; j++) {
+            bench_sensor(i * BENCH_CHART_SAMPLES + j, &temp, &lux);
+        }
+        if (n == LCD_W) {
+            memmove(ys[0], ys[0] + 1, sizeof(ys[0][0]) * (LCD_W - 1));
+            memmove(ys[1], ys[1] + 1, sizeof(ys[1][0]) * (LCD_W - 1));
+            n--;
+        }
+        ys[0][n] = top + (uint16_t)((35.0f - temp) * (height - 1) / 20.0f);
+        ys[1][n] = top + (uint16_t)((1100.0f - lux) * (height - 1) / 1100.0f);
+        n++;
+        lcd_fill(0, top, LCD_W, top + height, LCD_BLACK);
+        for (j = 1; j < n; j++) {
+            lcd_draw_line(j - 1, ys[0][j - 1], j, ys[0][j], LCD_RED);
+            lcd_draw_line(j - 1, ys[1][j - 1], j, ys[1][j], LCD_YELLOW);
+        }
+        lcd_flush();
+    }
+}
+
+/* 精灵表：4帧逐渐变大的圆点，圆外为透明色 */
+static const lcd_bitmap_t *bench_sprite_sheet(void)
+{
+    static uint8_t data[BENCH_SPRITE_SIZE * BENCH_SPRITE_FRAMES * BENCH_SPRITE_SIZE * 2];
+    static lcd_bitmap_t sheet = {BENCH_SPRITE_SIZE * BENCH_SPRITE_FRAMES, BENCH_SPRITE_SIZE,
+                                 BENCH_SPRITE_SIZE, BENCH_SPRITE_SIZE, data};
+    int c = BENCH_SPRITE_SIZE / 2;
+    int x, y, r, dx, dy;
+    uint16_t color;
+    uint8_t *p = data;
+
+    for (y = 0; y < sheet.height; y++) {
+        for (x = 0; x < sheet.width; x++) {
+            r = 5 + 2 * (x / BENCH_SPRITE_SIZE);
+            dx = x % BENCH_SPRITE_SIZE - c;
+            dy = y - c;
+            color = BENCH_SPRITE_KEY;
+            if (dx * dx + dy * dy <= r * r) {
+                color = (dx * dx + dy * dy <= (r - 3) * (r - 3)) ? LCD_GREEN : LCD_WHITE;
+            }
+            *p++ = (uint8_t)(color >> 8);
+            *p++ = (uint8_t)color;
+        }
+    }
+    return &sheet;
+}
+
+/* 横穿屏幕的图标在第step帧的X坐标，两端都有一部分在屏幕外 */
+static int16_t bench_sprite_x(uint16_t step)
+{
+    return (int16_t)(step * (LCD_W + BENCH_SPRITE_SIZE) / BENCH_SPRITE_STEPS - BENCH_SPRITE_SIZE);
+}
+
+static void bench_sprite_erase(int16_t x, uint16_t y)
+{
+    lcd_fill((x < 0) ? 0 : x, y, x + BENCH_SPRITE_SIZE, y + BENCH_SPRITE_SIZE, LCD_WHITE);
+}
+
+/* 状态栏上的图标循环播放，每帧只重画图标所在的格子；另有一个图标横穿屏幕 */
+static void scene_sprite(void)
+{
+    const lcd_bitmap_t *sheet = bench_sprite_sheet();
+    uint16_t y = LCD_H / 2;
+    uint16_t i, k, frame;
+
+    lcd_fill(0, 0, LCD_W, BENCH_SPRITE_SIZE, BENCH_SPRITE_BAR);
+    for (i = 0; i < BENCH_SPRITE_STEPS; i++) {
+        for (k = 0; k < BENCH_SPRITE_SLOTS; k++) {
+            frame = (i + k) % BENCH_SPRITE_FRAMES;
+            /* 圆点逐帧变大，新的一帧覆盖上一帧，回到第0帧时才清空格子 */
+            if (frame == 0) {
+                lcd_fill(k * BENCH_SPRITE_SIZE, 0, (k + 1) * BENCH_SPRITE_SIZE, BENCH_SPRITE_SIZE,
+                         BENCH_SPRITE_BAR);
+            }
+            lcd_blit_sprite(k * BENCH_SPRITE_SIZE, 0, sheet, frame, LCD_BLIT_COLOR_KEY, BENCH_SPRITE_KEY);
+        }
+        if (i > 0) {
+            bench_sprite_erase(bench_sprite_x(i - 1), y);
+        }
+        lcd_blit_sprite(bench_sprite_x(i), y, sheet, i % BENCH_SPRITE_FRAMES, LCD_BLIT_COLOR_KEY,
+                        BENCH_SPRITE_KEY);
+        lcd_flush();
+    }
+}
+
+/* 对照：每帧重画整个状态栏，图标逐点画出不透明的像素 */
+static void scene_sprite_redraw(void)
+{
+    const lcd_bitmap_t *sheet = bench_sprite_sheet();
+    uint16_t y = LCD_H / 2;
+    uint16_t i, k, frame, f, px, py;
+    int16_t x;
+    const uint8_t *p;
+
+    for (i = 0; i < BENCH_SPRITE_STEPS; i++) {
+        lcd_fill(0, 0, LCD_W, BENCH_SPRITE_SIZE, BENCH_SPRITE_BAR);
+        for (k = 0; k < BENCH_SPRITE_SLOTS; k++) {
+            frame = (i + k) % BENCH_SPRITE_FRAMES;
+            for (f = 0; f <= frame; f++) {
+                for (py = 0; py < BENCH_SPRITE_SIZE; py++) {
+                    for (px = 0; px < BENCH_SPRITE_SIZE; px++) {
+                        p = &sheet->data[(py * sheet->width + f * BENCH_SPRITE_SIZE + px) * 2];
+                        if (((p[0] << 8) | p[1]) != BENCH_SPRITE_KEY) {
+                            lcd_draw_point(k * BENCH_SPRITE_SIZE + px, py, (p[0] << 8) | p[1]);
+                        }
+                    }
+                }
+            }
+        }
+        if (i > 0) {
+            bench_sprite_erase(bench_sprite_x(i - 1), y);
+        }
+        x = bench_sprite_x(i);
+        f = i % BENCH_SPRITE_FRAMES;
+        for (py = 0; py < BENCH_SPRITE_SIZE; py++) {
+            for (px = 0; px < BENCH_SPRITE_SIZE; px++) {
+                p = &sheet->data[(py * sheet->width + f * BENCH_SPRITE_SIZE + px) * 2];
+                if (((p[0] << 8) | p[1]) != BENCH_SPRITE_KEY && x + px >= 0 && x + px < LCD_W) {
+                    lcd_draw_point(x + px, y + py, (p[0] << 8) | p[1]);
+                }
+            }
+        }
+        lcd_flush();
+    }
+}
+
+/* 仪表盘第i帧的数据：温度缓慢变化，光照每50帧阶跃一次，图标每4帧换一次 */
+static void bench_ui_data(uint16_t i, float *temp, float *lux, uint16_t *frame)
+{
+    uint16_t phase = i % 200;
+
+    *temp = 20.0f + ((phase < 100) ? phase : (200 - phase)) / 10.0f + bench_rand(10) / 100.0f;
+    *lux = 100.0f + (i / 50 % 5) * 200.0f + bench_rand(40);
+    *frame = (i / 4) % BENCH_SPRITE_FRAMES;
+}
+
+/* 保留模式的仪表盘：每帧只设置数值，lcd_ui_render只重画变化的部分 */
+static void scene_ui(void)
+{
+    static lcd_ui_panel_t root;
+    static lcd_ui_label_t title, unit;
+    static lcd_ui_number_t temp_num, lux_num;
+    static lcd_ui_bar_t lux_bar;
+    static lcd_ui_icon_t icon;
+    static lcd_ui_chart_t chart;
+    const lcd_bitmap_t *sheet = bench_sprite_sheet();
+    float temp, lux;
+    uint16_t i, frame;
+
+    lcd_ui_panel_init(&root, NULL, 0, 0, LCD_W, LCD_H, LCD_WHITE);
+    lcd_ui_label_init(&title, &root, 0, 0, 12, LCD_FONT_SIZE24, LCD_BLACK, LCD_WHITE, LCD_UI_TEXT_AA);
+    lcd_ui_label_set_text(&title, "E53 Sensors");
+    lcd_ui_icon_init(&icon, &root, LCD_W - BENCH_SPRITE_SIZE, 0, sheet, 0, LCD_BLIT_COLOR_KEY, BENCH_SPRITE_KEY);
+    lcd_ui_number_init(&temp_num, &root, 0, 40, 3, 1, LCD_FONT_SIZE32, LCD_RED, LCD_WHITE);
+    lcd_ui_label_init(&unit, &root, 80, 40, 1, LCD_FONT_SIZE32, LCD_RED, LCD_WHITE, 0);
+    lcd_ui_label_set_text(&unit, "C");
+    lcd_ui_number_init(&lux_num, &root, 0, 80, 4, 0, LCD_FONT_SIZE16, LCD_BLACK, LCD_WHITE);
+    lcd_ui_bar_init(&lux_bar, &root, 0, 100, LCD_W, 12, 0.0f, 1100.0f, LCD_YELLOW, LCD_GRAY);
+    if (lcd_ui_chart_init(&chart, &root, 0, BENCH_UI_CHART_Y, LCD_W, LCD_H - BENCH_UI_CHART_Y,
+                          LCD_BLACK, LCD_GRAY, 20) != 0) {
+        return;
+    }
+    lcd_chart_set_series(&chart.chart, 0, 15.0f, 35.0f, LCD_RED);
+    lcd_chart_set_series(&chart.chart, 1, 0.0f, 1100.0f, LCD_YELLOW);
+
+    for (i = 0; i < BENCH_UI_FRAMES; i++) {
+        bench_ui_data(i, &temp, &lux, &frame);
+        lcd_ui_number_set_float(&temp_num, temp);
+        lcd_ui_number_set_float(&lux_num, lux);
+        lcd_ui_bar_set_value(&lux_bar, lux);
+        lcd_ui_icon_set_index(&icon, frame);
+        lcd_chart_push(&chart.chart, 0, temp);
+        lcd_chart_push(&chart.chart, 1, lux);
+        lcd_ui_render(&root);
+    }
+}
+
+/* 对照：每帧清空曲线图以外的区域，重画所有文字、数字、进度条和图标 */
+static void scene_ui_redraw(void)
+{
+    const lcd_bitmap_t *sheet = bench_sprite_sheet();
+    lcd_chart_t chart;
+    lcd_num_t temp_num, lux_num;
+    uint16_t i, frame, fill;
+    float temp, lux;
+
+    if (lcd_chart_init(&chart, 0, BENCH_UI_CHART_Y, LCD_W, LCD_H - BENCH_UI_CHART_Y, LCD_BLACK, LCD_GRAY, 20,
+                       0) != 0) {
+        return;
+    }
+    lcd_chart_set_series(&chart, 0, 15.0f, 35.0f, LCD_RED);
+    lcd_chart_set_series(&chart, 1, 0.0f, 1100.0f, LCD_YELLOW);
+    lcd_num_init(&temp_num, 0, 40, 3, 1, LCD_RED, LCD_WHITE, LCD_FONT_SIZE32);
+    lcd_num_init(&lux_num, 0, 80, 4, 0, LCD_BLACK, LCD_WHITE, LCD_FONT_SIZE16);
+
+    for (i = 0; i < BENCH_UI_FRAMES; i++) {
+        bench_ui_data(i, &temp, &lux, &frame);
+        lcd_fill(0, 0, LCD_W, BENCH_UI_CHART_Y, LCD_WHITE);
+        lcd_draw_text_aa(0, 0, (const uint8_t *)"E53 Sensors", LCD_BLACK, LCD_WHITE, LCD_FONT_SIZE24);
+        lcd_blit_sprite(LCD_W - BENCH_SPRITE_SIZE, 0, sheet, frame, LCD_BLIT_COLOR_KEY, BENCH_SPRITE_KEY);
+        lcd_num_invalidate(&temp_num);
+        lcd_num_set_float(&temp_num, temp);
+        lcd_show_string(80, 40, (const uint8_t *)"C", LCD_RED, LCD_WHITE, LCD_FONT_SIZE32, 0);
+        lcd_num_invalidate(&lux_num);
+        lcd_num_set_float(&lux_num, lux);
+        fill = (lux >= 1100.0f) ? LCD_W : (uint16_t)(lux * LCD_W / 1100.0f + 0.5f);
+        lcd_fill(0, 100, fill, 112, LCD_YELLOW);
+        lcd_fill(fill, 100, LCD_W, 112, LCD_GRAY);
+        lcd_chart_push(&chart, 0, temp);
+        lcd_chart_push(&chart, 1, lux);
+        lcd_chart_update(&chart);
+        lcd_flush();
+    }
+}
+
+/* 把RGB565的logo编码为QOI，返回编码后的字节数。RGB888的低位复制高位，
+ * 转换回RGB565时与原图完全相同
+ */
+static uint32_t bench_qoi_encode(uint8_t *out)
+{
+    uint8_t index[64][3] = {{0}};
+    uint8_t prev[3] = {0, 0, 0};
+    uint8_t px[3];
+    uint32_t n = 0, i;
+    uint16_t c;
+    uint8_t run = 0, h;
+    int dr, dg, db, dr_dg, db_dg;
+
+    memcpy(out, "qoif", 4);
+    n = 4;
+    for (i = 0; i < 2; i++) {
+        c = (i == 0) ? BENCH_QOI_W : BENCH_QOI_H;
+        out[n++] = 0;
+        out[n++] = 0;
+        out[n++] = (uint8_t)(c >> 8);
+        out[n++] = (uint8_t)c;
+    }
+    out[n++] = 3;
+    out[n++] = 0;
+
+    for (i = 0; i < BENCH_QOI_W * BENCH_QOI_H; i++) {
+        c = (uint16_t)((gImage_lingzhi[i * 2] << 8) | gImage_lingzhi[i * 2 + 1]);
+        px[0] = (uint8_t)(((c >> 11) << 3) | ((c >> 11) >> 2));
+        px[1] = (uint8_t)((((c >> 5) & 0x3F) << 2) | (((c >> 5) & 0x3F) >> 4));
+        px[2] = (uint8_t)(((c & 0x1F) << 3) | ((c & 0x1F) >> 2));
+        if (memcmp(px, prev, 3) == 0) {
+            run++;
+            if (run == 62 || i + 1 == BENCH_QOI_W * BENCH_QOI_H) {
+                out[n++] = (uint8_t)(0xC0 | (run - 1));
+                run = 0;
+            }
+            continue;
+        }
+        if (run > 0) {
+            out[n++] = (uint8_t)(0xC0 | (run - 1));
+            run = 0;
+        }
+        h = (uint8_t)((px[0] * 3 + px[1] * 5 + px[2] * 7 + 255 * 11) % 64);
+        if (memcmp(index[h], px, 3) == 0) {
+            out[n++] = h;
+        } else {
+            memcpy(index[h], px, 3);
+            dr = (int8_t)(px[0] - prev[0]);
+            dg = (int8_t)(px[1] - prev[1]);
+            db = (int8_t)(px[2] - prev[2]);
+            dr_dg = dr - dg;
+            db_dg = db - dg;
+            if (dr >= -2 && dr <= 1 && dg >= -2 && dg <= 1 && db >= -2 && db <= 1) {
+                out[n++] = (uint8_t)(0x40 | ((dr + 2) << 4) | ((dg + 2) << 2) | (db + 2));
+            } else if (dg >= -32 && dg <= 31 && dr_dg >= -8 && dr_dg <= 7 && db_dg >= -8 && db_dg <= 7) {
+                out[n++] = (uint8_t)(0x80 | (dg + 32));
+                out[n++] = (uint8_t)(((dr_dg + 8) << 4) | (db_dg + 8));
+            } else {
+                out[n++] = 0xFE;
+                out[n++] = px[0];
+                out[n++] = px[1];
+                out[n++] = px[2];
+            }
+        }
+        memcpy(prev, px, 3);
+    }
+    memset(&out[n], 0, 7);
+    n += 7;
+    out[n++] = 1;
+    return n;
+}
+
+/* logo编码后的QOI数据 */
+static uint8_t m_qoi_data[BENCH_QOI_W * BENCH_QOI_H * 4 + 32];
+static uint32_t m_qoi_len = 0;
+
+/* 三个位置：完整显示、左边超出屏幕、右下角超出屏幕 */
+static const int16_t m_qoi_pos[][2] = {{15, 0}, {-50, 100}, {100, 280}};
+
+typedef struct {
+    const uint8_t *p;
+    uint32_t remain;
+} bench_qoi_reader_t;
+
+/* 模拟从套接字读取，每次最多返回BENCH_QOI_SEG_MAX个字节 */
+static int bench_qoi_read(void *ctx, uint8_t *buf, uint32_t len)
+{
+    bench_qoi_reader_t *r = (bench_qoi_reader_t *)ctx;
+    uint32_t n = 1 + bench_rand(BENCH_QOI_SEG_MAX);
+
+    n = (n < len) ? n : len;
+    n = (n < r->remain) ? n : r->remain;
+    memcpy(buf, r->p, n);
+    r->p += n;
+    r->remain -= n;
+    return (int)n;
+}
+
+/* 流式解码QOI：第一幅按随机长度分段调用lcd_qoi_feed，其余用lcd_show_qoi */
+static void scene_qoi(void)
+{
+    static lcd_qoi_t qoi;
+    bench_qoi_reader_t reader;
+    uint32_t off = 0, n;
+    uint16_t i;
+
+    if (m_qoi_len == 0) {
+        m_qoi_len = bench_qoi_encode(m_qoi_data);
+    }
+    lcd_qoi_begin(&qoi, m_qoi_pos[0][0], m_qoi_pos[0][1], 0);
+    while (off < m_qoi_len && !lcd_qoi_done(&qoi)) {
+        n = 1 + bench_rand(BENCH_QOI_SEG_MAX);
+        n = (n < m_qoi_len - off) ? n : (m_qoi_len - off);
+        if (lcd_qoi_feed(&qoi, &m_qoi_data[off], n) != 0) {
+            return;
+        }
+        off += n;
+    }
+    for (i = 1; i < sizeof(m_qoi_pos) / sizeof(m_qoi_pos[0]); i++) {
+        reader.p = m_qoi_data;
+        reader.remain = m_qoi_len;
+        if (lcd_show_qoi(m_qoi_pos[i][0], m_qoi_pos[i][1], bench_qoi_read, &reader, 0) != 0) {
+            return;
+        }
+    }
+    lcd_flush();
+}
+
+/* 对照：同样的位置直接显示RGB565原图 */
+static void scene_qoi_blit(void)
+{
+    lcd_bitmap_t logo = {BENCH_QOI_W, BENCH_QOI_H, 0, 0, gImage_lingzhi};
+    uint16_t i;
+
+    for (i = 0; i < sizeof(m_qoi_pos) / sizeof(m_qoi_pos[0]); i++) {
+        lcd_blit(m_qoi_pos[i][0], m_qoi_pos[i][1], &logo, 0, 0, BENCH_QOI_W, BENCH_QOI_H, 0, 0);
+    }
+    lcd_flush();
+}
+
+/* 仪表第i帧的指针角度：数值在0 ~ 100之间往复，每帧变化7 */
+static int16_t bench_gauge_angle(uint16_t i)
+{
+    uint16_t phase = (i * 7) % 200;
+    uint16_t value = (phase < 100) ? phase : (200 - phase);
+
+    return (int16_t)(BENCH_GAUGE_START + value * BENCH_GAUGE_SWEEP / 100);
+}
+
+/* 饼图各扇区的结束角度和颜色 */
+static const int16_t m_pie_end[] = {-30, 80, 200, 270};
+static const uint16_t m_pie_color[] = {LCD_RED, LCD_GREEN, LCD_BLUE, LCD_YELLOW};
+
+/* 仪表：饼图、刻度圆弧、数值圆弧和指针都用多边形填充，数值圆弧只重画变化的一段 */
+static void scene_gauge(void)
+{
+    int16_t cx = LCD_W / 2;
+    int16_t angle, last = BENCH_GAUGE_START;
+    int16_t start = -90;
+    uint16_t i;
+
+    for (i = 0; i < sizeof(m_pie_end) / sizeof(m_pie_end[0]); i++) {
+        lcd_fill_pie(cx, BENCH_PIE_Y, BENCH_PIE_R, start, m_pie_end[i], m_pie_color[i]);
+        start = m_pie_end[i];
+    }
+    lcd_fill_arc(cx, BENCH_GAUGE_Y, BENCH_GAUGE_R, BENCH_GAUGE_WIDTH, BENCH_GAUGE_START,
+                 BENCH_GAUGE_START + BENCH_GAUGE_SWEEP, LCD_LGRAY);
+
+    for (i = 0; i < BENCH_GAUGE_FRAMES; i++) {
+        angle = bench_gauge_angle(i);
+        if (angle > last) {
+            lcd_fill_arc(cx, BENCH_GAUGE_Y, BENCH_GAUGE_R, BENCH_GAUGE_WIDTH, last, angle, LCD_BLUE);
+        } else if (angle < last) {
+            lcd_fill_arc(cx, BENCH_GAUGE_Y, BENCH_GAUGE_R, BENCH_GAUGE_WIDTH, angle, last, LCD_LGRAY);
+        }
+        lcd_fill_needle(cx, BENCH_GAUGE_Y, BENCH_NEEDLE_LEN, BENCH_NEEDLE_WIDTH, last, LCD_WHITE);
+        lcd_fill_needle(cx, BENCH_GAUGE_Y, BENCH_NEEDLE_LEN, BENCH_NEEDLE_WIDTH, angle, LCD_RED);
+        lcd_fill_circle(cx, BENCH_GAUGE_Y, BENCH_NEEDLE_WIDTH / 2 + 2, LCD_BLACK);
+        last = angle;
+        lcd_flush();
+    }
+}
+
+/* 从半径r0到r1，在angle度方向上画一条径向线段 */
+static void bench_radial_line(int16_t cx, int16_t cy, float r0, float r1, float angle, uint16_t color)
+{
+    float rad = angle * 3.14159265f / 180.0f;
+    float c = cosf(rad);
+    float s = sinf(rad);
+
+    lcd_draw_line((uint16_t)lroundf(cx + r0 * c), (uint16_t)lroundf(cy + r0 * s),
+                  (uint16_t)lroundf(cx + r1 * c), (uint16_t)lroundf(cy + r1 * s), color);
+}
+
+/* 用每度一条径向线画圆弧或扇形 */
+static void bench_lines_arc(int16_t cx, int16_t cy, float r0, float r1, int16_t start, int16_t end, uint16_t color)
+{
+    int16_t a;
+
+    for (a = start; a <= end; a++) {
+        bench_radial_line(cx, cy, r0, r1, a, color);
+    }
+}
+
+/* 用平行于指针方向的一组线画指针 */
+static void bench_lines_needle(int16_t cx, int16_t cy, int16_t angle, uint16_t color)
+{
+    float rad = angle * 3.14159265f / 180.0f;
+    float c = cosf(rad);
+    float s = sinf(rad);
+    float d;
+
+    for (d = -BENCH_NEEDLE_WIDTH / 2.0f; d <= BENCH_NEEDLE_WIDTH / 2.0f; d += 0.5f) {
+        lcd_draw_line((uint16_t)lroundf(cx - d * s), (uint16_t)lroundf(cy + d * c),
+                      (uint16_t)lroundf(cx + BENCH_NEEDLE_LEN * c), (uint16_t)lroundf(cy + BENCH_NEEDLE_LEN * s),
+                      color);
+    }
+}
+
+/* 对照：同样的仪表用lcd_draw_line画出，圆弧和扇形每度一条径向线，指针为一组线 */
+static void scene_gauge_lines(void)
+{
+    int16_t cx = LCD_W / 2;
+    int16_t angle, last = BENCH_GAUGE_START;
+    int16_t start = -90;
+    uint16_t i;
+
+    for (i = 0; i < sizeof(m_pie_end) / sizeof(m_pie_end[0]); i++) {
+        bench_lines_arc(cx, BENCH_PIE_Y, 0, BENCH_PIE_R, start, m_pie_end[i], m_pie_color[i]);
+        start = m_pie_end[i];
+    }
+    bench_lines_arc(cx, BENCH_GAUGE_Y, BENCH_GAUGE_R - BENCH_GAUGE_WIDTH, BENCH_GAUGE_R, BENCH_GAUGE_START,
+                    BENCH_GAUGE_START + BENCH_GAUGE_SWEEP, LCD_LGRAY);
+
+    for (i = 0; i < BENCH_GAUGE_FRAMES; i++) {
+        angle = bench_gauge_angle(i);
+        if (angle > last) {
+            bench_lines_arc(cx, BENCH_GAUGE_Y, BENCH_GAUGE_R - BENCH_GAUGE_WIDTH, BENCH_GAUGE_R, last, angle,
+                            LCD_BLUE);
+        } else if (angle < last) {
+            bench_lines_arc(cx, BENCH_GAUGE_Y, BENCH_GAUGE_R - BENCH_GAUGE_WIDTH, BENCH_GAUGE_R, angle, last,
+                            LCD_LGRAY);
+        }
+        bench_lines_needle(cx, BENCH_GAUGE_Y, last, LCD_WHITE);
+        bench_lines_needle(cx, BENCH_GAUGE_Y, angle, LCD_RED);
+        lcd_fill_circle(cx, BENCH_GAUGE_Y, BENCH_NEEDLE_WIDTH / 2 + 2, LCD_BLACK);
+        last = angle;
+        lcd_flush();
+    }
+}
+
+/* 顶点为负数或在屏幕外的图形：多边形、扇形、圆弧和指针都被裁剪到屏幕内 */
+static void scene_shapes_clip(void)
+{
+    const lcd_point_t star[] = {{-40, -30}, {60, 200}, {-80, 90}, {LCD_W + 50, 60}, {20, LCD_H + 40}};
+    int16_t w = LCD_W;
+    int16_t h = LCD_H;
+    uint16_t i;
+
+    lcd_fill_triangle(-300, -200, w + 300, h / 2, -50, h + 400, LCD_GREEN);
+    lcd_fill_polygon(star, sizeof(star) / sizeof(star[0]), LCD_BLUE);
+    lcd_fill_triangle(w - 20, -60, w + 80, 40, w - 60, 90, LCD_RED);
+    lcd_fill_pie(-20, -20, 90, 0, 90, LCD_YELLOW);
+    lcd_fill_pie(w + 10, h / 2, 60, 90, 270, LCD_MAGENTA);
+    lcd_fill_arc(w / 2, h + 30, 100, 20, 180, 360, LCD_CYAN);
+    lcd_fill_arc(-200, -200, 40, 10, 0, 360, LCD_BLACK);
+    for (i = 0; i < 12; i++) {
+        lcd_fill_needle(w / 2, -10, h + 60, 10, (int16_t)(i * 30 - 45), i & 1 ? LCD_BLACK : LCD_BROWN);
+    }
+}
+
+/* 文字超出屏幕右边和下边：有显存时显存与屏幕须一致，最后整屏刷新后不丢字 */
+static void scene_text_clip(void)
+{
+    uint8_t cjk[] = "小凌派";
+    uint16_t w = LCD_W;
+    uint16_t h = LCD_H;
+
+    lcd_draw_text(w - 40, 10, (const uint8_t *)"Clip 0123", LCD_BLUE, LCD_WHITE, LCD_FONT_SIZE24, 0);
+    lcd_draw_text(w - 52, 40, (const uint8_t *)"Clip 0123", LCD_RED, LCD_WHITE, LCD_FONT_SIZE32, 1);
+    lcd_draw_text_aa(w - 45, 80, (const uint8_t *)"AA clip", LCD_BLACK, LCD_WHITE, LCD_FONT_SIZE24);
+    lcd_draw_text_aa(w - 30, 110, (const uint8_t *)"AA32", LCD_BLUE, LCD_WHITE, LCD_FONT_SIZE32);
+    lcd_show_chinese(w - 40, 150, cjk, LCD_RED, LCD_WHITE, LCD_FONT_SIZE32, 0);
+    lcd_show_chinese(w - 20, 190, cjk, LCD_BLUE, LCD_WHITE, LCD_FONT_SIZE24, 1);
+    lcd_draw_text(0, h - 10, (const uint8_t *)"Bottom edge", LCD_BLUE, LCD_WHITE, LCD_FONT_SIZE24, 0);
+    lcd_draw_text(130, h - 20, (const uint8_t *)"Over", LCD_RED, LCD_WHITE, LCD_FONT_SIZE32, 1);
+    lcd_draw_text_aa(w - 30, h - 12, (const uint8_t *)"AA", LCD_BLACK, LCD_WHITE, LCD_FONT_SIZE16);
+    lcd_show_chinese(80, h - 8, cjk, LCD_RED, LCD_WHITE, LCD_FONT_SIZE16, 0);
+    lcd_draw_text(w + 5, 10, (const uint8_t *)"off", LCD_RED, LCD_WHITE, LCD_FONT_SIZE16, 0);
+    lcd_draw_text_aa(10, h + 5, (const uint8_t *)"off", LCD_RED, LCD_WHITE, LCD_FONT_SIZE16);
+    /* 屏幕内的叠加文字经过显存，刷新时把所在区域的显存发送到屏幕 */
+    lcd_draw_text(w - 16, 14, (const uint8_t *)"-+", LCD_GREEN, LCD_WHITE, LCD_FONT_SIZE16, 1);
+    lcd_draw_text(w - 16, 84, (const uint8_t *)"-+", LCD_GREEN, LCD_WHITE, LCD_FONT_SIZE16, 1);
+    lcd_draw_text(w - 16, 160, (const uint8_t *)"-+", LCD_GREEN, LCD_WHITE, LCD_FONT_SIZE16, 1);
+    lcd_draw_text(4, h - 16, (const uint8_t *)"-+-+-+-+-+-+-+-+-", LCD_GREEN, LCD_WHITE, LCD_FONT_SIZE16, 1);
+    lcd_flush();
+}
+
+static const bench_scene_t m_scenes[] = {
+    {"fill",            scene_fill},
+    {"text16",          scene_text},
+    {"text24_overlay",  scene_text_overlay},
+    {"text24",          scene_text24},
+    {"text24_aa",       scene_text24_aa},
+    {"chinese",         scene_chinese},
+    {"lines",           scene_lines},
+    {"circles",         scene_circles},
+    {"rects",           scene_rects},
+    {"picture",         scene_picture},
+    {"image_rle",       scene_image},
+    {"num_widget",      scene_numbers},
+    {"console",         scene_console},
+    {"console_redraw",  scene_console_redraw},
+    {"chart",           scene_chart},
+    {"chart_redraw",    scene_chart_redraw},
+    {"sprite",          scene_sprite},
+    {"sprite_redraw",   scene_sprite_redraw},
+    {"ui",              scene_ui},
+    {"ui_redraw",       scene_ui_redraw},
+    {"qoi",             scene_qoi},
+    {"qoi_blit",        scene_qoi_blit},
+    {"gauge",           scene_gauge},
+    {"gauge_lines",     scene_gauge_lines},
+    {"shapes_clip",     scene_shapes_clip},
+    {"text_clip",       scene_text_clip},
+};
+
+static uint64_t bench_now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * NSEC_PER_SEC + (uint64_t)ts.tv_nsec;
+}
+
+static void usage(const char *prog)
+{
+    printf("usage: %s [-c clock_hz] [-g cs_gap_ns] [-p gpio_ns] [-r reg_ns] [-t rotation] [-o ppm_dir] [-s scene]\n",
+           prog);
+    printf("  -c  SPI clock used for wire time, default 50000000\n");
+    printf("  -g  fixed cost of each bus transaction in ns, default 0\n");
+    printf("  -p  cost of one LzGpioSetVal call in ns (bit-bang mode)\n");
+    printf("  -r  cost of one GPIO data register write in ns (bit-bang mode),\n");
+    printf("      wire time follows the SPI clock when both -p and -r are 0\n");
+    printf("  -t  switch to this rotation (0~3) with lcd_set_rotation after lcd_init\n");
+    printf("  -o  save a PPM snapshot of every scene into this directory\n");
+    printf("  -s  run only the named scene\n");
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t clock_hz = 50000000;
+    uint32_t cs_gap_ns = 0;
+    uint32_t gpio_ns = 0;
+    uint32_t reg_ns = 0;
+    const char *ppm_dir = NULL;
+    const char *only = NULL;
+    int rotation = -1;
+    lcd_sim_stats_t stats;
+    lcd_sim_stats_t total = {0};
+    uint64_t start, host_ns, total_host_ns = 0;
+    char path[256];
+    size_t i;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "c:g:p:r:t:o:s:h")) != -1) {
+        switch (opt) {
+            case 'c':
+                clock_hz = (uint32_t)strtoul(optarg, NULL, 0);
+                break;
+            case 'g':
+                cs_gap_ns = (uint32_t)strtoul(optarg, NULL, 0);
+                break;
+            case 'p':
+                gpio_ns = (uint32_t)strtoul(optarg, NULL, 0);
+                break;
+            case 'r':
+                reg_ns = (uint32_t)strtoul(optarg, NULL, 0);
+                break;
+            case 't':
+                rotation = (int)strtol(optarg, NULL, 0);
+                break;
+            case 'o':
+                ppm_dir = optarg;
+                break;
+            case 's':
+                only = optarg;
+                break;
+            default:
+                usage(argv[0]);
+                return (opt == 'h') ? 0 : 1;
+        }
+    }
+
+    lcd_sim_set_timing(clock_hz, cs_gap_ns, gpio_ns, reg_ns);
+    if (lcd_init() != 0) {
+        printf("lcd_init failed\n");
+        return 1;
+    }
+    if (rotation >= 0 && lcd_set_rotation((uint8_t)rotation, LCD_WHITE) != 0) {
+        printf("lcd_set_rotation failed\n");
+        return 1;
+    }
+
+    printf("LCD_FB_LINES=%d LCD_ASYNC_FLUSH=%d LCD_ENABLE_SPI=%d LCD_GPIO_FAST=%d\n",
+           LCD_FB_LINES, LCD_ASYNC_FLUSH, LCD_ENABLE_SPI, LCD_GPIO_FAST);
+    printf("clock=%uHz cs_gap=%uns gpio=%uns reg=%uns rotation=%u (%ux%u)\n", clock_hz, cs_gap_ns, gpio_ns,
+           reg_ns, lcd_get_rotation(), LCD_W, LCD_H);
+    printf("%-16s %10s %10s %8s %9s %10s %10s %10s %9s  %s\n", "scene", "transfers", "bytes",
+           "windows", "pixels", "gpio", "reg", "wire_ms", "host_ms", "crc32");
+
+    for (i = 0; i < sizeof(m_scenes) / sizeof(m_scenes[0]); i++) {
+        if (only != NULL && strcmp(only, m_scenes[i].name) != 0) {
+            continue;
+        }
+        /* 每个场景从白屏开始，清屏不计入统计 */
+        lcd_fill(0, 0, LCD_W, LCD_H, LCD_WHITE);
+        lcd_flush();
+        m_seed = 1;
+        lcd_sim_reset_stats();
+
+        start = bench_now_ns();
+        m_scenes[i].run();
+        lcd_flush();
+        host_ns = bench_now_ns() - start;
+
+        lcd_sim_get_stats(&stats);
+        printf("%-16s %10u %10u %8u %9u %10u %10u %10.3f %9.3f  %08x\n",
+               m_scenes[i].name, stats.transactions, stats.bytes, stats.windows, stats.pixels,
+               stats.gpio_writes, stats.reg_writes, (double)stats.wire_ns / NSEC_PER_MSEC,
+               (double)host_ns / NSEC_PER_MSEC, lcd_sim_checksum());
+        if (stats.errors != 0) {
+            printf("%-16s %u protocol errors\n", "", stats.errors);
+        }
+
+        total.transactions += stats.transactions;
+        total.bytes += stats.bytes;
+        total.windows += stats.windows;
+        total.pixels += stats.pixels;
+        total.gpio_writes += stats.gpio_writes;
+        total.reg_writes += stats.reg_writes;
+        total.wire_ns += stats.wire_ns;
+        total_host_ns += host_ns;
+
+        if (ppm_dir != NULL) {
+            snprintf(path, sizeof(path), "%s/%s.ppm", ppm_dir, m_scenes[i].name);
+            lcd_sim_save_ppm(path);
+        }
+    }
+
+    printf("%-16s %10u %10u %8u %9u %10u %10u %10.3f %9.3f\n",
+           "total", total.transactions, total.bytes, total.windows, total.pixels, total.gpio_writes,
+           total.reg_writes, (double)total.wire_ns / NSEC_PER_MSEC, (double)total_host_ns / NSEC_PER_MSEC);
+
+    lcd_deinit();
+    return 0;
+}
@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*
+ * 像素格式转换的主机基准测试：把一幅随机的240x320图片按RGB888、ARGB8888
+ * 和灰度逐行转换为RGB565，比较逐像素的参考实现与lcd_color.c的成组实现的
+ * 耗时，并检查两者的输出逐字节相同。
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "lcd_color.h"
+
+#define NSEC_PER_SEC        1000000000ULL
+
+/* 测试图片的大小 */
+#define BENCH_W             240
+#define BENCH_H             320
+/* 每种格式源像素的最大字节数 */
+#define BENCH_PIXEL_BYTES   4
+/* 检查行末和非对齐地址时的最大像素数 */
+#define BENCH_EDGE_PIXELS   17
+
+typedef struct {
+    const char *name;
+    uint8_t format;
+    uint8_t size;               /* 每像素字节数 */
+} bench_format_t;
+
+static const bench_format_t m_formats[] = {
+    {"rgb888",      LCD_COLOR_RGB888,   3},
+    {"argb8888",    LCD_COLOR_ARGB8888, 4},
+    {"gray8",       LCD_COLOR_GRAY8,    1},
+};
+
+static const uint8_t m_bayer[4][4] = {
+    {0, 8, 2, 10},
+    {12, 4, 14, 6},
+    {3, 11, 1, 9},
+    {15, 7, 13, 5},
+};
+
+static uint8_t m_src[BENCH_W * BENCH_H * BENCH_PIXEL_BYTES + BENCH_PIXEL_BYTES];
+static uint8_t m_ref[BENCH_W * BENCH_H * 2];
+static uint8_t m_out[BENCH_W * BENCH_H * 2];
+static uint32_t m_seed = 1;
+
+static uint8_t bench_rand(void)
+{
+    m_seed = m_seed * 1103515245 + 12345;
+    return (uint8_t)(m_seed >> 16);
+}
+
+static uint64_t bench_now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * NSEC_PER_SEC + (uint64_t)ts.tv_nsec;
+}
+
+static uint8_t ref_add(uint8_t v, uint8_t t)
+{
+    uint16_t sum = (uint16_t)v + t;
+
+    return (sum > 0xFF) ? 0xFF : (uint8_t)sum;
+}
+
+/* 参考实现：逐像素取出各通道，移位拼成RGB565后按高字节在前写出 */
+static void ref_convert(uint8_t *dst, const uint8_t *src, uint32_t count, uint8_t format, int dither,
+                        uint16_t x, uint16_t y)
+{
+    uint8_t r, g, b, d;
+    uint16_t color;
+    uint32_t i;
+
+    for (i = 0; i < count; i++) {
+        if (format == LCD_COLOR_RGB888) {
+            r = src[i * 3];
+            g = src[i * 3 + 1];
+            b = src[i * 3 + 2];
+        } else if (format == LCD_COLOR_ARGB8888) {
+            b = src[i * 4];
+            g = src[i * 4 + 1];
+            r = src[i * 4 + 2];
+        } else {
+            r = g = b = src[i];
+        }
+        if (dither) {
+            d = m_bayer[y & 3][(x + i) & 3];
+            r = ref_add(r, d / 2);
+            g = ref_add(g, d / 4);
+            b = ref_add(b, d / 2);
+        }
+        color = (uint16_t)(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3));
+        dst[i * 2] = (uint8_t)(color >> 8);
+        dst[i * 2 + 1] = (uint8_t)color;
+    }
+}
+
+static void run_convert(uint8_t *dst, const uint8_t *src, uint32_t count, uint8_t format, int dither,
+                        uint16_t x, uint16_t y)
+{
+    if (dither) {
+        lcd_color_convert_dither(dst, src, count, format, x, y);
+    } else {
+        lcd_color_convert(dst, src, count, format);
+    }
+}
+
+/* 整幅图片逐行转换loops遍，返回每像素的平均耗时 */
+static double bench_image(const bench_format_t *fmt, int dither, int ref, uint32_t loops)
+{
+    uint32_t stride = BENCH_W * fmt->size;
+    uint64_t start = bench_now_ns();
+    uint32_t i;
+    uint16_t y;
+
+    for (i = 0; i < loops; i++) {
+        for (y = 0; y < BENCH_H; y++) {
+            if (ref) {
+                ref_convert(&m_ref[y * BENCH_W * 2], &m_src[y * stride], BENCH_W, fmt->format, dither, 0, y);
+            } else {
+                run_convert(&m_out[y * BENCH_W * 2], &m_src[y * stride], BENCH_W, fmt->format, dither, 0, y);
+            }
+        }
+    }
+    return (double)(bench_now_ns() - start) / ((double)loops * BENCH_W * BENCH_H);
+}
+
+/* 检查各种长度、起始坐标和非对齐地址下与参考实现一致 */
+static int check_edges(const bench_format_t *fmt, int dither)
+{
+    uint32_t count, offset;
+    uint16_t x;
+
+    for (offset = 0; offset < BENCH_PIXEL_BYTES; offset++) {
+        for (count = 1; count <= BENCH_EDGE_PIXELS; count++) {
+            for (x = 0; x < 4; x++) {
+                ref_convert(m_ref, &m_src[offset], count, fmt->format, dither, x, x + 1);
+                run_convert(m_out + 1, &m_src[offset], count, fmt->format, dither, x, x + 1);
+                if (memcmp(m_ref, m_out + 1, count * 2) != 0) {
+                    return -1;
+                }
+            }
+        }
+    }
+    return 0;
+}
+
+static void usage(const char *prog)
+{
+    printf("usage: %s [-n loops]\n", prog);
+    printf("  -n  times to convert the whole image for timing, default 50\n");
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t loops = 50;
+    double ref_ns, swar_ns;
+    size_t i;
+    int dither;
+    int match;
+    int fail = 0;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "n:h")) != -1) {
+        switch (opt) {
+            case 'n':
+                loops = (uint32_t)strtoul(optarg, NULL, 0);
+                break;
+            default:
+                usage(argv[0]);
+                return (opt == 'h') ? 0 : 1;
+        }
+    }
+    if (loops == 0) {
+        loops = 1;
+    }
+
+    for (i = 0; i < sizeof(m_src); i++) {
+        m_src[i] = bench_rand();
+    }
+
+    printf("%ux%u image, %u loops\n", BENCH_W, BENCH_H, loops);
+    printf("%-16s %12s %12s %8s  %s\n", "format", "ref_ns/px", "swar_ns/px", "speedup", "match");
+    for (i = 0; i < sizeof(m_formats) / sizeof(m_formats[0]); i++) {
+        for (dither = 0; dither <= 1; dither++) {
+            ref_ns = bench_image(&m_formats[i], dither, 1, loops);
+            swar_ns = bench_image(&m_formats[i], dither, 0, loops);
+            match = (memcmp(m_ref, m_out, sizeof(m_ref)) == 0) && (check_edges(&m_formats[i], dither) == 0);
+            printf("%-8s%-8s %12.3f %12.3f %7.2fx  %s\n", m_formats[i].name, dither ? "+dither" : "",
+                   ref_ns, swar_ns, ref_ns / swar_ns, match ? "yes" : "NO");
+            fail |= !match;
+        }
+    }
+    return fail;
+}
@@ -0,0 +1,477 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*
+ * ST7789仿真后端：实现lz_hardware.h中LCD驱动用到的GPIO和SPI接口，
+ * 将总线上的字节按ST7789的命令解析，维护240*320的GRAM，并统计
+ * 总线传输次数、字节数和估算的传输时间。
+ */
+#include <stdio.h>
+#include <string.h>
+#include "lz_hardware.h"
+#include "hal_base.h"
+#include "lcd_sim.h"
+
+/* 与lcd.c中的引脚定义一致 */
+#define SIM_PIN_CS          GPIO0_PC0
+#define SIM_PIN_CLK         GPIO0_PC1
+#define SIM_PIN_MOSI        GPIO0_PC2
+#define SIM_PIN_RES         GPIO0_PC3
+#define SIM_PIN_DC          GPIO0_PC6
+
+/* ST7789命令 */
+#define ST7789_SWRESET      0x01
+#define ST7789_SLPIN        0x10
+#define ST7789_SLPOUT       0x11
+#define ST7789_NORON        0x13
+#define ST7789_INVOFF       0x20
+#define ST7789_INVON        0x21
+#define ST7789_DISPOFF      0x28
+#define ST7789_DISPON       0x29
+#define ST7789_CASET        0x2A
+#define ST7789_RASET        0x2B
+#define ST7789_RAMWR        0x2C
+#define ST7789_VSCRDEF      0x33
+#define ST7789_MADCTL       0x36
+#define ST7789_VSCSAD       0x37
+#define ST7789_COLMOD       0x3A
+#define ST7789_RAMWRC       0x3C
+
+/* MADCTL的位定义 */
+#define MADCTL_MY           0x80
+#define MADCTL_MX           0x40
+#define MADCTL_MV           0x20
+
+/* 命令参数的最大长度 */
+#define SIM_PARAM_MAX       16
+
+#define NSEC_PER_SEC        1000000000ULL
+
+typedef struct {
+    uint8_t madctl;
+    uint8_t colmod;
+    uint8_t sleep;
+    uint8_t display_on;
+    uint8_t inversion;
+    uint16_t xs, xe, ys, ye;    /* 地址窗口 */
+    uint16_t cx, cy;            /* 下一个像素的地址 */
+    uint16_t tfa, vsa, bfa;     /* 垂直滚动区域 */
+    uint16_t vsp;               /* 垂直滚动起始地址 */
+    uint8_t cmd;                /* 当前命令 */
+    uint8_t has_cmd;
+    uint8_t param[SIM_PARAM_MAX];
+    uint32_t param_len;
+    uint8_t pixel_hi;           /* 像素的高字节 */
+    uint8_t pixel_half;         /* 已收到像素的高字节 */
+} st7789_t;
+
+static uint16_t m_gram[LCD_SIM_GRAM_H][LCD_SIM_GRAM_W];
+static st7789_t m_panel;
+
+/* 每组GPIO的引脚数，以及每个数据寄存器控制的引脚数 */
+#define SIM_GPIO_PORT_PINS  32
+#define SIM_GPIO_REG_PINS   16
+#define SIM_GPIO_WE_SHIFT   16
+
+struct GPIO_REG g_lz_sim_gpio[LZ_SIM_GPIO_PORT_NUM];
+
+/* GPIO电平与移位寄存器 */
+static uint8_t m_pins[LZ_SIM_GPIO_NUM];
+static uint8_t m_shift;
+static uint8_t m_shift_bits;
+static uint8_t m_spi_mode = 0;
+
+static lcd_sim_stats_t m_stats;
+static uint64_t m_bits;
+static uint32_t m_clock_hz = 50000000;
+static uint32_t m_cs_gap_ns = 0;
+static uint32_t m_gpio_ns = 0;
+static uint32_t m_reg_ns = 0;
+
+static void panel_reset(void)
+{
+    memset(&m_panel, 0, sizeof(m_panel));
+    m_panel.sleep = 1;
+    m_panel.colmod = 0x66;
+    m_panel.xe = LCD_SIM_GRAM_W - 1;
+    m_panel.ye = LCD_SIM_GRAM_H - 1;
+    m_panel.vsa = LCD_SIM_GRAM_H;
+}
+
+/* 两字节大端参数 */
+static uint16_t param16(uint32_t i)
+{
+    return (uint16_t)((m_panel.param[i] << 8) | m_panel.param[i + 1]);
+}
+
+/* 按MADCTL将地址映射到GRAM，超出范围的像素丢弃 */
+static void panel_write_pixel(uint16_t color)
+{
+    uint32_t col = m_panel.cx;
+    uint32_t row = m_panel.cy;
+    uint32_t tmp;
+
+    if (m_panel.madctl & MADCTL_MV) {
+        tmp = col;
+        col = row;
+        row = tmp;
+    }
+    if (m_panel.madctl & MADCTL_MX) {
+        col = LCD_SIM_GRAM_W - 1 - col;
+    }
+    if (m_panel.madctl & MADCTL_MY) {
+        row = LCD_SIM_GRAM_H - 1 - row;
+    }
+    if (col < LCD_SIM_GRAM_W && row < LCD_SIM_GRAM_H) {
+        m_gram[row][col] = color;
+    }
+    m_stats.pixels++;
+
+    /* 写满一行后回到窗口左边，写满窗口后回到窗口起点 */
+    if (m_panel.cx >= m_panel.xe) {
+        m_panel.cx = m_panel.xs;
+        m_panel.cy = (m_panel.cy >= m_panel.ye) ? m_panel.ys : m_panel.cy + 1;
+    } else {
+        m_panel.cx++;
+    }
+}
+
+/* 命令的参数收齐后生效 */
+static void panel_param_done(void)
+{
+    switch (m_panel.cmd) {
+        case ST7789_CASET:
+            if (m_panel.param_len == 4) {
+                m_panel.xs = param16(0);
+                m_panel.xe = param16(2);
+            }
+            break;
+        case ST7789_RASET:
+            if (m_panel.param_len == 4) {
+                m_panel.ys = param16(0);
+                m_panel.ye = param16(2);
+            }
+            break;
+        case ST7789_MADCTL:
+            m_panel.madctl = m_panel.param[0];
+            break;
+        case ST7789_COLMOD:
+            m_panel.colmod = m_panel.param[0];
+            if ((m_panel.colmod & 0x07) != 0x05) {
+                m_stats.errors++;
+            }
+            break;
+        case ST7789_VSCRDEF:
+            if (m_panel.param_len == 6) {
+                m_panel.tfa = param16(0);
+                m_panel.vsa = param16(2);
+                m_panel.bfa = param16(4);
+                if (m_panel.tfa + m_panel.vsa + m_panel.bfa != LCD_SIM_GRAM_H) {
+                    m_stats.errors++;
+                }
+            }
+            break;
+        case ST7789_VSCSAD:
+            if (m_panel.param_len == 2) {
+                m_panel.vsp = param16(0);
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+static void panel_command(uint8_t cmd)
+{
+    m_stats.commands++;
+    m_panel.cmd = cmd;
+    m_panel.has_cmd = 1;
+    m_panel.param_len = 0;
+    m_panel.pixel_half = 0;
+
+    switch (cmd) {
+        case ST7789_SWRESET:
+            panel_reset();
+            break;
+        case ST7789_SLPIN:
+            m_panel.sleep = 1;
+            break;
+        case ST7789_SLPOUT:
+            m_panel.sleep = 0;
+            break;
+        case ST7789_NORON:
+            /* 退出滚动模式 */
+            m_panel.tfa = 0;
+            m_panel.vsa = LCD_SIM_GRAM_H;
+            m_panel.bfa = 0;
+            m_panel.vsp = 0;
+            break;
+        case ST7789_INVOFF:
+            m_panel.inversion = 0;
+            break;
+        case ST7789_INVON:
+            m_panel.inversion = 1;
+            break;
+        case ST7789_DISPOFF:
+            m_panel.display_on = 0;
+            break;
+        case ST7789_DISPON:
+            m_panel.display_on = 1;
+            break;
+        case ST7789_CASET:
+            m_stats.windows++;
+            break;
+        case ST7789_RAMWR:
+            m_panel.cx = m_panel.xs;
+            m_panel.cy = m_panel.ys;
+            break;
+        default:
+            break;
+    }
+}
+
+static void panel_data(uint8_t dat)
+{
+    if (!m_panel.has_cmd) {
+        m_stats.errors++;
+        return;
+    }
+
+    if (m_panel.cmd == ST7789_RAMWR || m_panel.cmd == ST7789_RAMWRC) {
+        if (!m_panel.pixel_half) {
+            m_panel.pixel_hi = dat;
+            m_panel.pixel_half = 1;
+        } else {
+            m_panel.pixel_half = 0;
+            panel_write_pixel((uint16_t)((m_panel.pixel_hi << 8) | dat));
+        }
+        return;
+    }
+
+    if (m_panel.param_len < SIM_PARAM_MAX) {
+        m_panel.param[m_panel.param_len++] = dat;
+    }
+    panel_param_done();
+}
+
+static void panel_byte(uint8_t dat, uint8_t dc)
+{
+    m_stats.bytes++;
+    m_bits += 8;
+    if (dc) {
+        panel_data(dat);
+    } else {
+        panel_command(dat);
+    }
+}
+
+static void bus_begin(void)
+{
+    m_stats.transactions++;
+    m_shift = 0;
+    m_shift_bits = 0;
+}
+
+void lcd_sim_set_timing(uint32_t clock_hz, uint32_t cs_gap_ns, uint32_t gpio_ns, uint32_t reg_ns)
+{
+    m_clock_hz = (clock_hz == 0) ? 1 : clock_hz;
+    m_cs_gap_ns = cs_gap_ns;
+    m_gpio_ns = gpio_ns;
+    m_reg_ns = reg_ns;
+}
+
+void lcd_sim_get_stats(lcd_sim_stats_t *stats)
+{
+    *stats = m_stats;
+    if (!m_spi_mode && (m_gpio_ns != 0 || m_reg_ns != 0)) {
+        /* GPIO模拟的时序由设置电平的耗时决定 */
+        stats->wire_ns = (uint64_t)m_stats.gpio_writes * m_gpio_ns + (uint64_t)m_stats.reg_writes * m_reg_ns;
+    } else {
+        stats->wire_ns = m_bits * NSEC_PER_SEC / m_clock_hz;
+    }
+    stats->wire_ns += (uint64_t)m_stats.transactions * m_cs_gap_ns;
+}
+
+void lcd_sim_reset_stats(void)
+{
+    memset(&m_stats, 0, sizeof(m_stats));
+    m_bits = 0;
+}
+
+uint16_t lcd_sim_get_pixel(uint16_t x, uint16_t y)
+{
+    uint32_t row = y;
+
+    if (x >= LCD_SIM_GRAM_W || y >= LCD_SIM_GRAM_H) {
+        return 0;
+    }
+    /* 滚动区域的第一行显示VSP指向的GRAM行 */
+    if (m_panel.vsa != 0 && y >= m_panel.tfa && y < m_panel.tfa + m_panel.vsa &&
+        m_panel.vsp >= m_panel.tfa && m_panel.vsp < m_panel.tfa + m_panel.vsa) {
+        row = m_panel.tfa + (y - m_panel.tfa + m_panel.vsp - m_panel.tfa) % m_panel.vsa;
+    }
+    return m_gram[row][x];
+}
+
+uint32_t lcd_sim_checksum(void)
+{
+    uint32_t crc = 0xFFFFFFFF;
+    uint16_t x, y;
+    int i;
+
+    for (y = 0; y < LCD_SIM_GRAM_H; y++) {
+        for (x = 0; x < LCD_SIM_GRAM_W; x++) {
+            crc ^= lcd_sim_get_pixel(x, y);
+            for (i = 0; i < 16; i++) {
+                crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+            }
+        }
+    }
+    return ~crc;
+}
+
+unsigned int lcd_sim_save_ppm(const char *path)
+{
+    FILE *fp;
+    uint16_t x, y, color;
+    uint8_t rgb[3];
+
+    fp = fopen(path, "wb");
+    if (fp == NULL) {
+        printf("%s, %d: open %s failed!\n", __FILE__, __LINE__, path);
+        return __LINE__;
+    }
+    fprintf(fp, "P6\n%d %d\n255\n", LCD_SIM_GRAM_W, LCD_SIM_GRAM_H);
+    for (y = 0; y < LCD_SIM_GRAM_H; y++) {
+        for (x = 0; x < LCD_SIM_GRAM_W; x++) {
+            color = lcd_sim_get_pixel(x, y);
+            rgb[0] = (uint8_t)(((color >> 11) & 0x1F) << 3);
+            rgb[1] = (uint8_t)(((color >> 5) & 0x3F) << 2);
+            rgb[2] = (uint8_t)((color & 0x1F) << 3);
+            fwrite(rgb, 1, sizeof(rgb), fp);
+        }
+    }
+    fclose(fp);
+    return 0;
+}
+
+/* 以下为lz_hardware.h的仿真实现 */
+
+unsigned int LzGpioInit(LzGpioName gpio)
+{
+    return (gpio < LZ_SIM_GPIO_NUM) ? LZ_HARDWARE_SUCCESS : LZ_HARDWARE_FAILURE;
+}
+
+unsigned int LzGpioDeinit(LzGpioName gpio)
+{
+    return (gpio < LZ_SIM_GPIO_NUM) ? LZ_HARDWARE_SUCCESS : LZ_HARDWARE_FAILURE;
+}
+
+unsigned int LzGpioSetDir(LzGpioName gpio, uint32_t dir)
+{
+    (void)dir;
+    return (gpio < LZ_SIM_GPIO_NUM) ? LZ_HARDWARE_SUCCESS : LZ_HARDWARE_FAILURE;
+}
+
+/* 引脚电平变化：CS下降沿开始一次传输，RES下降沿复位，CLK上升沿采样MOSI */
+static void sim_pin_set(uint32_t gpio, uint8_t level)
+{
+    uint8_t old = m_pins[gpio];
+
+    m_pins[gpio] = level;
+    if (gpio == SIM_PIN_CS && old && !level) {
+        bus_begin();
+    } else if (gpio == SIM_PIN_RES && old && !level) {
+        panel_reset();
+    } else if (gpio == SIM_PIN_CLK && !old && level && !m_pins[SIM_PIN_CS]) {
+        /* SPI模式3，上升沿采样，高位在前 */
+        m_shift = (uint8_t)((m_shift << 1) | m_pins[SIM_PIN_MOSI]);
+        if (++m_shift_bits == 8) {
+            panel_byte(m_shift, m_pins[SIM_PIN_DC]);
+            m_shift = 0;
+            m_shift_bits = 0;
+        }
+    }
+}
+
+unsigned int LzGpioSetVal(LzGpioName gpio, uint32_t val)
+{
+    if (gpio >= LZ_SIM_GPIO_NUM) {
+        return LZ_HARDWARE_FAILURE;
+    }
+    m_stats.gpio_writes++;
+    sim_pin_set(gpio, val != LZGPIO_LEVEL_LOW);
+    return LZ_HARDWARE_SUCCESS;
+}
+
+/* 数据寄存器的高16位为写使能，只有使能的位才改变电平 */
+void lz_sim_write_reg(volatile uint32_t *reg, uint32_t val)
+{
+    uint32_t port, base, bit;
+
+    m_stats.reg_writes++;
+    for (port = 0; port < LZ_SIM_GPIO_PORT_NUM; port++) {
+        if (reg == &g_lz_sim_gpio[port].SWPORT_DR_L) {
+            base = port * SIM_GPIO_PORT_PINS;
+            break;
+        }
+        if (reg == &g_lz_sim_gpio[port].SWPORT_DR_H) {
+            base = port * SIM_GPIO_PORT_PINS + SIM_GPIO_REG_PINS;
+            break;
+        }
+    }
+    if (port == LZ_SIM_GPIO_PORT_NUM) {
+        *reg = val;
+        return;
+    }
+
+    for (bit = 0; bit < SIM_GPIO_REG_PINS; bit++) {
+        if (val & (1u << (bit + SIM_GPIO_WE_SHIFT))) {
+            sim_pin_set(base + bit, (val >> bit) & 1);
+        }
+    }
+}
+
+unsigned int SpiIoInit(SpiBusIo bus)
+{
+    (void)bus;
+    return LZ_HARDWARE_SUCCESS;
+}
+
+unsigned int LzSpiInit(unsigned int id, LzSpiConfig conf)
+{
+    (void)id;
+    (void)conf;
+    m_spi_mode = 1;
+    return LZ_HARDWARE_SUCCESS;
+}
+
+unsigned int LzSpiDeinit(unsigned int id)
+{
+    (void)id;
+    return LZ_HARDWARE_SUCCESS;
+}
+
+unsigned int LzSpiWrite(unsigned int id, unsigned int cs, const void *buf, unsigned int len)
+{
+    const uint8_t *p = buf;
+
+    (void)id;
+    (void)cs;
+    bus_begin();
+    while (len--) {
+        panel_byte(*p++, m_pins[SIM_PIN_DC]);
+    }
+    return LZ_HARDWARE_SUCCESS;
+}
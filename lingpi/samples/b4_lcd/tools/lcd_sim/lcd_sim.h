@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef _LCD_SIM_H_
+#define _LCD_SIM_H_
+
+#include <stdint.h>
+
+/* ST7789的显存大小(竖屏方向) */
+#define LCD_SIM_GRAM_W      240
+#define LCD_SIM_GRAM_H      320
+
+/* 仿真总线统计 */
+typedef struct {
+    uint32_t transactions;  /* 总线传输次数(GPIO模式为CS有效的次数，SPI模式为LzSpiWrite的次数) */
+    uint32_t bytes;         /* 发送的字节数 */
+    uint32_t commands;      /* 命令字节数 */
+    uint32_t windows;       /* 设置列地址(0x2A)的次数 */
+    uint32_t pixels;        /* 写入GRAM的像素数 */
+    uint32_t gpio_writes;   /* 调用LzGpioSetVal的次数 */
+    uint32_t reg_writes;    /* 直接写GPIO数据寄存器的次数 */
+    uint32_t errors;        /* 协议错误次数，例如没有命令的数据、COLMOD不是16位等 */
+    uint64_t wire_ns;       /* 按总线时钟估算的传输时间(纳秒) */
+} lcd_sim_stats_t;
+
+/***************************************************************
+ * 函数名称: lcd_sim_set_timing
+ * 说    明: 设置估算总线时间使用的参数
+ * 参    数:
+ *       @clock_hz：SPI时钟频率
+ *       @cs_gap_ns：每次总线传输的固定开销(纳秒)
+ *       @gpio_ns：GPIO模式下每次调用LzGpioSetVal的耗时(纳秒)
+ *       @reg_ns：GPIO模式下每次写数据寄存器的耗时(纳秒)，与gpio_ns都为0时按时钟计算
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_sim_set_timing(uint32_t clock_hz, uint32_t cs_gap_ns, uint32_t gpio_ns, uint32_t reg_ns);
+
+
+/***************************************************************
+ * 函数名称: lcd_sim_get_stats
+ * 说    明: 获取仿真总线统计
+ * 参    数:
+ *       @stats：存放统计结果
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_sim_get_stats(lcd_sim_stats_t *stats);
+
+
+/***************************************************************
+ * 函数名称: lcd_sim_reset_stats
+ * 说    明: 清零仿真总线统计
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+void lcd_sim_reset_stats(void);
+
+
+/***************************************************************
+ * 函数名称: lcd_sim_get_pixel
+ * 说    明: 读取屏幕上显示的像素，已计入垂直滚动
+ * 参    数:
+ *       @x：物理列(0~239)
+ *       @y：物理行(0~319)
+ * 返 回 值: RGB565颜色
+ ***************************************************************/
+uint16_t lcd_sim_get_pixel(uint16_t x, uint16_t y);
+
+
+/***************************************************************
+ * 函数名称: lcd_sim_checksum
+ * 说    明: 计算屏幕显示内容的CRC32，用于回归比较
+ * 参    数: 无
+ * 返 回 值: CRC32
+ ***************************************************************/
+uint32_t lcd_sim_checksum(void);
+
+
+/***************************************************************
+ * 函数名称: lcd_sim_save_ppm
+ * 说    明: 将屏幕显示内容保存为PPM(P6)图片，按物理竖屏方向输出
+ * 参    数:
+ *       @path：文件路径
+ * 返 回 值: 返回0为成功，反之为失败
+ ***************************************************************/
+unsigned int lcd_sim_save_ppm(const char *path);
+
+#endif /* _LCD_SIM_H_ */
@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*
+ * 主机仿真用的LiteOS-M接口，任务、信号量、互斥锁和事件映射到pthread。
+ * 超时以毫秒计(按1ms一个tick)，LOS_Msleep不休眠，以免拖慢基准测试。
+ */
+#include <errno.h>
+#include <pthread.h>
+#include <time.h>
+#include "los_task.h"
+#include "los_sem.h"
+#include "los_mux.h"
+#include "los_event.h"
+
+/* 信号量和互斥锁的最大数目 */
+#define LOS_SHIM_SEM_MAX    8
+#define LOS_SHIM_MUX_MAX    8
+
+#define MSEC_PER_SEC        1000
+#define NSEC_PER_MSEC       1000000
+#define NSEC_PER_SEC        1000000000
+
+typedef struct {
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    uint32_t count;
+} los_shim_sem_t;
+
+static los_shim_sem_t m_sems[LOS_SHIM_SEM_MAX];
+static unsigned int m_sem_num = 0;
+static pthread_mutex_t m_muxes[LOS_SHIM_MUX_MAX];
+static unsigned int m_mux_num = 0;
+
+/* 所有事件共用一把锁和一个条件变量 */
+static pthread_mutex_t m_event_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t m_event_cond = PTHREAD_COND_INITIALIZER;
+
+/* 计算timeout毫秒之后的绝对时间 */
+static void los_shim_deadline(uint32_t timeout, struct timespec *ts)
+{
+    clock_gettime(CLOCK_REALTIME, ts);
+    ts->tv_sec += timeout / MSEC_PER_SEC;
+    ts->tv_nsec += (long)(timeout % MSEC_PER_SEC) * NSEC_PER_MSEC;
+    if (ts->tv_nsec >= NSEC_PER_SEC) {
+        ts->tv_sec++;
+        ts->tv_nsec -= NSEC_PER_SEC;
+    }
+}
+
+/* 等待条件变量，返回0为被唤醒，反之为超时 */
+static int los_shim_wait(pthread_cond_t *cond, pthread_mutex_t *lock, uint32_t timeout)
+{
+    struct timespec ts;
+
+    if (timeout == LOS_NO_WAIT) {
+        return ETIMEDOUT;
+    }
+    if (timeout == LOS_WAIT_FOREVER) {
+        return pthread_cond_wait(cond, lock);
+    }
+    los_shim_deadline(timeout, &ts);
+    return pthread_cond_timedwait(cond, lock, &ts);
+}
+
+unsigned int LOS_TaskCreate(unsigned int *taskID, TSK_INIT_PARAM_S *initParam)
+{
+    static unsigned int task_num = 0;
+    pthread_t thread;
+
+    if (pthread_create(&thread, NULL, initParam->pfnTaskEntry, (void *)(uintptr_t)initParam->uwArg) != 0) {
+        return LOS_NOK;
+    }
+    pthread_detach(thread);
+    *taskID = ++task_num;
+    return LOS_OK;
+}
+
+unsigned int LOS_Msleep(uint32_t msecs)
+{
+    (void)msecs;
+    return LOS_OK;
+}
+
+unsigned int LOS_SemCreate(uint16_t count, unsigned int *semHandle)
+{
+    los_shim_sem_t *sem;
+
+    if (m_sem_num >= LOS_SHIM_SEM_MAX) {
+        return LOS_NOK;
+    }
+    sem = &m_sems[m_sem_num];
+    pthread_mutex_init(&sem->lock, NULL);
+    pthread_cond_init(&sem->cond, NULL);
+    sem->count = count;
+    *semHandle = m_sem_num++;
+    return LOS_OK;
+}
+
+unsigned int LOS_SemPend(unsigned int semHandle, uint32_t timeout)
+{
+    los_shim_sem_t *sem = &m_sems[semHandle];
+    unsigned int ret = LOS_OK;
+
+    pthread_mutex_lock(&sem->lock);
+    while (sem->count == 0) {
+        if (los_shim_wait(&sem->cond, &sem->lock, timeout) == ETIMEDOUT) {
+            ret = LOS_NOK;
+            break;
+        }
+    }
+    if (ret == LOS_OK) {
+        sem->count--;
+    }
+    pthread_mutex_unlock(&sem->lock);
+    return ret;
+}
+
+unsigned int LOS_SemPost(unsigned int semHandle)
+{
+    los_shim_sem_t *sem = &m_sems[semHandle];
+
+    pthread_mutex_lock(&sem->lock);
+    sem->count++;
+    pthread_cond_signal(&sem->cond);
+    pthread_mutex_unlock(&sem->lock);
+    return LOS_OK;
+}
+
+unsigned int LOS_MuxCreate(unsigned int *muxHandle)
+{
+    pthread_mutexattr_t attr;
+
+    if (m_mux_num >= LOS_SHIM_MUX_MAX) {
+        return LOS_NOK;
+    }
+    /* LiteOS-M的互斥锁可以被同一任务重复获取 */
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(&m_muxes[m_mux_num], &attr);
+    pthread_mutexattr_destroy(&attr);
+    *muxHandle = m_mux_num++;
+    return LOS_OK;
+}
+
+unsigned int LOS_MuxPend(unsigned int muxHandle, uint32_t timeout)
+{
+    (void)timeout;
+    return (pthread_mutex_lock(&m_muxes[muxHandle]) == 0) ? LOS_OK : LOS_NOK;
+}
+
+unsigned int LOS_MuxPost(unsigned int muxHandle)
+{
+    return (pthread_mutex_unlock(&m_muxes[muxHandle]) == 0) ? LOS_OK : LOS_NOK;
+}
+
+unsigned int LOS_EventInit(EVENT_CB_S *eventCB)
+{
+    eventCB->uwEventID = 0;
+    return LOS_OK;
+}
+
+unsigned int LOS_EventRead(EVENT_CB_S *eventCB, uint32_t eventMask, uint32_t mode, uint32_t timeout)
+{
+    uint32_t events = 0;
+
+    pthread_mutex_lock(&m_event_lock);
+    while (1) {
+        if (mode & LOS_WAITMODE_AND) {
+            events = ((eventCB->uwEventID & eventMask) == eventMask) ? eventMask : 0;
+        } else {
+            events = eventCB->uwEventID & eventMask;
+        }
+        if (events != 0 || los_shim_wait(&m_event_cond, &m_event_lock, timeout) == ETIMEDOUT) {
+            break;
+        }
+    }
+    if (events != 0 && (mode & LOS_WAITMODE_CLR)) {
+        eventCB->uwEventID &= ~events;
+    }
+    pthread_mutex_unlock(&m_event_lock);
+    return events;
+}
+
+unsigned int LOS_EventWrite(EVENT_CB_S *eventCB, uint32_t events)
+{
+    pthread_mutex_lock(&m_event_lock);
+    eventCB->uwEventID |= events;
+    pthread_cond_broadcast(&m_event_cond);
+    pthread_mutex_unlock(&m_event_lock);
+    return LOS_OK;
+}
+
+unsigned int LOS_EventClear(EVENT_CB_S *eventCB, uint32_t events)
+{
+    pthread_mutex_lock(&m_event_lock);
+    eventCB->uwEventID &= events;
+    pthread_mutex_unlock(&m_event_lock);
+    return LOS_OK;
+}
@@ -19,6 +19,10 @@
 #define OLED_COLUMN_MAX         128
 #define OLED_ROW_MAX            64
 
+/* 显示和画图函数先修改显存，默认在返回前自动调用oled_flush写入OLED；
+ * oled_set_auto_flush(0)后只修改显存，调用oled_flush后才写入OLED
+ */
+
 /* 定义OLED字体大小 */
 #define OLED_CHR_SIZE_12        12
 #define OLED_CHR_SIZE_16        16
@@ -61,13 +65,50 @@ void oled_display_off(void);
 
 /***************************************************************
  * 函数名称: oled_clear
- * 说    明: oled清空
+ * 说    明: oled清屏
  * 参    数: 无
  * 返 回 值: 无
  ***************************************************************/
 void oled_clear(void);
 
 
+/***************************************************************
+ * 函数名称: oled_flush
+ * 说    明: 把显存中有变化的部分写入OLED，没有变化时不产生任何I2C
+ *           传输。页寻址时每页只发送脏列范围内的数据；整帧模式下
+ *           所有脏页的外接窗口作为一次连续的数据流发送
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+void oled_flush(void);
+
+
+/***************************************************************
+ * 函数名称: oled_set_frame_mode
+ * 说    明: 切换整帧模式。整帧模式使用SSD1306的水平寻址，
+ *           oled_flush把变化的区域作为一个窗口连续发送，适合大部分
+ *           内容每帧都变化的动画和曲线；默认的页寻址模式适合只有
+ *           少量文字变化的界面。须在oled_init之后调用
+ * 参    数:
+ *      @enable：1为整帧模式，0为页寻址模式
+ * 返 回 值: 无
+ ***************************************************************/
+void oled_set_frame_mode(uint8_t enable);
+
+
+/***************************************************************
+ * 函数名称: oled_set_auto_flush
+ * 说    明: 切换自动刷新。自动刷新时每个显示和画图函数返回前调用
+ *           oled_flush，效果与直接写OLED相同，oled_init后默认开启；
+ *           关闭后多次绘制只修改显存，由调用者在一帧画完后调用
+ *           oled_flush一次发送
+ * 参    数:
+ *      @enable：1为自动刷新，0为手动调用oled_flush
+ * 返 回 值: 无
+ ***************************************************************/
+void oled_set_auto_flush(uint8_t enable);
+
+
 /***************************************************************
  * 函数名称: oled_show_char
  * 说    明: oled显示字符
@@ -122,4 +163,16 @@ void oled_show_string(uint8_t x, uint8_t y, uint8_t *p, uint8_t chr_size);
 void oled_draw_bmp(unsigned char x0, unsigned char y0, unsigned char x1, unsigned char y1, unsigned char bmp[]);
 
 
+/***************************************************************
+ * 函数名称: oled_draw_point
+ * 说    明: oled画点
+ * 参    数:
+ *      @x：点的X轴坐标，取值为0~127
+ *      @y：点的Y轴坐标，取值为0~63
+ *      @mode：1为点亮，0为熄灭
+ * 返 回 值: 无
+ ***************************************************************/
+void oled_draw_point(uint8_t x, uint8_t y, uint8_t mode);
+
+
 #endif /* _OLED_H_ */
\ No newline at end of file
@@ -53,6 +53,8 @@ void oled_process(void)
     int i = 0;
 
     oled_init();
+    /* 每次循环画完所有字符串后统一刷新 */
+    oled_set_auto_flush(0);
     oled_clear();
 
     while (1) {
@@ -63,6 +65,8 @@ void oled_process(void)
 
         snprintf(buffer, sizeof(buffer), "%d Sec!", i++);
         oled_show_string(OLED_STRING4_X, OLED_STRING4_Y, buffer, OLED_STRING4_SIZE);
+        /* 只有秒数变化，每次只刷新这几列 */
+        oled_flush();
 
         printf("\n\n");
         LOS_Msleep(WAIT_MSEC);
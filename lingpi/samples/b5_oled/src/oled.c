@@ -12,6 +12,7 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <string.h>
 #include "lz_hardware.h"
 #include "oled.h"
 #include "oled_font.h"
@@ -67,13 +68,85 @@ static I2cBusIo m_i2cBus = {
 static unsigned int m_i2c_freq = 400000;
 #endif
 
-/* 定义OLED读写操作 */
-#define OLED_CMD            0 // OLED的命令操作标记
-#define OLED_DATA           1 // OLED的数据操作标记
+/* I2C传输的控制字节，通知OLED芯片后面的字节都是命令或都是数据 */
+#define OLED_CONTROL_CMD    0x00
+#define OLED_CONTROL_DATA   0x40
+
+/* 一次I2C传输最多发送的命令或数据字节数(不含控制字节)，默认为一整页。
+ * 整帧模式下设为1024时，整个屏幕只用一次传输
+ */
+#ifndef OLED_BURST_MAX
+#define OLED_BURST_MAX      128
+#endif
+
+/* SSD1306的寻址方式命令和参数 */
+#define OLED_CMD_ADDRESSING     0x20
+#define OLED_CMD_COLUMN_RANGE   0x21
+#define OLED_CMD_PAGE_RANGE     0x22
+#define OLED_ADDRESSING_HORIZONTAL  0x00
+#define OLED_ADDRESSING_PAGE        0x02
 
 /* 字节的bits数目 */
 #define BYTE_TO_BITS        8
 
+/* OLED的页数，每页8行 */
+#define OLED_PAGE_MAX       (OLED_ROW_MAX / BYTE_TO_BITS)
+
+/* 一页中变化的列范围，没有变化时x1为OLED_COLUMN_MAX、x2为0 */
+typedef struct {
+    uint8_t x1;
+    uint8_t x2;
+} oled_dirty_t;
+
+/* 显存，排列与SSD1306的GRAM相同：每页128字节，每个字节为一列中的8行，低位在上 */
+static uint8_t m_gram[OLED_PAGE_MAX][OLED_COLUMN_MAX];
+/* 每页的脏列范围 */
+static oled_dirty_t m_dirty[OLED_PAGE_MAX];
+/* 是否为整帧模式(水平寻址) */
+static uint8_t m_frame_mode = 0;
+/* 显示和画图函数返回前是否自动调用oled_flush */
+static uint8_t m_auto_flush = 1;
+
+/* 初始化命令，在一次传输中发送 */
+static const uint8_t m_init_cmds[] = {
+    0xAE,   // --display off
+    0x20,   // set memory addressing mode
+    0x02,   // --page addressing，MCU复位而OLED未断电时也从页寻址开始
+    0x00,   // ---set low column address
+    0x10,   // ---set high column address
+    0x40,   // --set start line address
+    0xB0,   // --set page address
+    0x81,   // contract control
+    0xFF,   // --128
+    0xA1,   // set segment remap
+    0xA6,   // --normal / reverse
+    0xA8,   // --set multiplex ratio(1 to 64)
+    0x3F,   // --1/32 duty
+    0xC8,   // Com scan direction
+    0xD3,   // -set display offset
+    0x00,
+
+    0xD5,   // set osc division
+    0x80,
+
+    0xD8,   // set area color mode off
+    0x05,
+
+    0xD9,   // Set Pre-Charge Period
+    0xF1,
+
+    0xDA,   // set com pin configuartion
+    0x12,
+
+    0xDB,   // set Vcomh
+    0x30,
+
+    0x8D,   // set charge pump enable
+    0x14,
+
+    0xAF,   // --turn on oled panel
+};
+
 /***************************************************************
  * 函数名称: oled_pow
  * 说    明: 计算m^n
@@ -166,118 +239,186 @@ static inline void write_iic_byte(unsigned char iic_byte)
 
 
 /***************************************************************
- * 函数名称: write_iic_command
- * 说    明: 通过i2c通信协议，往芯片写入一个命令
+ * 函数名称: write_iic_begin
+ * 说    明: 开始一次i2c传输，发送从设备地址和控制字节
  * 参    数:
- *      @IIC_Command：命令数值
+ *      @control：控制字节，OLED_CONTROL_CMD或OLED_CONTROL_DATA
  * 返 回 值: 无
  ***************************************************************/
-static inline void write_iic_command(unsigned char iic_command)
+static void write_iic_begin(unsigned char control)
 {
     iic_start();
     /* 从设备地址 + SA0, SA0=0表示写操作 */
     write_iic_byte((OLED_I2C_ADDRESS << 1) | 0x0);
     iic_wait_ack();
-    /* 通知芯片，下一个字节是命令 */
-    write_iic_byte(0x00);
+    /* 通知芯片，后面的字节是命令或数据 */
+    write_iic_byte(control);
     iic_wait_ack();
-    write_iic_byte(iic_command);
-    iic_wait_ack();
-    iic_stop();
 }
 
 
 /***************************************************************
- * 函数名称: write_iic_data
- * 说    明: 通过i2c通信协议，往芯片写入一个数据
+ * 函数名称: write_iic_write
+ * 说    明: 在当前传输中继续写入多个命令或数据
  * 参    数:
- *      @IIC_Data：数据数值
+ *      @buf：命令或数据
+ *      @len：命令或数据的字节数
  * 返 回 值: 无
  ***************************************************************/
-static inline void write_iic_data(unsigned char iic_data)
+static void write_iic_write(const unsigned char *buf, unsigned int len)
+{
+    unsigned int i;
+
+    for (i = 0; i < len; i++) {
+        write_iic_byte(buf[i]);
+        iic_wait_ack();
+    }
+}
+
+
+/***************************************************************
+ * 函数名称: write_iic_end
+ * 说    明: 结束当前传输
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+static void write_iic_end(void)
 {
-    iic_start();
-    /* 从设备地址 + SA0, SA0=0表示写操作 */
-    write_iic_byte((OLED_I2C_ADDRESS << 1) | 0x0);
-    iic_wait_ack();
-    /* 通知芯片，下一个字节是数据 */
-    write_iic_byte(0x40);
-    iic_wait_ack();
-    write_iic_byte(iic_data);
-    iic_wait_ack();
     iic_stop();
 }
 #else
+/* 传输缓冲区，第一个字节为控制字节 */
+static unsigned char m_iic_buf[OLED_BURST_MAX + 1];
+/* 缓冲区中的字节数(含控制字节) */
+static unsigned int m_iic_len = 0;
+
+
 /***************************************************************
- * 函数名称: write_iic_command
- * 说    明: 通过i2c通信协议，往芯片写入一个命令
- * 参    数:
- *      @IIC_Command：命令数值
+ * 函数名称: write_iic_send
+ * 说    明: 把缓冲区中的控制字节和命令或数据在一次传输中发送，
+ *           保留控制字节供下一次传输使用
+ * 参    数: 无
  * 返 回 值: 无
  ***************************************************************/
-static inline void write_iic_command(unsigned char iic_command)
+static void write_iic_send(void)
 {
-#define BUFFER_MAXSIZE      2 /* 字符串长度 */
-    unsigned char buffer[BUFFER_MAXSIZE];
     unsigned int ret;
 
-    /* 填充数据，第一个字节是通知OLED芯片，下一个字节是命令 */
-    buffer[0] = 0x00;
-    buffer[1] = iic_command;
-    ret = LzI2cWrite(OLED_I2C_BUS, OLED_I2C_ADDRESS, buffer, BUFFER_MAXSIZE);
+    if (m_iic_len <= 1) {
+        return;
+    }
+    ret = LzI2cWrite(OLED_I2C_BUS, OLED_I2C_ADDRESS, m_iic_buf, m_iic_len);
     if (ret != 0) {
         printf("%s, %s, %d: LzI2cWrite failed(%d)!\n", __FILE__, __func__, __LINE__, ret);
     }
+    m_iic_len = 1;
 }
 
 
 /***************************************************************
- * 函数名称: write_iic_data
- * 说    明: 通过i2c通信协议，往芯片写入一个数据
+ * 函数名称: write_iic_begin
+ * 说    明: 开始向芯片写入命令或数据
  * 参    数:
- *      @iic_data：数据数值
+ *      @control：控制字节，OLED_CONTROL_CMD或OLED_CONTROL_DATA
  * 返 回 值: 无
  ***************************************************************/
-static inline void write_iic_data(unsigned char iic_data)
+static void write_iic_begin(unsigned char control)
 {
-#define BUFFER_MAXSIZE      2   /* 字符串长度 */
-    unsigned char buffer[BUFFER_MAXSIZE];
-    unsigned int ret;
+    /* 第一个字节通知OLED芯片，后面的字节是命令或数据 */
+    m_iic_buf[0] = control;
+    m_iic_len = 1;
+}
 
-    /* 填充数据，第一个字节是通知OLED芯片，下一个字节是数据 */
-    buffer[0] = 0x40;
-    buffer[1] = iic_data;
-    ret = LzI2cWrite(OLED_I2C_BUS, OLED_I2C_ADDRESS, buffer, BUFFER_MAXSIZE);
-    if (ret != 0) {
-        printf("%s, %s, %d: LzI2cWrite failed(%d)!\n", __FILE__, __func__, __LINE__, ret);
+
+/***************************************************************
+ * 函数名称: write_iic_write
+ * 说    明: 把命令或数据放入缓冲区，缓冲区满OLED_BURST_MAX个字节时
+ *           发送一次
+ * 参    数:
+ *      @buf：命令或数据
+ *      @len：命令或数据的字节数
+ * 返 回 值: 无
+ ***************************************************************/
+static void write_iic_write(const unsigned char *buf, unsigned int len)
+{
+    unsigned int n;
+
+    while (len > 0) {
+        n = sizeof(m_iic_buf) - m_iic_len;
+        n = (len > n) ? n : len;
+        memcpy(&m_iic_buf[m_iic_len], buf, n);
+        m_iic_len += n;
+        buf += n;
+        len -= n;
+        if (m_iic_len == sizeof(m_iic_buf)) {
+            write_iic_send();
+        }
     }
 }
+
+
+/***************************************************************
+ * 函数名称: write_iic_end
+ * 说    明: 发送缓冲区中剩余的命令或数据
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+static void write_iic_end(void)
+{
+    write_iic_send();
+}
 #endif
 
 
 /***************************************************************
- * 函数名称: oled_wr_byte
- * 说    明: 往芯片写数据
+ * 函数名称: write_iic_burst
+ * 说    明: 通过i2c通信协议往芯片写入多个命令或数据，每次传输发送
+ *           一个控制字节和最多OLED_BURST_MAX个字节
  * 参    数:
- *      @data：数据数值
- *      @cmd：该数据是命令，还是数据
+ *      @control：控制字节，OLED_CONTROL_CMD或OLED_CONTROL_DATA
+ *      @buf：命令或数据
+ *      @len：命令或数据的字节数
  * 返 回 值: 无
  ***************************************************************/
-static inline void oled_wr_byte(unsigned dat, unsigned cmd)
+static void write_iic_burst(unsigned char control, const unsigned char *buf, unsigned int len)
 {
-    if (cmd == OLED_DATA) {
-        write_iic_data(dat);
-    } else if (cmd == OLED_CMD) {
-        write_iic_command(dat);
-    } else {
-        printf("%s, %s, %d: cmd(%d) out of the range!\n", __FILE__, __func__, __LINE__, cmd);
-    }
+    write_iic_begin(control);
+    write_iic_write(buf, len);
+    write_iic_end();
+}
+
+
+/***************************************************************
+ * 函数名称: oled_write_cmd_burst
+ * 说    明: 往芯片连续写入多个命令，命令的参数紧跟在命令后面
+ * 参    数:
+ *      @cmds：命令
+ *      @len：命令的字节数
+ * 返 回 值: 无
+ ***************************************************************/
+static inline void oled_write_cmd_burst(const uint8_t *cmds, uint32_t len)
+{
+    write_iic_burst(OLED_CONTROL_CMD, cmds, len);
+}
+
+
+/***************************************************************
+ * 函数名称: oled_write_data_burst
+ * 说    明: 往芯片的GRAM连续写入多个数据，写入位置按寻址方式自动移动
+ * 参    数:
+ *      @data：数据
+ *      @len：数据的字节数
+ * 返 回 值: 无
+ ***************************************************************/
+static inline void oled_write_data_burst(const uint8_t *data, uint32_t len)
+{
+    write_iic_burst(OLED_CONTROL_DATA, data, len);
 }
 
 
 /***************************************************************
  * 函数名称: oled_set_pos
- * 说    明: 坐标设置
+ * 说    明: 坐标设置，3个命令在一次传输中发送
  * 参    数:
  *      @x：X轴坐标
  *      @y：Y轴坐标
@@ -286,11 +427,58 @@ static inline void oled_wr_byte(unsigned dat, unsigned cmd)
 static inline void oled_set_pos(unsigned char x, unsigned char y)
 {
 #define BYTE_DIV        4 /* 截取字节部分 */
-    oled_wr_byte(0xb0 + y, OLED_CMD);
-    oled_wr_byte(((x & 0xf0) >> BYTE_DIV) | 0x10, OLED_CMD);
-    oled_wr_byte((x & 0x0f), OLED_CMD);
+    uint8_t cmds[] = {
+        0xb0 + y,                               // 设置页地址（0~7）
+        ((x & 0xf0) >> BYTE_DIV) | 0x10,        // 设置显示位置—列高地址
+        (x & 0x0f),                             // 设置显示位置—列低地址
+    };
+
+    oled_write_cmd_burst(cmds, sizeof(cmds));
 }
 
+
+/***************************************************************
+ * 函数名称: oled_mark_dirty
+ * 说    明: 把一页中的[x1, x2]列并入这一页的脏列范围
+ * 参    数:
+ *      @page：页地址
+ *      @x1：起始列
+ *      @x2：结束列
+ * 返 回 值: 无
+ ***************************************************************/
+static inline void oled_mark_dirty(uint8_t page, uint8_t x1, uint8_t x2)
+{
+    if (x1 < m_dirty[page].x1) {
+        m_dirty[page].x1 = x1;
+    }
+    if (x2 > m_dirty[page].x2) {
+        m_dirty[page].x2 = x2;
+    }
+}
+
+
+/***************************************************************
+ * 函数名称: oled_gram_set
+ * 说    明: 修改显存中的一个字节，内容有变化时才标记为脏，
+ *           超出屏幕的部分被忽略
+ * 参    数:
+ *      @x：列地址
+ *      @page：页地址
+ *      @dat：8行像素，低位在上
+ * 返 回 值: 无
+ ***************************************************************/
+static inline void oled_gram_set(uint8_t x, uint8_t page, uint8_t dat)
+{
+    if (x >= OLED_COLUMN_MAX || page >= OLED_PAGE_MAX) {
+        return;
+    }
+    if (m_gram[page][x] != dat) {
+        m_gram[page][x] = dat;
+        oled_mark_dirty(page, x, x);
+    }
+}
+
+
 /***************************************************************
  * 函数名称: oled_init
  * 说    明: oled初始化
@@ -300,6 +488,7 @@ static inline void oled_set_pos(unsigned char x, unsigned char y)
 unsigned int oled_init(void)
 {
     uint32_t sleep_msec = 200;
+    uint8_t i;
 #if !OLED_I2C_ENABLE
     /* GPIO0_C1 => I2C1_SDA_M1 */
     LzGpioInit(GPIO_I2C_SDA);
@@ -310,50 +499,27 @@ unsigned int oled_init(void)
 #else
     if (I2cIoInit(m_i2cBus) != LZ_HARDWARE_SUCCESS) {
         printf("%s, %d: I2cIoInit failed!\n", __FILE__, __LINE__);
-        return __FILE__;
+        return __LINE__;
     }
     if (LzI2cInit(OLED_I2C_BUS, m_i2c_freq) != LZ_HARDWARE_SUCCESS) {
         printf("%s, %d: I2cIoInit failed!\n", __FILE__, __LINE__);
-        return __FILE__;
+        return __LINE__;
     }
 #endif
 
-    LOS_Msleep(sleep_msec);
-
-    oled_wr_byte(0xAE, OLED_CMD); // --display off
-    oled_wr_byte(0x00, OLED_CMD); // ---set low column address
-    oled_wr_byte(0x10, OLED_CMD); // ---set high column address
-    oled_wr_byte(0x40, OLED_CMD); // --set start line address
-    oled_wr_byte(0xB0, OLED_CMD); // --set page address
-    oled_wr_byte(0x81, OLED_CMD); // contract control
-    oled_wr_byte(0xFF, OLED_CMD); // --128
-    oled_wr_byte(0xA1, OLED_CMD); // set segment remap
-    oled_wr_byte(0xA6, OLED_CMD); // --normal / reverse
-    oled_wr_byte(0xA8, OLED_CMD); // --set multiplex ratio(1 to 64)
-    oled_wr_byte(0x3F, OLED_CMD); // --1/32 duty
-    oled_wr_byte(0xC8, OLED_CMD); // Com scan direction
-    oled_wr_byte(0xD3, OLED_CMD); // -set display offset
-    oled_wr_byte(0x00, OLED_CMD);
-
-    oled_wr_byte(0xD5, OLED_CMD); // set osc division
-    oled_wr_byte(0x80, OLED_CMD);
-
-    oled_wr_byte(0xD8, OLED_CMD); // set area color mode off
-    oled_wr_byte(0x05, OLED_CMD);
-
-    oled_wr_byte(0xD9, OLED_CMD); // Set Pre-Charge Period
-    oled_wr_byte(0xF1, OLED_CMD);
-
-    oled_wr_byte(0xDA, OLED_CMD); // set com pin configuartion
-    oled_wr_byte(0x12, OLED_CMD);
+    /* 上电后GRAM的内容不确定，第一次oled_flush刷新整个屏幕 */
+    memset(m_gram, 0, sizeof(m_gram));
+    for (i = 0; i < OLED_PAGE_MAX; i++) {
+        m_dirty[i].x1 = 0;
+        m_dirty[i].x2 = OLED_COLUMN_MAX - 1;
+    }
 
-    oled_wr_byte(0xDB, OLED_CMD); // set Vcomh
-    oled_wr_byte(0x30, OLED_CMD);
+    m_frame_mode = 0;
+    m_auto_flush = 1;
 
-    oled_wr_byte(0x8D, OLED_CMD); // set charge pump enable
-    oled_wr_byte(0x14, OLED_CMD);
+    LOS_Msleep(sleep_msec);
 
-    oled_wr_byte(0xAF, OLED_CMD); // --turn on oled panel
+    oled_write_cmd_burst(m_init_cmds, sizeof(m_init_cmds));
 
     return 0;
 }
@@ -377,9 +543,23 @@ unsigned int oled_deinit(void)
 }
 
 
+/***************************************************************
+ * 函数名称: oled_auto_flush
+ * 说    明: 显示和画图函数返回前调用，自动刷新模式下把显存写入OLED
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+static inline void oled_auto_flush(void)
+{
+    if (m_auto_flush) {
+        oled_flush();
+    }
+}
+
+
 /***************************************************************
  * 函数名称: oled_clear
- * 说    明: oled清空
+ * 说    明: oled清屏
  * 参    数: 无
  * 返 回 值: 无
  ***************************************************************/
@@ -387,14 +567,126 @@ void oled_clear(void)
 {
     uint8_t i, n;
 
-    for (i = 0; i < BYTE_TO_BITS; i++) {
-        oled_wr_byte(0xb0 + i, OLED_CMD);   // 设置页地址（0~7）
-        oled_wr_byte(0x00, OLED_CMD);       // 设置显示位置—列低地址
-        oled_wr_byte(0x10, OLED_CMD);       // 设置显示位置—列高地址
+    for (i = 0; i < OLED_PAGE_MAX; i++) {
         for (n = 0; n < OLED_COLUMN_MAX; n++) {
-            oled_wr_byte(0, OLED_DATA);
+            oled_gram_set(n, i, 0);
+        }
+    }
+    oled_auto_flush();
+}
+
+
+/***************************************************************
+ * 函数名称: oled_flush_frame
+ * 说    明: 整帧模式的刷新：取所有脏页的最小外接窗口，设置一次列范围
+ *           和页范围后，窗口内的数据按水平寻址连续发送，中间不再设置
+ *           地址。窗口内没有变化的页也会重新发送
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+static void oled_flush_frame(void)
+{
+    uint8_t x1 = OLED_COLUMN_MAX, x2 = 0;
+    uint8_t p1 = OLED_PAGE_MAX, p2 = 0;
+    uint8_t cmds[6];
+    uint8_t i;
+
+    for (i = 0; i < OLED_PAGE_MAX; i++) {
+        if (m_dirty[i].x1 > m_dirty[i].x2) {
+            continue;
         }
+        p1 = (i < p1) ? i : p1;
+        p2 = i;
+        x1 = (m_dirty[i].x1 < x1) ? m_dirty[i].x1 : x1;
+        x2 = (m_dirty[i].x2 > x2) ? m_dirty[i].x2 : x2;
+    }
+    if (p1 > p2) {
+        return;
     }
+
+    /* 列范围和页范围，写入位置回到窗口左上角 */
+    cmds[0] = OLED_CMD_COLUMN_RANGE;
+    cmds[1] = x1;
+    cmds[2] = x2;
+    cmds[3] = OLED_CMD_PAGE_RANGE;
+    cmds[4] = p1;
+    cmds[5] = p2;
+    oled_write_cmd_burst(cmds, sizeof(cmds));
+
+    write_iic_begin(OLED_CONTROL_DATA);
+    for (i = p1; i <= p2; i++) {
+        write_iic_write(&m_gram[i][x1], x2 - x1 + 1);
+        m_dirty[i].x1 = OLED_COLUMN_MAX;
+        m_dirty[i].x2 = 0;
+    }
+    write_iic_end();
+}
+
+
+/***************************************************************
+ * 函数名称: oled_flush
+ * 说    明: 把显存中有变化的部分写入OLED，没有变化时不产生任何I2C
+ *           传输。页寻址时每页只发送脏列范围内的数据；整帧模式下
+ *           所有脏页的外接窗口作为一次连续的数据流发送
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+void oled_flush(void)
+{
+    uint8_t i;
+
+    if (m_frame_mode) {
+        oled_flush_frame();
+        return;
+    }
+
+    for (i = 0; i < OLED_PAGE_MAX; i++) {
+        if (m_dirty[i].x1 > m_dirty[i].x2) {
+            continue;
+        }
+        oled_set_pos(m_dirty[i].x1, i);
+        oled_write_data_burst(&m_gram[i][m_dirty[i].x1], m_dirty[i].x2 - m_dirty[i].x1 + 1);
+        m_dirty[i].x1 = OLED_COLUMN_MAX;
+        m_dirty[i].x2 = 0;
+    }
+}
+
+
+/***************************************************************
+ * 函数名称: oled_set_frame_mode
+ * 说    明: 切换整帧模式。整帧模式使用SSD1306的水平寻址，
+ *           oled_flush把变化的区域作为一个窗口连续发送，适合大部分
+ *           内容每帧都变化的动画和曲线；默认的页寻址模式适合只有
+ *           少量文字变化的界面。须在oled_init之后调用
+ * 参    数:
+ *      @enable：1为整帧模式，0为页寻址模式
+ * 返 回 值: 无
+ ***************************************************************/
+void oled_set_frame_mode(uint8_t enable)
+{
+    uint8_t cmds[] = {
+        OLED_CMD_ADDRESSING,
+        enable ? OLED_ADDRESSING_HORIZONTAL : OLED_ADDRESSING_PAGE,
+    };
+
+    oled_write_cmd_burst(cmds, sizeof(cmds));
+    m_frame_mode = enable ? 1 : 0;
+}
+
+
+/***************************************************************
+ * 函数名称: oled_set_auto_flush
+ * 说    明: 切换自动刷新。自动刷新时每个显示和画图函数返回前调用
+ *           oled_flush，效果与直接写OLED相同，oled_init后默认开启；
+ *           关闭后多次绘制只修改显存，由调用者在一帧画完后调用
+ *           oled_flush一次发送
+ * 参    数:
+ *      @enable：1为自动刷新，0为手动调用oled_flush
+ * 返 回 值: 无
+ ***************************************************************/
+void oled_set_auto_flush(uint8_t enable)
+{
+    m_auto_flush = enable ? 1 : 0;
 }
 
 
@@ -406,9 +698,13 @@ void oled_clear(void)
  ***************************************************************/
 void oled_display_on(void)
 {
-    oled_wr_byte(0X8D, OLED_CMD); // SET DCDC命令
-    oled_wr_byte(0X14, OLED_CMD); // DCDC ON
-    oled_wr_byte(0XAF, OLED_CMD); // DISPLAY ON
+    const uint8_t cmds[] = {
+        0X8D,   // SET DCDC命令
+        0X14,   // DCDC ON
+        0XAF,   // DISPLAY ON
+    };
+
+    oled_write_cmd_burst(cmds, sizeof(cmds));
 }
 
 
@@ -420,15 +716,19 @@ void oled_display_on(void)
  ***************************************************************/
 void oled_display_off(void)
 {
-    oled_wr_byte(0X8D, OLED_CMD); // SET DCDC命令
-    oled_wr_byte(0X10, OLED_CMD); // DCDC OFF
-    oled_wr_byte(0XAE, OLED_CMD); // DISPLAY OFF
+    const uint8_t cmds[] = {
+        0X8D,   // SET DCDC命令
+        0X10,   // DCDC OFF
+        0XAE,   // DISPLAY OFF
+    };
+
+    oled_write_cmd_burst(cmds, sizeof(cmds));
 }
 
 
 /***************************************************************
- * 函数名称: oled_show_char
- * 说    明: oled显示字符
+ * 函数名称: oled_put_char
+ * 说    明: 把字符写入显存，不刷新
  * 参    数:
  *      @x：字符的X轴坐标
  *      @y：字符的Y轴坐标
@@ -436,7 +736,7 @@ void oled_display_off(void)
  *      @chr_size：字符的字体，包括12/16两种字体
  * 返 回 值: 无
  ***************************************************************/
-void oled_show_char(uint8_t x, uint8_t y, uint8_t chr, uint8_t chr_size)
+static void oled_put_char(uint8_t x, uint8_t y, uint8_t chr, uint8_t chr_size)
 {
 #define F8X16_LINE_DATA         8
 #define F6X8_LINE_DATA          6
@@ -453,23 +753,35 @@ void oled_show_char(uint8_t x, uint8_t y, uint8_t chr, uint8_t chr_size)
     }
 
     if (chr_size == OLED_CHR_SIZE_16) {
-        oled_set_pos(x, y);
         for (i = 0; i < F8X16_LINE_DATA; i++) {
-            oled_wr_byte(F8X16[c * 16 + i], OLED_DATA);
-        }
-        oled_set_pos(x, y + 1);
-        for (i = 0; i < F8X16_LINE_DATA; i++) {
-            oled_wr_byte(F8X16[c * CHAR_LEN + i + BYTE_BITS], OLED_DATA);
+            oled_gram_set(x + i, y, F8X16[c * CHAR_LEN + i]);
+            oled_gram_set(x + i, y + 1, F8X16[c * CHAR_LEN + i + BYTE_BITS]);
         }
     } else {
-        oled_set_pos(x, y);
         for (i = 0; i < F6X8_LINE_DATA; i++) {
-            oled_wr_byte(F6x8[c][i], OLED_DATA);
+            oled_gram_set(x + i, y, F6x8[c][i]);
         }
     }
 }
 
 
+/***************************************************************
+ * 函数名称: oled_show_char
+ * 说    明: oled显示字符
+ * 参    数:
+ *      @x：字符的X轴坐标
+ *      @y：字符的Y轴坐标
+ *      @chr：字符
+ *      @chr_size：字符的字体，包括12/16两种字体
+ * 返 回 值: 无
+ ***************************************************************/
+void oled_show_char(uint8_t x, uint8_t y, uint8_t chr, uint8_t chr_size)
+{
+    oled_put_char(x, y, chr, chr_size);
+    oled_auto_flush();
+}
+
+
 /***************************************************************
  * 函数名称: oled_show_num
  * 说    明: oled显示数字
@@ -493,14 +805,15 @@ void oled_show_num(uint8_t x, uint8_t y, uint32_t num, uint8_t len, uint8_t size
         temp = (num / oled_pow(POWER_BASE, len - t - 1)) % POWER_REMINDER;
         if (enshow == 0 && t < (len - 1)) {
             if (temp == 0) {
-                oled_show_char(x + (size2 / div)*t, y, ' ', size2);
+                oled_put_char(x + (size2 / div)*t, y, ' ', size2);
                 continue;
             } else {
                 enshow = 1;
             }
         }
-        oled_show_char(x + (size2 / div)*t, y, temp + '0', size2);
+        oled_put_char(x + (size2 / div)*t, y, temp + '0', size2);
     }
+    oled_auto_flush();
 }
 
 
@@ -521,7 +834,7 @@ void oled_show_string(uint8_t x, uint8_t y, uint8_t *chr, uint8_t chr_size)
     uint8_t offset = 2;
 
     while (chr[j] != '\0') {
-        oled_show_char(x, y, chr[j], chr_size);
+        oled_put_char(x, y, chr[j], chr_size);
         x += x_offset;
         if (x > OLED_COLUMN_MAX) {
             x = 0;
@@ -529,6 +842,7 @@ void oled_show_string(uint8_t x, uint8_t y, uint8_t *chr, uint8_t chr_size)
         }
         j++;
     }
+    oled_auto_flush();
 }
 
 
@@ -556,10 +870,32 @@ void oled_draw_bmp(unsigned char x0, unsigned char y0, unsigned char x1, unsigne
     }
 
     for (y = y0; y < y1; y++) {
-        oled_set_pos(x0, y);
-
         for (x = x0; x < x1; x++) {
-            oled_wr_byte(bmp[j++], OLED_DATA);
+            oled_gram_set(x, y, bmp[j++]);
         }
     }
+    oled_auto_flush();
+}
+
+
+/***************************************************************
+ * 函数名称: oled_draw_point
+ * 说    明: oled画点
+ * 参    数:
+ *      @x：点的X轴坐标，取值为0~127
+ *      @y：点的Y轴坐标，取值为0~63
+ *      @mode：1为点亮，0为熄灭
+ * 返 回 值: 无
+ ***************************************************************/
+void oled_draw_point(uint8_t x, uint8_t y, uint8_t mode)
+{
+    uint8_t page, bit;
+
+    if (x >= OLED_COLUMN_MAX || y >= OLED_ROW_MAX) {
+        return;
+    }
+    page = y / BYTE_TO_BITS;
+    bit = 1 << (y % BYTE_TO_BITS);
+    oled_gram_set(x, page, mode ? (m_gram[page][x] | bit) : (m_gram[page][x] & ~bit));
+    oled_auto_flush();
 }
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/* 主机仿真用的lz_hardware.h，只声明OLED驱动用到的接口，由oled_sim.c实现 */
+#ifndef _LZ_HARDWARE_H_
+#define _LZ_HARDWARE_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include "los_task.h"
+
+#define LZ_HARDWARE_SUCCESS     0
+#define LZ_HARDWARE_FAILURE     1
+
+#define LZGPIO_LEVEL_LOW        0
+#define LZGPIO_LEVEL_HIGH       1
+#define LZGPIO_LEVEL_KEEP       2
+
+#define LZGPIO_DIR_IN           0
+#define LZGPIO_DIR_OUT          1
+#define LZGPIO_DIR_KEEP         2
+
+#define GPIO0_PC1               17
+#define GPIO0_PC2               18
+
+#define MUX_FUNC5               5
+#define PULL_NONE               0
+#define DRIVE_KEEP              0
+
+#define FUNC_ID_I2C1            1
+#define FUNC_MODE_M1            1
+
+typedef struct {
+    uint32_t gpio;
+    uint32_t func;
+    uint32_t type;
+    uint32_t drv;
+    uint32_t dir;
+    uint32_t val;
+} PinIo;
+
+typedef struct {
+    PinIo scl;
+    PinIo sda;
+    uint32_t id;
+    uint32_t mode;
+} I2cBusIo;
+
+unsigned int I2cIoInit(I2cBusIo io);
+unsigned int LzI2cInit(unsigned int id, unsigned int freq);
+unsigned int LzI2cDeinit(unsigned int id);
+unsigned int LzI2cWrite(unsigned int id, unsigned short slaveAddr, const unsigned char *buf, unsigned int len);
+
+#endif /* _LZ_HARDWARE_H_ */
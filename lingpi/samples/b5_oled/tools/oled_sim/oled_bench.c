@@ -0,0 +1,306 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*
+ * OLED驱动的主机基准测试：在SSD1306仿真后端上运行几个典型的显示场景，
+ * 输出每帧的I2C传输次数、字节数、按I2C时钟估算的总线时间，以及同样的
+ * 命令和数据逐字节发送(每个字节一次传输)时的估算时间，最后一列是
+ * GRAM内容的CRC32，用于比较不同配置下的显示结果是否一致。
+ */
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "lz_hardware.h"
+#include "oled.h"
+#include "oled_sim.h"
+
+/* 与oled.c的默认值一致，由Makefile的BURST变量覆盖 */
+#ifndef OLED_BURST_MAX
+#define OLED_BURST_MAX      128
+#endif
+
+#define NSEC_PER_MSEC       1000000.0
+
+#define OLED_PAGE_NUM       (OLED_ROW_MAX / 8)
+
+/* 整屏动画的帧数 */
+#define BENCH_FULL_FRAMES   32
+/* 文字场景的帧数，与oled_example.c的字符串位置一致 */
+#define BENCH_TEXT_FRAMES   60
+/* 滚动曲线的帧数、中线和振幅 */
+#define BENCH_CHART_FRAMES  64
+#define BENCH_CHART_MID     32
+#define BENCH_CHART_AMP     28
+#define BENCH_CHART_PERIOD  40.0
+
+typedef struct {
+    const char *name;
+    uint32_t (*run)(void);      /* 返回帧数 */
+} bench_scene_t;
+
+/* 整屏动画每帧的内容 */
+static uint8_t m_frame[OLED_PAGE_NUM * OLED_COLUMN_MAX];
+/* 场景结束后GRAM应有的内容，由场景填写 */
+static uint8_t m_expect[OLED_PAGE_NUM * OLED_COLUMN_MAX];
+static uint8_t m_expect_valid;
+/* 是否在oled_init之后切换到整帧模式 */
+static uint8_t m_frame_mode;
+
+/***************************************************************
+ * 函数名称: scene_init
+ * 说    明: oled_init和第一次刷新整个屏幕
+ * 参    数: 无
+ * 返 回 值: 帧数
+ ***************************************************************/
+static uint32_t scene_init(void)
+{
+    oled_sim_power_on(1);
+    oled_init();
+    if (m_frame_mode) {
+        oled_set_frame_mode(1);
+    }
+    oled_flush();
+
+    memset(m_expect, 0, sizeof(m_expect));
+    m_expect_valid = 1;
+    return 1;
+}
+
+/***************************************************************
+ * 函数名称: scene_full
+ * 说    明: 整个屏幕每帧都变化的动画，每个字节与上一帧都不同
+ * 参    数: 无
+ * 返 回 值: 帧数
+ ***************************************************************/
+static uint32_t scene_full(void)
+{
+    uint32_t i, n;
+
+    for (n = 0; n < BENCH_FULL_FRAMES; n++) {
+        for (i = 0; i < sizeof(m_frame); i++) {
+            m_frame[i] = (uint8_t)((i * 7 + n * 13) | 0x01) ^ ((n & 1) ? 0xFF : 0x00);
+        }
+        oled_draw_bmp(0, 0, OLED_COLUMN_MAX, OLED_PAGE_NUM, m_frame);
+        oled_flush();
+    }
+
+    memcpy(m_expect, m_frame, sizeof(m_expect));
+    m_expect_valid = 1;
+    return BENCH_FULL_FRAMES;
+}
+
+/***************************************************************
+ * 函数名称: bench_text_frame
+ * 说    明: 画一帧oled_example.c的界面，只有秒数变化
+ * 参    数:
+ *       @sec：秒数
+ * 返 回 值: 无
+ ***************************************************************/
+static void bench_text_frame(uint32_t sec)
+{
+    char buffer[32];
+
+    oled_show_string(6, 0, (uint8_t *)"0.96' OLED TEST", OLED_CHR_SIZE_16);
+    oled_show_string(0, 3, (uint8_t *)"ASCII:", OLED_CHR_SIZE_16);
+    oled_show_string(64, 3, (uint8_t *)"CODE:", OLED_CHR_SIZE_16);
+    snprintf(buffer, sizeof(buffer), "%u Sec!", sec);
+    oled_show_string(40, 6, (uint8_t *)buffer, OLED_CHR_SIZE_16);
+}
+
+/***************************************************************
+ * 函数名称: scene_text
+ * 说    明: oled_example.c的界面，关闭自动刷新，每帧调用一次oled_flush
+ * 参    数: 无
+ * 返 回 值: 帧数
+ ***************************************************************/
+static uint32_t scene_text(void)
+{
+    uint32_t n;
+
+    for (n = 0; n < BENCH_TEXT_FRAMES; n++) {
+        bench_text_frame(n);
+        oled_flush();
+    }
+    return BENCH_TEXT_FRAMES;
+}
+
+/***************************************************************
+ * 函数名称: scene_text_auto
+ * 说    明: 与scene_text相同，但每个显示函数返回前自动刷新
+ * 参    数: 无
+ * 返 回 值: 帧数
+ ***************************************************************/
+static uint32_t scene_text_auto(void)
+{
+    uint32_t n;
+
+    oled_set_auto_flush(1);
+    for (n = 0; n < BENCH_TEXT_FRAMES; n++) {
+        bench_text_frame(n);
+    }
+    oled_set_auto_flush(0);
+    return BENCH_TEXT_FRAMES;
+}
+
+/***************************************************************
+ * 函数名称: bench_chart_y
+ * 说    明: 滚动曲线第n帧第x列的纵坐标
+ * 参    数:
+ *       @x：列
+ *       @n：帧
+ * 返 回 值: 纵坐标
+ ***************************************************************/
+static uint8_t bench_chart_y(uint32_t x, uint32_t n)
+{
+    return (uint8_t)lround(BENCH_CHART_MID + BENCH_CHART_AMP * sin((x + n) * 2 * M_PI / BENCH_CHART_PERIOD));
+}
+
+/***************************************************************
+ * 函数名称: scene_chart
+ * 说    明: 向左滚动的正弦曲线，每帧擦掉旧的点再画新的点，每列都变化
+ * 参    数: 无
+ * 返 回 值: 帧数
+ ***************************************************************/
+static uint32_t scene_chart(void)
+{
+    uint32_t x, n;
+
+    for (n = 0; n < BENCH_CHART_FRAMES; n++) {
+        for (x = 0; x < OLED_COLUMN_MAX; x++) {
+            if (n > 0) {
+                oled_draw_point(x, bench_chart_y(x, n - 1), 0);
+            }
+            oled_draw_point(x, bench_chart_y(x, n), 1);
+        }
+        oled_flush();
+    }
+    return BENCH_CHART_FRAMES;
+}
+
+static const bench_scene_t m_scenes[] = {
+    {"init",            scene_init},
+    {"full_frame",      scene_full},
+    {"text",            scene_text},
+    {"text_auto",       scene_text_auto},
+    {"chart",           scene_chart},
+};
+
+/***************************************************************
+ * 函数名称: bench_verify
+ * 说    明: 场景给出了期望内容时，检查GRAM是否与之一致
+ * 参    数: 无
+ * 返 回 值: 不一致的字节数
+ ***************************************************************/
+static uint32_t bench_verify(void)
+{
+    uint32_t page, x, bad = 0;
+
+    if (!m_expect_valid) {
+        return 0;
+    }
+    for (page = 0; page < OLED_PAGE_NUM; page++) {
+        for (x = 0; x < OLED_COLUMN_MAX; x++) {
+            if (oled_sim_get_gram(page, x) != m_expect[page * OLED_COLUMN_MAX + x]) {
+                bad++;
+            }
+        }
+    }
+    return bad;
+}
+
+static void usage(const char *prog)
+{
+    printf("usage: %s [-f] [-s scene] [-p]\n", prog);
+    printf("  -f  switch to frame mode (horizontal addressing) after oled_init\n");
+    printf("  -s  run only the named scene\n");
+    printf("  -p  print the panel contents after every scene\n");
+}
+
+int main(int argc, char **argv)
+{
+    const char *only = NULL;
+    int print = 0;
+    oled_sim_stats_t stats;
+    uint32_t frames, bad;
+    int failed = 0;
+    size_t i;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "fs:ph")) != -1) {
+        switch (opt) {
+            case 'f':
+                m_frame_mode = 1;
+                break;
+            case 's':
+                only = optarg;
+                break;
+            case 'p':
+                print = 1;
+                break;
+            default:
+                usage(argv[0]);
+                return (opt == 'h') ? 0 : 1;
+        }
+    }
+
+    printf("OLED_BURST_MAX=%d frame_mode=%u\n", OLED_BURST_MAX, m_frame_mode);
+    printf("figures are per frame, wire time at the LzI2cInit clock\n");
+    printf("%-12s %6s %10s %8s %8s %8s %9s %11s  %s\n", "scene", "frames", "transfers", "bytes",
+           "commands", "data", "wire_ms", "bytewise_ms", "crc32");
+
+    for (i = 0; i < sizeof(m_scenes) / sizeof(m_scenes[0]); i++) {
+        if (only != NULL && strcmp(only, m_scenes[i].name) != 0) {
+            continue;
+        }
+        /* 每个场景从上电开始，初始化和清屏不计入统计 */
+        oled_sim_power_on((uint32_t)i + 1);
+        if (oled_init() != 0) {
+            printf("oled_init failed\n");
+            return 1;
+        }
+        if (m_frame_mode) {
+            oled_set_frame_mode(1);
+        }
+        oled_set_auto_flush(0);
+        oled_flush();
+        m_expect_valid = 0;
+        oled_sim_reset_stats();
+
+        frames = m_scenes[i].run();
+        oled_sim_get_stats(&stats);
+
+        printf("%-12s %6u %10.1f %8.1f %8.1f %8.1f %9.3f %11.3f  %08x\n", m_scenes[i].name, frames,
+               (double)stats.transactions / frames, (double)stats.bytes / frames,
+               (double)stats.commands / frames, (double)stats.data / frames,
+               stats.wire_ns / NSEC_PER_MSEC / frames, stats.bytewise_ns / NSEC_PER_MSEC / frames,
+               oled_sim_checksum());
+        if (stats.errors != 0) {
+            printf("%-12s %u protocol errors\n", "", stats.errors);
+            failed = 1;
+        }
+        bad = bench_verify();
+        if (bad != 0) {
+            printf("%-12s %u bytes differ from the expected frame\n", "", bad);
+            failed = 1;
+        }
+        if (print) {
+            oled_sim_print();
+        }
+    }
+
+    oled_deinit();
+    return failed;
+}
@@ -0,0 +1,354 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*
+ * SSD1306仿真后端：实现lz_hardware.h中OLED驱动用到的I2C接口，
+ * 将每次LzI2cWrite的控制字节、命令和数据按SSD1306的协议解析，
+ * 维护128*64的GRAM，并统计传输次数、字节数和按I2C时钟估算的传输时间。
+ */
+#include <stdio.h>
+#include <string.h>
+#include "lz_hardware.h"
+#include "oled_sim.h"
+
+/* 与oled.c中的从设备地址一致 */
+#define SIM_I2C_ADDRESS     0x3C
+
+/* 控制字节：Co为1时后面只有一个字节，之后是下一个控制字节；D/C为1时是数据 */
+#define SIM_CONTROL_CO      0x80
+#define SIM_CONTROL_DC      0x40
+
+/* SSD1306命令 */
+#define SSD1306_ADDRESSING      0x20
+#define SSD1306_COLUMN_RANGE    0x21
+#define SSD1306_PAGE_RANGE      0x22
+#define SSD1306_PAGE_START      0xB0
+#define SSD1306_PAGE_START_END  0xB7
+#define SSD1306_COLUMN_LOW      0x00
+#define SSD1306_COLUMN_LOW_END  0x0F
+#define SSD1306_COLUMN_HIGH     0x10
+#define SSD1306_COLUMN_HIGH_END 0x1F
+
+/* 寻址方式 */
+#define SIM_ADDRESSING_HORIZONTAL   0
+#define SIM_ADDRESSING_VERTICAL     1
+#define SIM_ADDRESSING_PAGE         2
+
+/* 每个字节在总线上占9个时钟(8位数据和应答)，起始和停止条件各按1个时钟计算 */
+#define SIM_BITS_PER_BYTE   9
+#define SIM_BITS_START_STOP 2
+/* 逐字节发送时每次传输的字节数：从设备地址、控制字节和一个命令或数据 */
+#define SIM_BYTEWISE_BYTES  3
+
+#define NSEC_PER_SEC        1000000000ULL
+#define CRC32_POLY          0xEDB88320
+
+static uint8_t m_gram[OLED_SIM_PAGES][OLED_SIM_COLUMNS];
+static oled_sim_stats_t m_stats;
+
+/* I2C总线：LzI2cInit初始化的总线号和时钟频率 */
+static int m_bus_id = -1;
+static uint32_t m_bus_freq = 400000;
+
+/* 寻址状态 */
+static uint8_t m_addressing = SIM_ADDRESSING_PAGE;
+static uint8_t m_col, m_page;
+static uint8_t m_col_start, m_col_end = OLED_SIM_COLUMNS - 1;
+static uint8_t m_page_start, m_page_end = OLED_SIM_PAGES - 1;
+
+/* 正在接收参数的命令和剩余的参数个数 */
+static uint8_t m_cmd;
+static uint8_t m_param_left;
+static uint8_t m_param_index;
+
+/***************************************************************
+ * 函数名称: sim_param_count
+ * 说    明: 返回命令的参数个数，只列出驱动用到的多字节命令，
+ *           其他命令按单字节处理
+ * 参    数:
+ *       @cmd：命令
+ * 返 回 值: 参数个数
+ ***************************************************************/
+static uint8_t sim_param_count(uint8_t cmd)
+{
+    switch (cmd) {
+        case SSD1306_COLUMN_RANGE:
+        case SSD1306_PAGE_RANGE:
+            return 2;
+        case SSD1306_ADDRESSING:
+        case 0x81:  /* 对比度 */
+        case 0x8D:  /* 电荷泵 */
+        case 0xA8:  /* 复用率 */
+        case 0xD3:  /* 显示偏移 */
+        case 0xD5:  /* 振荡器分频 */
+        case 0xD8:  /* 区域颜色模式 */
+        case 0xD9:  /* 预充电周期 */
+        case 0xDA:  /* COM引脚配置 */
+        case 0xDB:  /* VCOMH */
+            return 1;
+        default:
+            return 0;
+    }
+}
+
+/***************************************************************
+ * 函数名称: sim_param
+ * 说    明: 处理多字节命令的一个参数
+ * 参    数:
+ *       @value：参数
+ * 返 回 值: 无
+ ***************************************************************/
+static void sim_param(uint8_t value)
+{
+    switch (m_cmd) {
+        case SSD1306_ADDRESSING:
+            m_addressing = value & 0x03;
+            if (m_addressing > SIM_ADDRESSING_PAGE) {
+                m_stats.errors++;
+                m_addressing = SIM_ADDRESSING_PAGE;
+            }
+            break;
+        case SSD1306_COLUMN_RANGE:
+            value &= OLED_SIM_COLUMNS - 1;
+            if (m_param_index == 0) {
+                m_col_start = value;
+            } else {
+                m_col_end = value;
+                m_col = m_col_start;
+            }
+            break;
+        case SSD1306_PAGE_RANGE:
+            value &= OLED_SIM_PAGES - 1;
+            if (m_param_index == 0) {
+                m_page_start = value;
+            } else {
+                m_page_end = value;
+                m_page = m_page_start;
+            }
+            break;
+        default:
+            break;
+    }
+    m_param_index++;
+    m_param_left--;
+}
+
+/***************************************************************
+ * 函数名称: sim_command
+ * 说    明: 处理一个命令字节
+ * 参    数:
+ *       @cmd：命令或上一个命令的参数
+ * 返 回 值: 无
+ ***************************************************************/
+static void sim_command(uint8_t cmd)
+{
+    m_stats.commands++;
+
+    if (m_param_left > 0) {
+        sim_param(cmd);
+        return;
+    }
+
+    if (cmd <= SSD1306_COLUMN_HIGH_END || (cmd >= SSD1306_PAGE_START && cmd <= SSD1306_PAGE_START_END)) {
+        /* 起始列和起始页只用于页寻址 */
+        if (m_addressing != SIM_ADDRESSING_PAGE) {
+            m_stats.errors++;
+            return;
+        }
+        if (cmd <= SSD1306_COLUMN_LOW_END) {
+            m_col = (m_col & 0xF0) | (cmd & 0x0F);
+        } else if (cmd <= SSD1306_COLUMN_HIGH_END) {
+            m_col = (uint8_t)(((cmd & 0x07) << 4) | (m_col & 0x0F));
+        } else {
+            m_page = cmd - SSD1306_PAGE_START;
+        }
+        m_col_start = m_col;
+        return;
+    }
+
+    m_cmd = cmd;
+    m_param_left = sim_param_count(cmd);
+    m_param_index = 0;
+}
+
+/***************************************************************
+ * 函数名称: sim_data
+ * 说    明: 把一个数据字节写入GRAM，按寻址方式移动写入位置
+ * 参    数:
+ *       @value：数据
+ * 返 回 值: 无
+ ***************************************************************/
+static void sim_data(uint8_t value)
+{
+    m_stats.data++;
+    m_gram[m_page][m_col] = value;
+
+    switch (m_addressing) {
+        case SIM_ADDRESSING_HORIZONTAL:
+            if (m_col < m_col_end) {
+                m_col++;
+                break;
+            }
+            m_col = m_col_start;
+            m_page = (m_page < m_page_end) ? m_page + 1 : m_page_start;
+            break;
+        case SIM_ADDRESSING_VERTICAL:
+            if (m_page < m_page_end) {
+                m_page++;
+                break;
+            }
+            m_page = m_page_start;
+            m_col = (m_col < m_col_end) ? m_col + 1 : m_col_start;
+            break;
+        default:
+            /* 页寻址到达最后一列后回到起始列，页不变 */
+            m_col = (m_col < OLED_SIM_COLUMNS - 1) ? m_col + 1 : m_col_start;
+            break;
+    }
+}
+
+unsigned int I2cIoInit(I2cBusIo io)
+{
+    (void)io;
+    return LZ_HARDWARE_SUCCESS;
+}
+
+unsigned int LzI2cInit(unsigned int id, unsigned int freq)
+{
+    m_bus_id = (int)id;
+    m_bus_freq = freq;
+    return LZ_HARDWARE_SUCCESS;
+}
+
+unsigned int LzI2cDeinit(unsigned int id)
+{
+    if ((int)id == m_bus_id) {
+        m_bus_id = -1;
+    }
+    return LZ_HARDWARE_SUCCESS;
+}
+
+unsigned int LzI2cWrite(unsigned int id, unsigned short slaveAddr, const unsigned char *buf, unsigned int len)
+{
+    uint64_t bits = SIM_BITS_START_STOP + (uint64_t)SIM_BITS_PER_BYTE * (len + 1);
+    uint32_t commands = m_stats.commands;
+    uint32_t data = m_stats.data;
+    unsigned int i = 0;
+    uint8_t control;
+
+    m_stats.transactions++;
+    m_stats.bytes += len + 1;
+    m_stats.wire_ns += bits * NSEC_PER_SEC / m_bus_freq;
+
+    if ((int)id != m_bus_id || slaveAddr != SIM_I2C_ADDRESS || len < 2) {
+        m_stats.errors++;
+        return LZ_HARDWARE_FAILURE;
+    }
+
+    while (i < len) {
+        control = buf[i++];
+        if ((control & ~(SIM_CONTROL_CO | SIM_CONTROL_DC)) != 0) {
+            m_stats.errors++;
+            break;
+        }
+        /* Co为0时后面的字节都属于这个控制字节 */
+        do {
+            if (i >= len) {
+                break;
+            }
+            if (control & SIM_CONTROL_DC) {
+                sim_data(buf[i++]);
+            } else {
+                sim_command(buf[i++]);
+            }
+        } while ((control & SIM_CONTROL_CO) == 0);
+    }
+
+    bits = (uint64_t)(SIM_BITS_START_STOP + SIM_BITS_PER_BYTE * SIM_BYTEWISE_BYTES) *
+           ((m_stats.commands - commands) + (m_stats.data - data));
+    m_stats.bytewise_ns += bits * NSEC_PER_SEC / m_bus_freq;
+    return LZ_HARDWARE_SUCCESS;
+}
+
+unsigned int LOS_Msleep(uint32_t msecs)
+{
+    (void)msecs;
+    return 0;
+}
+
+void oled_sim_power_on(uint32_t seed)
+{
+    uint8_t page, x;
+
+    for (page = 0; page < OLED_SIM_PAGES; page++) {
+        for (x = 0; x < OLED_SIM_COLUMNS; x++) {
+            seed = seed * 1103515245 + 12345;
+            m_gram[page][x] = (uint8_t)(seed >> 16);
+        }
+    }
+    m_addressing = SIM_ADDRESSING_PAGE;
+    m_col = 0;
+    m_page = 0;
+    m_col_start = 0;
+    m_col_end = OLED_SIM_COLUMNS - 1;
+    m_page_start = 0;
+    m_page_end = OLED_SIM_PAGES - 1;
+    m_param_left = 0;
+}
+
+void oled_sim_get_stats(oled_sim_stats_t *stats)
+{
+    *stats = m_stats;
+}
+
+void oled_sim_reset_stats(void)
+{
+    memset(&m_stats, 0, sizeof(m_stats));
+}
+
+uint8_t oled_sim_get_gram(uint8_t page, uint8_t x)
+{
+    return m_gram[page % OLED_SIM_PAGES][x % OLED_SIM_COLUMNS];
+}
+
+uint32_t oled_sim_checksum(void)
+{
+    uint32_t crc = 0xFFFFFFFF;
+    uint8_t page, x, bit;
+
+    for (page = 0; page < OLED_SIM_PAGES; page++) {
+        for (x = 0; x < OLED_SIM_COLUMNS; x++) {
+            crc ^= m_gram[page][x];
+            for (bit = 0; bit < 8; bit++) {
+                crc = (crc >> 1) ^ (CRC32_POLY & (0 - (crc & 1)));
+            }
+        }
+    }
+    return ~crc;
+}
+
+void oled_sim_print(void)
+{
+    const uint8_t rows = OLED_SIM_PAGES * 8;
+    uint8_t y, x, top, bottom;
+
+    for (y = 0; y < rows; y += 2) {
+        for (x = 0; x < OLED_SIM_COLUMNS; x++) {
+            top = (m_gram[y / 8][x] >> (y % 8)) & 1;
+            bottom = (m_gram[(y + 1) / 8][x] >> ((y + 1) % 8)) & 1;
+            putchar((top && bottom) ? '8' : (top ? '\'' : (bottom ? '.' : ' ')));
+        }
+        putchar('\n');
+    }
+}
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2022 FuZhou Lockzhiner Electronic Co., Ltd. All rights reserved.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef _OLED_SIM_H_
+#define _OLED_SIM_H_
+
+#include <stdint.h>
+
+/* SSD1306的GRAM大小：8页，每页128列 */
+#define OLED_SIM_PAGES      8
+#define OLED_SIM_COLUMNS    128
+
+/* 仿真总线统计 */
+typedef struct {
+    uint32_t transactions;  /* LzI2cWrite的次数 */
+    uint32_t bytes;         /* 总线上的字节数，含从设备地址和控制字节 */
+    uint32_t commands;      /* 收到的命令字节数，含命令参数 */
+    uint32_t data;          /* 写入GRAM的数据字节数 */
+    uint32_t errors;        /* 协议错误次数，例如从设备地址或控制字节不对 */
+    uint64_t wire_ns;       /* 按I2C时钟估算的传输时间(纳秒) */
+    uint64_t bytewise_ns;   /* 同样的命令和数据逐字节发送时的估算传输时间(纳秒) */
+} oled_sim_stats_t;
+
+/***************************************************************
+ * 函数名称: oled_sim_power_on
+ * 说    明: 模拟OLED上电：GRAM填入不确定的内容，寻址方式回到页寻址
+ * 参    数:
+ *       @seed：生成GRAM内容的种子
+ * 返 回 值: 无
+ ***************************************************************/
+void oled_sim_power_on(uint32_t seed);
+
+
+/***************************************************************
+ * 函数名称: oled_sim_get_stats
+ * 说    明: 获取仿真总线统计
+ * 参    数:
+ *       @stats：存放统计结果
+ * 返 回 值: 无
+ ***************************************************************/
+void oled_sim_get_stats(oled_sim_stats_t *stats);
+
+
+/***************************************************************
+ * 函数名称: oled_sim_reset_stats
+ * 说    明: 清零仿真总线统计
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+void oled_sim_reset_stats(void);
+
+
+/***************************************************************
+ * 函数名称: oled_sim_get_gram
+ * 说    明: 读取SSD1306 GRAM中的一个字节
+ * 参    数:
+ *       @page：页(0~7)
+ *       @x：列(0~127)
+ * 返 回 值: 该列在这一页中的8行，低位在上
+ ***************************************************************/
+uint8_t oled_sim_get_gram(uint8_t page, uint8_t x);
+
+
+/***************************************************************
+ * 函数名称: oled_sim_checksum
+ * 说    明: 计算GRAM内容的CRC32，用于回归比较
+ * 参    数: 无
+ * 返 回 值: CRC32
+ ***************************************************************/
+uint32_t oled_sim_checksum(void);
+
+
+/***************************************************************
+ * 函数名称: oled_sim_print
+ * 说    明: 用字符画在终端打印GRAM内容，每个字符表示上下两行
+ * 参    数: 无
+ * 返 回 值: 无
+ ***************************************************************/
+void oled_sim_print(void);
+
+#endif /* _OLED_SIM_H_ */